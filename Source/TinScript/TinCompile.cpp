@@ -30,12 +30,14 @@
 #include <assert.h>
 #include <string.h>
 #include <stdio.h>
+#include <algorithm>
 
 // -- includes
 #include "integration.h"
 #include "TinParse.h"
 #include "TinDefines.h"
 #include "TinRegBinding.h"
+#include "TinScheduler.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -99,6 +101,46 @@ int32 GetBinOpPrecedence(eBinaryOpType binoptype)
     return gBinOpPrecedence[binoptype];
 }
 
+// ====================================================================================================================
+// GetVectorOpInstruction():  Returns the typed vector operation for a binary op, given the operand types known at
+// compile time, or OP_NULL if the generic operation (and type op override lookup) is required.
+// ====================================================================================================================
+eOpCode GetVectorOpInstruction(eOpCode op, eVarType lhs_type, eVarType rhs_type, eVarType& out_result_type)
+{
+    out_result_type = TYPE_NULL;
+    bool8 lhs_vector = (lhs_type == TYPE_vector3f || lhs_type == TYPE_vector4f);
+    bool8 rhs_vector = (rhs_type == TYPE_vector3f || rhs_type == TYPE_vector4f);
+    bool8 lhs_scalar = (lhs_type == TYPE_float || lhs_type == TYPE_int);
+    bool8 rhs_scalar = (rhs_type == TYPE_float || rhs_type == TYPE_int);
+
+    switch (op)
+    {
+        case OP_Add:
+        case OP_Sub:
+            if (!lhs_vector || lhs_type != rhs_type)
+                return (OP_NULL);
+            out_result_type = lhs_type;
+            return (op == OP_Add ? OP_VectorAdd : OP_VectorSub);
+
+        case OP_Mult:
+            if (lhs_vector && rhs_scalar)
+                out_result_type = lhs_type;
+            else if (lhs_scalar && rhs_vector)
+                out_result_type = rhs_type;
+            else
+                return (OP_NULL);
+            return (OP_VectorMult);
+
+        case OP_Div:
+            if (!lhs_vector || !rhs_scalar)
+                return (OP_NULL);
+            out_result_type = lhs_type;
+            return (OP_VectorDiv);
+    }
+
+    return (OP_NULL);
+}
+
 // ====================================================================================================================
 // GetAssOpInstructionType():  Declaration and accessor to identify types of assignment operations.
 // ====================================================================================================================
@@ -397,6 +439,29 @@ void CCompileTreeNode::Dump(char*& output, int32& length) const
 	length -= debuglength;
 }
 
+// ====================================================================================================================
+// ContainsFunctionCall():  Returns true if this node, or any child (or a child's siblings), calls a function.
+// ====================================================================================================================
+bool8 CCompileTreeNode::ContainsFunctionCall() const
+{
+    if (type == eFuncCall || type == eObjMethod || type == ePODMethod)
+        return (true);
+
+    for (const CCompileTreeNode* child = leftchild; child != nullptr; child = child->next)
+    {
+        if (child->ContainsFunctionCall())
+            return (true);
+    }
+
+    for (const CCompileTreeNode* child = rightchild; child != nullptr; child = child->next)
+    {
+        if (child->ContainsFunctionCall())
+            return (true);
+    }
+
+    return (false);
+}
+
 // ====================================================================================================================
 // OutputIndentToBuffer():  Write out spaces to align the output to a given indent level
 // ====================================================================================================================
@@ -892,7 +957,10 @@ int32 CValueNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonly)
                 // strings to be ref-counted beyond their use, but better to ensure the string still exists,
                 // than to remove a string that is still needed...
                 if (pushtype == TYPE_string && !countonly)
+                {
                     codeblock->GetScriptContext()->GetStringTable()->RefCountIncrement(*(uint32*)valuebuf);
+                    codeblock->AddLiteral(*(uint32*)valuebuf);
+                }
     		}
 			else
             {
@@ -910,6 +978,23 @@ int32 CValueNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonly)
 	return size;
 }
 
+// ====================================================================================================================
+// GetKnownResultType():  A (non-array) variable pushes its declared type, and a literal pushes its value type.
+// ====================================================================================================================
+eVarType CValueNode::GetKnownResultType() const
+{
+    if (isparam)
+        return (TYPE_NULL);
+
+    if (isvariable)
+    {
+        CVariableEntry* var = GetVariableEntry();
+        return (var != nullptr && !var->IsArray() ? var->GetType() : TYPE_NULL);
+    }
+
+    return (valtype);
+}
+
 // ====================================================================================================================
 // Dump():  Outputs the text version of the instructions compiled from this node.
 // ====================================================================================================================
@@ -1018,6 +1103,7 @@ CObjMemberNode::CObjMemberNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link,
     : CCompileTreeNode(_codeblock, _link, eObjMember, _linenumber)
 {
 	SafeStrcpy(membername, sizeof(membername), _membername, _memberlength + 1);
+    m_pushByHash = false;
 }
 
 // ====================================================================================================================
@@ -1050,17 +1136,30 @@ int32 CObjMemberNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 counton
 
 		// -- if we're supposed to be pushing a var (for an assign...), we actually push
         // -- a member (still a variable, but the lookup is different)
-        if (pushresult == TYPE__var || pushresult == TYPE_hashtable || m_unaryDelta != 0)
+        // -- a member assigned the result of a function call is resolved by hash when it's assigned, as the
+        // call may suspend the VM (wait(), or an async function), and the object may not outlive it
+        if (pushresult == TYPE__var && m_pushByHash && m_unaryDelta == 0)
         {
 			size += PushInstruction(countonly, instrptr, OP_PushMember, DBG_instr);
 			size += PushInstruction(countonly, instrptr, memberhash, DBG_var);
+            return (size);
+        }
+
+        // -- each site is given an ID for its member cache, so registered members can be accessed by offset
+        uint32 site_id = countonly ? 0 : codeblock->AllocMemberCacheSite();
+        if (pushresult == TYPE__var || pushresult == TYPE_hashtable || m_unaryDelta != 0)
+        {
+			size += PushInstruction(countonly, instrptr, OP_PushMemberOffset, DBG_instr);
+			size += PushInstruction(countonly, instrptr, memberhash, DBG_var);
+			size += PushInstruction(countonly, instrptr, site_id, DBG_value);
 		}
 
 		// -- otherwise we push the hash, but the instruction is to get the value
 		else
         {
-			size += PushInstruction(countonly, instrptr, OP_PushMemberVal, DBG_instr);
+			size += PushInstruction(countonly, instrptr, OP_PushMemberOffsetVal, DBG_instr);
 			size += PushInstruction(countonly, instrptr, memberhash, DBG_var);
+			size += PushInstruction(countonly, instrptr, site_id, DBG_value);
 		}
 
         // -- if we're applying a post increment/decrement, we also need to push the post-op instruction
@@ -1328,6 +1427,10 @@ int32 CBinaryOpNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonl
 	// -- note:  if the binopresult is TYPE_NULL, simply inherit the result from the parent node
 	eVarType childresulttype = binopresult != TYPE_NULL ? binopresult : pushresult;
 
+    // -- an object member assigned from a function call isn't pushed by address - see CObjMemberNode::Eval()
+    if (IsAssignOpNode() && leftchild->GetType() == eObjMember && rightchild->ContainsFunctionCall())
+        static_cast<CObjMemberNode*>(leftchild)->SetPushByHash();
+
 	// -- evaluate the left child, pushing the result of the type required
 	// -- except in the case of an assignment operator - the left child is the variable
     int32 tree_size = leftchild->Eval(instrptr, IsAssignOpNode() ? TYPE__var : childresulttype, countonly);
@@ -1384,8 +1487,13 @@ int32 CBinaryOpNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonl
         size += PushInstruction(countonly, instrptr, OP_PushAssignValue, DBG_instr, "consec assigns");
     }
 
-    // -- push the specific operation to be performed
-    size += PushInstruction(countonly, instrptr, binaryopcode, DBG_instr);
+    // -- push the specific operation to be performed - if the operand types are known to be vectors,
+    // -- use the typed vector operation, bypassing the op override lookup
+    eVarType vector_type = TYPE_NULL;
+    eOpCode vector_op = !IsAssignOpNode() ? GetVectorOpInstruction(binaryopcode, leftchild->GetKnownResultType(),
+                                                                  rightchild->GetKnownResultType(), vector_type)
+                                          : OP_NULL;
+    size += PushInstruction(countonly, instrptr, vector_op != OP_NULL ? vector_op : binaryopcode, DBG_instr);
 
     // -- the branch destination is after the evaluation of the binary op code
     // -- if booleanAnd, and the left child is false, then:
@@ -1405,6 +1513,20 @@ int32 CBinaryOpNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonl
 	return size;
 }
 
+// ====================================================================================================================
+// GetKnownResultType():  A binary op node only knows its result type when it compiles to a typed vector operation.
+// ====================================================================================================================
+eVarType CBinaryOpNode::GetKnownResultType() const
+{
+    if (IsAssignOpNode() || !leftchild || !rightchild)
+        return (TYPE_NULL);
+
+    eVarType vector_type = TYPE_NULL;
+    GetVectorOpInstruction(binaryopcode, leftchild->GetKnownResultType(), rightchild->GetKnownResultType(),
+                           vector_type);
+    return (vector_type);
+}
+
 // ====================================================================================================================
 // IsAssignOpNode(): assignments request the right (value) branch to resolve to the type required by the left branch
 // ====================================================================================================================
@@ -2736,6 +2858,23 @@ CFuncCallNode::CFuncCallNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link, i
     mCallType = call_type;
 }
 
+// ====================================================================================================================
+// FindStackDispatchFunction():  Returns the registered global function, if the call can be dispatched directly
+// from the exec stack - all arguments provided, all of which (and the return) are single value types.
+// ====================================================================================================================
+static CFunctionEntry* FindStackDispatchFunction(CScriptContext* script_context, uint32 funchash, int32 arg_count)
+{
+    CFunctionEntry* fe = script_context->GetGlobalNamespace()->GetFuncTable()->FindItem(funchash);
+    if (!fe || !fe->UsesRegisteredStackFrame())
+        return (NULL);
+
+    // -- calls relying on default args still initialize the parameters
+    if (fe->GetContext()->GetParameterCount() != arg_count + 1)
+        return (NULL);
+
+    return (fe);
+}
+
 // ====================================================================================================================
 // Eval():  Generates the byte code instruction compiled from this node.
 // ====================================================================================================================
@@ -2781,6 +2920,38 @@ int32 CFuncCallNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonl
         }
         else
         {
+            // -- registered functions can take their arguments directly from the stack, skipping the assignment
+            // to the function context parameters entirely
+            int32 arg_count = 0;
+            for (const CCompileTreeNode* arg = leftchild ? leftchild->next : NULL; arg; arg = arg->next)
+                ++arg_count;
+
+            if (FindStackDispatchFunction(codeblock->GetScriptContext(), funchash, arg_count))
+            {
+                // -- evaluate the value of each argument, in order
+                for (const CCompileTreeNode* arg = leftchild->next; arg; arg = arg->next)
+                {
+                    assert(arg->IsAssignOpNode() && arg->rightchild);
+                    int32 tree_size = arg->rightchild->Eval(instrptr, TYPE__resolve, countonly);
+                    if (tree_size < 0)
+                        return (-1);
+                    size += tree_size;
+
+                    if (arg->rightchild->IsAssignOpNode())
+                        size += PushInstruction(countonly, instrptr, OP_PushAssignValue, DBG_instr, "consec assigns");
+                }
+
+                size += PushInstruction(countonly, instrptr, OP_FuncCallNative, DBG_instr);
+                size += PushInstruction(countonly, instrptr, funchash, DBG_func);
+                size += PushInstruction(countonly, instrptr, arg_count, DBG_value, "arg count");
+
+                // -- all functions will return a value - pop it if it's unused
+                if (pushresult <= TYPE_void)
+                    size += PushInstruction(countonly, instrptr, OP_Pop, DBG_instr);
+
+                return size;
+            }
+
             size += PushInstruction(countonly, instrptr, OP_FuncCallArgs, DBG_instr);
             size += PushInstruction(countonly, instrptr, nshash, DBG_nshash);
         }
@@ -3815,10 +3986,12 @@ bool8 CScheduleNode::CompileToC(int32 indent, char*& out_buffer, int32& max_size
 // ====================================================================================================================
 // Constructor
 // ====================================================================================================================
-CSchedFuncNode::CSchedFuncNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link, int32 _linenumber, bool8 _immediate)
+CSchedFuncNode::CSchedFuncNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link, int32 _linenumber, bool8 _immediate,
+                               int32 _priority)
     : CCompileTreeNode(_codeblock, _link, eSched, _linenumber)
 {
     mImmediate = _immediate;
+    mPriority = _priority;
 }
 
 // ====================================================================================================================
@@ -3850,8 +4023,10 @@ int32 CSchedFuncNode::Eval(uint32*& instrptr, eVarType pushresult, bool countonl
     size += tree_size;
 
     // -- push the instruction to begin the schedule call
+    // -- the operand carries the immediate flag, and the priority class (+1, so 0 is unspecified)
+    uint32 schedule_flags = (mImmediate ? 1 : 0) | ((uint32)(mPriority + 1) << kSchedulePriorityShift);
     size += PushInstruction(countonly, instrptr, OP_ScheduleBegin, DBG_instr);
-    size += PushInstruction(countonly, instrptr, mImmediate, DBG_value);
+    size += PushInstruction(countonly, instrptr, schedule_flags, DBG_value);
 
     // -- evaluate the right child, tree of all parameters for the scheduled function call
     tree_size = rightchild->Eval(instrptr, TYPE_void, countonly);
@@ -4022,6 +4197,228 @@ bool8 CDestroyObjectNode::CompileToC(int32 indent, char*& out_buffer, int32& max
     return (true);
 }
 
+// == class CWaitNode =================================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CWaitNode::CWaitNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link, int32 _linenumber)
+    : CCompileTreeNode(_codeblock, _link, eWait, _linenumber)
+{
+}
+
+// ====================================================================================================================
+// Eval():  Generates the byte code instruction compiled from this node.
+// ====================================================================================================================
+int32 CWaitNode::Eval(uint32*& instrptr, eVarType pushresult, bool8 countonly) const
+{
+	DebugEvaluateNode(*this, countonly, instrptr);
+	int32 size = 0;
+
+  	// -- evaluate the left child, pushing the wait time as a TYPE_int
+    int32 tree_size = leftchild->Eval(instrptr, TYPE_int, countonly);
+    if (tree_size < 0)
+        return (-1);
+    size += tree_size;
+
+    // -- suspend the VM
+	size += PushInstruction(countonly, instrptr, OP_Wait, DBG_instr);
+
+	return size;
+}
+
+// ====================================================================================================================
+// CompileToC(): Convert the parse tree to valid C, to compile directly to the executable. 
+// ====================================================================================================================
+bool8 CWaitNode::CompileToC(int32 indent, char*& out_buffer, int32& max_size, bool root_node) const
+{
+    TinPrint(TinScript::GetContext(), "CWaitNode::CompileToC() not implemented.\n");
+    return (true);
+}
+
+// == class CCodeBlockImage ===========================================================================================
+
+std::mutex CCodeBlockImage::gRegistryLock;
+CCodeBlockImage* CCodeBlockImage::gRegistryList = nullptr;
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CCodeBlockImage::CCodeBlockImage(uint32 filename_hash, const std::filesystem::file_time_type& binary_ft,
+                                 uint32* instr_block, uint32 instr_count, uint32* line_numbers, uint32 line_count)
+    : mFileNameHash(filename_hash)
+    , mBinaryFileTime(binary_ft)
+    , mInstrBlock(instr_block)
+    , mInstrCount(instr_count)
+    , mLineNumbers(line_numbers)
+    , mLineNumberCount(line_count)
+    , mLiterals(nullptr)
+    , mLiteralCount(0)
+    , mLiteralStrings(nullptr)
+    , mRefCount(1)
+    , mIsRegistered(false)
+    , mNext(nullptr)
+{
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CCodeBlockImage::~CCodeBlockImage()
+{
+    if (mInstrBlock)
+        TinFreeArray(mInstrBlock);
+    if (mLineNumbers)
+        TinFreeArray(mLineNumbers);
+    if (mLiterals)
+        TinFreeArray(mLiterals);
+    if (mLiteralStrings)
+        TinFreeArray(mLiteralStrings);
+}
+
+// ====================================================================================================================
+// Publish():  Creates and registers the image for a newly compiled (or loaded) codeblock
+// ====================================================================================================================
+CCodeBlockImage* CCodeBlockImage::Publish(uint32 filename_hash, const std::filesystem::file_time_type& binary_ft,
+                                          uint32* instr_block, uint32 instr_count, uint32* line_numbers,
+                                          uint32 line_count, const uint32* literal_hashes, int32 literal_count,
+                                          CStringTable* string_table)
+{
+    // -- the image isn't owned by any context
+    CCodeBlockImage* image = TinAllocShared(ALLOC_CodeBlock, CCodeBlockImage, filename_hash, binary_ft,
+                                            instr_block, instr_count, line_numbers, line_count);
+
+    // -- copy the literal strings - a literal no longer in the table can't be carried
+    int32 strings_size = 0;
+    for (int32 i = 0; i < literal_count; ++i)
+    {
+        const char* string = string_table->FindString(literal_hashes[i]);
+        if (string != nullptr)
+            strings_size += (int32)strlen(string) + 1;
+    }
+
+    if (strings_size > 0)
+    {
+        image->mLiterals = TinAllocSharedArray(ALLOC_CodeBlock, tLiteral, literal_count);
+        image->mLiteralStrings = TinAllocSharedArray(ALLOC_CodeBlock, char, strings_size);
+
+        int32 offset = 0;
+        for (int32 i = 0; i < literal_count; ++i)
+        {
+            const char* string = string_table->FindString(literal_hashes[i]);
+            if (string == nullptr)
+                continue;
+
+            int32 length = (int32)strlen(string);
+            memcpy(&image->mLiteralStrings[offset], string, length + 1);
+            image->mLiterals[image->mLiteralCount].mHash = literal_hashes[i];
+            image->mLiterals[image->mLiteralCount].mOffset = offset;
+            ++image->mLiteralCount;
+            offset += length + 1;
+        }
+    }
+
+    // -- the publishing codeblock holds its references, the same as any codeblock sharing the image
+    image->AddLiteralRefs(string_table);
+
+    std::lock_guard<std::mutex> lock(gRegistryLock);
+
+    // -- an image for an older binary is unregistered - the codeblocks already sharing it keep their reference
+    CCodeBlockImage** prev_ptr = &gRegistryList;
+    while (*prev_ptr != nullptr)
+    {
+        if ((*prev_ptr)->mFileNameHash == filename_hash)
+        {
+            CCodeBlockImage* old_image = *prev_ptr;
+            *prev_ptr = old_image->mNext;
+            old_image->mIsRegistered = false;
+            old_image->mNext = nullptr;
+            break;
+        }
+        prev_ptr = &(*prev_ptr)->mNext;
+    }
+
+    image->mIsRegistered = true;
+    image->mNext = gRegistryList;
+    gRegistryList = image;
+    return (image);
+}
+
+// ====================================================================================================================
+// Acquire():  Finds the registered image for a file, if it was built from the given binary
+// ====================================================================================================================
+CCodeBlockImage* CCodeBlockImage::Acquire(uint32 filename_hash, const std::filesystem::file_time_type& binary_ft,
+                                          CStringTable* string_table)
+{
+    CCodeBlockImage* found = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(gRegistryLock);
+        for (CCodeBlockImage* image = gRegistryList; image != nullptr; image = image->mNext)
+        {
+            if (image->mFileNameHash != filename_hash)
+                continue;
+
+            if (image->mBinaryFileTime == binary_ft)
+            {
+                image->mRefCount.fetch_add(1, std::memory_order_relaxed);
+                found = image;
+            }
+            break;
+        }
+    }
+
+    // -- the literals are immutable once published, so we don't need the lock to add them
+    if (found != nullptr)
+        found->AddLiteralRefs(string_table);
+
+    return (found);
+}
+
+// ====================================================================================================================
+// AddLiteralRefs():  Adds each literal string to the given string table, with a reference
+// ====================================================================================================================
+void CCodeBlockImage::AddLiteralRefs(CStringTable* string_table) const
+{
+    if (string_table == nullptr)
+        return;
+
+    for (int32 i = 0; i < mLiteralCount; ++i)
+        string_table->AddString(&mLiteralStrings[mLiterals[i].mOffset], -1, mLiterals[i].mHash, true);
+}
+
+// ====================================================================================================================
+// Release():  Removes a reference, the last reference unregisters and frees the image
+// ====================================================================================================================
+void CCodeBlockImage::Release(CStringTable* string_table)
+{
+    // -- the releasing context no longer needs the literals
+    if (string_table != nullptr)
+    {
+        for (int32 i = 0; i < mLiteralCount; ++i)
+            string_table->RefCountDecrement(mLiterals[i].mHash);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(gRegistryLock);
+        if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        if (mIsRegistered)
+        {
+            CCodeBlockImage** prev_ptr = &gRegistryList;
+            while (*prev_ptr != nullptr && *prev_ptr != this)
+                prev_ptr = &(*prev_ptr)->mNext;
+            if (*prev_ptr != nullptr)
+                *prev_ptr = mNext;
+            mIsRegistered = false;
+        }
+    }
+
+    // -- note:  shared allocations are freed to the heap, from whichever thread releases the last reference
+    CCodeBlockImage* image = this;
+    TinFree(image);
+}
+
 // == class CCodeBlock ================================================================================================
 
 // ====================================================================================================================
@@ -4036,6 +4433,7 @@ CCodeBlock::CCodeBlock(CScriptContext* script_context, const char* _filename)
 
     mInstrBlock = NULL;
     mInstrCount = 0;
+    mImage = nullptr;
 
     smFuncDefinitionStack = TinAlloc(ALLOC_FuncCallStack, CFunctionCallStack);
     smCurrentGlobalVarTable = TinAlloc(ALLOC_VarTable, tVarTable, kLocalVarTableSize);
@@ -4057,6 +4455,14 @@ CCodeBlock::CCodeBlock(CScriptContext* script_context, const char* _filename)
     mLineNumberCount = 0;
     mLineNumberCurrent = -1;
     mLineNumbers = nullptr;
+
+    mMemberCacheSiteCount = 0;
+    mMemberCacheSize = 0;
+    mMemberCacheList = nullptr;
+
+    mLiteralHashes = nullptr;
+    mLiteralCount = 0;
+    mLiteralSize = 0;
 }
 
 // ====================================================================================================================
@@ -4064,7 +4470,14 @@ CCodeBlock::CCodeBlock(CScriptContext* script_context, const char* _filename)
 // ====================================================================================================================
 CCodeBlock::~CCodeBlock()
 {
-	if (mInstrBlock)
+    // -- a published (or shared) image owns the instructions and line numbers
+    if (mImage != nullptr)
+    {
+        mImage->Release(mContextOwner->GetStringTable());
+        mInstrBlock = nullptr;
+        mLineNumbers = nullptr;
+    }
+	else if (mInstrBlock)
 		TinFreeArray(mInstrBlock);
 
 	// -- clear out the breakpoints list
@@ -4083,6 +4496,12 @@ CCodeBlock::~CCodeBlock()
 
     if (mLineNumbers)
         TinFreeArray(mLineNumbers);
+
+    if (mMemberCacheList)
+        TinFreeArray(mMemberCacheList);
+
+    if (mLiteralHashes)
+        TinFreeArray(mLiteralHashes);
 }
 
 // ====================================================================================================================
@@ -4090,12 +4509,98 @@ CCodeBlock::~CCodeBlock()
 // ====================================================================================================================
 void CCodeBlock::AllocateInstructionBlock(int32 _size, int32 _linecount)
 {
+    // -- the blocks are shared allocations, as the published image may outlive this context
     mInstrBlock = NULL;
     mInstrCount = _size;
     if (_size > 0)
-        mInstrBlock = TinAllocArray(ALLOC_CodeBlock, uint32, _size);
+        mInstrBlock = TinAllocSharedArray(ALLOC_CodeBlock, uint32, _size);
     if (_linecount > 0)
-        mLineNumbers = TinAllocArray(ALLOC_CodeBlock, uint32, _linecount);
+        mLineNumbers = TinAllocSharedArray(ALLOC_CodeBlock, uint32, _linecount);
+}
+
+// ====================================================================================================================
+// PublishImage():  Hands the instructions and line numbers to a registered image, so other contexts may share them
+// ====================================================================================================================
+void CCodeBlock::PublishImage(const std::filesystem::file_time_type& binary_ft)
+{
+    if (mImage != nullptr || mInstrBlock == nullptr || mFileNameHash == 0)
+        return;
+
+    // -- each literal is only carried once
+    std::sort(mLiteralHashes, mLiteralHashes + mLiteralCount);
+    int32 unique_count = (int32)(std::unique(mLiteralHashes, mLiteralHashes + mLiteralCount) - mLiteralHashes);
+
+    // -- note:  a codeblock loaded from a binary has no recorded literals - its strings come from the string table
+    // file, loaded by every context
+    mImage = CCodeBlockImage::Publish(mFileNameHash, binary_ft, mInstrBlock, mInstrCount, mLineNumbers,
+                                      mLineNumberCount, mLiteralHashes, unique_count,
+                                      mContextOwner->GetStringTable());
+
+    // -- the image has the literals now
+    if (mLiteralHashes)
+        TinFreeArray(mLiteralHashes);
+    mLiteralHashes = nullptr;
+    mLiteralCount = 0;
+    mLiteralSize = 0;
+}
+
+// ====================================================================================================================
+// SetImage():  Executes the instructions of a shared image, rather than loading them - the reference is adopted
+// ====================================================================================================================
+void CCodeBlock::SetImage(CCodeBlockImage* image)
+{
+    if (image == nullptr || mImage != nullptr || mInstrBlock != nullptr)
+        return;
+
+    // -- note:  the image's literal strings were added to our string table, when it was acquired
+    // -- the VM only reads through the instruction ptr
+    mImage = image;
+    mInstrBlock = const_cast<uint32*>(image->GetInstructionPtr());
+    mInstrCount = image->GetInstructionCount();
+    mLineNumbers = const_cast<uint32*>(image->GetLineNumberPtr());
+    mLineNumberCount = image->GetLineNumberCount();
+}
+
+// ====================================================================================================================
+// AddLiteral():  Records the hash of a compiled string literal, so the published image can carry the string
+// ====================================================================================================================
+void CCodeBlock::AddLiteral(uint32 string_hash)
+{
+    if (mLiteralCount >= mLiteralSize)
+    {
+        int32 new_size = mLiteralSize > 0 ? mLiteralSize * 2 : kMemberCacheInitialSize;
+        uint32* new_list = TinAllocArray(ALLOC_CodeBlock, uint32, new_size);
+        if (mLiteralHashes)
+        {
+            memcpy(new_list, mLiteralHashes, sizeof(uint32) * mLiteralCount);
+            TinFreeArray(mLiteralHashes);
+        }
+        mLiteralHashes = new_list;
+        mLiteralSize = new_size;
+    }
+
+    mLiteralHashes[mLiteralCount++] = string_hash;
+}
+
+// ====================================================================================================================
+// GrowMemberCache():  Ensure the member cache list is large enough for the given site, new entries are empty.
+// ====================================================================================================================
+void CCodeBlock::GrowMemberCache(uint32 site_id)
+{
+    uint32 new_size = mMemberCacheSize > 0 ? mMemberCacheSize : kMemberCacheInitialSize;
+    while (new_size <= site_id)
+        new_size *= 2;
+
+    tMemberCache* new_list = TinAllocArray(ALLOC_CodeBlock, tMemberCache, new_size);
+    memset(new_list, 0, sizeof(tMemberCache) * new_size);
+    if (mMemberCacheList)
+    {
+        memcpy(new_list, mMemberCacheList, sizeof(tMemberCache) * mMemberCacheSize);
+        TinFreeArray(mMemberCacheList);
+    }
+
+    mMemberCacheList = new_list;
+    mMemberCacheSize = new_size;
 }
 
 // ====================================================================================================================
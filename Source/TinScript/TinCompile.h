@@ -27,7 +27,9 @@
 
 // -- includes
 #include <assert.h>
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 
 #include "integration.h"
 #include "TinDefines.h"
@@ -51,6 +53,7 @@ class CFunctionCallStack;
 class CWhileLoopNode;
 class CCodeBlock;
 class CDebuggerWatchExpression;
+class CStringTable;
 
 typedef CHashTable<CVariableEntry> tVarTable;
 typedef CHashTable<CFunctionEntry> tFuncTable;
@@ -85,6 +88,13 @@ class CCompileTreeNode
 
         virtual bool8 IsAssignOpNode() const { return (false); }
 
+        // -- true if this node, or any of its children, calls a function (which may suspend the VM)
+        bool8 ContainsFunctionCall() const;
+
+        // -- the type this node is known (at compile time) to push, or TYPE_NULL if only resolvable at runtime
+        // -- note:  only valid once the node has been evaluated
+        virtual eVarType GetKnownResultType() const { return (TYPE_NULL); }
+
 		static CCompileTreeNode* CreateTreeRoot(CCodeBlock* codeblock);
 
         void SetPostUnaryOpDelta(int32 unary_delta) { m_unaryDelta = unary_delta; }
@@ -201,6 +211,8 @@ class CValueNode : public CCompileTreeNode
 
         bool IsParameter() { return (isparam); }
 
+        virtual eVarType GetKnownResultType() const;
+
         virtual bool8 CompileToC(int32 indent, char*& out_buffer, int32& max_size, bool root_node) const;
 
 
@@ -238,6 +250,7 @@ class CBinaryOpNode : public CCompileTreeNode
         virtual bool8 CompileToC(int32 indent, char*& out_buffer, int32& max_size, bool root_node) const;
 
 		virtual bool8 IsAssignOpNode() const;
+        virtual eVarType GetKnownResultType() const;
         eOpCode GetOpCode() const { return binaryopcode; }
         int32 GetBinaryOpPrecedence() const { return binaryopprecedence; }
         void OverrideBinaryOpPrecedence(int32 new_precedence) { binaryopprecedence = new_precedence; }
@@ -304,11 +317,15 @@ class CObjMemberNode : public CCompileTreeNode
 
         virtual bool8 CompileToC(int32 indent, char*& out_buffer, int32& max_size, bool root_node) const;
 
+        // -- assigned the result of a function call, the member is pushed by object ID and hash, not address
+        void SetPushByHash() { m_pushByHash = true; }
+
     protected:
 		char membername[kMaxTokenLength];
+        bool8 m_pushByHash;
 
 	protected:
-		CObjMemberNode() { }
+		CObjMemberNode() { m_pushByHash = false; }
 };
 
 // ====================================================================================================================
@@ -861,7 +878,7 @@ class CSchedFuncNode : public CCompileTreeNode
 {
     public:
         CSchedFuncNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link, int32 _linenumber,
-                       bool8 _immediate);
+                       bool8 _immediate, int32 _priority = -1);
 
         virtual int32 Eval(uint32*& instrptr, eVarType pushresult, bool countonly) const;
 
@@ -870,6 +887,9 @@ class CSchedFuncNode : public CCompileTreeNode
     protected:
         bool8 mImmediate;
 
+        // -- the schedule:<priority>() class, or -1 if unspecified
+        int32 mPriority;
+
     protected:
         CSchedFuncNode() { }
 };
@@ -929,6 +949,91 @@ class CDestroyObjectNode : public CCompileTreeNode
 		CDestroyObjectNode() { }
 };
 
+// ====================================================================================================================
+// class CWaitNode:  Parse tree node, compiles to suspend the executing (scheduled) function for a time.
+// ====================================================================================================================
+class CWaitNode : public CCompileTreeNode
+{
+	public:
+		CWaitNode(CCodeBlock* _codeblock, CCompileTreeNode*& _link, int32 _linenumber);
+
+		virtual int32 Eval(uint32*& instrptr, eVarType pushresult, bool countonly) const;
+
+        virtual bool8 CompileToC(int32 indent, char*& out_buffer, int32& max_size, bool root_node) const;
+
+	protected:
+		CWaitNode() { }
+};
+
+// ====================================================================================================================
+// class CCodeBlockImage:  The immutable compiled image of a script file - its instructions and line number table.
+// -- images are reference counted, and shared by the codeblocks of every context executing the same binary
+// -- everything mutable (function entries, globals, breakpoints, member caches) belongs to each context's CCodeBlock
+// -- string literals are compiled as hashes, so the image carries a copy of each literal string, to be added to the
+// -- string table of every context sharing it
+// ====================================================================================================================
+class CCodeBlockImage
+{
+    public:
+        // -- takes ownership of the (shared) instruction and line number blocks, and registers the image,
+        // replacing any image previously registered for the same file
+        // -- the literal strings are copied from the publishing context's string table
+        // -- the returned image holds one reference, for the publishing codeblock
+        static CCodeBlockImage* Publish(uint32 filename_hash, const std::filesystem::file_time_type& binary_ft,
+                                        uint32* instr_block, uint32 instr_count, uint32* line_numbers,
+                                        uint32 line_count, const uint32* literal_hashes, int32 literal_count,
+                                        CStringTable* string_table);
+
+        // -- returns the registered image with a reference added, only if it was built from the same binary
+        // -- the literal strings are added to the acquiring context's string table, with a reference each
+        static CCodeBlockImage* Acquire(uint32 filename_hash, const std::filesystem::file_time_type& binary_ft,
+                                        CStringTable* string_table);
+
+        // -- removes the references to the literal strings from the releasing context's string table
+        void Release(CStringTable* string_table);
+
+        const uint32* GetInstructionPtr() const { return (mInstrBlock); }
+        uint32 GetInstructionCount() const { return (mInstrCount); }
+        const uint32* GetLineNumberPtr() const { return (mLineNumbers); }
+        uint32 GetLineNumberCount() const { return (mLineNumberCount); }
+        int32 GetRefCount() const { return (mRefCount.load(std::memory_order_relaxed)); }
+
+    private:
+        friend class CMemoryTracker;
+        CCodeBlockImage(uint32 filename_hash, const std::filesystem::file_time_type& binary_ft, uint32* instr_block,
+                        uint32 instr_count, uint32* line_numbers, uint32 line_count);
+        ~CCodeBlockImage();
+
+        uint32 mFileNameHash;
+        std::filesystem::file_time_type mBinaryFileTime;
+        uint32* mInstrBlock;
+        uint32 mInstrCount;
+        uint32* mLineNumbers;
+        uint32 mLineNumberCount;
+
+        // -- the literal strings, each an offset into a single block of (null terminated) strings
+        struct tLiteral
+        {
+            uint32 mHash;
+            int32 mOffset;
+        };
+
+        void AddLiteralRefs(CStringTable* string_table) const;
+
+        tLiteral* mLiterals;
+        int32 mLiteralCount;
+        char* mLiteralStrings;
+
+        // -- the refcount is only decremented to zero while holding the registry lock, so an image can't be
+        // acquired by one thread, while being freed by another
+        std::atomic<int32> mRefCount;
+        bool8 mIsRegistered;
+        CCodeBlockImage* mNext;
+
+        static std::mutex gRegistryLock;
+        static CCodeBlockImage* gRegistryList;
+};
+
 // ====================================================================================================================
 // class CCodeBlock:  Stores the table of local variables, functions, and the byte code for a compiled script.
 // ====================================================================================================================
@@ -943,6 +1048,12 @@ class CCodeBlock
 
         void AllocateInstructionBlock(int32 _size, int32 _linecount);
 
+        // -- once compiled (or loaded), the instructions are published as an image, to be shared by other contexts
+        // -- a codeblock created from a shared image must never write to its instructions
+        void PublishImage(const std::filesystem::file_time_type& binary_ft);
+        void SetImage(CCodeBlockImage* image);
+        CCodeBlockImage* GetImage() const { return (mImage); }
+
         const char* GetFileName() const { return (mFileName); }
 
         uint32 GetFilenameHash() const { return (mFileNameHash); }
@@ -1004,6 +1115,27 @@ class CCodeBlock
 
         void SetFinishedParsing() { mIsParsing = false; }
 
+        // -- each obj.member site is compiled with an ID, indexing a cache of the member's offset and type
+        // -- the cache is valid only for objects of the namespace that filled it
+        struct tMemberCache
+        {
+            uint32 mNamespaceHash;
+            uint32 mOffset;
+            eVarType mType;
+            CVariableEntry* mVarEntry;
+        };
+
+        uint32 AllocMemberCacheSite() { return (mMemberCacheSiteCount++); }
+
+        // -- string literals are recorded as they're compiled, to be carried by the published image
+        void AddLiteral(uint32 string_hash);
+        tMemberCache* GetMemberCache(uint32 site_id)
+        {
+            if (site_id >= mMemberCacheSize)
+                GrowMemberCache(site_id);
+            return (&mMemberCacheList[site_id]);
+        }
+
 		// -- track the source file time - any time the source needs to be recompiled, then we notify
 		// the debugger that the file has been modified...
         const std::filesystem::file_time_type& GetCheckSourceFileTime() const { return mCheckSourceFileTime; }
@@ -1034,6 +1166,7 @@ class CCodeBlock
         uint32 mFileNameHash;
 		uint32* mInstrBlock;
 		uint32 mInstrCount;
+        CCodeBlockImage* mImage;
 
         // -- keep track of the linenumber offsets
         uint32 mLineNumberIndex;
@@ -1046,6 +1179,17 @@ class CCodeBlock
 
         // -- keep a list of all lines to be broken on, for this code block
         CHashTable<CDebuggerWatchExpression>* mBreakpoints;
+
+        // -- the hashes of the string literals compiled into this codeblock (not stored in a .tso)
+        uint32* mLiteralHashes;
+        int32 mLiteralCount;
+        int32 mLiteralSize;
+
+        // -- member access caches, allocated as sites are executed (the site count isn't stored in a .tso)
+        void GrowMemberCache(uint32 site_id);
+        uint32 mMemberCacheSiteCount;
+        uint32 mMemberCacheSize;
+        tMemberCache* mMemberCacheList;
 };
 
 // ====================================================================================================================
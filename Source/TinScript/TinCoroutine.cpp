@@ -0,0 +1,477 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinCoroutine.cpp
+// ====================================================================================================================
+
+// -- class include
+#include "TinCoroutine.h"
+
+// -- includes
+#include "string.h"
+
+#include "TinScript.h"
+#include "TinHash.h"
+#include "TinCompile.h"
+#include "TinExecStack.h"
+#include "TinFunctionEntry.h"
+#include "TinVariableEntry.h"
+#include "TinStringTable.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+// -- the values pushed above each frame's local variables are typed, so they can be walked from the top down --------
+
+// ====================================================================================================================
+// GetFrameReserveTop():  Returns the stack top, once the given function call's local variables were reserved.
+// -- note:  this must match the space reserved by OpExecFuncCallArgs()
+// ====================================================================================================================
+static int32 GetFrameReserveTop(const CFunctionCallStack::tFunctionCallEntry& entry)
+{
+    CFunctionEntry* fe = entry.funcentry;
+    if (fe == nullptr || fe->GetContext() == nullptr ||
+        (fe->GetType() == eFuncTypeRegistered && !fe->UsesRegisteredStackFrame()))
+    {
+        return (entry.stackvaroffset);
+    }
+
+    return (entry.stackvaroffset + fe->GetContext()->CalculateLocalVarStackSize() * MAX_TYPE_SIZE);
+}
+
+// ====================================================================================================================
+// GetPushedRegion():  Region 0 is the stack below the first function call, region (i + 1) is above the local
+// variables of function call i, up to the next function call (or the stack top).
+// ====================================================================================================================
+static void GetPushedRegion(const CFunctionCallStack::tFunctionCallEntry* entries, int32 depth, int32 stack_top,
+                            int32 region, int32& out_start, int32& out_end)
+{
+    out_start = region > 0 ? GetFrameReserveTop(entries[region - 1]) : 0;
+    out_end = region < depth ? entries[region].stackvaroffset : stack_top;
+    if (out_start < 0)
+        out_start = 0;
+    if (out_end > stack_top)
+        out_end = stack_top;
+}
+
+// ====================================================================================================================
+// GetPushedValue():  Returns the next value down from pos, and its type, or nullptr once the region is walked.
+// ====================================================================================================================
+static uint32* GetPushedValue(uint32* words, int32 region_start, int32& pos, eVarType& out_type)
+{
+    if (pos - 1 < region_start)
+        return (nullptr);
+
+    eVarType type = (eVarType)words[pos - 1];
+    if (type < 0 || type >= TYPE_COUNT)
+        return (nullptr);
+
+    int32 word_count = kBytesToWordCount(gRegisteredTypeSize[type]);
+    int32 value_start = pos - 1 - word_count;
+    if (value_start < region_start)
+        return (nullptr);
+
+    out_type = type;
+    pos = value_start;
+    return (&words[value_start]);
+}
+
+// ====================================================================================================================
+// GetPushedAddress():  Returns the raw address held by a pushed POD member, or hashtable, otherwise nullptr.
+// ====================================================================================================================
+static uint32* GetPushedAddress(eVarType type, const uint32* value)
+{
+#if BUILD_64
+    if (type == TYPE__podmember)
+        return ((uint32*)kPointer64FromUInt32(value[1], value[2]));
+    else if (type == TYPE_hashtable)
+        return ((uint32*)kPointer64FromUInt32(value[0], value[1]));
+#else
+    if (type == TYPE__podmember)
+        return ((uint32*)value[1]);
+    else if (type == TYPE_hashtable)
+        return ((uint32*)value[0]);
+#endif
+
+    return (nullptr);
+}
+
+// ====================================================================================================================
+// SetPushedAddress():  Replaces the raw address held by a pushed POD member, or hashtable.
+// ====================================================================================================================
+static void SetPushedAddress(eVarType type, uint32* value, uint32* addr)
+{
+    uint32* addr_words = type == TYPE__podmember ? &value[1] : &value[0];
+#if BUILD_64
+    addr_words[0] = kPointer64UpperUInt32(addr);
+    addr_words[1] = kPointer64LowerUInt32(addr);
+#else
+    addr_words[0] = (uint32)addr;
+#endif
+}
+
+// == class CCoroutine ================================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CCoroutine::CCoroutine(CScriptContext* script_context, int32 frame_capacity, int32 wait_ms)
+{
+    mContextOwner = script_context;
+    mFrameCapacity = frame_capacity > 0 ? frame_capacity : 1;
+    mFrames = TinAllocArray(ALLOC_Coroutine, tFrame, mFrameCapacity);
+    mFrameCount = 0;
+
+    // -- a wait of 0 (yield) still resumes on the next update, never within the current one
+    mWaitMS = wait_ms > 0 ? wait_ms : 0;
+
+    mAsyncHandle = 0;
+    mHasAsyncResult = false;
+    mAsyncResultType = TYPE_int;
+    memset(mAsyncResult, 0, sizeof(mAsyncResult));
+
+    mStackWords = nullptr;
+    mStackBase = nullptr;
+    mStackTop = 0;
+    mStackTopReserve = 0;
+    mCallEntries = nullptr;
+    mCallDepth = 0;
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CCoroutine::~CCoroutine()
+{
+    // -- a coroutine destroyed while still suspended (cancelled) never finishes its functions, so we do what
+    // each function call's Pop() would have done - destroy the local objects
+    if (mCallEntries != nullptr && !mContextOwner->IsShuttingDown())
+    {
+        for (int32 i = mCallDepth - 1; i >= 0; --i)
+        {
+            for (int32 j = 0; j < mCallEntries[i].mLocalObjectCount; ++j)
+            {
+                if (mContextOwner->FindObjectEntry(mCallEntries[i].mLocalObjectIDList[j]) != nullptr)
+                    mContextOwner->DestroyObject(mCallEntries[i].mLocalObjectIDList[j]);
+            }
+        }
+    }
+
+    if (mCallEntries != nullptr)
+    {
+        AddStringRefs(false);
+        ReleasePushedStrings();
+    }
+    ReleaseCapture();
+    TinFreeArray(mFrames);
+
+    // -- a string result never delivered still holds its reference
+    if (mHasAsyncResult && mAsyncResultType == TYPE_string && mContextOwner->GetStringTable() != nullptr)
+        mContextOwner->GetStringTable()->RefCountDecrement(mAsyncResult[0]);
+}
+
+// ====================================================================================================================
+// AddFrame():  Records the codeblock and instruction at which an unwinding Execute() level resumes.
+// ====================================================================================================================
+bool8 CCoroutine::AddFrame(CCodeBlock* codeblock, const uint32* instrptr)
+{
+    tFrame frame;
+    frame.mCodeBlock = codeblock;
+    frame.mInstrOffset = (uint32)(instrptr - codeblock->GetInstructionPtr());
+    return (AddFrame(frame));
+}
+
+// ====================================================================================================================
+// AddFrame():  Appends a frame, outer to the frames already added.
+// ====================================================================================================================
+bool8 CCoroutine::AddFrame(const tFrame& frame)
+{
+    if (mFrameCount >= mFrameCapacity)
+    {
+        ScriptAssert_(mContextOwner, 0, "<internal>", -1,
+                      "Error - coroutine frame count exceeds the function call depth: %d\n", mFrameCapacity);
+        return (false);
+    }
+
+    mFrames[mFrameCount++] = frame;
+    return (true);
+}
+
+// ====================================================================================================================
+// SetAsyncResult():  Stores the value completing the async handle, delivered when the coroutine is restored.
+// -- for TYPE_string, the address is the const char*, and the string is added to the string table, and referenced
+// ====================================================================================================================
+void CCoroutine::SetAsyncResult(eVarType result_type, void* result_addr)
+{
+    mAsyncHandle = 0;
+    mHasAsyncResult = true;
+    memset(mAsyncResult, 0, sizeof(mAsyncResult));
+
+    // -- an async function with nothing to return (void) still returns, and as with any function, the value is 0
+    if (result_type < FIRST_VALID_TYPE || result_type > LAST_VALID_TYPE || result_addr == nullptr)
+    {
+        mAsyncResultType = TYPE_int;
+        return;
+    }
+
+    mAsyncResultType = result_type;
+    if (result_type == TYPE_string)
+    {
+        mAsyncResult[0] = Hash((const char*)result_addr, -1, true);
+        if (mContextOwner->GetStringTable() != nullptr)
+            mContextOwner->GetStringTable()->RefCountIncrement(mAsyncResult[0]);
+    }
+    else
+    {
+        memcpy(mAsyncResult, result_addr, gRegisteredTypeSize[result_type]);
+    }
+}
+
+// ====================================================================================================================
+// CanSuspend():  Returns false (and the type) if a raw address pushed on the stack points outside the stack.
+// -- e.g. other.member = AsyncFn();  the member's address can't be written once other has been destroyed
+// ====================================================================================================================
+bool8 CCoroutine::CanSuspend(CExecStack& execstack, CFunctionCallStack& funccallstack, eVarType& out_type)
+{
+    uint32* words = const_cast<uint32*>(execstack.GetStackBase());
+    int32 stack_top = execstack.GetStackTop();
+    int32 depth = funccallstack.GetStackDepth();
+    const CFunctionCallStack::tFunctionCallEntry* entries = depth > 0 ? funccallstack.GetEntry(0) : nullptr;
+    for (int32 region = 0; region <= depth; ++region)
+    {
+        int32 region_start = 0;
+        int32 pos = 0;
+        GetPushedRegion(entries, depth, stack_top, region, region_start, pos);
+
+        eVarType type = TYPE_NULL;
+        uint32* value = nullptr;
+        while ((value = GetPushedValue(words, region_start, pos, type)) != nullptr)
+        {
+            uint32* addr = GetPushedAddress(type, value);
+            if (addr != nullptr && (addr < words || addr >= words + stack_top))
+            {
+                out_type = type;
+                return (false);
+            }
+        }
+    }
+
+    return (true);
+}
+
+// ====================================================================================================================
+// Capture():  Copies the used portion of the (fully unwound) VM stacks.
+// ====================================================================================================================
+void CCoroutine::Capture(CExecStack& execstack, CFunctionCallStack& funccallstack)
+{
+    mStackBase = execstack.GetStackBase();
+    mStackTop = execstack.GetStackTop();
+    mStackTopReserve = execstack.GetStackTopReserve();
+    if (mStackTop > 0)
+    {
+        mStackWords = TinAllocArray(ALLOC_Coroutine, uint32, mStackTop);
+        memcpy(mStackWords, execstack.GetStackBase(), sizeof(uint32) * mStackTop);
+    }
+
+    mCallDepth = funccallstack.GetStackDepth();
+    mCallEntries = TinAllocArray(ALLOC_Coroutine, CFunctionCallStack::tFunctionCallEntry,
+                                 mCallDepth > 0 ? mCallDepth : 1);
+    for (int32 i = 0; i < mCallDepth; ++i)
+        mCallEntries[i] = *funccallstack.GetEntry(i);
+
+    // -- string locals on the stack aren't reference counted, so while suspended, we hold the references
+    // note:  pushed strings already hold theirs, from CExecStack::Push()
+    AddStringRefs(true);
+}
+
+// ====================================================================================================================
+// Restore():  Copies the captured stacks back into a new VM, and releases the copy.
+// ====================================================================================================================
+void CCoroutine::Restore(CExecStack& execstack, CFunctionCallStack& funccallstack)
+{
+    RebaseStackAddresses(execstack.GetStackBase());
+    execstack.Restore(mStackWords, mStackTop, mStackTopReserve);
+    funccallstack.RestoreEntries(mCallEntries, mCallDepth);
+
+    // -- the string locals are back on an executing stack
+    AddStringRefs(false);
+    ReleaseCapture();
+
+    // -- the async function's handle is still on the stack, as its return value - replace it with the result
+    if (mHasAsyncResult)
+    {
+        eVarType handle_type;
+        execstack.Pop(handle_type);
+        execstack.Push(mAsyncResult, mAsyncResultType);
+
+        // -- the stack now holds its own reference
+        if (mAsyncResultType == TYPE_string && mContextOwner->GetStringTable() != nullptr)
+            mContextOwner->GetStringTable()->RefCountDecrement(mAsyncResult[0]);
+        mHasAsyncResult = false;
+    }
+}
+
+// ====================================================================================================================
+// ReferencesObject():  Returns true if the coroutine is suspended within a method of the given object.
+// ====================================================================================================================
+bool8 CCoroutine::ReferencesObject(uint32 object_id) const
+{
+    for (int32 i = 0; i < mCallDepth; ++i)
+    {
+        if (mCallEntries[i].oe_id == object_id)
+            return (true);
+    }
+    return (false);
+}
+
+// ====================================================================================================================
+// ReferencesFunction():  Returns true if the coroutine is suspended within the given function.
+// ====================================================================================================================
+bool8 CCoroutine::ReferencesFunction(CFunctionEntry* fe) const
+{
+    for (int32 i = 0; i < mCallDepth; ++i)
+    {
+        if (mCallEntries[i].funcentry == fe)
+            return (true);
+    }
+    return (false);
+}
+
+// ====================================================================================================================
+// AddStringRefs():  Increments (or decrements) the ref count of the string values of each frame's local variables.
+// -- including the args of a registered function using a stack frame, assigned before an inner call suspended
+// ====================================================================================================================
+void CCoroutine::AddStringRefs(bool8 increment)
+{
+    CStringTable* string_table = mContextOwner->GetStringTable();
+    if (string_table == nullptr)
+        return;
+
+    for (int32 i = 0; i < mCallDepth; ++i)
+    {
+        CFunctionEntry* fe = mCallEntries[i].funcentry;
+        if (fe == nullptr || fe->GetLocalVarTable() == nullptr ||
+            (fe->GetType() != eFuncTypeScript && !fe->UsesRegisteredStackFrame()))
+        {
+            continue;
+        }
+
+        // -- string arrays have their own storage, only scalars are stored on the stack
+        tVarTable* var_table = fe->GetLocalVarTable();
+        CVariableEntry* ve = var_table->First();
+        while (ve)
+        {
+            if (ve->GetType() == TYPE_string && !ve->IsArray() && ve->GetStackOffset() >= 0)
+            {
+                int32 word_index = mCallEntries[i].stackvaroffset + ve->GetStackOffset() * MAX_TYPE_SIZE;
+                if (word_index >= 0 && word_index < mStackTop)
+                {
+                    if (increment)
+                        string_table->RefCountIncrement(mStackWords[word_index]);
+                    else
+                        string_table->RefCountDecrement(mStackWords[word_index]);
+                }
+            }
+            ve = var_table->Next();
+        }
+    }
+}
+
+// ====================================================================================================================
+// ReleasePushedStrings():  A cancelled coroutine never pops its stack, so we release what each Pop() would have.
+// ====================================================================================================================
+void CCoroutine::ReleasePushedStrings()
+{
+    CStringTable* string_table = mContextOwner->GetStringTable();
+    if (string_table == nullptr || mStackWords == nullptr)
+        return;
+
+    for (int32 region = 0; region <= mCallDepth; ++region)
+    {
+        int32 region_start = 0;
+        int32 pos = 0;
+        GetPushedRegion(mCallEntries, mCallDepth, mStackTop, region, region_start, pos);
+
+        eVarType type = TYPE_NULL;
+        uint32* value = nullptr;
+        while ((value = GetPushedValue(mStackWords, region_start, pos, type)) != nullptr)
+        {
+            if (type == TYPE_string)
+                string_table->RefCountDecrement(value[0]);
+        }
+    }
+}
+
+// ====================================================================================================================
+// RebaseStackAddresses():  Pushed addresses into the captured stack (e.g. a local's POD member) are moved to the
+// stack it's being restored into.
+// ====================================================================================================================
+void CCoroutine::RebaseStackAddresses(const uint32* new_stack_base)
+{
+    if (mStackWords == nullptr || mStackBase == nullptr || new_stack_base == mStackBase)
+        return;
+
+    for (int32 region = 0; region <= mCallDepth; ++region)
+    {
+        int32 region_start = 0;
+        int32 pos = 0;
+        GetPushedRegion(mCallEntries, mCallDepth, mStackTop, region, region_start, pos);
+
+        eVarType type = TYPE_NULL;
+        uint32* value = nullptr;
+        while ((value = GetPushedValue(mStackWords, region_start, pos, type)) != nullptr)
+        {
+            uint32* addr = GetPushedAddress(type, value);
+            if (addr != nullptr && addr >= mStackBase && addr < mStackBase + mStackTop)
+                SetPushedAddress(type, value, const_cast<uint32*>(new_stack_base) + (addr - mStackBase));
+        }
+    }
+}
+
+// ====================================================================================================================
+// ReleaseCapture():  Frees the captured stacks - the string references must already have been released.
+// ====================================================================================================================
+void CCoroutine::ReleaseCapture()
+{
+    if (mStackWords != nullptr)
+    {
+        TinFreeArray(mStackWords);
+        mStackWords = nullptr;
+    }
+    mStackBase = nullptr;
+    if (mCallEntries != nullptr)
+    {
+        TinFreeArray(mCallEntries);
+        mCallEntries = nullptr;
+    }
+    mStackTop = 0;
+    mStackTopReserve = 0;
+    mCallDepth = 0;
+}
+
+} // TinScript
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
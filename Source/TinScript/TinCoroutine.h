@@ -0,0 +1,124 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinCoroutine.h
+// A suspended VM - the frames, execution stack, and function call stack of a scheduled function that called wait(),
+// or called an async registered function
+// ====================================================================================================================
+
+#ifndef __TINCOROUTINE_H
+#define __TINCOROUTINE_H
+
+// -- includes --------------------------------------------------------------------------------------------------------
+
+#include "integration.h"
+#include "TinTypes.h"
+#include "TinExecute.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+class CCodeBlock;
+class CExecStack;
+class CFunctionEntry;
+
+// ====================================================================================================================
+// class CCoroutine:  The heap copy of a suspended VM, resumed in place by the scheduler once its wait has elapsed.
+// -- OP_Wait creates the coroutine, and as each CCodeBlock::Execute() level unwinds, it records where it resumes
+// -- only the used portion of the stacks is kept, so an idle coroutine costs a few hundred bytes
+// ====================================================================================================================
+class CCoroutine
+{
+    public:
+        // -- the frame capacity is the function call depth at the wait() - one Execute() level per script function
+        CCoroutine(CScriptContext* script_context, int32 frame_capacity, int32 wait_ms);
+        ~CCoroutine();
+
+        struct tFrame
+        {
+            CCodeBlock* mCodeBlock;
+            uint32 mInstrOffset;
+        };
+
+        // -- frames are added innermost first, as the VM unwinds
+        bool8 AddFrame(CCodeBlock* codeblock, const uint32* instrptr);
+        bool8 AddFrame(const tFrame& frame);
+        int32 GetFrameCount() const { return (mFrameCount); }
+        const tFrame& GetFrame(int32 index) const { return (mFrames[index]); }
+
+        int32 GetWaitTime() const { return (mWaitMS); }
+
+        // -- a coroutine suspended by an async function call waits for its handle to be completed, instead of time
+        // -- once completed, the result replaces the handle (the async function's return value) on the stack
+        void SetAsyncHandle(int32 handle) { mAsyncHandle = handle; }
+        int32 GetAsyncHandle() const { return (mAsyncHandle); }
+        void SetAsyncResult(eVarType result_type, void* result_addr);
+
+        // -- copies the stacks once unwound, and restores them into a new VM to resume
+        void Capture(CExecStack& execstack, CFunctionCallStack& funccallstack);
+        void Restore(CExecStack& execstack, CFunctionCallStack& funccallstack);
+
+        // -- a raw address pushed on the stack (e.g. the POD member of a local vector3f) is rebased when restored,
+        // but an address outside the stack (e.g. an object member) isn't guaranteed to outlive the suspension
+        static bool8 CanSuspend(CExecStack& execstack, CFunctionCallStack& funccallstack, eVarType& out_type);
+
+        // -- a coroutine is cancelled if an object whose method it's executing, or any function it's executing,
+        // is destroyed
+        bool8 ReferencesObject(uint32 object_id) const;
+        bool8 ReferencesFunction(CFunctionEntry* fe) const;
+
+    private:
+        void AddStringRefs(bool8 increment);
+        void ReleasePushedStrings();
+        void RebaseStackAddresses(const uint32* new_stack_base);
+        void ReleaseCapture();
+
+        CScriptContext* mContextOwner;
+
+        tFrame* mFrames;
+        int32 mFrameCapacity;
+        int32 mFrameCount;
+        int32 mWaitMS;
+
+        int32 mAsyncHandle;
+        bool8 mHasAsyncResult;
+        eVarType mAsyncResultType;
+        uint32 mAsyncResult[MAX_TYPE_SIZE];
+
+        // -- the captured stacks - the original stack base is only kept to rebase addresses into the stack
+        uint32* mStackWords;
+        const uint32* mStackBase;
+        int32 mStackTop;
+        int32 mStackTopReserve;
+        CFunctionCallStack::tFunctionCallEntry* mCallEntries;
+        int32 mCallDepth;
+};
+
+} // TinScript
+
+#endif // __TINCOROUTINE_H
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
@@ -0,0 +1,887 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinDebuggerSync.cpp
+// ====================================================================================================================
+
+// -- class include
+#include "TinDebuggerSync.h"
+
+// -- includes
+#include "string.h"
+#include "stdio.h"
+
+#include <chrono>
+
+#include "socket.h"
+
+#include "TinScript.h"
+#include "TinNamespace.h"
+#include "TinObjectGroup.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+static_assert(kDebuggerPacketMaxSize <= k_MaxPacketSize,
+              "Error - kDebuggerPacketMaxSize must not exceed the socket's k_MaxPacketSize");
+
+// -- the member block header:  packet ID, request ID, stack offset, function namespace, function, function object,
+// object ID, sync mode, and the row count
+static const int32 kMemberBlockHeaderWords = 9;
+
+// -- each row has a namespace hash, var hash, type, array size, var object ID, and source var ID column
+static const int32 kMemberBlockColumnCount = 6;
+
+// -- the initial number of member values cached for an inspected object, doubled as needed
+static const int32 kMemberCacheInitialSize = 16;
+
+// ====================================================================================================================
+// GetDebuggerSyncTimeMS():  The bandwidth budget is refilled by the (real) time elapsed, not the sim time
+// ====================================================================================================================
+static int64 GetDebuggerSyncTimeMS()
+{
+    return ((int64)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// == class CDebuggerSync =============================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CDebuggerSync::CDebuggerSync(CScriptContext* script_context)
+{
+    mContextOwner = script_context;
+    mPacketSink = nullptr;
+    mDebuggerSession = 0;
+
+    mQueueHead = nullptr;
+    mQueueTail = nullptr;
+    mFreeRecords = nullptr;
+    mQueuedCount = 0;
+    mPendingCreates = TinAlloc(ALLOC_HashTable, CHashTable<tSyncRecord>, kDebuggerSyncTableSize);
+
+    mLastUpdateTimeMS = GetDebuggerSyncTimeMS();
+    SetBandwidthCap(kDebuggerDefaultBandwidth);
+
+    memset(&mMemberBlock, 0, sizeof(mMemberBlock));
+    mRowCount = 0;
+    mRowStringLength = 0;
+    mObjectDeltas = TinAlloc(ALLOC_HashTable, CHashTable<tObjectDelta>, kDebuggerSyncTableSize);
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CDebuggerSync::~CDebuggerSync()
+{
+    ClearQueue();
+    while (mFreeRecords != nullptr)
+    {
+        tSyncRecord* sync_record = mFreeRecords;
+        mFreeRecords = sync_record->mNext;
+        TinFree(sync_record);
+    }
+    TinFree(mPendingCreates);
+
+    ClearObjectDelta(0);
+    TinFree(mObjectDeltas);
+}
+
+// ====================================================================================================================
+// IsActive():  Returns true if there's a debugger (or a loopback sink) to receive the notifications.
+// ====================================================================================================================
+bool8 CDebuggerSync::IsActive()
+{
+    if (mPacketSink != nullptr)
+        return (true);
+
+    int32 debugger_session = 0;
+    if (!mContextOwner->IsDebuggerConnected(debugger_session))
+        return (false);
+
+    // -- a new debugger knows nothing of what was queued or sent to the last one
+    if (debugger_session != mDebuggerSession)
+    {
+        ClearQueue();
+        ClearObjectDelta(0);
+        mDebuggerSession = debugger_session;
+    }
+
+    return (true);
+}
+
+// ====================================================================================================================
+// SetBandwidthCap():  Sets the bytes per second the queued notifications may use, 0 for uncapped.
+// ====================================================================================================================
+void CDebuggerSync::SetBandwidthCap(int32 bytes_per_second)
+{
+    mBandwidthCap = bytes_per_second > 0 ? bytes_per_second : 0;
+
+    // -- we allow a burst of a quarter second, but always at least one packet
+    mBandwidthBudget = mBandwidthCap / 4 > kDebuggerPacketMaxSize ? mBandwidthCap / 4 : kDebuggerPacketMaxSize;
+}
+
+// ====================================================================================================================
+// NotifyCreateObject():  Queues the object's creation, unless it's already pending.
+// ====================================================================================================================
+void CDebuggerSync::NotifyCreateObject(uint32 object_id)
+{
+    if (object_id == 0 || mPendingCreates->FindItem(object_id) != nullptr)
+        return;
+
+    tSyncRecord* sync_record = QueueRecord(eSyncRecordCreateObject, object_id, 0, false);
+    mPendingCreates->AddItem(*sync_record, object_id);
+}
+
+// ====================================================================================================================
+// NotifyDestroyObject():  Cancels the object's creation if still pending, otherwise queues the destruction.
+// ====================================================================================================================
+void CDebuggerSync::NotifyDestroyObject(uint32 object_id)
+{
+    if (object_id == 0)
+        return;
+
+    // -- the object no longer needs a delta
+    ClearObjectDelta(object_id);
+
+    // -- if the debugger was never told of the object, it doesn't need to be told it's gone
+    tSyncRecord* pending_create = mPendingCreates->FindItem(object_id);
+    if (pending_create != nullptr)
+    {
+        pending_create->mCancelled = true;
+        mPendingCreates->RemoveItem(object_id);
+        return;
+    }
+
+    QueueRecord(eSyncRecordDestroyObject, object_id, 0, false);
+}
+
+// ====================================================================================================================
+// NotifySetAddObject():  Queues the object's membership in a set.
+// ====================================================================================================================
+void CDebuggerSync::NotifySetAddObject(uint32 set_id, uint32 object_id, bool8 owned)
+{
+    QueueRecord(eSyncRecordSetAddObject, object_id, set_id, owned);
+}
+
+// ====================================================================================================================
+// NotifySetRemoveObject():  Queues the object's removal from a set.
+// ====================================================================================================================
+void CDebuggerSync::NotifySetRemoveObject(uint32 set_id, uint32 object_id)
+{
+    QueueRecord(eSyncRecordSetRemoveObject, object_id, set_id, false);
+}
+
+// ====================================================================================================================
+// NotifyListObjectsComplete():  Queues the completion of DebuggerListObjects(), after the objects listed.
+// ====================================================================================================================
+void CDebuggerSync::NotifyListObjectsComplete()
+{
+    QueueRecord(eSyncRecordListObjectsComplete, 0, 0, false);
+}
+
+// ====================================================================================================================
+// QueueRecord():  Appends a record to the queue, reusing a free record if we have one.
+// ====================================================================================================================
+CDebuggerSync::tSyncRecord* CDebuggerSync::QueueRecord(eDebuggerSyncRecord type, uint32 object_id, uint32 set_id,
+                                                       bool8 owned)
+{
+    tSyncRecord* sync_record = mFreeRecords;
+    if (sync_record != nullptr)
+        mFreeRecords = sync_record->mNext;
+    else
+        sync_record = TinAlloc(ALLOC_Debugger, tSyncRecord);
+
+    sync_record->mType = type;
+    sync_record->mObjectID = object_id;
+    sync_record->mSetID = set_id;
+    sync_record->mOwned = owned;
+    sync_record->mCancelled = false;
+    sync_record->mNext = nullptr;
+
+    if (mQueueTail != nullptr)
+        mQueueTail->mNext = sync_record;
+    else
+        mQueueHead = sync_record;
+    mQueueTail = sync_record;
+    ++mQueuedCount;
+
+    return (sync_record);
+}
+
+// ====================================================================================================================
+// ClearQueue():  Discards the queued records.
+// ====================================================================================================================
+void CDebuggerSync::ClearQueue()
+{
+    mPendingCreates->RemoveAll();
+    while (mQueueHead != nullptr)
+    {
+        tSyncRecord* sync_record = mQueueHead;
+        mQueueHead = sync_record->mNext;
+        sync_record->mNext = mFreeRecords;
+        mFreeRecords = sync_record;
+    }
+    mQueueTail = nullptr;
+    mQueuedCount = 0;
+}
+
+// ====================================================================================================================
+// Update():  Refills the bandwidth budget, and sends as many of the queued notifications as the budget allows.
+// ====================================================================================================================
+void CDebuggerSync::Update()
+{
+    int64 current_time = GetDebuggerSyncTimeMS();
+    int64 elapsed_ms = current_time - mLastUpdateTimeMS;
+    mLastUpdateTimeMS = current_time;
+
+    if (mQueueHead == nullptr)
+        return;
+
+    // -- if the debugger disconnected, there's no one to send the queue to
+    if (!IsActive())
+    {
+        ClearQueue();
+        return;
+    }
+
+    if (mBandwidthCap <= 0)
+    {
+        SendQueued(false);
+        return;
+    }
+
+    int64 max_budget = mBandwidthCap / 4 > kDebuggerPacketMaxSize ? mBandwidthCap / 4 : kDebuggerPacketMaxSize;
+    mBandwidthBudget += (elapsed_ms * mBandwidthCap) / 1000;
+    if (mBandwidthBudget > max_budget)
+        mBandwidthBudget = max_budget;
+
+    SendQueued(true);
+}
+
+// ====================================================================================================================
+// Flush():  Sends every queued notification, regardless of the bandwidth cap.
+// ====================================================================================================================
+void CDebuggerSync::Flush()
+{
+    if (mQueueHead != nullptr && IsActive())
+        SendQueued(false);
+}
+
+// ====================================================================================================================
+// SendQueued():  Packs the queued records into as few packets as possible - the queue is consumed in order.
+// ====================================================================================================================
+void CDebuggerSync::SendQueued(bool8 use_budget)
+{
+    // -- the batch is the packet ID, the record count, then the records
+    const int32 batch_header_size = 2 * (int32)sizeof(int32);
+    int32 batch[kDebuggerPacketMaxSize / sizeof(int32)];
+    int32 record[kDebuggerPacketMaxSize / sizeof(int32)];
+    int32 batch_size = batch_header_size;
+    int32 record_count = 0;
+
+    while (mQueueHead != nullptr)
+    {
+        // -- once over budget, the rest waits for the next update
+        if (use_budget && mBandwidthBudget <= 0 && record_count == 0)
+            break;
+
+        tSyncRecord* sync_record = mQueueHead;
+        mQueueHead = sync_record->mNext;
+        if (mQueueHead == nullptr)
+            mQueueTail = nullptr;
+        --mQueuedCount;
+
+        int32 record_size = WriteRecord(sync_record, record, kDebuggerPacketMaxSize - batch_header_size);
+
+        sync_record->mNext = mFreeRecords;
+        mFreeRecords = sync_record;
+
+        // -- records for objects already destroyed are skipped
+        if (record_size <= 0)
+            continue;
+
+        // -- if the record doesn't fit, send the batch so far
+        if (batch_size + record_size > kDebuggerPacketMaxSize)
+        {
+            batch[0] = k_DebuggerObjectBatchPacketID;
+            batch[1] = record_count;
+            SocketManager::tDataPacket* newPacket = CreatePacket(batch_size);
+            if (newPacket == nullptr)
+            {
+                ClearQueue();
+                return;
+            }
+            memcpy(newPacket->mData, batch, batch_size);
+            SendPacket(newPacket);
+            mBandwidthBudget -= batch_size + (int32)sizeof(SocketManager::tPacketHeader);
+
+            batch_size = batch_header_size;
+            record_count = 0;
+        }
+
+        memcpy((char*)batch + batch_size, record, record_size);
+        batch_size += record_size;
+        ++record_count;
+
+        if (use_budget && mBandwidthBudget <= 0)
+            break;
+    }
+
+    // -- send what remains
+    if (record_count > 0)
+    {
+        batch[0] = k_DebuggerObjectBatchPacketID;
+        batch[1] = record_count;
+        SocketManager::tDataPacket* newPacket = CreatePacket(batch_size);
+        if (newPacket == nullptr)
+        {
+            ClearQueue();
+            return;
+        }
+        memcpy(newPacket->mData, batch, batch_size);
+        SendPacket(newPacket);
+        mBandwidthBudget -= batch_size + (int32)sizeof(SocketManager::tPacketHeader);
+    }
+}
+
+// ====================================================================================================================
+// WriteRecord():  Writes a record, returns the size in bytes, or 0 if the record is no longer relevant.
+// ====================================================================================================================
+int32 CDebuggerSync::WriteRecord(tSyncRecord* sync_record, int32* dataPtr, int32 max_size)
+{
+    int32* dataStart = dataPtr;
+    switch (sync_record->mType)
+    {
+        case eSyncRecordCreateObject:
+        {
+            if (sync_record->mCancelled)
+                return (0);
+            mPendingCreates->RemoveItem(sync_record->mObjectID);
+
+            CObjectEntry* oe = mContextOwner->FindObjectEntry(sync_record->mObjectID);
+            if (oe == nullptr)
+                return (0);
+
+            // -- create the derivation string
+            char derivation_buf[kMaxNameLength];
+            char* derivation_ptr = derivation_buf;
+            *derivation_ptr = '\0';
+            int32 remaining = kMaxNameLength;
+            bool8 first = true;
+            CNamespace* ns = oe->GetNamespace();
+            while (ns && remaining > 1)
+            {
+                // -- if this is registered class, highlight it
+                if (ns->IsRegisteredClass())
+                    snprintf(derivation_ptr, remaining, "%s[%s]", !first ? "-->" : " ", UnHash(ns->GetHash()));
+                else
+                    snprintf(derivation_ptr, remaining, "%s%s", !first ? "-->" : " ", UnHash(ns->GetHash()));
+
+                int32 length = (int32)strlen(derivation_ptr);
+                remaining -= length;
+                derivation_ptr += length;
+
+                first = false;
+                ns = ns->GetNext();
+            }
+
+            // -- get the file/line from where this object was created
+            int32 stack_size = 0;
+            uint32 created_file_array[kDebuggerCallstackSize];
+            int32 created_lines_array[kDebuggerCallstackSize];
+            if (!CMemoryTracker::GetCreatedCallstack(oe->GetID(), stack_size, created_file_array,
+                                                     created_lines_array) || stack_size <= 0)
+            {
+                // -- memory tracking is disabled - ensure we have a zero stack size
+                stack_size = 0;
+            }
+
+            // -- strings are rounded up to a 4-byte aligned length (including the EOL)
+            const char* obj_name = oe->GetNameHash() != 0 ? oe->GetName() : "<unnamed>";
+            int32 obj_name_length = (int32)strlen(obj_name) + 1;
+            obj_name_length += 4 - (obj_name_length % 4);
+            int32 derivation_length = (int32)strlen(derivation_buf) + 1;
+            derivation_length += 4 - (derivation_length % 4);
+
+            int32 total_size = (int32)sizeof(int32) * (5 + 2 * stack_size) + obj_name_length + derivation_length;
+            if (total_size > max_size)
+                return (0);
+
+            *dataPtr++ = eSyncRecordCreateObject;
+            *dataPtr++ = oe->GetID();
+
+            *dataPtr++ = obj_name_length;
+            SafeStrcpy((char*)dataPtr, obj_name_length, obj_name, obj_name_length);
+            dataPtr += (obj_name_length / 4);
+
+            *dataPtr++ = derivation_length;
+            SafeStrcpy((char*)dataPtr, derivation_length, derivation_buf, derivation_length);
+            dataPtr += (derivation_length / 4);
+
+            *dataPtr++ = stack_size;
+            if (stack_size > 0)
+            {
+                memcpy(dataPtr, created_file_array, sizeof(uint32) * stack_size);
+                dataPtr += stack_size;
+                memcpy(dataPtr, created_lines_array, sizeof(int32) * stack_size);
+                dataPtr += stack_size;
+            }
+            break;
+        }
+
+        case eSyncRecordDestroyObject:
+            *dataPtr++ = eSyncRecordDestroyObject;
+            *dataPtr++ = sync_record->mObjectID;
+            break;
+
+        // -- the destruction of either the set or the object supercedes a change in membership
+        case eSyncRecordSetAddObject:
+        case eSyncRecordSetRemoveObject:
+            if (mContextOwner->FindObjectEntry(sync_record->mObjectID) == nullptr ||
+                mContextOwner->FindObjectEntry(sync_record->mSetID) == nullptr)
+            {
+                return (0);
+            }
+
+            *dataPtr++ = sync_record->mType;
+            *dataPtr++ = sync_record->mSetID;
+            *dataPtr++ = sync_record->mObjectID;
+            if (sync_record->mType == eSyncRecordSetAddObject)
+                *dataPtr++ = sync_record->mOwned ? 1 : 0;
+            break;
+
+        case eSyncRecordListObjectsComplete:
+            *dataPtr++ = eSyncRecordListObjectsComplete;
+            break;
+
+        default:
+            return (0);
+    }
+
+    return (kPointerDiffUInt32(dataPtr, dataStart));
+}
+
+// ====================================================================================================================
+// BeginMemberBlock():  Begins a block of an object's members, returns the block to be restored by EndMemberBlock().
+// ====================================================================================================================
+CDebuggerSync::tMemberBlock CDebuggerSync::BeginMemberBlock(CDebuggerWatchVarEntry* calling_function,
+                                                            uint32 object_id, eDebuggerMemberSync sync_mode)
+{
+    // -- a nested block is only begun once the rows before it are sent, but to be sure...
+    SendMemberBlock();
+
+    tMemberBlock previous_block = mMemberBlock;
+    mMemberBlock.mWatchRequestID = calling_function ? calling_function->mWatchRequestID : 0;
+    mMemberBlock.mStackOffsetFromBottom = calling_function ? calling_function->mStackOffsetFromBottom : -1;
+    mMemberBlock.mFuncNamespaceHash = calling_function ? calling_function->mFuncNamespaceHash : 0;
+    mMemberBlock.mFunctionHash = calling_function ? calling_function->mFunctionHash : 0;
+    mMemberBlock.mFunctionObjectID = calling_function ? calling_function->mFunctionObjectID : 0;
+    mMemberBlock.mObjectID = object_id;
+    mMemberBlock.mSyncMode = sync_mode;
+
+    // -- an inspect is a new snapshot, to which refreshes are compared
+    if (sync_mode == eMemberSyncInspect)
+        ClearObjectDelta(object_id);
+
+    return (previous_block);
+}
+
+// ====================================================================================================================
+// AddMember():  Formats the member's value, and adds a row to the block (unless it's unchanged, for a refresh).
+// ====================================================================================================================
+void CDebuggerSync::AddMember(CDebuggerWatchVarEntry& member_entry)
+{
+    mContextOwner->DebuggerWatchFormatValue(&member_entry);
+    if (!IsMemberChanged(member_entry))
+        return;
+
+    // -- if the row doesn't fit, send the rows so far
+    int32 name_length = (int32)strlen(member_entry.mVarName) + 1;
+    int32 value_length = (int32)strlen(member_entry.mValue) + 1;
+    int32 block_size = (int32)sizeof(int32) * (kMemberBlockHeaderWords + kMemberBlockColumnCount * (mRowCount + 1)) +
+                       mRowStringLength + name_length + value_length + 3;
+    if (mRowCount >= kDebuggerMemberBlockMaxRows || block_size > kDebuggerPacketMaxSize)
+        SendMemberBlock();
+
+    mRowNamespaceHash[mRowCount] = member_entry.mNamespaceHash;
+    mRowVarHash[mRowCount] = member_entry.mVarHash;
+    mRowType[mRowCount] = member_entry.mType;
+    mRowArraySize[mRowCount] = member_entry.mArraySize;
+    mRowVarObjectID[mRowCount] = member_entry.mVarObjectID;
+    mRowSourceVarID[mRowCount] = member_entry.mSourceVarID;
+    ++mRowCount;
+
+    memcpy(&mRowStrings[mRowStringLength], member_entry.mVarName, name_length);
+    mRowStringLength += name_length;
+    memcpy(&mRowStrings[mRowStringLength], member_entry.mValue, value_length);
+    mRowStringLength += value_length;
+
+    // -- array entries and object members are sent after the row they belong to
+    bool8 has_children = member_entry.mArraySize > 1 ||
+                         (member_entry.mType == TYPE_object && member_entry.mVarObjectID > 0);
+    if (has_children && member_entry.mSourceVarEntry != nullptr)
+    {
+        SendMemberBlock();
+        tMemberBlock current_block = mMemberBlock;
+        mContextOwner->DebuggerSendWatchChildren(&member_entry);
+        mMemberBlock = current_block;
+    }
+}
+
+// ====================================================================================================================
+// EndMemberBlock():  Sends the remaining rows, and restores the enclosing block.
+// ====================================================================================================================
+void CDebuggerSync::EndMemberBlock(const tMemberBlock& previous_block)
+{
+    SendMemberBlock();
+    mMemberBlock = previous_block;
+}
+
+// ====================================================================================================================
+// SendMemberBlock():  Sends the staged rows - the shared context once, then each column, then the packed strings.
+// ====================================================================================================================
+void CDebuggerSync::SendMemberBlock()
+{
+    if (mRowCount == 0)
+        return;
+
+    int32 string_size = (mRowStringLength + 3) & ~3;
+    int32 total_size = (int32)sizeof(int32) * (kMemberBlockHeaderWords + kMemberBlockColumnCount * mRowCount) +
+                       string_size;
+
+    SocketManager::tDataPacket* newPacket = CreatePacket(total_size);
+    if (newPacket != nullptr)
+    {
+        int32* dataPtr = (int32*)newPacket->mData;
+        *dataPtr++ = k_DebuggerMemberBlockPacketID;
+        *dataPtr++ = mMemberBlock.mWatchRequestID;
+        *dataPtr++ = mMemberBlock.mStackOffsetFromBottom;
+        *dataPtr++ = mMemberBlock.mFuncNamespaceHash;
+        *dataPtr++ = mMemberBlock.mFunctionHash;
+        *dataPtr++ = mMemberBlock.mFunctionObjectID;
+        *dataPtr++ = mMemberBlock.mObjectID;
+        *dataPtr++ = mMemberBlock.mSyncMode;
+        *dataPtr++ = mRowCount;
+
+        int32 column_size = (int32)sizeof(int32) * mRowCount;
+        memcpy(dataPtr, mRowNamespaceHash, column_size);
+        dataPtr += mRowCount;
+        memcpy(dataPtr, mRowVarHash, column_size);
+        dataPtr += mRowCount;
+        memcpy(dataPtr, mRowType, column_size);
+        dataPtr += mRowCount;
+        memcpy(dataPtr, mRowArraySize, column_size);
+        dataPtr += mRowCount;
+        memcpy(dataPtr, mRowVarObjectID, column_size);
+        dataPtr += mRowCount;
+        memcpy(dataPtr, mRowSourceVarID, column_size);
+        dataPtr += mRowCount;
+
+        memset(dataPtr, 0, string_size);
+        memcpy(dataPtr, mRowStrings, mRowStringLength);
+
+        SendPacket(newPacket);
+    }
+
+    mRowCount = 0;
+    mRowStringLength = 0;
+}
+
+// ====================================================================================================================
+// IsMemberChanged():  For a refresh, returns true only if the value differs from the last sent - inspects and
+// refreshes both record the value sent.
+// ====================================================================================================================
+bool8 CDebuggerSync::IsMemberChanged(const CDebuggerWatchVarEntry& member_entry)
+{
+    if (mMemberBlock.mSyncMode == eMemberSyncSnapshot || mMemberBlock.mObjectID == 0)
+        return (true);
+
+    tObjectDelta* object_delta = mObjectDeltas->FindItem(mMemberBlock.mObjectID);
+    if (object_delta == nullptr)
+    {
+        object_delta = TinAlloc(ALLOC_Debugger, tObjectDelta);
+        mObjectDeltas->AddItem(*object_delta, mMemberBlock.mObjectID);
+    }
+
+    uint32 value_hash = HashValue(member_entry.mValue);
+
+    // -- members are visited in the same order each time, so we look where the last left off, before searching
+    int32 found_index = -1;
+    int32 cursor = object_delta->mCursor;
+    if (cursor < object_delta->mCount && object_delta->mValues[cursor].mVarHash == member_entry.mVarHash &&
+        object_delta->mValues[cursor].mNamespaceHash == member_entry.mNamespaceHash)
+    {
+        found_index = cursor;
+    }
+    else
+    {
+        for (int32 i = 0; i < object_delta->mCount; ++i)
+        {
+            if (object_delta->mValues[i].mVarHash == member_entry.mVarHash &&
+                object_delta->mValues[i].mNamespaceHash == member_entry.mNamespaceHash)
+            {
+                found_index = i;
+                break;
+            }
+        }
+    }
+
+    if (found_index >= 0)
+    {
+        object_delta->mCursor = found_index + 1;
+        bool8 changed = object_delta->mValues[found_index].mValueHash != value_hash ||
+                        mMemberBlock.mSyncMode == eMemberSyncInspect;
+        object_delta->mValues[found_index].mValueHash = value_hash;
+        return (changed);
+    }
+
+    // -- a new member (e.g. a dynamic variable added since the last refresh)
+    if (object_delta->mCount >= object_delta->mCapacity)
+    {
+        int32 new_capacity = object_delta->mCapacity > 0 ? object_delta->mCapacity * 2 : kMemberCacheInitialSize;
+        tMemberValue* new_values = TinAllocArray(ALLOC_Debugger, tMemberValue, new_capacity);
+        if (object_delta->mValues != nullptr)
+        {
+            memcpy(new_values, object_delta->mValues, sizeof(tMemberValue) * object_delta->mCount);
+            TinFreeArray(object_delta->mValues);
+        }
+        object_delta->mValues = new_values;
+        object_delta->mCapacity = new_capacity;
+    }
+
+    tMemberValue& member_value = object_delta->mValues[object_delta->mCount++];
+    member_value.mNamespaceHash = member_entry.mNamespaceHash;
+    member_value.mVarHash = member_entry.mVarHash;
+    member_value.mValueHash = value_hash;
+    object_delta->mCursor = object_delta->mCount;
+    return (true);
+}
+
+// ====================================================================================================================
+// ClearObjectDelta():  Releases the delta values of the given object, or of every object, given 0.
+// ====================================================================================================================
+void CDebuggerSync::ClearObjectDelta(uint32 object_id)
+{
+    if (object_id != 0)
+    {
+        tObjectDelta* object_delta = mObjectDeltas->FindItem(object_id);
+        if (object_delta != nullptr)
+        {
+            mObjectDeltas->RemoveItem(object_id);
+            if (object_delta->mValues != nullptr)
+                TinFreeArray(object_delta->mValues);
+            TinFree(object_delta);
+        }
+        return;
+    }
+
+    tObjectDelta* object_delta = mObjectDeltas->First();
+    while (object_delta != nullptr)
+    {
+        if (object_delta->mValues != nullptr)
+            TinFreeArray(object_delta->mValues);
+        object_delta = mObjectDeltas->Next();
+    }
+    mObjectDeltas->DestroyAll();
+}
+
+// ====================================================================================================================
+// CreatePacket():  Creates a packet to be written in place - the loopback sink doesn't need a connected socket.
+// ====================================================================================================================
+SocketManager::tDataPacket* CDebuggerSync::CreatePacket(int32 size)
+{
+    SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::DATA, size);
+    if (mPacketSink != nullptr)
+        return (new SocketManager::tDataPacket(&header, NULL));
+
+    SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header, NULL);
+    if (newPacket == nullptr)
+        TinPrint(mContextOwner, "Error - CDebuggerSync::CreatePacket():  unable to send - not connected\n");
+    return (newPacket);
+}
+
+// ====================================================================================================================
+// SendPacket():  Sends the packet to the sink, or the socket - if it can't be sent, it's deleted.
+// ====================================================================================================================
+bool8 CDebuggerSync::SendPacket(SocketManager::tDataPacket* packet)
+{
+    bool result = mPacketSink != nullptr ? mPacketSink(packet) : SocketManager::SendDataPacket(packet);
+    if (!result)
+        delete packet;
+    return (result);
+}
+
+// ====================================================================================================================
+// DecodePacket():  Reconstitutes a batch or member block, notifying the listener of each record or row.
+// -- returns false if the packet isn't one of ours, or is malformed
+// ====================================================================================================================
+bool8 CDebuggerSync::DecodePacket(int32* dataPtr, int32 data_size, CDebuggerSyncListener* listener)
+{
+    if (dataPtr == nullptr || listener == nullptr || data_size < (int32)sizeof(int32) * 2)
+        return (false);
+
+    int32* dataEnd = dataPtr + (data_size / sizeof(int32));
+    int32 packet_id = *dataPtr++;
+
+    if (packet_id == k_DebuggerObjectBatchPacketID)
+    {
+        int32 record_count = *dataPtr++;
+        for (int32 i = 0; i < record_count; ++i)
+        {
+            if (dataPtr >= dataEnd)
+                return (false);
+
+            int32 record_type = *dataPtr++;
+            switch (record_type)
+            {
+                case eSyncRecordCreateObject:
+                {
+                    uint32 object_id = (uint32)(*dataPtr++);
+
+                    int32 obj_name_length = *dataPtr++;
+                    const char* obj_name = (const char*)dataPtr;
+                    dataPtr += obj_name_length / 4;
+
+                    int32 derivation_length = *dataPtr++;
+                    const char* derivation = (const char*)dataPtr;
+                    dataPtr += derivation_length / 4;
+
+                    int32 stack_size = *dataPtr++;
+                    if (stack_size < 0 || stack_size > kDebuggerCallstackSize || dataPtr + 2 * stack_size > dataEnd)
+                        return (false);
+
+                    uint32 created_file_array[kDebuggerCallstackSize];
+                    int32 created_lines_array[kDebuggerCallstackSize];
+                    memcpy(created_file_array, dataPtr, sizeof(uint32) * stack_size);
+                    dataPtr += stack_size;
+                    memcpy(created_lines_array, dataPtr, sizeof(int32) * stack_size);
+                    dataPtr += stack_size;
+
+                    listener->OnCreateObject(object_id, obj_name, derivation, stack_size, created_file_array,
+                                             created_lines_array);
+                    break;
+                }
+
+                case eSyncRecordDestroyObject:
+                    listener->OnDestroyObject((uint32)(*dataPtr++));
+                    break;
+
+                case eSyncRecordSetAddObject:
+                {
+                    uint32 set_id = (uint32)(*dataPtr++);
+                    uint32 object_id = (uint32)(*dataPtr++);
+                    bool8 owned = *dataPtr++ != 0;
+                    listener->OnSetAddObject(set_id, object_id, owned);
+                    break;
+                }
+
+                case eSyncRecordSetRemoveObject:
+                {
+                    uint32 set_id = (uint32)(*dataPtr++);
+                    uint32 object_id = (uint32)(*dataPtr++);
+                    listener->OnSetRemoveObject(set_id, object_id);
+                    break;
+                }
+
+                case eSyncRecordListObjectsComplete:
+                    listener->OnListObjectsComplete();
+                    break;
+
+                default:
+                    return (false);
+            }
+        }
+
+        return (true);
+    }
+
+    else if (packet_id == k_DebuggerMemberBlockPacketID)
+    {
+        if (dataPtr + kMemberBlockHeaderWords - 1 > dataEnd)
+            return (false);
+
+        // -- the context shared by every row
+        CDebuggerWatchVarEntry watch_var_entry;
+        watch_var_entry.mWatchRequestID = *dataPtr++;
+        watch_var_entry.mStackOffsetFromBottom = *dataPtr++;
+        watch_var_entry.mFuncNamespaceHash = *dataPtr++;
+        watch_var_entry.mFunctionHash = *dataPtr++;
+        watch_var_entry.mFunctionObjectID = *dataPtr++;
+        watch_var_entry.mObjectID = *dataPtr++;
+        ++dataPtr;
+        int32 row_count = *dataPtr++;
+        if (row_count < 0 || row_count > kDebuggerMemberBlockMaxRows ||
+            dataPtr + kMemberBlockColumnCount * row_count > dataEnd)
+        {
+            return (false);
+        }
+
+        int32* ns_column = dataPtr;
+        int32* var_hash_column = ns_column + row_count;
+        int32* type_column = var_hash_column + row_count;
+        int32* array_size_column = type_column + row_count;
+        int32* var_object_column = array_size_column + row_count;
+        int32* source_var_column = var_object_column + row_count;
+        const char* string_ptr = (const char*)(source_var_column + row_count);
+        const char* string_end = (const char*)dataEnd;
+
+        for (int32 i = 0; i < row_count; ++i)
+        {
+            watch_var_entry.mNamespaceHash = (uint32)ns_column[i];
+            watch_var_entry.mVarHash = (uint32)var_hash_column[i];
+            watch_var_entry.mType = (eVarType)type_column[i];
+            watch_var_entry.mArraySize = array_size_column[i];
+            watch_var_entry.mVarObjectID = (uint32)var_object_column[i];
+            watch_var_entry.mSourceVarID = (uint32)source_var_column[i];
+
+            // -- the name, then the value, each null terminated
+            for (int32 s = 0; s < 2; ++s)
+            {
+                const char* string_start = string_ptr;
+                while (string_ptr < string_end && *string_ptr != '\0')
+                    ++string_ptr;
+                if (string_ptr >= string_end)
+                    return (false);
+
+                char* dest = s == 0 ? watch_var_entry.mVarName : watch_var_entry.mValue;
+                SafeStrcpy(dest, kMaxNameLength, string_start, kMaxNameLength);
+                ++string_ptr;
+            }
+
+            listener->OnMemberEntry(watch_var_entry);
+        }
+
+        return (true);
+    }
+
+    return (false);
+}
+
+} // TinScript
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
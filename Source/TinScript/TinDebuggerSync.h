@@ -0,0 +1,225 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinDebuggerSync.h
+// The batched object notifications, and columnar member blocks, sent to the debugger
+// ====================================================================================================================
+
+#ifndef __TINDEBUGGERSYNC_H
+#define __TINDEBUGGERSYNC_H
+
+// -- includes --------------------------------------------------------------------------------------------------------
+
+#include "integration.h"
+#include "TinTypes.h"
+#include "TinHash.h"
+
+// -- forward declarations --------------------------------------------------------------------------------------------
+
+namespace SocketManager
+{
+    struct tDataPacket;
+}
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+class CScriptContext;
+class CObjectEntry;
+class CDebuggerWatchVarEntry;
+
+// -- the records within a k_DebuggerObjectBatchPacketID packet
+enum eDebuggerSyncRecord
+{
+    eSyncRecordNone,
+    eSyncRecordCreateObject,
+    eSyncRecordDestroyObject,
+    eSyncRecordSetAddObject,
+    eSyncRecordSetRemoveObject,
+    eSyncRecordListObjectsComplete,
+};
+
+// -- how a member block is sent:  a snapshot is sent as is, an inspect resets the object's delta values,
+// and a refresh sends only the members whose value has changed since the last inspect or refresh
+enum eDebuggerMemberSync
+{
+    eMemberSyncSnapshot,
+    eMemberSyncInspect,
+    eMemberSyncRefresh,
+};
+
+// -- packets are sent through SocketManager::SendDataPacket(), unless a loopback sink is set (e.g. a test client)
+typedef bool (*DebuggerPacketSink)(SocketManager::tDataPacket* packet);
+
+// ====================================================================================================================
+// class CDebuggerSyncListener:  The receiving end of the protocol - the debugger, or a headless (loopback) client.
+// ====================================================================================================================
+class CDebuggerSyncListener
+{
+    public:
+        virtual ~CDebuggerSyncListener() { }
+
+        virtual void OnCreateObject(uint32 object_id, const char* object_name, const char* derivation,
+                                    int32 stack_size, uint32* file_array, int32* line_array) = 0;
+        virtual void OnDestroyObject(uint32 object_id) = 0;
+        virtual void OnSetAddObject(uint32 set_id, uint32 object_id, bool8 owned) = 0;
+        virtual void OnSetRemoveObject(uint32 set_id, uint32 object_id) = 0;
+        virtual void OnListObjectsComplete() = 0;
+
+        // -- each row of a member block is reconstituted as a watch var entry
+        virtual void OnMemberEntry(CDebuggerWatchVarEntry& watch_var_entry) = 0;
+};
+
+// ====================================================================================================================
+// class CDebuggerSync:  Coalesces the object notifications for the debugger, and packs object members into blocks.
+// -- object creation, destruction, and set membership are queued, and sent in batches from Update(), within the
+// bandwidth cap - an object created and destroyed before its batch is sent, is never sent at all
+// -- object members are sent immediately (they're requested), a block of columns per object, rather than a
+// packet per member
+// ====================================================================================================================
+class CDebuggerSync
+{
+    public:
+        CDebuggerSync(CScriptContext* script_context);
+        ~CDebuggerSync();
+
+        // -- a loopback sink is always active, otherwise we need a connected debugger
+        void SetPacketSink(DebuggerPacketSink sink) { mPacketSink = sink; }
+        bool8 IsActive();
+
+        // -- bytes per second, 0 to send every queued notification each update
+        void SetBandwidthCap(int32 bytes_per_second);
+        int32 GetBandwidthCap() const { return (mBandwidthCap); }
+
+        // -- object notifications are queued until the next update
+        void NotifyCreateObject(uint32 object_id);
+        void NotifyDestroyObject(uint32 object_id);
+        void NotifySetAddObject(uint32 set_id, uint32 object_id, bool8 owned);
+        void NotifySetRemoveObject(uint32 set_id, uint32 object_id);
+        void NotifyListObjectsComplete();
+        int32 GetQueuedCount() const { return (mQueuedCount); }
+
+        // -- sends the queued notifications, within the bandwidth cap - Flush() ignores the cap
+        void Update();
+        void Flush();
+
+        // -- the block context is returned by Begin(), and restored by End(), so blocks can be nested
+        // (e.g. the members of an object referenced by a member)
+        struct tMemberBlock
+        {
+            int32 mWatchRequestID;
+            int32 mStackOffsetFromBottom;
+            uint32 mFuncNamespaceHash;
+            uint32 mFunctionHash;
+            uint32 mFunctionObjectID;
+            uint32 mObjectID;
+            eDebuggerMemberSync mSyncMode;
+        };
+
+        tMemberBlock BeginMemberBlock(CDebuggerWatchVarEntry* calling_function, uint32 object_id,
+                                      eDebuggerMemberSync sync_mode);
+        void AddMember(CDebuggerWatchVarEntry& member_entry);
+        void EndMemberBlock(const tMemberBlock& previous_block);
+
+        // -- packets written in place, and sent to the sink (if set) or the debugger socket
+        SocketManager::tDataPacket* CreatePacket(int32 size);
+        bool8 SendPacket(SocketManager::tDataPacket* packet);
+
+        // -- decodes a k_DebuggerObjectBatchPacketID or k_DebuggerMemberBlockPacketID packet
+        static bool8 DecodePacket(int32* dataPtr, int32 data_size, CDebuggerSyncListener* listener);
+
+    private:
+        struct tSyncRecord
+        {
+            eDebuggerSyncRecord mType;
+            uint32 mObjectID;
+            uint32 mSetID;
+            bool8 mOwned;
+            bool8 mCancelled;
+            tSyncRecord* mNext;
+        };
+
+        // -- the last value sent, for each member of an inspected object
+        struct tMemberValue
+        {
+            uint32 mNamespaceHash;
+            uint32 mVarHash;
+            uint32 mValueHash;
+        };
+
+        struct tObjectDelta
+        {
+            tMemberValue* mValues;
+            int32 mCount;
+            int32 mCapacity;
+            int32 mCursor;
+        };
+
+        tSyncRecord* QueueRecord(eDebuggerSyncRecord type, uint32 object_id, uint32 set_id, bool8 owned);
+        void SendQueued(bool8 use_budget);
+        int32 WriteRecord(tSyncRecord* record, int32* dataPtr, int32 max_size);
+        void ClearQueue();
+
+        bool8 IsMemberChanged(const CDebuggerWatchVarEntry& member_entry);
+        void ClearObjectDelta(uint32 object_id);
+        void SendMemberBlock();
+
+        CScriptContext* mContextOwner;
+        DebuggerPacketSink mPacketSink;
+        int32 mDebuggerSession;
+
+        // -- the notification queue (FIFO), and the pending creations, so a destroy can cancel them
+        tSyncRecord* mQueueHead;
+        tSyncRecord* mQueueTail;
+        tSyncRecord* mFreeRecords;
+        int32 mQueuedCount;
+        CHashTable<tSyncRecord>* mPendingCreates;
+
+        // -- the token bucket, refilled each update
+        int32 mBandwidthCap;
+        int64 mBandwidthBudget;
+        int64 mLastUpdateTimeMS;
+
+        // -- the member block being built - the rows are staged as columns, and the strings packed
+        tMemberBlock mMemberBlock;
+        int32 mRowCount;
+        uint32 mRowNamespaceHash[kDebuggerMemberBlockMaxRows];
+        uint32 mRowVarHash[kDebuggerMemberBlockMaxRows];
+        int32 mRowType[kDebuggerMemberBlockMaxRows];
+        int32 mRowArraySize[kDebuggerMemberBlockMaxRows];
+        uint32 mRowVarObjectID[kDebuggerMemberBlockMaxRows];
+        uint32 mRowSourceVarID[kDebuggerMemberBlockMaxRows];
+        char mRowStrings[kDebuggerPacketMaxSize];
+        int32 mRowStringLength;
+
+        CHashTable<tObjectDelta>* mObjectDeltas;
+};
+
+} // TinScript
+
+#endif // __TINDEBUGGERSYNC_H
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
@@ -231,6 +231,8 @@ enum eMathBinaryFunctionType
 	ReservedKeywordEntry(super)                 \
 	ReservedKeywordEntry(interface)             \
 	ReservedKeywordEntry(ensure_interface)      \
+	ReservedKeywordEntry(wait)                  \
+	ReservedKeywordEntry(yield)                 \
 
 enum eReservedKeyword
 {
@@ -300,6 +302,7 @@ enum eReservedKeyword
 	CompileNodeTypeEntry(Schedule)			    \
 	CompileNodeTypeEntry(CreateObject)  	    \
 	CompileNodeTypeEntry(DestroyObject)  	    \
+	CompileNodeTypeEntry(Wait)  	            \
 
 // enum to mark the nodes for debug output
 enum ECompileNodeType
@@ -349,6 +352,8 @@ enum class EFunctionCallType
 	OperationEntry(PushArrayValue)     	\
 	OperationEntry(PushMember)			\
 	OperationEntry(PushMemberVal)		\
+	OperationEntry(PushMemberOffset)	\
+	OperationEntry(PushMemberOffsetVal)	\
 	OperationEntry(PushPODMember)       \
 	OperationEntry(PushPODMemberVal)    \
 	OperationEntry(PushSelf)    		\
@@ -360,6 +365,10 @@ enum class EFunctionCallType
 	OperationEntry(Mult)				\
 	OperationEntry(Div)					\
 	OperationEntry(Mod)					\
+	OperationEntry(VectorAdd)			\
+	OperationEntry(VectorSub)			\
+	OperationEntry(VectorMult)			\
+	OperationEntry(VectorDiv)			\
 	OperationEntry(AssignAdd)			\
 	OperationEntry(AssignSub)			\
 	OperationEntry(AssignMult)			\
@@ -397,6 +406,7 @@ enum class EFunctionCallType
 	OperationEntry(FuncDeclEnd)    		\
 	OperationEntry(FuncCallArgs)		\
 	OperationEntry(FuncCall)			\
+	OperationEntry(FuncCallNative)	\
 	OperationEntry(FuncReturn)			\
 	OperationEntry(MethodCallArgs)		\
 	OperationEntry(PODCallArgs)			\
@@ -414,6 +424,7 @@ enum class EFunctionCallType
 	OperationEntry(ScheduleEnd)         \
 	OperationEntry(CreateObject)		\
 	OperationEntry(DestroyObject)		\
+	OperationEntry(Wait)		        \
 	OperationEntry(EOF)					\
 
 enum eOpCode : int16
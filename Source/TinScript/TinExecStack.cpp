@@ -302,6 +302,34 @@ int32 CExecStack::GetStackTop()
     return (kPointerDiffUInt32(mStackTop, mStack) / sizeof(uint32));
 }
 
+// ====================================================================================================================
+// GetStackTopReserve(): returns the top of the space reserved for local vars, which values can't be popped below
+// ====================================================================================================================
+int32 CExecStack::GetStackTopReserve() const
+{
+    if (mStackTopReserve == nullptr)
+        return (0);
+    return (kPointerDiffUInt32(mStackTopReserve, mStack) / sizeof(uint32));
+}
+
+// ====================================================================================================================
+// Restore():  Restores the stack contents captured from a suspended coroutine
+// ====================================================================================================================
+void CExecStack::Restore(const uint32* words, int32 stack_top, int32 stack_top_reserve)
+{
+    if (stack_top < 0 || stack_top > (int32)mSize || stack_top_reserve > stack_top)
+    {
+        ScriptAssert_(TinScript::GetContext(), 0, "<internal>", -1,
+                      "Error - CExecStack::Restore() invalid stack top: %d\n", stack_top);
+        return;
+    }
+
+    if (stack_top > 0)
+        memcpy(mStack, words, sizeof(uint32) * stack_top);
+    mStackTop = mStack + stack_top;
+    mStackTopReserve = mStack + stack_top_reserve;
+}
+
 // ====================================================================================================================
 // GetStackVarAddr():  local vars contain an offset, so their actual storage is wherever the (stack top + offset) is
 // ====================================================================================================================
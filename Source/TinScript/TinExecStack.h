@@ -64,6 +64,12 @@ class CExecStack
 
         void* GetStackVarAddr(int32 varstacktop, int32 varoffset) const;
 
+        // -- a suspended coroutine copies out the used portion of the stack, and restores it into a new VM
+        // note:  the stack is index based (local vars are offsets), so the copy is position independent
+        const uint32* GetStackBase() const { return (mStack); }
+        int32 GetStackTopReserve() const;
+        void Restore(const uint32* words, int32 stack_top, int32 stack_top_reserve);
+
         int DebugPrintStack(bool depth_only = false);
 
 	private:
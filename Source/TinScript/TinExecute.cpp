@@ -46,6 +46,7 @@
 #include "TinScheduler.h"
 #include "TinOpExecFunctions.h"
 #include "TinExecStack.h"
+#include "TinCoroutine.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -228,13 +229,13 @@ CFunctionCallStack::tFunctionCallEntry::tFunctionCallEntry(CFunctionEntry* _func
 // ====================================================================================================================
 // -- constructor
 // ====================================================================================================================
-_declspec(thread) CFunctionCallStack* g_ExecutionHead = nullptr;
+thread_local CFunctionCallStack* g_ExecutionHead = nullptr;
 
-_declspec(thread) bool8 g_DebuggerBreakStep = false;
+thread_local bool8 g_DebuggerBreakStep = false;
 
-_declspec(thread) CFunctionCallStack* g_DebuggerBreakLastCallstack = nullptr;
-_declspec(thread) int32 g_DebuggerBreakLastLineNumber = -1;
-_declspec(thread) int32 g_DebuggerBreakLastStackDepth = -1;
+thread_local CFunctionCallStack* g_DebuggerBreakLastCallstack = nullptr;
+thread_local int32 g_DebuggerBreakLastLineNumber = -1;
+thread_local int32 g_DebuggerBreakLastStackDepth = -1;
 
 // -- a section to track whether the VM is jumping to the same address repeatedly... at a max count,
 // we'll consider this an infinite loop, and assert
@@ -252,7 +253,7 @@ struct tOPBranchTracking
     int32 count = 0;
 };
 
-_declspec(thread) CHashTable<tOPBranchTracking>* g_BranchTrackingTable = nullptr;
+thread_local CHashTable<tOPBranchTracking>* g_BranchTrackingTable = nullptr;
 
 #endif
 
@@ -297,6 +298,61 @@ void CFunctionCallStack::ClearBranchTracking()
 #endif
 }
 
+// ====================================================================================================================
+// IsOnlyExecution():  True if no other function call stack on this thread has a function call.
+// ====================================================================================================================
+bool8 CFunctionCallStack::IsOnlyExecution() const
+{
+    CFunctionCallStack* walk = g_ExecutionHead;
+    while (walk != nullptr)
+    {
+        if (walk != this && walk->m_stacktop > 0)
+            return (false);
+        walk = walk->m_ExecutionNext;
+    }
+
+    return (true);
+}
+
+// ====================================================================================================================
+// AddStackStringRefs():  Increments (or decrements) the ref count of the string locals of each function call.
+// ====================================================================================================================
+void CFunctionCallStack::AddStackStringRefs(CExecStack& execstack, bool8 increment) const
+{
+    CStringTable* string_table = execstack.GetContextOwner()->GetStringTable();
+    int32 stack_top = execstack.GetStackTop();
+    for (int32 i = 0; i < m_stacktop; ++i)
+    {
+        const tFunctionCallEntry& entry = m_functionEntryStack[i];
+        CFunctionEntry* fe = entry.funcentry;
+
+        // -- a function still being prepared (e.g. its args) hasn't reserved its locals yet
+        if (!entry.isexecuting || fe == nullptr || fe->GetLocalVarTable() == nullptr ||
+            (fe->GetType() != eFuncTypeScript && !fe->UsesRegisteredStackFrame()))
+        {
+            continue;
+        }
+
+        // -- string arrays have their own storage, only scalars are stored on the stack
+        tVarTable* var_table = fe->GetLocalVarTable();
+        CVariableEntry* ve = var_table->First();
+        while (ve)
+        {
+            int32 word_index = entry.stackvaroffset + ve->GetStackOffset() * MAX_TYPE_SIZE;
+            if (ve->GetType() == TYPE_string && !ve->IsArray() && ve->GetStackOffset() >= 0 &&
+                entry.stackvaroffset >= 0 && word_index < stack_top)
+            {
+                uint32 string_hash = *(uint32*)execstack.GetStackVarAddr(entry.stackvaroffset, ve->GetStackOffset());
+                if (increment)
+                    string_table->RefCountIncrement(string_hash);
+                else
+                    string_table->RefCountDecrement(string_hash);
+            }
+            ve = var_table->Next();
+        }
+    }
+}
+
 // -- class CFunctionCallStack ----------------------------------------------------------------------------------------
 
 CFunctionCallStack::CFunctionCallStack(CExecStack* var_execstack)
@@ -370,7 +426,7 @@ CFunctionCallStack::~CFunctionCallStack()
         // -- clean the string table of unused strings
         if (TinScript::GetContext()->GetStringTable())
         {
-            TinScript::GetContext()->GetStringTable()->RemoveUnreferencedStrings();
+            TinScript::GetContext()->GetStringTable()->RemoveUnreferencedStrings(kStringTableRemoveBudget);
         }
 
         // -- as we've also completed the entire execution stack, now is a good time to reset all
@@ -453,6 +509,17 @@ CFunctionEntry* CFunctionCallStack::Pop(CObjectEntry*& objentry, int32& var_offs
 	return (m_functionEntryStack[--m_stacktop].funcentry);
 }
 
+// ====================================================================================================================
+// RestoreEntries():  Restores the function call entries captured from a suspended coroutine
+// ====================================================================================================================
+void CFunctionCallStack::RestoreEntries(const tFunctionCallEntry* entries, int32 count)
+{
+    assert(count >= 0 && count <= m_size);
+    for (int32 i = 0; i < count; ++i)
+        m_functionEntryStack[i] = entries[i];
+    m_stacktop = count;
+}
+
 // ====================================================================================================================
 // GetBreakExecutionFunctionCallEntry():  Get the function call entry from callstack, at the internal stack offset
 // ====================================================================================================================
@@ -801,7 +868,7 @@ int32 CFunctionCallStack::DebuggerGetStackVarEntries(CScriptContext* script_cont
 
 	// -- fill in the cached members
     // $$$TZA Arrays!  Support array return type...
-	cur_entry->mVarHash = Hash("__return");
+	cur_entry->mVarHash = HashLiteral_("__return");
 	cur_entry->mVarObjectID = 0;
     if (funcReturnType == TYPE_object)
     {
@@ -860,7 +927,7 @@ int32 CFunctionCallStack::DebuggerGetStackVarEntries(CScriptContext* script_cont
                 snprintf(cur_entry->mValue, sizeof(cur_entry->mValue), "%d", cur_entry->mFunctionObjectID);
 
                 // -- fill in the cached members
-                cur_entry->mVarHash = Hash("self");
+                cur_entry->mVarHash = HashLiteral_("self");
                 cur_entry->mVarObjectID = cur_entry->mFunctionObjectID;
             }
 
@@ -876,7 +943,7 @@ int32 CFunctionCallStack::DebuggerGetStackVarEntries(CScriptContext* script_cont
             while (ve)
             {
                 // -- the first variable is usually the "__return", which we handle separately
-                if (ve->GetHash() == Hash("__return"))
+                if (ve->GetHash() == HashLiteral_("__return"))
                 {
                     ve = func_vt->Next();
                     continue;
@@ -985,7 +1052,7 @@ bool CFunctionCallStack::FindExecutionStackVar(uint32 var_hash, CDebuggerWatchVa
         return false;
 
     // -- if this function call is a method, and we're requesting the "self" variable
-    if (func_call_entry->objentry != NULL && var_hash == Hash("self"))
+    if (func_call_entry->objentry != NULL && var_hash == HashLiteral_("self"))
     {
 		// -- clear the dynamic watch request ID
 		watch_entry.mWatchRequestID = 0;
@@ -1310,6 +1377,62 @@ CFunctionEntry* CFunctionCallStack::GetTopMethod(CObjectEntry*& objentry)
     return (NULL);
 }
 
+// ====================================================================================================================
+// CallRegisteredStackFrame():  Dispatch a registered function, whose args were assigned to the frame reserved on the
+// exec stack by OP_FuncCallArgs / OP_MethodCallArgs - since each call owns its frame, this is reentrant
+// ====================================================================================================================
+static bool8 CallRegisteredStackFrame(CFunctionEntry* fe, CObjectEntry* oe, CExecStack& execstack,
+                                      CFunctionCallStack& funccallstack)
+{
+    CObjectEntry* frame_oe = NULL;
+    int32 var_offset = 0;
+    funccallstack.GetTop(frame_oe, var_offset);
+
+    // -- copy the args out of the frame
+    CFunctionContext* func_context = fe->GetContext();
+    int32 arg_count = func_context->GetParameterCount() - 1;
+    tDispatchArg args[kMaxRegisteredParameterCount];
+    for (int32 i = 0; i < arg_count; ++i)
+    {
+        CVariableEntry* ve = func_context->GetParameter(i + 1);
+        void* stack_addr = execstack.GetStackVarAddr(var_offset, ve->GetStackOffset());
+        if (stack_addr == NULL)
+            return (false);
+
+        args[i].type = ve->GetType();
+        memcpy(args[i].value, stack_addr, sizeof(args[i].value));
+    }
+
+    // -- dispatch - the return value is pushed directly (void functions push a 0)
+    if (!fe->GetRegObject()->DispatchFromStack(oe ? oe->GetAddr() : NULL, args, execstack))
+        return (false);
+
+    // -- there's no OP_FuncReturn for a registered function - pop the function call stack
+    funccallstack.Pop(frame_oe, var_offset);
+
+    // -- pop the return value while we unreserve the frame
+    eVarType contenttype;
+    uint32 stacktopcontent[MAX_TYPE_SIZE];
+    void* content = execstack.Pop(contenttype);
+    memcpy(stacktopcontent, content, MAX_TYPE_SIZE * sizeof(uint32));
+
+    // -- restore the calling function's reserve, just as OP_FuncReturn does for a script function
+    CObjectEntry* prev_oe = NULL;
+    int32 prev_var_offset = 0;
+    int32 prev_stack_top_reserve = 0;
+    CFunctionEntry* prev_function = funccallstack.GetTop(prev_oe, prev_var_offset);
+    if (prev_function != NULL && prev_function->GetContext() != NULL)
+    {
+        int32 prev_local_space = prev_function->GetContext()->CalculateLocalVarStackSize();
+        prev_stack_top_reserve = prev_var_offset + (prev_local_space * MAX_TYPE_SIZE);
+    }
+
+    execstack.UnReserve(execstack.GetStackTop() - var_offset, prev_stack_top_reserve);
+    execstack.Push((void*)stacktopcontent, contenttype);
+
+    return (true);
+}
+
 // ====================================================================================================================
 // CodeBlockCallFunction():  Begin execution of a function, given the function entry and execution stacks.
 // ====================================================================================================================
@@ -1367,6 +1490,13 @@ bool8 CodeBlockCallFunction(CFunctionEntry* fe, CObjectEntry* oe, CExecStack& ex
         }
     }
 
+    // -- registered 'C' function, with the args assigned to its frame on the exec stack
+    else if (!copy_stack_parameters && fe->UsesRegisteredStackFrame())
+    {
+        if (!CallRegisteredStackFrame(fe, oe, execstack, funccallstack))
+            return (false);
+    }
+
     // -- registered 'C' function
     else if (fe->GetType() == eFuncTypeRegistered)
     {
@@ -1397,9 +1527,74 @@ bool8 CodeBlockCallFunction(CFunctionEntry* fe, CObjectEntry* oe, CExecStack& ex
         funccallstack.Pop(oe, var_offset);
     }
 
+    // -- an async function returned its pending handle - the calling script is suspended until it's completed
+    if (fe->IsAsync())
+        AsyncCallSuspend(TinScript::GetContext(), fe, execstack, funccallstack);
+
     return true;
 }
 
+// ====================================================================================================================
+// AsyncCallSuspend():  Suspends the calling script, given the handle returned by an async registered function.
+// -- the handle is left on the stack as the function's return value, and replaced by the result when resumed
+// ====================================================================================================================
+void AsyncCallSuspend(CScriptContext* script_context, CFunctionEntry* fe, CExecStack& execstack,
+                      CFunctionCallStack& funccallstack)
+{
+    // -- a handle of 0 means the call was never started (or completed immediately) - the 0 is the result
+    eVarType handle_type;
+    void* handle_addr = execstack.Peek(handle_type);
+    if (handle_addr == NULL || handle_type != TYPE_int || *(int32*)handle_addr == 0)
+        return;
+
+    // -- as with wait(), only a scheduled function can be suspended - the handle is simply returned, and its
+    // completion discarded
+    if (!funccallstack.IsResumable())
+    {
+        ScriptAssert_(script_context, 0, "<internal>", -1,
+                      "Error - async function %s() is only valid within a scheduled function - not awaited\n",
+                      UnHash(fe->GetHash()));
+        return;
+    }
+
+    // -- the result can't be assigned to an address outside the stack (e.g. obj.position.x = AsyncFn();), as the
+    // object may be destroyed before it's completed - the same as above, the handle is simply returned
+    eVarType address_type = TYPE_NULL;
+    if (!CCoroutine::CanSuspend(execstack, funccallstack, address_type))
+    {
+        ScriptAssert_(script_context, 0, "<internal>", -1,
+                      "Error - async function %s() with a pending %s address on the stack - not awaited\n",
+                      UnHash(fe->GetHash()), GetRegisteredTypeName(address_type));
+        return;
+    }
+
+    // -- the coroutine needs a frame for each Execute() level, one per function on the call stack
+    CCoroutine* coroutine = TinAlloc(ALLOC_Coroutine, CCoroutine, script_context, funccallstack.GetStackDepth(), 0);
+    coroutine->SetAsyncHandle(*(int32*)handle_addr);
+    funccallstack.BeginSuspend(coroutine);
+}
+
+// ====================================================================================================================
+// ReclaimTransientStrings():  Removes the unreferenced strings (e.g. intermediate values) at a loop's back edge.
+// -- otherwise they're only removed once the execution completes, so a loop building strings grows the string table
+// -- only while no other VM on this thread has a function call (e.g. a registered function calling back into script),
+// as the caller may still hold an unreferenced string's const char* (e.g. its own arguments)
+// -- values pushed on the stack hold a reference, but string locals don't, so they're referenced while we remove
+// ====================================================================================================================
+void ReclaimTransientStrings(CScriptContext* script_context, CExecStack& execstack, CFunctionCallStack& funccallstack)
+{
+    CStringTable* string_table = script_context->GetStringTable();
+    if (string_table == nullptr || string_table->GetDeleteListCount() < kStringTableTransientReclaimCount ||
+        !funccallstack.IsOnlyExecution())
+    {
+        return;
+    }
+
+    funccallstack.AddStackStringRefs(execstack, true);
+    string_table->RemoveUnreferencedStrings();
+    funccallstack.AddStackStringRefs(execstack, false);
+}
+
 // ====================================================================================================================
 // ExecuteCodeBlock():  Execute a code block, including immediate instructions and defining functions.
 // ====================================================================================================================
@@ -1416,7 +1611,7 @@ bool8 ExecuteCodeBlock(CCodeBlock& codeblock)
 // ExecuteScheduledFunction():  Execute a scheduled function.
 // ====================================================================================================================
 bool8 ExecuteScheduledFunction(CScriptContext* script_context, uint32 objectid, uint32 ns_hash, uint32 funchash,
-                               CFunctionContext* parameters)
+                               CFunctionContext* parameters, CScheduler* resume_scheduler)
 {
     // -- sanity check
     if (funchash == 0 && parameters == NULL)
@@ -1457,6 +1652,9 @@ bool8 ExecuteScheduledFunction(CScriptContext* script_context, uint32 objectid,
 	CExecStack execstack;
     CFunctionCallStack funccallstack(&execstack);
 
+    // -- a function dispatched by a scheduler may wait(), suspending this VM as a coroutine the scheduler resumes
+    funccallstack.SetResumable(resume_scheduler != nullptr);
+
     // -- nullvalue used to clear parameter values
     char nullvalue[MAX_TYPE_SIZE];
     memset(nullvalue, 0, MAX_TYPE_SIZE);
@@ -1536,6 +1734,16 @@ bool8 ExecuteScheduledFunction(CScriptContext* script_context, uint32 objectid,
         return false;
     }
 
+    // -- if the function called wait(), the VM has unwound without returning - the scheduler resumes it later
+    if (funccallstack.IsSuspending())
+    {
+        CCoroutine* coroutine = funccallstack.EndSuspend();
+        coroutine->Capture(execstack, funccallstack);
+        resume_scheduler->AddCoroutine(coroutine);
+        script_context->ResetAssertStack();
+        return (true);
+    }
+
     // -- because every function is required to push a value onto the stack, pop the stack and
     // -- copy it to the _return parameter of this scheduled function
     eVarType contenttype;
@@ -1602,6 +1810,148 @@ bool8 ExecuteScheduledFunction(CScriptContext* script_context, uint32 objectid,
     return (true);
 }
 
+// ====================================================================================================================
+// ResumeCoroutine():  Restore a suspended VM, and continue executing each frame, from the innermost out.
+// ====================================================================================================================
+bool8 ResumeCoroutine(CScheduler* scheduler, CCoroutine* coroutine)
+{
+    CScriptContext* script_context = scheduler->GetScriptContext();
+
+	// -- create the stack to use for the execution, and restore the suspended stacks
+	CExecStack execstack;
+    CFunctionCallStack funccallstack(&execstack);
+    funccallstack.SetResumable(true);
+    coroutine->Restore(execstack, funccallstack);
+
+    // -- each frame continues from where it unwound - when it returns, the frame it was called from continues,
+    // just as it would have, returning from OpExecFuncCall()
+    bool8 success = true;
+    bool8 suspended = false;
+    int32 frame_count = coroutine->GetFrameCount();
+    for (int32 i = 0; i < frame_count; ++i)
+    {
+        const CCoroutine::tFrame& frame = coroutine->GetFrame(i);
+        success = frame.mCodeBlock->Execute(frame.mInstrOffset, execstack, funccallstack);
+        if (!success)
+        {
+            if (funccallstack.mDebuggerFunctionReload == 0)
+            {
+                TinPrint(script_context, "Error - ResumeCoroutine(): Unable to resume function: %s()\n",
+                         frame.mCodeBlock->GetFileName());
+            }
+            break;
+        }
+
+        // -- waiting again - the new coroutine holds the frames that just unwound, and still needs the frames
+        // we haven't resumed yet
+        if (funccallstack.IsSuspending())
+        {
+            CCoroutine* next_coroutine = funccallstack.EndSuspend();
+            for (int32 j = i + 1; j < frame_count; ++j)
+                next_coroutine->AddFrame(coroutine->GetFrame(j));
+            next_coroutine->Capture(execstack, funccallstack);
+            scheduler->AddCoroutine(next_coroutine);
+            suspended = true;
+            break;
+        }
+    }
+
+    // -- the scheduled function has returned - discard its return value
+    if (success && !suspended)
+    {
+        eVarType contenttype;
+        execstack.Pop(contenttype);
+    }
+
+    TinFree(coroutine);
+    script_context->ResetAssertStack();
+    return (success);
+}
+
+// ====================================================================================================================
+// ExecuteLifecycleChain():  Execute an object's cached OnCreate()/OnDestroy() chain, all levels sharing one VM.
+// ====================================================================================================================
+bool8 ExecuteLifecycleChain(CScriptContext* script_context, CObjectEntry* oe, uint32 function_hash,
+                            const tLifecycleMethod* methods, int32 count)
+{
+    // -- sanity check
+    if (oe == nullptr || methods == nullptr || count <= 0)
+        return (false);
+
+    // -- the chain is copied, as it's owned by the namespace, and rebuilt (freeing the cached array) if any method
+    // defines a function or links a namespace
+    // -- note:  most hierarchies are shallow, so the copy is usually on the stack
+    const int32 k_localChainSize = 16;
+    tLifecycleMethod local_chain[k_localChainSize];
+    tLifecycleMethod* chain = count <= k_localChainSize ? local_chain
+                                                        : TinAllocArray(ALLOC_Namespace, tLifecycleMethod, count);
+    memcpy(chain, methods, sizeof(tLifecycleMethod) * count);
+
+    // -- create the stacks shared by every method in the chain
+    CExecStack execstack;
+    CFunctionCallStack funccallstack(&execstack);
+
+    // -- nullvalue used to clear parameter values
+    char nullvalue[MAX_TYPE_SIZE];
+    memset(nullvalue, 0, MAX_TYPE_SIZE);
+
+    // -- if any method defines a function or links a namespace, the cached chain is rebuilt, so from then on,
+    // we look up each remaining method (namespaces are never deleted while objects exist)
+    uint32 object_id = oe->GetID();
+    uint32 generation = script_context->GetLifecycleGeneration();
+    bool8 success = true;
+    for (int32 i = 0; i < count; ++i)
+    {
+        CNamespace* ns = chain[i].ns;
+        CFunctionEntry* fe = chain[i].fe;
+        if (generation != script_context->GetLifecycleGeneration())
+        {
+            fe = ns->GetFuncTable()->FindItem(function_hash);
+            if (fe == nullptr)
+                continue;
+        }
+
+        // -- lifecycle methods have no arguments, but the context parameters must still be cleared
+        int32 paramcount = fe->GetContext()->GetParameterCount();
+        for (int32 p = 0; p < paramcount; ++p)
+            fe->GetContext()->GetParameter(p)->SetValue(NULL, nullvalue);
+
+        // -- push the function entry onto the call stack (same as if OP_FuncCallArgs had been used)
+        funccallstack.Push(fe, oe, 0);
+        if (fe->GetType() != eFuncTypeRegistered)
+        {
+            int32 localvarcount = fe->GetContext()->CalculateLocalVarStackSize();
+            execstack.Reserve(localvarcount * MAX_TYPE_SIZE);
+        }
+        funccallstack.BeginExecution();
+
+        // -- call the function - a failure leaves the stacks in an unknown state, so the chain is aborted
+        eVarType contenttype;
+        if (!CodeBlockCallFunction(fe, oe, execstack, funccallstack, true) || !execstack.Pop(contenttype))
+        {
+            if (funccallstack.mDebuggerFunctionReload == 0)
+            {
+                ScriptAssert_(script_context, 0, "<internal>", -1, "Error - [%d] Object method %s::%s() failed\n",
+                              object_id, UnHash(ns->GetHash()), UnHash(function_hash));
+            }
+            success = false;
+            break;
+        }
+
+        // -- the object may have destroyed itself
+        if (script_context->FindObjectEntry(object_id) != oe)
+            break;
+    }
+
+    if (chain != local_chain)
+        TinFreeArray(chain);
+
+    // -- there was no assert, but still...
+    script_context->ResetAssertStack();
+
+    return (success);
+}
+
 // ====================================================================================================================
 // GetOpExecFunction():  Get the function pointer from the table tied to the enum of operations.
 // ====================================================================================================================
@@ -1807,6 +2157,9 @@ bool8 DebuggerBreakLoop(CCodeBlock* cb, const uint32* instrptr, CExecStack& exec
         // -- or sends a message to step or run
         script_context->ProcessThreadCommands();
 
+        // -- objects created or destroyed by commands (e.g. from the console) still notify the debugger
+        script_context->GetDebuggerSync()->Update();
+
         // -- if either mDebuggerBreakStep or mDebuggerBreakRun was set, exit the loop
         if (script_context->mDebuggerActionStep || script_context->mDebuggerActionRun)
         {
@@ -2107,6 +2460,13 @@ bool8 CCodeBlock::Execute(uint32 offset, CExecStack& execstack, CFunctionCallSta
             return (false);
         }
 
+        // -- if the op suspended the VM (wait()), unwind, recording where each level resumes
+        if (funccallstack.IsSuspending())
+        {
+            funccallstack.GetSuspending()->AddFrame(this, instrptr);
+            return (true);
+        }
+
         // -- two notable exceptions - if the curoperation was either OP_FuncReturn or OP_EOF,
         // -- we're finished executing this codeblock
         if (curoperation == OP_FuncReturn || curoperation == OP_EOF)
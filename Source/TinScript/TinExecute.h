@@ -36,6 +36,11 @@
 namespace TinScript
 {
 
+// -- forward declarations
+struct tLifecycleMethod;
+class CCoroutine;
+class CScheduler;
+
 //  DebugPrintVar(): helper function for dumping variables/values during execution
 const char* DebugPrintVar(void* addr, eVarType vartype, bool dump_stack = false);
 
@@ -97,6 +102,24 @@ class CFunctionCallStack
             return (m_stacktop);
         }
 
+        // -- coroutine support:  only the VM executing a scheduled function can be suspended by wait()
+        // -- OP_Wait begins the suspend, and each Execute() level returns, recording its frame in the coroutine
+        void SetResumable(bool8 resumable) { mIsResumable = resumable; }
+        bool8 IsResumable() const { return (mIsResumable); }
+        void BeginSuspend(CCoroutine* coroutine) { mSuspending = coroutine; }
+        bool8 IsSuspending() const { return (mSuspending != nullptr); }
+        CCoroutine* GetSuspending() const { return (mSuspending); }
+        CCoroutine* EndSuspend()
+        {
+            CCoroutine* coroutine = mSuspending;
+            mSuspending = nullptr;
+            return (coroutine);
+        }
+
+        // -- the entries are copied out when a coroutine is captured, and copied back to resume it
+        const tFunctionCallEntry* GetEntry(int32 index) const { return (&m_functionEntryStack[index]); }
+        void RestoreEntries(const tFunctionCallEntry* entries, int32 count);
+
         void DebuggerUpdateStackTopCurrentLine(uint32 cur_codeblock, int32 cur_line);
 
         int32 DebuggerGetCallstack(uint32* codeblock_array, uint32* objid_array,
@@ -168,6 +191,13 @@ class CFunctionCallStack
         static bool NotifyBranchInstruction(const uint32* from_instr);
         static void ClearBranchTracking();
 
+        // -- true if no other function call stack on this thread has an entry (e.g. a registered function calling
+        // back into script, or an object's OnCreate())
+        bool8 IsOnlyExecution() const;
+
+        // -- string locals on the stack aren't reference counted - this adds (or removes) their references
+        void AddStackStringRefs(CExecStack& execstack, bool8 increment) const;
+
 	private:
         CExecStack* m_varExecStack = nullptr;
         char m_functionStackStorage[sizeof(tFunctionCallEntry) * kExecFuncCallDepth];
@@ -175,6 +205,9 @@ class CFunctionCallStack
 		int32 m_size;
 		int32 m_stacktop;
 
+        bool8 mIsResumable = false;
+        CCoroutine* mSuspending = nullptr;
+
 		// -- we need to keep track of the full script callstack
 		// note:  lots of things execute functions with their own independent CFunctionCallStack
 		// (e.g. schedules, conditionals, watches, etc...)...
@@ -190,9 +223,16 @@ class CFunctionCallStack
 
 bool8 ExecuteCodeBlock(CCodeBlock& codeblock);
 bool8 ExecuteScheduledFunction(CScriptContext* script_context, uint32 objectid, uint32 ns_hash, uint32 funchash,
-                               CFunctionContext* parameters);
+                               CFunctionContext* parameters, CScheduler* resume_scheduler = nullptr);
+bool8 ResumeCoroutine(CScheduler* scheduler, CCoroutine* coroutine);
+bool8 ExecuteLifecycleChain(CScriptContext* script_context, CObjectEntry* oe, uint32 function_hash,
+                            const tLifecycleMethod* methods, int32 count);
 bool8 CodeBlockCallFunction(CFunctionEntry* fe, CObjectEntry* oe, CExecStack& execstack,
                             CFunctionCallStack& funccallstack, bool copy_stack_parameters);
+void AsyncCallSuspend(CScriptContext* script_context, CFunctionEntry* fe, CExecStack& execstack,
+                      CFunctionCallStack& funccallstack);
+void ReclaimTransientStrings(CScriptContext* script_context, CExecStack& execstack,
+                             CFunctionCallStack& funccallstack);
 
 bool8 DebuggerWaitForConnection(CScriptContext* script_context, const char* assert_msg);
 
@@ -31,6 +31,7 @@
 #include "TinCompile.h"
 #include "TinExecute.h"
 #include "TinRegistration.h"
+#include "TinScheduler.h"
 
 namespace TinScript
 {
@@ -340,6 +341,52 @@ bool CFunctionContext::InitDefaultArgs(CFunctionEntry* fe)
     return true;
 }
 
+// ====================================================================================================================
+// InitDefaultStackArgs():  For registered functions using a stack frame, the reserved frame is already zeroed, we
+// only need to copy in the default values
+// ====================================================================================================================
+bool CFunctionContext::InitDefaultStackArgs(CFunctionEntry* fe, CExecStack& execstack, int32 stacktop)
+{
+    // -- sanity check
+    if (fe == nullptr)
+        return false;
+
+    CRegDefaultArgValues* default_args = fe->GetRegObject() ? fe->GetRegObject()->GetDefaultArgValues() : nullptr;
+    if (default_args == nullptr)
+        return true;
+
+    // -- initialize the input parameters (starting at 1, since param 0 is the return value)
+    for (int32 i = 1; i < GetParameterCount(); ++i)
+    {
+        CVariableEntry* ve = GetParameter(i);
+        const char* default_arg_name = nullptr;
+        eVarType default_arg_type = TYPE_COUNT;
+        void* default_arg_value = nullptr;
+        if (!default_args->GetDefaultArgValue(i, default_arg_name, default_arg_type, default_arg_value))
+            continue;
+
+        if (ve->GetType() != default_arg_type)
+        {
+            TinPrint(TinScript::GetContext(), "Error - %s(): InitDefaultStackArgs() - default arg %d is a different type\n",
+                TinScript::UnHash(fe->GetHash()), i);
+            return false;
+        }
+
+        void* stack_addr = execstack.GetStackVarAddr(stacktop, ve->GetStackOffset());
+        if (stack_addr == nullptr)
+            return false;
+
+        // -- script values for strings are always the hash, and like all stack vars, are not ref counted
+        if (default_arg_type == TYPE_string)
+            *(uint32*)stack_addr = Hash(*(const char**)default_arg_value);
+        else
+            memcpy(stack_addr, default_arg_value, gRegisteredTypeSize[default_arg_type]);
+    }
+
+    // -- success
+    return true;
+}
+
 // ====================================================================================================================
 // InitStackVarOffsets():  Initialize the offset where the memory for a local variable can be found.
 // ====================================================================================================================
@@ -442,6 +489,7 @@ CFunctionEntry::CFunctionEntry(uint32 _nshash, const char* _name, uint32 _hash,
     mCodeblock = NULL;
     mInstrOffset = 0;
     mRegObject = NULL;
+    mUsesStackFrame = false;
 }
 
 // ====================================================================================================================
@@ -456,6 +504,7 @@ CFunctionEntry::CFunctionEntry(uint32 _nshash, const char* _name, uint32 _hash,
     mCodeblock = NULL;
     mInstrOffset = 0;
     mRegObject = _func;
+    mUsesStackFrame = false;
 }
 
 // ====================================================================================================================
@@ -467,6 +516,14 @@ CFunctionEntry::~CFunctionEntry()
     // abort execution... this is legitimate for reloading scripts at, say, a breakpoint
     CFunctionCallStack::NotifyFunctionDeleted(this);
 
+    // -- cached OnCreate()/OnDestroy() chains must not reference a deleted function
+    if (TinScript::GetContext() != nullptr)
+        TinScript::GetContext()->InvalidateLifecycleChains();
+
+    // -- as are suspended coroutines executing this function
+    if (TinScript::GetContext() != nullptr && TinScript::GetContext()->GetScheduler() != nullptr)
+        TinScript::GetContext()->GetScheduler()->NotifyFunctionDeleted(this);
+
     // -- notify the codeblock that this entry no longer exists
     if (mCodeblock)
     {
@@ -542,6 +599,22 @@ CRegFunctionBase* CFunctionEntry::GetRegObject()
     return mRegObject;
 }
 
+// ====================================================================================================================
+// UsesRegisteredStackFrame():  Returns true if this is a registered function whose args are stored on the exec stack.
+// ====================================================================================================================
+bool8 CFunctionEntry::UsesRegisteredStackFrame()
+{
+    return (mType == eFuncTypeRegistered && mUsesStackFrame);
+}
+
+// ====================================================================================================================
+// IsAsync():  Returns true if this is a registered function returning a pending handle, registered as async.
+// ====================================================================================================================
+bool8 CFunctionEntry::IsAsync()
+{
+    return (mType == eFuncTypeRegistered && mRegObject != nullptr && mRegObject->IsAsync());
+}
+
 }  // TinScript
 
 // ====================================================================================================================
@@ -58,6 +58,7 @@ public:
     bool8 IsParameter(CVariableEntry* ve);
     void ClearParameters();
     bool InitDefaultArgs(CFunctionEntry* fe);
+    bool InitDefaultStackArgs(CFunctionEntry* fe, CExecStack& execstack, int32 stacktop);
     void InitStackVarOffsets(CFunctionEntry* fe);
 
     void SetIsPODMethod() { m_isPODMethod = true; }
@@ -69,11 +70,9 @@ public:
     uint32 CalcHash();
 
     // -- use a variadic template to calculate the hash of a variable signature
+    // -- the primary template terminates the recursion (the empty signature)
     template <typename... T>
-    struct SignatureHash;
-
-    template <>
-    struct SignatureHash <>
+    struct SignatureHash
     {
         static uint32 calculate(uint32 cur_hash)
         {
@@ -155,6 +154,9 @@ public:
     eVarType GetReturnType();
     tVarTable* GetLocalVarTable();
     CRegFunctionBase* GetRegObject();
+    bool8 UsesRegisteredStackFrame();
+    void SetUsesRegisteredStackFrame() { mUsesStackFrame = true; }
+    bool8 IsAsync();
 
 private:
     char mName[kMaxNameLength];
@@ -169,6 +171,9 @@ private:
     CFunctionContext mContext;
 
     CRegFunctionBase* mRegObject;
+
+    // -- decided once, for this context's entry, when the registered function is registered
+    bool8 mUsesStackFrame;
 };
 
 } // namespace TinScript
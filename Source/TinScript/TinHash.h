@@ -34,6 +34,7 @@
 #include "stdio.h"
 
 #include "integration.h"
+#include "TinMemory.h"
 
 // == namespace Tinscript =============================================================================================
 
@@ -49,9 +50,89 @@ CScriptContext* GetContext();
 // ====================================================================================================================
 // -- implemented in TinScript.cpp
 uint32 Hash(const char *s, int32 length = -1, bool add_to_table = true);
+uint32 HashValue(const char *s, int32 length = -1);
 uint32 HashAppend(uint32 h, const char *string, int32 length = -1);
 const char* UnHash(uint32 hash);
 
+// ====================================================================================================================
+// HashLiteral():  A constexpr implementation of HashValue(), so string literals can be hashed at compile time.
+// -- the result must be identical to HashValue(), including the case insensitive conversion
+// ====================================================================================================================
+constexpr uint8 HashLiteralChar(uint8 c)
+{
+    return ((!CASE_SENSITIVE && c >= 'A' && c <= 'Z') ? (uint8)('z' + (c - 'A')) : c);
+}
+
+constexpr uint32 HashLiteralAppend(uint32 h, const char* s)
+{
+    return (s[0] == '\0' ? h : HashLiteralAppend(((h << 5) + h) + HashLiteralChar((uint8)s[0]), s + 1));
+}
+
+constexpr uint32 HashLiteral(const char* s)
+{
+    return ((s == nullptr || s[0] == '\0') ? 0 : HashLiteralAppend(5381, s));
+}
+
+// -- literals hashed with HashLiteral_() by the engine, added to the string table at startup, so they can be UnHash()'d
+// -- (HashLiteral_() static_asserts its literal is in this list)
+#define HashLiteralTuple                        \
+    HashLiteralEntry("__return")                \
+    HashLiteralEntry("self")                    \
+    HashLiteralEntry("OnCreate")                \
+    HashLiteralEntry("OnDestroy")               \
+    HashLiteralEntry("VOID")                    \
+    HashLiteralEntry("CScriptObject")           \
+    HashLiteralEntry("CObjectSet")              \
+    HashLiteralEntry("CObjectGroup")            \
+    HashLiteralEntry("CGroupIterator")          \
+    HashLiteralEntry("CHashtable")              \
+    HashLiteralEntry("TYPE_vector3f")           \
+    HashLiteralEntry("TYPE_vector4f")           \
+    HashLiteralEntry("TYPE_quat")               \
+    HashLiteralEntry("x")                       \
+    HashLiteralEntry("y")                       \
+    HashLiteralEntry("z")                       \
+    HashLiteralEntry("w")                       \
+    HashLiteralEntry("_p1")                     \
+    HashLiteralEntry("_p2")                     \
+    HashLiteralEntry("_p3")                     \
+    HashLiteralEntry("_p4")                     \
+    HashLiteralEntry("_p5")                     \
+    HashLiteralEntry("_p6")                     \
+    HashLiteralEntry("_p7")                     \
+    HashLiteralEntry("_p8")                     \
+    HashLiteralEntry("_p9")                     \
+    HashLiteralEntry("_p10")                    \
+    HashLiteralEntry("_p11")                    \
+    HashLiteralEntry("_p12")                    \
+    HashLiteralEntry("<stdin>")                 \
+
+// -- true if the hash is one of the HashLiteralTuple entries
+constexpr bool IsHashLiteralRegistered(uint32 h)
+{
+    #define HashLiteralEntry(s) HashLiteral(s) == h ||
+    return (HashLiteralTuple false);
+    #undef HashLiteralEntry
+}
+
+// -- the template argument forces the hash to be evaluated at compile time
+template <uint32 H>
+struct tHashLiteral
+{
+    static const uint32 value = H;
+};
+
+template <uint32 H>
+struct tListedHashLiteral : public tHashLiteral<H>
+{
+    static_assert(IsHashLiteralRegistered(H), "HashLiteral_() - the literal must be added to HashLiteralTuple");
+};
+
+#define HashLiteral_(s) (::TinScript::tListedHashLiteral< ::TinScript::HashLiteral(s)>::value)
+
+// -- for literals the caller adds to the string table itself (e.g. registered members), so need not be listed
+#define HashLiteralUnlisted_(s) (::TinScript::tHashLiteral< ::TinScript::HashLiteral(s)>::value)
+
 // ====================================================================================================================
 // class CHashTable:  This class is used for *all* TinScript hash tables, of any type.
 // Regardless of the content type being stored, this hash table only allows pointers (to that type).
@@ -43,7 +43,7 @@ namespace TinScript
 
 // -- we need to keep track of the association between CHashtable instances, and the CVariableEntry hashtables
 // being wrapped
-_declspec(thread) CHashTable<CHashtable>* gWrappedHashtablesMap = nullptr;
+thread_local CHashTable<CHashtable>* gWrappedHashtablesMap = nullptr;
 
 void CHashtable::NotifyHashtableWrapped(CVariableEntry* ve, CHashtable* wrapper)
 {
@@ -100,33 +100,6 @@ class CHashtable
             }
         }
 
-        template <>
-        bool GetValue(const char* key, const char*& out_string)
-        {
-            // see if we can get a value for a given key
-            if (key == nullptr || key[0] == '\0')
-                return false;
-
-            // -- get the internal hashtable (the *actual* hashtable that this class wraps)
-            tVarTable* hashtable = (tVarTable*)mHashtableVE->GetAddr(nullptr);
-
-            // -- see if this hashtable already has an entry for the given key
-            uint32 key_hash = Hash(key);
-            CVariableEntry* hte = hashtable->FindItem(key_hash);
-            if (hte == nullptr)
-                return false;
-
-            // -- get the value, and see if we convert it to the appropriate type
-            void* source_addr = hte->GetAddr(nullptr);
-            void* converted_val = TypeConvert(TinScript::GetContext(), hte->GetType(), source_addr, TYPE_string);
-            if (converted_val == nullptr)
-                return false;
-
-            // -- theoretically, we've got our type!
-            out_string = (const char*)UnHash(*(uint32*)converted_val);
-            return true;
-        }
-
         static bool CopyHashtableVEToVe(const CVariableEntry* src_ve, CVariableEntry* dest_ve);
 
         // -- add an entry to a CHashtable from C++
@@ -224,6 +197,34 @@ class CHashtable
         bool mHashtableIsInternal = true;
 };
 
+// -- string values are returned as the string table entry
+template <>
+inline bool CHashtable::GetValue<const char*>(const char* key, const char*& out_string)
+{
+    // see if we can get a value for a given key
+    if (key == nullptr || key[0] == '\0')
+        return false;
+
+    // -- get the internal hashtable (the *actual* hashtable that this class wraps)
+    tVarTable* hashtable = (tVarTable*)mHashtableVE->GetAddr(nullptr);
+
+    // -- see if this hashtable already has an entry for the given key
+    uint32 key_hash = Hash(key);
+    CVariableEntry* hte = hashtable->FindItem(key_hash);
+    if (hte == nullptr)
+        return false;
+
+    // -- get the value, and see if we convert it to the appropriate type
+    void* source_addr = hte->GetAddr(nullptr);
+    void* converted_val = TypeConvert(TinScript::GetContext(), hte->GetType(), source_addr, TYPE_string);
+    if (converted_val == nullptr)
+        return false;
+
+    // -- theoretically, we've got our type!
+    out_string = (const char*)UnHash(*(uint32*)converted_val);
+    return true;
+}
+
 }
 
 // ====================================================================================================================
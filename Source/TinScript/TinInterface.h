@@ -37,7 +37,8 @@ namespace TinScript
 // ====================================================================================================================
 // CreateContext():  Creates a singleton context, max of one for each thread
 // ====================================================================================================================
-CScriptContext* CreateContext(TinPrintHandler printhandler, TinAssertHandler asserthandler, bool is_main_thread);
+CScriptContext* CreateContext(TinPrintHandler printhandler, TinAssertHandler asserthandler, bool is_main_thread,
+                              CScriptAllocator* allocator = NULL);
 
 // ====================================================================================================================
 // UpdateContext():  Updates the singleton context in the calling thread
@@ -91,6 +92,11 @@ bool8 ExecScript(const char* filename, bool allow_no_exist = false);
 // ====================================================================================================================
 void SetTimeScale(float time_scale);
 
+// ====================================================================================================================
+// SetScheduleBudget():  Limits the time (microseconds) spent dispatching schedules each frame, 0 for unlimited
+// ====================================================================================================================
+void SetScheduleBudget(int32 budget_us, int32 max_deferral_frames = kScheduleMaxDeferralFrames);
+
 // ====================================================================================================================
 // ExecResult():  Pass the value returned by a script function back to code
 // ====================================================================================================================
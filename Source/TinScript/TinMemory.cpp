@@ -26,6 +26,11 @@
 // -- includes --------------------------------------------------------------------------------------------------------
 
 #include "TinMemory.h"
+
+// -- lib includes
+#include <cstddef>
+#include <mutex>
+
 #include "TinStringTable.h"
 #include "TinScript.h"
 #include "TinInterface.h"
@@ -40,7 +45,12 @@ namespace TinScript
 
 // -- thread singleton ------------------------------------------------------------------------------------------------
 
-_declspec(thread) CMemoryTracker* g_memoryTrackerInstance = nullptr;
+thread_local CMemoryTracker* g_memoryTrackerInstance = nullptr;
+thread_local CScriptAllocator* g_threadAllocator = nullptr;
+
+// -- guards the list of live allocators, and (if MEMORY_CHECK_REMOTE_FREE) queuing a remote free against Release()
+static std::mutex g_liveAllocatorLock;
+static uint32 g_allocatorGeneration = 0;
 
 // -- create the string table of allocation type names
 const char* g_allocationTypeNames[] =
@@ -57,14 +67,9 @@ const char* g_allocationTypeNames[] =
 // ====================================================================================================================
 CMemoryTracker::CMemoryTracker()
 {
-    // -- initialize the array of allocations
-    for (int32 i = 0; i < AllocType_Count; ++i)
-        m_allocationTotals[i] = 0;
-
     // -- initialize our untracked hash tables
     for (int i = 0; i < k_trackedAllocationTableSize; ++i)
     {
-        m_allocationTable[i] = nullptr;
         m_objectCreatedTable[i] = nullptr;
         m_objectCreatedFileLineTable[i] = nullptr;
     }
@@ -75,17 +80,9 @@ CMemoryTracker::CMemoryTracker()
 // ====================================================================================================================
 CMemoryTracker::~CMemoryTracker()
 {
-    // -- destroy the entries in the allocation table
+    // -- destroy the entries in the object tables
     for (int i = 0; i < k_trackedAllocationTableSize; ++i)
     {
-        tAllocEntry* alloc_entry = m_allocationTable[i];
-        while (alloc_entry != nullptr)
-        {
-            tAllocEntry* next = alloc_entry->next;
-            delete alloc_entry;
-            alloc_entry = next;
-        }
-
         tObjectCreateEntry* object_entry = m_objectCreatedTable[i];
         while (object_entry != nullptr)
         {
@@ -132,92 +129,78 @@ void CMemoryTracker::Shutdown()
 }
 
 // ====================================================================================================================
-// Alloc():  If the system is enabled, this is a wrapper to allocate memory, and add track it in the allocation tables.
+// SetThreadAllocator():  Set the allocator used for all TinAlloc() calls from this thread (owned by the context).
+// ====================================================================================================================
+void CMemoryTracker::SetThreadAllocator(CScriptAllocator* allocator)
+{
+    g_threadAllocator = allocator;
+}
+
+// ====================================================================================================================
+// GetThreadAllocator():  Returns the allocator used for all TinAlloc() calls from this thread.
+// ====================================================================================================================
+CScriptAllocator* CMemoryTracker::GetThreadAllocator()
+{
+    return (g_threadAllocator);
+}
+
+// ====================================================================================================================
+// Alloc():  Allocate from the thread's context allocator, preceded by a header identifying the owner, size and type.
 // ====================================================================================================================
 void* CMemoryTracker::Alloc(eAllocType alloc_type, int32 size)
 {
-   
     if (size == 0)
     {
         return nullptr;
     }
-    
-    // -- ensure we've been initialized
-    void* addr = ::operator new(size);
 
-    // -- if this is not the main thread, don't track the allocation
-    if (TinScript::GetContext() == nullptr || !TinScript::GetContext()->IsMainThread())
-        return (addr);
+    // -- if there is no context on this thread (or it's not yet initialized), allocate from the heap
+    CScriptAllocator* allocator = g_threadAllocator;
+    if (allocator != nullptr)
+        return (allocator->Alloc(alloc_type, size));
 
-    // -- if the memory tracker hasn't yet been initialized, it's because
-    // -- we're performing allocations during context initialization
-    if (g_memoryTrackerInstance == nullptr)
-        Initialize();
+    return (AllocShared(alloc_type, size));
+}
 
-    // -- add the address to the table
-    tAllocEntry* alloc_entry = new tAllocEntry(alloc_type, addr, size);
-    uint32 hash = kPointerToUInt32(addr);
-    int32 bucket = hash % k_trackedAllocationTableSize;
-    alloc_entry->next = g_memoryTrackerInstance->m_allocationTable[bucket];
-    g_memoryTrackerInstance->m_allocationTable[bucket] = alloc_entry;
+// ====================================================================================================================
+// AllocShared():  Allocate from the heap, not owned by any context, so the memory may be freed from any thread.
+// ====================================================================================================================
+void* CMemoryTracker::AllocShared(eAllocType alloc_type, int32 size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
 
-    // -- update the allocation total
-    g_memoryTrackerInstance->m_allocationTotals[alloc_type] += size;
+    tAllocHeader* header = reinterpret_cast<tAllocHeader*>(::operator new(kAllocHeaderSize + size));
+    header->allocator = nullptr;
+    header->size = size;
+    header->alloc_type = alloc_type;
+#if MEMORY_CHECK_REMOTE_FREE
+    header->generation = 0;
+#endif
 
-    return (addr);
+    return (reinterpret_cast<char*>(header) + kAllocHeaderSize);
 }
 
 // ====================================================================================================================
-// Free():  If enabled, this wrapper updates the allocation tables
+// Free():  Return the memory to the allocator that owns it.
 // ====================================================================================================================
 void CMemoryTracker::Free(void* addr)
 {
-    // -- if we have no memory tracker, we're done
-    if (g_memoryTrackerInstance == nullptr)
+    if (addr == nullptr)
         return;
 
-    // -- find and remove the allocation entry
-    uint32 hash = kPointerToUInt32(addr);
-    int32 bucket = hash % k_trackedAllocationTableSize;
-
-    // -- note:  the CMemoryTracker lives in the main thread - however, any allocation from
-    // -- the socket thread will not be tracked - but it could be freed from the main thread
-    // -- causing alloc_entry to be null
-    if (g_memoryTrackerInstance->m_allocationTable[bucket] == nullptr)
-        return;
+    tAllocHeader* header = reinterpret_cast<tAllocHeader*>(reinterpret_cast<char*>(addr) - kAllocHeaderSize);
+    if (header->allocator == nullptr)
+        ::operator delete(header);
 
-    tAllocEntry* alloc_entry = nullptr;
-    if (kPointerToUInt32(g_memoryTrackerInstance->m_allocationTable[bucket]->addr) == hash)
-    {
-        alloc_entry = g_memoryTrackerInstance->m_allocationTable[bucket];
-        g_memoryTrackerInstance->m_allocationTable[bucket] = alloc_entry->next;
-    }
+    // -- note:  memory can be allocated on one thread, and freed from another (e.g. the socket thread)
+    // -- the allocator is not thread safe, so the owner will free the block on its next allocation
+    else if (header->allocator != g_threadAllocator)
+        CScriptAllocator::QueueRemoteFree(header);
     else
-    {
-        tAllocEntry* alloc_prev = g_memoryTrackerInstance->m_allocationTable[bucket];
-        while (alloc_prev->next != nullptr && kPointerToUInt32(alloc_prev->next->addr) != hash)
-            alloc_prev = alloc_prev->next;
-
-        // -- if we found our allocation, remove it from the list
-        if (alloc_prev->next != nullptr)
-        {
-            alloc_entry = alloc_prev->next;
-            alloc_prev->next = alloc_prev->next->next;
-        }
-    }
-
-    if (alloc_entry == nullptr)
-        return;
-
-    // -- update the allocation total
-    g_memoryTrackerInstance->m_allocationTotals[alloc_entry->type] -= alloc_entry->size;
-    if (g_memoryTrackerInstance->m_allocationTotals[alloc_entry->type] < 0)
-    {
-        Assert_(g_memoryTrackerInstance->m_allocationTotals[alloc_entry->type] >= 0);
-    }
-
-    // -- delete the entry
-    delete alloc_entry;
+        header->allocator->Free(header);
 }
 
 // ====================================================================================================================
@@ -421,19 +404,20 @@ bool8 CMemoryTracker::GetCreatedCallstack(uint32 object_id, int32& out_stack_siz
 // ====================================================================================================================
 void CMemoryTracker::DumpTotals()
 {
-    // -- nothing to do if the memory tracker isn't enabled
-    if (g_memoryTrackerInstance == nullptr)
+    // -- the totals are tracked by the context allocator
+    if (g_threadAllocator == nullptr)
     {
-        TinPrint(TinScript::GetContext(),
-                 "Not available: #define MEMORY_TRACKER_ENABLE 1, in integration.h");
+        TinPrint(TinScript::GetContext(), "Not available: no allocator for this thread's context\n");
         return;
     }
 
-    // -- print the totals from the table
+    // -- print the totals for each allocation type
     for (int32 i = 0; i < AllocType_Count; ++i)
     {
-        TinPrint(TinScript::GetContext(), "%s: %d\n", g_allocationTypeNames[i],
-                 g_memoryTrackerInstance->m_allocationTotals[i])
+        eAllocType alloc_type = (eAllocType)i;
+        TinPrint(TinScript::GetContext(), "%s: %d bytes, %d allocations (peak %d bytes)\n",
+                 g_allocationTypeNames[i], g_threadAllocator->GetAllocationTotal(alloc_type),
+                 g_threadAllocator->GetAllocationCount(alloc_type), g_threadAllocator->GetAllocationPeak(alloc_type));
     }
 }
 
@@ -516,6 +500,407 @@ void CMemoryTracker::FindObject(const char* object_name)
     }
 }
 
+// == class CMemoryPool ===============================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CMemoryPool::CMemoryPool(eAllocType alloc_type, int32 element_size, int32 slab_count, bool8 tracked)
+{
+    // -- every element must be large enough to hold the free list link, and we keep the elements
+    // aligned, since they're used to construct arbitrary registered classes
+    const int32 alignment = static_cast<int32>(alignof(std::max_align_t));
+    if (element_size < static_cast<int32>(sizeof(tFreeElement)))
+        element_size = static_cast<int32>(sizeof(tFreeElement));
+
+    m_allocType = alloc_type;
+    m_tracked = tracked;
+    m_elementSize = (element_size + alignment - 1) & ~(alignment - 1);
+    m_slabCount = slab_count > 0 ? slab_count : 1;
+    m_slabHeaderSize = (static_cast<int32>(sizeof(tSlab)) + alignment - 1) & ~(alignment - 1);
+
+    m_used = 0;
+    m_capacity = 0;
+    m_freeList = nullptr;
+    m_slabList = nullptr;
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CMemoryPool::~CMemoryPool()
+{
+    // -- the pool owns the memory, not the instances - any element still in use is simply released
+    tSlab* slab = m_slabList;
+    while (slab != nullptr)
+    {
+        tSlab* next = slab->next;
+        void* slab_addr = (void*)slab;
+        if (m_tracked)
+            CMemoryTracker::Free(slab_addr);
+        else
+            ::operator delete(slab_addr);
+        slab = next;
+    }
+}
+
+// ====================================================================================================================
+// AllocSlab():  Allocate a new slab of elements, and push them all onto the free list.
+// ====================================================================================================================
+bool8 CMemoryPool::AllocSlab()
+{
+    int32 slab_size = m_slabHeaderSize + (m_elementSize * m_slabCount);
+    // -- an untracked pool is used by the allocator itself, and must come straight from the heap
+    void* slab_addr = m_tracked ? CMemoryTracker::Alloc(m_allocType, slab_size) : ::operator new(slab_size);
+    tSlab* slab = reinterpret_cast<tSlab*>(slab_addr);
+    if (slab == nullptr)
+        return (false);
+
+    slab->next = m_slabList;
+    m_slabList = slab;
+
+    // -- push the elements in reverse, so allocations are handed out in address order
+    char* element_base = reinterpret_cast<char*>(slab) + m_slabHeaderSize;
+    for (int32 i = m_slabCount - 1; i >= 0; --i)
+    {
+        tFreeElement* element = reinterpret_cast<tFreeElement*>(element_base + (i * m_elementSize));
+        element->next = m_freeList;
+        m_freeList = element;
+    }
+
+    m_capacity += m_slabCount;
+    return (true);
+}
+
+// ====================================================================================================================
+// Alloc():  Pop an element from the free list, allocating a new slab as required.
+// ====================================================================================================================
+void* CMemoryPool::Alloc()
+{
+    if (m_freeList == nullptr && !AllocSlab())
+        return (nullptr);
+
+    tFreeElement* element = m_freeList;
+    m_freeList = element->next;
+    ++m_used;
+
+    return (element);
+}
+
+// ====================================================================================================================
+// Free():  Push an element back onto the free list.
+// ====================================================================================================================
+void CMemoryPool::Free(void* addr)
+{
+    if (addr == nullptr)
+        return;
+
+    Assert_(m_used > 0);
+    tFreeElement* element = reinterpret_cast<tFreeElement*>(addr);
+    element->next = m_freeList;
+    m_freeList = element;
+    --m_used;
+}
+
+// == class CScriptAllocator ==========================================================================================
+
+CScriptAllocator* CScriptAllocator::g_liveList = nullptr;
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CScriptAllocator::CScriptAllocator()
+    : m_remoteFreeList(nullptr)
+{
+    for (int32 i = 0; i < AllocType_Count; ++i)
+    {
+        m_allocationTotals[i] = 0;
+        m_allocationCounts[i] = 0;
+        m_allocationPeaks[i] = 0;
+    }
+
+    // -- generation 0 is never issued, it identifies a shared (heap) allocation
+    std::lock_guard<std::mutex> lock(g_liveAllocatorLock);
+    if (++g_allocatorGeneration == 0)
+        ++g_allocatorGeneration;
+    m_generation = g_allocatorGeneration;
+    m_nextLive = g_liveList;
+    g_liveList = this;
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CScriptAllocator::~CScriptAllocator()
+{
+}
+
+// ====================================================================================================================
+// Release():  Called instead of delete, once the context is destroyed - blocks still live are not freed individually.
+// ====================================================================================================================
+void CScriptAllocator::Release()
+{
+    // -- once removed from the live list, no other thread can queue a remote free, so this is the last
+    {
+        std::lock_guard<std::mutex> lock(g_liveAllocatorLock);
+        CScriptAllocator** live_ptr = &g_liveList;
+        while (*live_ptr != nullptr && *live_ptr != this)
+            live_ptr = &(*live_ptr)->m_nextLive;
+        if (*live_ptr == this)
+            *live_ptr = m_nextLive;
+    }
+
+    ProcessRemoteFrees();
+    delete this;
+}
+
+// ====================================================================================================================
+// IsLive():  Returns true if the allocator has not been released - matched on the address and generation.
+// ====================================================================================================================
+bool8 CScriptAllocator::IsLive(const CScriptAllocator* allocator, uint32 generation)
+{
+    std::lock_guard<std::mutex> lock(g_liveAllocatorLock);
+    return (IsLiveLocked(allocator, generation));
+}
+
+// ====================================================================================================================
+// IsLiveLocked():  As IsLive(), called with the live list already locked.
+// ====================================================================================================================
+bool8 CScriptAllocator::IsLiveLocked(const CScriptAllocator* allocator, uint32 generation)
+{
+    const CScriptAllocator* live_allocator = g_liveList;
+    while (live_allocator != nullptr)
+    {
+        if (live_allocator == allocator)
+            return (live_allocator->m_generation == generation);
+        live_allocator = live_allocator->m_nextLive;
+    }
+
+    return (false);
+}
+
+// ====================================================================================================================
+// ReportLiveBlocks():  Print the allocation types with blocks still live - returns the number of live blocks.
+// ====================================================================================================================
+int32 CScriptAllocator::ReportLiveBlocks(TinPrintHandler print_handler) const
+{
+    int32 live_count = 0;
+    for (int32 i = 0; i < AllocType_Count; ++i)
+    {
+        if (m_allocationCounts[i] <= 0)
+            continue;
+
+        live_count += m_allocationCounts[i];
+        if (print_handler != nullptr)
+        {
+            print_handler(1, "Warning - allocator released with %d live %s blocks (%d bytes)\n",
+                          m_allocationCounts[i], g_allocationTypeNames[i], m_allocationTotals[i]);
+        }
+    }
+
+    return (live_count);
+}
+
+// ====================================================================================================================
+// Alloc():  Allocate a block large enough for the header, and update the counters for the allocation type.
+// ====================================================================================================================
+void* CScriptAllocator::Alloc(eAllocType alloc_type, int32 size)
+{
+    // -- first free anything returned to us from other threads
+    ProcessRemoteFrees();
+
+    tAllocHeader* header = reinterpret_cast<tAllocHeader*>(AllocBlock(GetBlockSize(size)));
+    if (header == nullptr)
+        return (nullptr);
+
+    header->allocator = this;
+    header->size = size;
+    header->alloc_type = alloc_type;
+#if MEMORY_CHECK_REMOTE_FREE
+    header->generation = m_generation;
+#endif
+
+    m_allocationTotals[alloc_type] += size;
+    ++m_allocationCounts[alloc_type];
+    if (m_allocationTotals[alloc_type] > m_allocationPeaks[alloc_type])
+        m_allocationPeaks[alloc_type] = m_allocationTotals[alloc_type];
+
+    return (reinterpret_cast<char*>(header) + kAllocHeaderSize);
+}
+
+// ====================================================================================================================
+// Free():  Free a block, on the owning thread.
+// ====================================================================================================================
+void CScriptAllocator::Free(tAllocHeader* header)
+{
+    FreeHeader(header);
+}
+
+// ====================================================================================================================
+// FreeHeader():  Update the counters for the allocation type, and free the block.
+// ====================================================================================================================
+void CScriptAllocator::FreeHeader(tAllocHeader* header)
+{
+    m_allocationTotals[header->alloc_type] -= header->size;
+    --m_allocationCounts[header->alloc_type];
+    Assert_(m_allocationTotals[header->alloc_type] >= 0);
+
+    FreeBlock(header, GetBlockSize(header->size));
+}
+
+// ====================================================================================================================
+// GetBlockSize():  The block includes the header, and must be large enough to be queued as a remote free.
+// ====================================================================================================================
+int32 CScriptAllocator::GetBlockSize(int32 size)
+{
+    const int32 min_size = (int32)sizeof(tRemoteFree);
+    return (kAllocHeaderSize + (size > min_size ? size : min_size));
+}
+
+// ====================================================================================================================
+// QueueRemoteFree():  Push a block freed from another thread onto the owner's remote list (the header remains intact).
+// ====================================================================================================================
+void CScriptAllocator::QueueRemoteFree(tAllocHeader* header)
+{
+    CScriptAllocator* allocator = header->allocator;
+
+#if MEMORY_CHECK_REMOTE_FREE
+    // -- the owner must not be released between the check and the push, so the live list stays locked
+    // -- note:  a block whose allocator was released is leaked, rather than written into deleted memory
+    std::lock_guard<std::mutex> lock(g_liveAllocatorLock);
+    bool8 is_live = IsLiveLocked(allocator, header->generation);
+    Assert_(is_live);
+    if (!is_live)
+        return;
+#endif
+
+    tRemoteFree* remote = reinterpret_cast<tRemoteFree*>(reinterpret_cast<char*>(header) + kAllocHeaderSize);
+    remote->next = allocator->m_remoteFreeList.load(std::memory_order_relaxed);
+    while (!allocator->m_remoteFreeList.compare_exchange_weak(remote->next, remote, std::memory_order_release,
+                                                              std::memory_order_relaxed))
+    {
+    }
+}
+
+// ====================================================================================================================
+// ProcessRemoteFrees():  Called by the owning thread, to free all blocks queued from other threads.
+// ====================================================================================================================
+void CScriptAllocator::ProcessRemoteFrees()
+{
+    if (m_remoteFreeList.load(std::memory_order_relaxed) == nullptr)
+        return;
+
+    tRemoteFree* remote = m_remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+    while (remote != nullptr)
+    {
+        tRemoteFree* next = remote->next;
+        FreeHeader(reinterpret_cast<tAllocHeader*>(reinterpret_cast<char*>(remote) - kAllocHeaderSize));
+        remote = next;
+    }
+}
+
+// == class CPoolAllocator ============================================================================================
+
+// -- the large block link is padded, so the block that follows is aligned for any type
+const int32 CPoolAllocator::k_largeBlockHeaderSize = (int32)((sizeof(tLargeBlock) + alignof(std::max_align_t) - 1) &
+                                                             ~(alignof(std::max_align_t) - 1));
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CPoolAllocator::CPoolAllocator()
+    : m_largeBlockList(nullptr)
+{
+    // -- the pools are untracked - the allocations they serve are tracked by type instead
+    int32 block_size = kMemoryPoolMinBlockSize;
+    for (int32 i = 0; i < k_sizeClassCount; ++i)
+    {
+        m_sizeClassPools[i] = new CMemoryPool(ALLOC_Integration, block_size, kMemoryPoolSlabCount, false);
+        block_size <<= 1;
+    }
+
+    Assert_((block_size >> 1) == kMemoryPoolMaxBlockSize);
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CPoolAllocator::~CPoolAllocator()
+{
+    // -- anything still allocated from the pools is released in bulk, along with the slabs
+    for (int32 i = 0; i < k_sizeClassCount; ++i)
+        delete m_sizeClassPools[i];
+
+    while (m_largeBlockList != nullptr)
+    {
+        tLargeBlock* next = m_largeBlockList->next;
+        ::operator delete(m_largeBlockList);
+        m_largeBlockList = next;
+    }
+}
+
+// ====================================================================================================================
+// GetSizeClass():  Returns the index of the smallest pool with blocks large enough, or -1 for a heap allocation.
+// ====================================================================================================================
+int32 CPoolAllocator::GetSizeClass(int32 size)
+{
+    if (size > kMemoryPoolMaxBlockSize)
+        return (-1);
+
+    int32 size_class = 0;
+    int32 block_size = kMemoryPoolMinBlockSize;
+    while (block_size < size)
+    {
+        block_size <<= 1;
+        ++size_class;
+    }
+
+    return (size_class);
+}
+
+// ====================================================================================================================
+// AllocBlock():  Allocate from the size class pool, or the heap if the block is too large.
+// ====================================================================================================================
+void* CPoolAllocator::AllocBlock(int32 size)
+{
+    int32 size_class = GetSizeClass(size);
+    if (size_class >= 0)
+        return (m_sizeClassPools[size_class]->Alloc());
+
+    // -- the block follows the link, which is padded to keep the block aligned
+    tLargeBlock* large_block = reinterpret_cast<tLargeBlock*>(::operator new(k_largeBlockHeaderSize + size));
+    large_block->prev = nullptr;
+    large_block->next = m_largeBlockList;
+    if (m_largeBlockList != nullptr)
+        m_largeBlockList->prev = large_block;
+    m_largeBlockList = large_block;
+
+    return (reinterpret_cast<char*>(large_block) + k_largeBlockHeaderSize);
+}
+
+// ====================================================================================================================
+// FreeBlock():  Return the block to the size class pool it was allocated from.
+// ====================================================================================================================
+void CPoolAllocator::FreeBlock(void* addr, int32 size)
+{
+    int32 size_class = GetSizeClass(size);
+    if (size_class >= 0)
+    {
+        m_sizeClassPools[size_class]->Free(addr);
+        return;
+    }
+
+    tLargeBlock* large_block = reinterpret_cast<tLargeBlock*>(reinterpret_cast<char*>(addr) - k_largeBlockHeaderSize);
+    if (large_block->prev != nullptr)
+        large_block->prev->next = large_block->next;
+    else
+        m_largeBlockList = large_block->next;
+    if (large_block->next != nullptr)
+        large_block->next->prev = large_block->prev;
+
+    ::operator delete(large_block);
+}
+
 // == Function Registration ===========================================================================================
 
 REGISTER_CLASS_FUNCTION(CMemoryTracker, MemoryDumpTotals, DumpTotals);
@@ -29,19 +29,41 @@
 // -- includes --------------------------------------------------------------------------------------------------------
 
 #include "integration.h"
-#include "TinHash.h"
 
-// -- forward declarations --------------------------------------------------------------------------------------------
+// -- lib includes
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
 
-enum eAllocType;
+// -- forward declarations --------------------------------------------------------------------------------------------
 
 namespace TinScript
 {
 
 class CFunctionCallStack;
+class CScriptAllocator;
 
 // ====================================================================================================================
-// class CMemoryTracker:  Tracks the total bytes allocated, for each TinAlloc() type
+// tAllocHeader:  Every TinAlloc() is preceded by a header, so we can free (and track) without any lookup.
+// ====================================================================================================================
+struct tAllocHeader
+{
+    CScriptAllocator* allocator;
+    int32 size;
+    int32 alloc_type;
+
+#if MEMORY_CHECK_REMOTE_FREE
+    // -- allocator addresses are reused, so a free from another thread is matched on the generation as well
+    uint32 generation;
+#endif
+};
+
+// -- the header is padded, so the allocation that follows is aligned for any type
+const int32 kAllocHeaderSize = (int32)((sizeof(tAllocHeader) + alignof(std::max_align_t) - 1) &
+                                       ~(alignof(std::max_align_t) - 1));
+
+// ====================================================================================================================
+// class CMemoryTracker:  Routes every TinAlloc() to the calling thread's context allocator
 // -- and tracks the file/line location for every object created
 // ====================================================================================================================
 
@@ -54,9 +76,34 @@ class CMemoryTracker
         static void Initialize();
         static void Shutdown();
 
+        static void SetThreadAllocator(CScriptAllocator* allocator);
+        static CScriptAllocator* GetThreadAllocator();
+
         static void* Alloc(eAllocType alloc_type, int32 size);
+        static void* AllocShared(eAllocType alloc_type, int32 size);
         static void Free(void* addr);
 
+        // -- used by TinFree():  destruct the object, and free the memory
+        template <typename T>
+        static void Destroy(T* addr)
+        {
+            if (addr == nullptr)
+                return;
+
+            // -- if we're deleting through a base class pointer, we need the address of the complete object
+            void* alloc_addr = GetCompleteObjectAddr(addr, std::is_polymorphic<T>());
+            addr->~T();
+            Free(alloc_addr);
+        }
+
+        // -- used by TinFreeArray():  arrays are only ever allocated for types without a destructor
+        template <typename T>
+        static void DestroyArray(T* addr)
+        {
+            static_assert(std::is_trivially_destructible<T>::value, "TinAllocArray() requires a trivial destructor");
+            Free((void*)addr);
+        }
+
         static void NotifyObjectCreated(uint32 object_id, const CFunctionCallStack* funccallstack);
         static void NotifyObjectDestroyed(uint32 object_id);
 
@@ -70,27 +117,14 @@ class CMemoryTracker
 
 
     private:
-        struct tAllocEntry
-        {
-            tAllocEntry(eAllocType _type, void* _addr, int32 _size)
-            {
-                type = _type;
-                addr = _addr;
-                size = _size;
-                next = nullptr;
-            }
-
-            eAllocType type;
-            void* addr;
-            int32 size;
-            tAllocEntry* next;
-        };
+        template <typename T>
+        static void* GetCompleteObjectAddr(T* addr, std::true_type) { return (dynamic_cast<void*>(addr)); }
 
-        int32 m_allocationTotals[AllocType_Count];
+        template <typename T>
+        static void* GetCompleteObjectAddr(T* addr, std::false_type) { return ((void*)addr); }
 
         // -- an untracked (minimal) hash table
         static const int k_trackedAllocationTableSize = 1553;
-        tAllocEntry* m_allocationTable[k_trackedAllocationTableSize];
 
         // -- a custom (non-tracked) hash table for object tracking (file/line where they were created)
         static uint32 CalculateFileLineHash(uint32 codeblock_hash, int32 line_number);
@@ -123,6 +157,166 @@ class CMemoryTracker
         tObjectCreatedFileLine* m_objectCreatedFileLineTable[k_trackedAllocationTableSize];
 };
 
+// ====================================================================================================================
+// class CMemoryPool:  A slab allocator for fixed size elements.
+// Slabs are allocated (and tracked) as a whole, and released only when the pool is destroyed - freed elements are
+// pushed onto a free list, so alloc/free for high churn types (e.g. object instances) is a pop/push.
+// ====================================================================================================================
+class CMemoryPool
+{
+    public:
+        CMemoryPool(eAllocType alloc_type, int32 element_size, int32 slab_count = kMemoryPoolSlabCount,
+                    bool8 tracked = true);
+        ~CMemoryPool();
+
+        void* Alloc();
+        void Free(void* addr);
+
+        // -- convenience methods, to construct/destruct an instance of a type in pooled memory
+        template <typename T, typename... Args>
+        T* Construct(Args... args)
+        {
+            void* addr = Alloc();
+            return (addr != nullptr ? new (addr) T(args...) : nullptr);
+        }
+
+        template <typename T>
+        void Destruct(T* item)
+        {
+            if (item != nullptr)
+            {
+                item->~T();
+                Free(item);
+            }
+        }
+
+        int32 GetElementSize() const { return (m_elementSize); }
+        int32 GetUsed() const { return (m_used); }
+        int32 GetCapacity() const { return (m_capacity); }
+
+    private:
+        struct tFreeElement
+        {
+            tFreeElement* next;
+        };
+
+        struct tSlab
+        {
+            tSlab* next;
+        };
+
+        bool8 AllocSlab();
+
+        eAllocType m_allocType;
+        bool8 m_tracked;
+        int32 m_elementSize;
+        int32 m_slabCount;
+        int32 m_slabHeaderSize;
+
+        int32 m_used;
+        int32 m_capacity;
+
+        tFreeElement* m_freeList;
+        tSlab* m_slabList;
+};
+
+// ====================================================================================================================
+// class CScriptAllocator:  The interface for the allocator owned by each context, serving every TinAlloc().
+// The allocator only provides memory - the per type counters are maintained here, so an implementation
+// (e.g. an application's own heap) need not track anything.
+// Blocks are freed by other threads (through the remote free queue) only while the context exists - memory that
+// may outlive the context, or be freed after it's destroyed, must be allocated with TinAllocShared().
+// ====================================================================================================================
+class CScriptAllocator
+{
+    public:
+        CScriptAllocator();
+
+        // -- returns true if the allocator with the given generation has not been released
+        // -- note:  the allocator is never dereferenced, so this is safe to call with a stale address
+        static bool8 IsLive(const CScriptAllocator* allocator, uint32 generation);
+        uint32 GetGeneration() const { return (m_generation); }
+
+        // -- deletes the allocator, once the context is destroyed - any blocks still live are released with it
+        void Release();
+
+        virtual void* AllocBlock(int32 size) = 0;
+        virtual void FreeBlock(void* addr, int32 size) = 0;
+
+        // -- called by the tracker, for allocations owned by this allocator
+        void* Alloc(eAllocType alloc_type, int32 size);
+        void Free(tAllocHeader* header);
+
+        // -- a block freed from a thread other than the owner is queued, and freed by the owner on its next Alloc(),
+        // its context's Update(), or when the context is destroyed
+        // -- static, as the owner is verified to be live (if MEMORY_CHECK_REMOTE_FREE) before it's touched
+        static void QueueRemoteFree(tAllocHeader* header);
+        void ProcessRemoteFrees();
+
+        // -- prints each allocation type with blocks still live (e.g. never freed by the destroyed context)
+        int32 ReportLiveBlocks(TinPrintHandler print_handler) const;
+
+        int32 GetAllocationTotal(eAllocType alloc_type) const { return (m_allocationTotals[alloc_type]); }
+        int32 GetAllocationCount(eAllocType alloc_type) const { return (m_allocationCounts[alloc_type]); }
+        int32 GetAllocationPeak(eAllocType alloc_type) const { return (m_allocationPeaks[alloc_type]); }
+
+    protected:
+        // -- only deleted through Release()
+        virtual ~CScriptAllocator();
+
+    private:
+        struct tRemoteFree
+        {
+            tRemoteFree* next;
+        };
+
+        static int32 GetBlockSize(int32 size);
+        static bool8 IsLiveLocked(const CScriptAllocator* allocator, uint32 generation);
+        void FreeHeader(tAllocHeader* header);
+
+        std::atomic<tRemoteFree*> m_remoteFreeList;
+
+        // -- unique to each allocator, and the list of allocators not yet released
+        uint32 m_generation;
+        CScriptAllocator* m_nextLive;
+        static CScriptAllocator* g_liveList;
+
+        int32 m_allocationTotals[AllocType_Count];
+        int32 m_allocationCounts[AllocType_Count];
+        int32 m_allocationPeaks[AllocType_Count];
+};
+
+// ====================================================================================================================
+// class CPoolAllocator:  The default context allocator - size class pools for small blocks, the heap for large.
+// All memory, pooled or large, is released in bulk when the allocator is deleted.
+// ====================================================================================================================
+class CPoolAllocator : public CScriptAllocator
+{
+    public:
+        CPoolAllocator();
+
+        virtual void* AllocBlock(int32 size) override;
+        virtual void FreeBlock(void* addr, int32 size) override;
+
+    protected:
+        virtual ~CPoolAllocator();
+
+    private:
+        // -- large blocks come from the heap, linked so they can be released with the pools
+        struct tLargeBlock
+        {
+            tLargeBlock* prev;
+            tLargeBlock* next;
+        };
+
+        static int32 GetSizeClass(int32 size);
+
+        static const int32 k_sizeClassCount = 7;
+        static const int32 k_largeBlockHeaderSize;
+        CMemoryPool* m_sizeClassPools[k_sizeClassCount];
+        tLargeBlock* m_largeBlockList;
+};
+
 }
 
 #endif
@@ -31,6 +31,7 @@
 
 // -- includes
 #include "TinVariableEntry.h"
+#include "TinExecute.h"
 #include "TinScheduler.h"
 #include "TinObjectGroup.h"
 #include "TinStringTable.h"
@@ -62,6 +63,9 @@ CObjectEntry::CObjectEntry(CScriptContext* script_context, uint32 _objid, uint32
     mGroupOwner = NULL;
     mManualRegister = register_manual;
     mIsDestroyed = false;
+    mMembershipList = NULL;
+    mMembershipCount = 0;
+    mMembershipSize = 0;
 }
 
 // ====================================================================================================================
@@ -74,6 +78,74 @@ CObjectEntry::~CObjectEntry()
         mDynamicVariables->DestroyAll();
         TinFree(mDynamicVariables);
     }
+
+    if (mMembershipList)
+        TinFreeArray(mMembershipList);
+}
+
+// ====================================================================================================================
+// FindMembershipIndex():  Returns the index of this object within the given set, or -1 if it's not a member.
+// ====================================================================================================================
+int32 CObjectEntry::FindMembershipIndex(const CObjectSet* set) const
+{
+    // -- objects are rarely members of more than a few sets, so a linear search is fastest
+    for (int32 i = 0; i < mMembershipCount; ++i)
+    {
+        if (mMembershipList[i].set == set)
+            return (mMembershipList[i].index);
+    }
+
+    return (-1);
+}
+
+// ====================================================================================================================
+// SetMembershipIndex():  Adds (or updates) the membership of this object in the given set, along with its index.
+// ====================================================================================================================
+void CObjectEntry::SetMembershipIndex(CObjectSet* set, int32 index)
+{
+    for (int32 i = 0; i < mMembershipCount; ++i)
+    {
+        if (mMembershipList[i].set == set)
+        {
+            mMembershipList[i].index = index;
+            return;
+        }
+    }
+
+    // -- grow the list as needed
+    if (mMembershipCount >= mMembershipSize)
+    {
+        int32 new_size = mMembershipSize > 0 ? mMembershipSize * 2 : 4;
+        tMembership* new_list = TinAllocArray(ALLOC_ObjectGroup, tMembership, new_size);
+        if (mMembershipList)
+        {
+            memcpy(new_list, mMembershipList, sizeof(tMembership) * mMembershipCount);
+            TinFreeArray(mMembershipList);
+        }
+
+        mMembershipList = new_list;
+        mMembershipSize = new_size;
+    }
+
+    mMembershipList[mMembershipCount].set = set;
+    mMembershipList[mMembershipCount].index = index;
+    ++mMembershipCount;
+}
+
+// ====================================================================================================================
+// ClearMembership():  Removes the membership of this object, from the given set.
+// ====================================================================================================================
+void CObjectEntry::ClearMembership(const CObjectSet* set)
+{
+    for (int32 i = 0; i < mMembershipCount; ++i)
+    {
+        if (mMembershipList[i].set == set)
+        {
+            // -- the order of memberships isn't important, so replace with the last
+            mMembershipList[i] = mMembershipList[--mMembershipCount];
+            return;
+        }
+    }
 }
 
 // ====================================================================================================================
@@ -153,6 +225,22 @@ CFunctionEntry* CObjectEntry::GetSuperFunctionEntry(uint32 nshash, uint32 funcha
 // ====================================================================================================================
 void CObjectEntry::CallFunctionHierarchy(uint32 function_hash, bool8 ascending)
 {
+    // -- OnCreate() and OnDestroy() chains are cached by the namespace, and executed within a single VM
+    CNamespace::eLifecycleChain chain = CNamespace::eLifecycleCount;
+    if (ascending && function_hash == HashLiteral_("OnCreate"))
+        chain = CNamespace::eLifecycleOnCreate;
+    else if (!ascending && function_hash == HashLiteral_("OnDestroy"))
+        chain = CNamespace::eLifecycleOnDestroy;
+
+    if (chain != CNamespace::eLifecycleCount && GetNamespace() != nullptr)
+    {
+        int32 count = 0;
+        const tLifecycleMethod* methods = GetNamespace()->GetLifecycleChain(chain, count);
+        if (count > 0)
+            ExecuteLifecycleChain(GetScriptContext(), this, function_hash, methods, count);
+        return;
+    }
+
     // -- if the call is ascending, we have to create the namespace stack, so we can drill down
     // -- and call from parent to child
     if (ascending)
@@ -671,7 +759,7 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
         // -- and the hierarchy of linked namespaces will uncover any errors
         if (!class_namespace)
         {
-            class_namespace = GetNamespaceDictionary()->FindItem(Hash("CScriptObject"));
+            class_namespace = GetNamespaceDictionary()->FindItem(HashLiteral_("CScriptObject"));
             if (class_namespace)
             {
                 if (!LinkNamespaces(namespaceentry, class_namespace))
@@ -693,7 +781,13 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
         }
 
         // -- create the object
-        void* newobj = (*funcptr)();
+        void* newobj = class_namespace->CreateObjectInstance();
+        if (newobj == NULL)
+        {
+            ScriptAssert_(this, 0, "<internal>", -1,
+                          "Error - Unable to create an instance of class: %s\n", UnHash(classhash));
+            return 0;
+        }
 
         // -- see if we can hook this object up to the namespace for it's object name
         CNamespace* objnamens = namespaceentry;
@@ -710,6 +804,7 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
                     ScriptAssert_(this, 0, "<internal>", -1,
                                   "Error - failed to link namespace ::%s to parent namespace ::%s\n",
                                   UnHash(objnamens->GetHash()), UnHash(namespaceentry->GetHash()));
+                    class_namespace->DestroyObjectInstance(newobj);
                     return 0;
                 }
             }
@@ -729,8 +824,7 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
                 ScriptAssert_(this, 0, "<internal>", -1,
                               "Error - Unable to verify hierarchy for namespace: %s\n",
                               UnHash(objnamens->GetHash()));
-                // $$$TZA find a way to delete the newly created, but non-registered object
-                //delete newobj;
+                class_namespace->DestroyObjectInstance(newobj);
                 return 0;
             }
             else if (tempns != class_namespace)
@@ -739,15 +833,14 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
                               "Error - Unable to create an instance of base class: %s, using object namespace: %s.\n"
                               "Use derived class: %s\n",
                               UnHash(class_namespace->GetHash()), UnHash(objnamehash), UnHash(tempns->GetHash()));
-                // $$$TZA find a way to delete the newly created, but non-registered object
-                //delete newobj;
+                class_namespace->DestroyObjectInstance(newobj);
                 return 0;
             }
         }
 
         // -- add this object to the dictionary of all objects created from script
-        CObjectEntry* newobjectentry = TinAlloc(ALLOC_ObjEntry, CObjectEntry, this,
-                                                objectid, objnamehash, objnamens, newobj, false);
+        CObjectEntry* newobjectentry = GetObjectEntryPool()->Construct<CObjectEntry>(this, objectid, objnamehash,
+                                                                                    objnamens, newobj, false);
         GetObjectDictionary()->AddItem(*newobjectentry, objectid);
 
         // -- add the object to the dictionary by address
@@ -755,7 +848,7 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
 
         // -- if the item is named, add it to the name dictionary
         // $$$TZA Note:  names are not guaranteed unique...  warn?
-        if (objnamehash != Hash(""))
+        if (objnamehash != 0)
             GetNameDictionary()->AddItem(*newobjectentry, objnamehash);
 
 #if MEMORY_TRACKER_ENABLE
@@ -769,7 +862,7 @@ uint32 CScriptContext::CreateObject(uint32 classhash, uint32 objnamehash, const
         // -- "OnCreate" is the equivalent of a constructor - we want to call every OnCreate
         // -- from the bottom of the hierarchy to the highest derivation for which it is defined
         // -- NOTE:  it is not required to be defined for any level
-        newobjectentry->CallFunctionHierarchy(Hash("OnCreate"), true);
+        newobjectentry->CallFunctionHierarchy(HashLiteral_("OnCreate"), true);
 
         return (objectid);
     }
@@ -822,15 +915,15 @@ uint32 CScriptContext::RegisterObject(void* objaddr, const char* classname, cons
     }
 
     // -- add this object to the dictionary of all objects created from script
-    CObjectEntry* newobjectentry = TinAlloc(ALLOC_ObjEntry, CObjectEntry, this,
-                                            objectid, objnamehash, objnamens, objaddr, true);
+    CObjectEntry* newobjectentry = GetObjectEntryPool()->Construct<CObjectEntry>(this, objectid, objnamehash,
+                                                                                objnamens, objaddr, true);
     GetObjectDictionary()->AddItem(*newobjectentry, objectid);
 
     // -- add the object to the dictionary by address
     GetAddressDictionary()->AddItem(*newobjectentry, kPointerToUInt32(objaddr));
 
     // -- if the item is named, add it to the name dictionary
-    if (objnamehash != Hash("")) {
+    if (objnamehash != 0) {
         GetNameDictionary()->AddItem(*newobjectentry, objnamehash);
     }
 
@@ -840,7 +933,7 @@ uint32 CScriptContext::RegisterObject(void* objaddr, const char* classname, cons
     // -- "OnCreate" is the equivalent of a constructor - we want to call every OnCreate
     // -- from the bottom of the hierarchy to the highest derivation for which it is defined
     // -- NOTE:  it is not required to be defined for any level
-    newobjectentry->CallFunctionHierarchy(Hash("OnCreate"), true);
+    newobjectentry->CallFunctionHierarchy(HashLiteral_("OnCreate"), true);
 
     return objectid;
 }
@@ -894,8 +987,8 @@ void CScriptContext::DestroyObject(uint32 objectid)
     }
 
     // -- get the Destroy function
-    CNamespace::DestroyInstance destroyptr = namespaceentry->GetDestroyInstance();
-    if (destroyptr == NULL)
+    CNamespace* class_namespace = namespaceentry->GetRegisteredClassNamespace();
+    if (class_namespace == NULL)
     {
         ScriptAssert_(this, 0, "<internal>", -1,
                       "Error - no Destroy() function registered for class: %s\n",
@@ -906,7 +999,7 @@ void CScriptContext::DestroyObject(uint32 objectid)
     // -- "OnDestroy" is the equivalent of a destructor - we want to call every OnDestroy
     // -- from the top of the hierarchy through to the root base implementation
     // -- NOTE:  it is not required to be defined for any level
-    oe->CallFunctionHierarchy(Hash("OnDestroy"), false);
+    oe->CallFunctionHierarchy(HashLiteral_("OnDestroy"), false);
 
     // -- get the address of the object
     void* objaddr = oe->GetAddr();
@@ -922,7 +1015,7 @@ void CScriptContext::DestroyObject(uint32 objectid)
 
     // -- if the object was not registered externally, delete the actual object
     if (!oe->IsManuallyRegistered())
-        (*destroyptr)(objaddr);
+        class_namespace->DestroyObjectInstance(objaddr);
 
     // -- notify the debugger, after the destructor has had a chance to send "RemoveFromSet" notifications
     DebuggerNotifyDestroyObject(objectid);
@@ -933,7 +1026,7 @@ void CScriptContext::DestroyObject(uint32 objectid)
     GetNameDictionary()->RemoveItem(oe, oe->GetNameHash());
 
     // -- delete the object entry *after* the object
-    TinFree(oe);
+    GetObjectEntryPool()->Destruct(oe);
 }
 
 // ====================================================================================================================
@@ -1331,7 +1424,7 @@ bool8 CScriptContext::ExportObjectTreeCreate(CObjectEntry* oe, FILE* filehandle,
     }
 
     // -- if this object is a group (specifically, not a set)
-    static uint32 object_group_hash = Hash("CObjectGroup");
+    const uint32 object_group_hash = HashLiteral_("CObjectGroup");
     if (oe->HasNamespace(object_group_hash))
     {
         // -- bump the index
@@ -1376,7 +1469,7 @@ bool8 CScriptContext::ExportObjectTreeMembers(CObjectEntry* oe, FILE* filehandle
     }
 
     // -- if this object is a group (specifically, not a set)
-    static uint32 object_group_hash = Hash("CObjectGroup");
+    const uint32 object_group_hash = HashLiteral_("CObjectGroup");
     if (oe->HasNamespace(object_group_hash))
     {
         CObjectGroup* group = static_cast<CObjectGroup*>(FindObject(oe->GetID()));
@@ -1404,7 +1497,7 @@ bool8 CScriptContext::ExportObjectTreeMembers(CObjectEntry* oe, FILE* filehandle
 bool8 CScriptContext::ExportObjectTreeHierarchy(CObjectEntry* oe, FILE* filehandle, char* indent_buf)
 {
     // -- if this object is a set (re-creating the hierarchy includes sets)
-    static uint32 object_set_hash = Hash("CObjectSet");
+    const uint32 object_set_hash = HashLiteral_("CObjectSet");
     if (oe->HasNamespace(object_set_hash))
     {
         CObjectSet* set = static_cast<CObjectSet*>(FindObject(oe->GetID()));
@@ -1644,7 +1737,7 @@ bool8 CScriptContext::FileWritef(FILE* filehandle, const char* fmt, ...)
 // Constructor
 // ====================================================================================================================
 CNamespace::CNamespace(CScriptContext* script_context, const char* _name, uint32 _typeID,
-                       CreateInstance _createinstance, DestroyInstance _destroyinstance)
+                       CreateInstance _createinstance, DestroyInstance _destroyinstance, int32 _instancesize)
 {
     mContextOwner = script_context;
     // -- ensure the name lives in the string table
@@ -1655,9 +1748,19 @@ CNamespace::CNamespace(CScriptContext* script_context, const char* _name, uint32
     mNext = NULL;
     mCreateFuncptr = _createinstance;
     mDestroyFuncptr = _destroyinstance;
+    mInstancePool = NULL;
+    if (_createinstance != NULL && _instancesize > 0)
+        mInstancePool = TinAlloc(ALLOC_CreateObj, CMemoryPool, ALLOC_CreateObj, _instancesize);
     mMemberTable = TinAlloc(ALLOC_VarTable, tVarTable, kLocalVarTableSize);
     mMethodTable = TinAlloc(ALLOC_FuncTable, tFuncTable, kLocalFuncTableSize);
     mIsInterfaceVerified = false;
+
+    mLifecycleGeneration = 0;
+    for (int32 chain = 0; chain < eLifecycleCount; ++chain)
+    {
+        mLifecycleChain[chain] = nullptr;
+        mLifecycleCount[chain] = 0;
+    }
 }
 
 // ====================================================================================================================
@@ -1669,6 +1772,131 @@ CNamespace::~CNamespace()
     TinFree(mMemberTable);
     mMethodTable->DestroyAll();
     TinFree(mMethodTable);
+
+    for (int32 chain = 0; chain < eLifecycleCount; ++chain)
+    {
+        if (mLifecycleChain[chain] != nullptr)
+            TinFreeArray(mLifecycleChain[chain]);
+    }
+
+    // -- any instances still in existence are owned by the context, and were not destructed... release the memory
+    if (mInstancePool)
+        TinFree(mInstancePool);
+}
+
+// ====================================================================================================================
+// SetNext():  Link this namespace to its parent - any cached lifecycle chains in the hierarchy are now stale.
+// ====================================================================================================================
+void CNamespace::SetNext(CNamespace* _next)
+{
+    mNext = _next;
+    mContextOwner->InvalidateLifecycleChains();
+}
+
+// ====================================================================================================================
+// GetLifecycleChain():  Returns the OnCreate()/OnDestroy() methods within this hierarchy, in the order they're called.
+// ====================================================================================================================
+const tLifecycleMethod* CNamespace::GetLifecycleChain(eLifecycleChain chain, int32& out_count)
+{
+    if (mLifecycleGeneration != mContextOwner->GetLifecycleGeneration())
+        BuildLifecycleChains();
+
+    out_count = mLifecycleCount[chain];
+    return (mLifecycleChain[chain]);
+}
+
+// ====================================================================================================================
+// BuildLifecycleChains():  Walk the hierarchy once, caching every namespace that implements OnCreate()/OnDestroy().
+// ====================================================================================================================
+void CNamespace::BuildLifecycleChains()
+{
+    static const uint32 lifecycle_hash[eLifecycleCount] = { HashLiteral_("OnCreate"), HashLiteral_("OnDestroy") };
+
+    for (int32 chain = 0; chain < eLifecycleCount; ++chain)
+    {
+        if (mLifecycleChain[chain] != nullptr)
+        {
+            TinFreeArray(mLifecycleChain[chain]);
+            mLifecycleChain[chain] = nullptr;
+        }
+        mLifecycleCount[chain] = 0;
+
+        // -- count the implementations first
+        int32 count = 0;
+        for (CNamespace* ns = this; ns != nullptr; ns = ns->GetNext())
+        {
+            if (ns->GetFuncTable()->FindItem(lifecycle_hash[chain]) != nullptr)
+                ++count;
+        }
+
+        if (count == 0)
+            continue;
+
+        // -- OnDestroy() is called from child to parent, OnCreate() in reverse, from the root down to the child
+        tLifecycleMethod* methods = TinAllocArray(ALLOC_Namespace, tLifecycleMethod, count);
+        int32 index = chain == eLifecycleOnCreate ? count - 1 : 0;
+        int32 step = chain == eLifecycleOnCreate ? -1 : 1;
+        for (CNamespace* ns = this; ns != nullptr; ns = ns->GetNext())
+        {
+            CFunctionEntry* fe = ns->GetFuncTable()->FindItem(lifecycle_hash[chain]);
+            if (fe != nullptr)
+            {
+                methods[index].ns = ns;
+                methods[index].fe = fe;
+                index += step;
+            }
+        }
+
+        mLifecycleChain[chain] = methods;
+        mLifecycleCount[chain] = count;
+    }
+
+    mLifecycleGeneration = mContextOwner->GetLifecycleGeneration();
+}
+
+// ====================================================================================================================
+// GetRegisteredClassNamespace():  Script-derived namespaces have no create/destroy functions of their own...
+// find the highest level namespace in the hierarchy, that is a registered class.
+// ====================================================================================================================
+CNamespace* CNamespace::GetRegisteredClassNamespace()
+{
+    CNamespace* ns = this;
+    while (ns && ns->mDestroyFuncptr == NULL)
+        ns = ns->mNext;
+    return (ns);
+}
+
+// ====================================================================================================================
+// CreateObjectInstance():  Allocate memory from the pool, and construct an instance of the registered class.
+// ====================================================================================================================
+void* CNamespace::CreateObjectInstance()
+{
+    if (mCreateFuncptr == NULL || mInstancePool == NULL)
+        return (NULL);
+
+    void* addr = mInstancePool->Alloc();
+    if (addr == NULL)
+        return (NULL);
+
+    void* newobj = (*mCreateFuncptr)(addr);
+    if (newobj == NULL)
+        mInstancePool->Free(addr);
+
+    return (newobj);
+}
+
+// ====================================================================================================================
+// DestroyObjectInstance():  Destruct an instance of the registered class, and return the memory to the pool.
+// ====================================================================================================================
+void CNamespace::DestroyObjectInstance(void* addr)
+{
+    CNamespace* class_namespace = GetRegisteredClassNamespace();
+    if (!addr || !class_namespace)
+        return;
+
+    (*class_namespace->mDestroyFuncptr)(addr);
+    if (class_namespace->mInstancePool)
+        class_namespace->mInstancePool->Free(addr);
 }
 
 // ====================================================================================================================
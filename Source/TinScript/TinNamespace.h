@@ -39,6 +39,8 @@ class CFunctionEntry;
 class CNamespace;
 class CNamespaceReg;
 class CObjectGroup;
+class CObjectSet;
+class CMemoryPool;
 
 typedef CHashTable<CVariableEntry> tVarTable;
 typedef CHashTable<CFunctionEntry> tFuncTable;
@@ -72,6 +74,13 @@ class CObjectEntry
 
         bool8 IsManuallyRegistered() { return (mManualRegister); }
 
+        // -- the object sets this object is a member of, and the object's index within each
+        int32 GetMembershipCount() const { return (mMembershipCount); }
+        CObjectSet* GetMembershipSet(int32 membership) const { return (mMembershipList[membership].set); }
+        int32 FindMembershipIndex(const CObjectSet* set) const;
+        void SetMembershipIndex(CObjectSet* set, int32 index);
+        void ClearMembership(const CObjectSet* set);
+
         CVariableEntry* GetVariableEntry(uint32 varhash);
         CFunctionEntry* GetFunctionEntry(uint32 nshash, uint32 funchash);
         CFunctionEntry* GetSuperFunctionEntry(uint32 nshash, uint32 funchash);
@@ -93,6 +102,23 @@ class CObjectEntry
         bool8 mManualRegister;
         bool8 mIsDestroyed;
         CHashTable<CVariableEntry>* mDynamicVariables;
+
+        struct tMembership
+        {
+            CObjectSet* set;
+            int32 index;
+        };
+
+        tMembership* mMembershipList;
+        int32 mMembershipCount;
+        int32 mMembershipSize;
+};
+
+// -- an entry in a namespace's cached OnCreate()/OnDestroy() chain
+struct tLifecycleMethod
+{
+    CNamespace* ns;
+    CFunctionEntry* fe;
 };
 
 // ====================================================================================================================
@@ -101,12 +127,14 @@ class CObjectEntry
 class CNamespace
 {
     public:
-        typedef void* (*CreateInstance)();
+        // -- registered classes are constructed in place (and destructed) within memory owned by the namespace pool
+        typedef void* (*CreateInstance)(void* addr);
         typedef void (*DestroyInstance)(void* addr);
         typedef void (*Register)(CScriptContext* script_context, CNamespace* reg);
 
         CNamespace(CScriptContext* script_context, const char* name, uint32 _typeID = 0,
-                   CreateInstance _createinstance = NULL, DestroyInstance _destroyinstance = NULL);
+                   CreateInstance _createinstance = NULL, DestroyInstance _destroyinstance = NULL,
+                   int32 _instancesize = 0);
         virtual ~CNamespace();
 
         CScriptContext* GetScriptContext() { return (mContextOwner); }
@@ -131,7 +159,7 @@ class CNamespace
         }
 
         CNamespace* GetNext() const { return (mNext); }
-        void SetNext(CNamespace* _next) { mNext = _next; }
+        void SetNext(CNamespace* _next);
 
         CreateInstance GetCreateInstance() const { return (mCreateFuncptr); }
 
@@ -148,13 +176,31 @@ class CNamespace
                 return (NULL);
         }
 
+        // -- find the registered class namespace (the first with a proper destructor), to construct/destruct instances
+        CNamespace* GetRegisteredClassNamespace();
+        void* CreateObjectInstance();
+        void DestroyObjectInstance(void* addr);
+
         CVariableEntry* GetVarEntry(uint32 varhash);
         tVarTable* GetVarTable() const { return (mMemberTable); }
         tFuncTable* GetFuncTable() const { return (mMethodTable); }
 
+        // -- each namespace caches the OnCreate()/OnDestroy() methods found within its hierarchy, in calling order
+        // -- the cache is rebuilt when the context's lifecycle generation changes (a function defined, or a link)
+        enum eLifecycleChain
+        {
+            eLifecycleOnCreate,
+            eLifecycleOnDestroy,
+            eLifecycleCount
+        };
+
+        const tLifecycleMethod* GetLifecycleChain(eLifecycleChain chain, int32& out_count);
+
     private:
         CNamespace() { }
 
+        void BuildLifecycleChains();
+
         CScriptContext* mContextOwner;
 
         const char* mName;
@@ -165,9 +211,14 @@ class CNamespace
 
         CreateInstance mCreateFuncptr;
         DestroyInstance mDestroyFuncptr;
+        CMemoryPool* mInstancePool;
 
         tVarTable* mMemberTable;
         tFuncTable* mMethodTable;
+
+        uint32 mLifecycleGeneration;
+        tLifecycleMethod* mLifecycleChain[eLifecycleCount];
+        int32 mLifecycleCount[eLifecycleCount];
 };
 
 // ====================================================================================================================
@@ -178,7 +229,7 @@ class CNamespaceReg
     public:
         CNamespaceReg(const char* _name, const char* _parentname, uint32 _typeID,
                       void* _createfuncptr, void* _destroyfuncptr,
-                      void* _regfuncptr)
+                      void* _regfuncptr, int32 _instancesize)
         {
             mName = _name;
             mHash = Hash(mName);
@@ -188,6 +239,7 @@ class CNamespaceReg
             mCreateFuncptr = (CNamespace::CreateInstance)_createfuncptr;
             mDestroyFuncptr = (CNamespace::DestroyInstance)_destroyfuncptr;
             mRegFuncptr = (CNamespace::Register)_regfuncptr;
+            mInstanceSize = _instancesize;
 
             next = head;
             head = this;
@@ -212,6 +264,7 @@ class CNamespaceReg
 
         CNamespace::CreateInstance GetCreateFunction() const { return (mCreateFuncptr); }
         CNamespace::DestroyInstance GetDestroyFunction() const { return (mDestroyFuncptr); }
+        int32 GetInstanceSize() const { return (mInstanceSize); }
 
         void RegisterNamespace(CScriptContext* script_context, CNamespace* _namespace)
         {
@@ -229,6 +282,7 @@ class CNamespaceReg
         CNamespace::CreateInstance mCreateFuncptr;
         CNamespace::DestroyInstance mDestroyFuncptr;
         CNamespace::Register mRegFuncptr;
+        int32 mInstanceSize;
         CNamespace** mClassNamespace;
 
         CNamespaceReg() { }
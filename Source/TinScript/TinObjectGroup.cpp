@@ -31,6 +31,7 @@
 
 #include "TinScript.h"
 #include "TinRegBinding.h"
+#include "TinStringTable.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -42,12 +43,10 @@ namespace TinScript
 // ====================================================================================================================
 // Constructor
 // ====================================================================================================================
-CMasterMembershipList::CMasterMembershipList(CScriptContext* script_context, int32 _size)
+CMasterMembershipList::CMasterMembershipList(CScriptContext* script_context)
 {
-    assert(script_context != NULL && _size > 0);
+    assert(script_context != NULL);
     mContextOwner = script_context;
-
-    mMasterMembershipList = TinAlloc(ALLOC_ObjectGroup, CHashTable<tMembershipList>, _size);
 }
 
 // ====================================================================================================================
@@ -55,39 +54,23 @@ CMasterMembershipList::CMasterMembershipList(CScriptContext* script_context, int
 // ====================================================================================================================
 CMasterMembershipList::~CMasterMembershipList()
 {
-    if (mMasterMembershipList)
-    {
-        mMasterMembershipList->DestroyAll();
-        TinFree(mMasterMembershipList);
-    }
 }
 
 // ====================================================================================================================
-// AddMembership():  Notify the master list that an object has been added to an object set.
+// AddMembership():  Notify the master list that an object has been added to an object set, at the given index.
 // ====================================================================================================================
-void CMasterMembershipList::AddMembership(CObjectEntry* oe, CObjectSet* group)
+void CMasterMembershipList::AddMembership(CObjectEntry* oe, CObjectSet* group, int32 index)
 {
     // -- sanity check
     if (!oe || !group)
         return;
 
-    uint32 group_id = GetScriptContext()->FindIDByAddress(group);
-    uint32 object_id = oe->GetID();
+    // -- the object entry stores the membership, along with the object's index within the group
+    oe->SetMembershipIndex(group, index);
 
-    // -- get the member list for the specific object, and add this group to it
-    tMembershipList* member_list = mMasterMembershipList->FindItem(object_id);
-    if (!member_list)
-    {
-        member_list = TinAlloc(ALLOC_ObjectGroup, tMembershipList, kObjectGroupTableSize);
-        mMasterMembershipList->AddItem(*member_list, object_id);
-    }
-
-    // -- ensure we don't add this group twice
-    if (!member_list->FindItem(group_id))
-        member_list->AddItem(*group, group_id);
-
-    // -- notify the debugger of the discontinued membership
-    GetScriptContext()->DebuggerNotifySetAddObject(group_id, object_id, (oe->GetGroupID() == group_id));
+    // -- notify the debugger of the new membership
+    uint32 group_id = GetScriptContext()->FindIDByAddress(group);
+    GetScriptContext()->DebuggerNotifySetAddObject(group_id, oe->GetID(), (oe->GetGroupID() == group_id));
 }
 
 // ====================================================================================================================
@@ -99,33 +82,18 @@ void CMasterMembershipList::RemoveMembership(CObjectEntry* oe, CObjectSet* group
     if (!oe || !group)
         return;
 
-    uint32 group_id = GetScriptContext()->FindIDByAddress(group);
-    uint32 object_id = oe->GetID();
-
-    // -- get the member list for the specific object, and add this group to it
-    tMembershipList* member_list = mMasterMembershipList->FindItem(object_id);
-    if (!member_list)
+    if (oe->FindMembershipIndex(group) < 0)
     {
         ScriptAssert_(GetScriptContext(), 0, "<internal>", -1,
-                      "Error - RemoveMembership() - no membership list for object %d\n", object_id);
+                      "Error - RemoveMembership() - object %d is not a member of the group\n", oe->GetID());
         return;
     }
 
-    // -- ensure the object is actually in the group
-    if (member_list->FindItem(group_id))
-    {
-        member_list->RemoveItem(group_id);
-
-        // -- if this is the last group the object is a member of, we can delete the group
-        if (member_list->Used() == 0)
-        {
-            mMasterMembershipList->RemoveItem(object_id);
-            TinFree(member_list);
-        }
-    }
+    oe->ClearMembership(group);
 
     // -- notify the debugger of the discontinued membership
-    GetScriptContext()->DebuggerNotifySetRemoveObject(group_id, object_id);
+    uint32 group_id = GetScriptContext()->FindIDByAddress(group);
+    GetScriptContext()->DebuggerNotifySetRemoveObject(group_id, oe->GetID());
 }
 
 // ====================================================================================================================
@@ -138,32 +106,140 @@ void CMasterMembershipList::OnDelete(CObjectEntry* oe)
         return;
 
     uint32 objectid = oe->GetID();
-    // -- see if this object belongs to any groups
-    tMembershipList* member_list = mMasterMembershipList->FindItem(oe->GetID());
-    if (member_list)
+    int32 cur_count = oe->GetMembershipCount();
+    while (cur_count > 0)
     {
-        int32 cur_count = member_list->Used();
-        while (cur_count > 1)
-        {
-            CObjectSet* group = member_list->First();
-            group->RemoveObject(objectid);
+        CObjectSet* group = oe->GetMembershipSet(cur_count - 1);
+        group->RemoveObject(objectid);
 
-            // -- ensure our count actually went down
-            int32 new_count = member_list->Used();
-            if (new_count != (cur_count - 1))
-            {
-                //Assert_(false, "Error - CMasterMembershipList::OnDelete() failed to remove object");
-                Assert_(false);
-            }
-            cur_count = new_count;
+        // -- ensure our count actually went down
+        int32 new_count = oe->GetMembershipCount();
+        if (new_count != (cur_count - 1))
+        {
+            //Assert_(false, "Error - CMasterMembershipList::OnDelete() failed to remove object");
+            Assert_(false);
+            break;
         }
+        cur_count = new_count;
+    }
+}
+
+// == class CObjectSet::CSetIterator ==================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CObjectSet::CSetIterator::CSetIterator(CObjectSet* object_set)
+{
+    m_objectSet = object_set;
+    m_objectID = 0;
+    m_position = -1;
+    m_entryWasRemoved = false;
+
+    // -- link to the iterator list
+    m_next = object_set->mIteratorList;
+    if (m_next != nullptr)
+        m_next->m_prev = this;
+    m_prev = nullptr;
+    object_set->mIteratorList = this;
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CObjectSet::CSetIterator::~CSetIterator()
+{
+    // -- unlink from the iterator list
+    if (m_next != nullptr)
+        m_next->m_prev = m_prev;
+    if (m_prev != nullptr)
+        m_prev->m_next = m_next;
+    else
+        m_objectSet->mIteratorList = m_next;
+}
+
+// ====================================================================================================================
+// ResolveRemoved():  If the current object was removed, the iterator refers to the object that followed it.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::CSetIterator::ResolveRemoved()
+{
+    m_entryWasRemoved = false;
+    while (m_position < m_objectSet->mObjectListCount && m_objectSet->mObjectList[m_position] == nullptr)
+        ++m_position;
 
-        // -- delete the last membership entry separately since empty lists
-        // -- auto-delete themselves
-        CObjectSet* group = member_list->First();
-        if (group)
-            group->RemoveObject(objectid);
+    if (m_position >= m_objectSet->mObjectListCount)
+    {
+        m_position = -1;
+        return (nullptr);
     }
+
+    return (m_objectSet->mObjectList[m_position]);
+}
+
+// ====================================================================================================================
+// First():  Set the iterator to the first object in the set.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::CSetIterator::First()
+{
+    m_position = m_objectSet->mFirstIndex;
+    return (ResolveRemoved());
+}
+
+// ====================================================================================================================
+// Next():  Set the iterator to the next object in the set.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::CSetIterator::Next()
+{
+    if (m_position < 0)
+        return (nullptr);
+
+    if (!m_entryWasRemoved)
+        ++m_position;
+
+    return (ResolveRemoved());
+}
+
+// ====================================================================================================================
+// Prev():  Set the iterator to the previous object in the set.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::CSetIterator::Prev()
+{
+    if (m_position < 0)
+        return (nullptr);
+
+    // -- consistent with hash table iterators, if the current object was removed, we return the object that followed
+    if (m_entryWasRemoved)
+        return (ResolveRemoved());
+
+    --m_position;
+    while (m_position >= 0 && m_objectSet->mObjectList[m_position] == nullptr)
+        --m_position;
+
+    return (m_position >= 0 ? m_objectSet->mObjectList[m_position] : nullptr);
+}
+
+// ====================================================================================================================
+// Last():  Set the iterator to the last object in the set.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::CSetIterator::Last()
+{
+    m_entryWasRemoved = false;
+    m_position = m_objectSet->mObjectListCount - 1;
+    while (m_position >= 0 && m_objectSet->mObjectList[m_position] == nullptr)
+        --m_position;
+
+    return (m_position >= 0 ? m_objectSet->mObjectList[m_position] : nullptr);
+}
+
+// ====================================================================================================================
+// Current():  Returns the object the iterator is currently referencing.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::CSetIterator::Current()
+{
+    if (m_position < 0)
+        return (nullptr);
+
+    return (ResolveRemoved());
 }
 
 // == class CObjectSet ================================================================================================
@@ -174,7 +250,17 @@ void CMasterMembershipList::OnDelete(CObjectEntry* oe)
 CObjectSet::CObjectSet()
 {
     mContextOwner = TinScript::GetContext();
-    mObjectList = TinAlloc(ALLOC_ObjectGroup, CHashTable<CObjectEntry>, kObjectGroupTableSize);
+    mObjectListSize = kObjectGroupTableSize;
+    mObjectListCount = 0;
+    mFirstIndex = 0;
+    mUsed = 0;
+    mObjectList = TinAllocArray(ALLOC_ObjectGroup, CObjectEntry*, mObjectListSize);
+    mRankTree = TinAllocArray(ALLOC_ObjectGroup, int32, mObjectListSize + 1);
+    memset(mRankTree, 0, sizeof(int32) * (mObjectListSize + 1));
+
+    // -- we always have one default iterator
+    mIteratorList = nullptr;
+    mDefaultIterator = TinAlloc(ALLOC_ObjectGroup, CSetIterator, this);
 	mIsBeingDestroyed = false;
 }
 
@@ -188,7 +274,264 @@ CObjectSet::~CObjectSet()
 
     // -- use RemoveAll(), as it will call OnRemove cleanly
     RemoveAll();
-    TinFree(mObjectList);
+
+    // -- destroy all iterators - if an iterator is owned by a CGroupIterator object, we destroy the object
+    while (mIteratorList != nullptr)
+    {
+        CSetIterator* iterator = mIteratorList;
+        CObjectEntry* object_entry = GetScriptContext() != nullptr
+                                     ? GetScriptContext()->FindObjectEntry(iterator->m_objectID)
+                                     : nullptr;
+        if (object_entry != nullptr)
+            GetScriptContext()->DestroyObject(object_entry->GetID());
+        else
+            TinFree(iterator);
+    }
+
+    TinFreeArray(mObjectList);
+    TinFreeArray(mRankTree);
+}
+
+// ====================================================================================================================
+// AppendEntry():  Add the object entry to the end of the list, and store its index in the object entry.
+// ====================================================================================================================
+void CObjectSet::AppendEntry(CObjectEntry* oe)
+{
+    if (mObjectListCount >= mObjectListSize)
+        Grow();
+
+    int32 index = mObjectListCount++;
+    mObjectList[index] = oe;
+    AddRank(index, 1);
+    ++mUsed;
+
+    // -- notify the master membership list that an object has been added to a group
+    GetScriptContext()->GetMasterMembershipList()->AddMembership(oe, this, index);
+}
+
+// ====================================================================================================================
+// InsertEntry():  Insert the object entry before the object currently at the given index.
+// ====================================================================================================================
+void CObjectSet::InsertEntry(CObjectEntry* oe, int32 index)
+{
+    // -- if the index is anywhere past the end, simply add
+    if (index >= mUsed)
+    {
+        AppendEntry(oe);
+        return;
+    }
+
+    if (index < 0)
+        index = 0;
+
+    // -- the list must be compact for the index to be the actual position
+    Compact();
+    if (mObjectListCount >= mObjectListSize)
+        Grow();
+
+    // -- shift the later entries, updating their stored index
+    for (int32 i = mObjectListCount; i > index; --i)
+    {
+        mObjectList[i] = mObjectList[i - 1];
+        mObjectList[i]->SetMembershipIndex(this, i);
+    }
+
+    mObjectList[index] = oe;
+    ++mObjectListCount;
+    ++mUsed;
+    RebuildRankTree();
+
+    // -- iterators continue to refer to the same object
+    CSetIterator* iter = mIteratorList;
+    while (iter != nullptr)
+    {
+        if (iter->m_position >= index)
+            ++iter->m_position;
+        iter = iter->m_next;
+    }
+
+    // -- notify the master membership list that an object has been added to a group
+    GetScriptContext()->GetMasterMembershipList()->AddMembership(oe, this, index);
+}
+
+// ====================================================================================================================
+// RemoveEntry():  Remove the object entry, leaving a hole in the list to be compacted later.
+// ====================================================================================================================
+void CObjectSet::RemoveEntry(CObjectEntry* oe)
+{
+    int32 index = oe->FindMembershipIndex(this);
+    if (index < 0)
+        return;
+
+    mObjectList[index] = nullptr;
+    AddRank(index, -1);
+    --mUsed;
+
+    // -- iterators referring to the removed object will continue with the object that followed
+    CSetIterator* iter = mIteratorList;
+    while (iter != nullptr)
+    {
+        if (iter->m_position == index)
+            iter->m_entryWasRemoved = true;
+        iter = iter->m_next;
+    }
+
+    // -- removing the trailing entry doesn't leave a hole
+    while (mObjectListCount > 0 && mObjectList[mObjectListCount - 1] == nullptr)
+        --mObjectListCount;
+
+    // -- leading holes are skipped, so the first object is always found directly
+    if (mObjectListCount == 0)
+        mFirstIndex = 0;
+    else
+    {
+        while (mObjectList[mFirstIndex] == nullptr)
+            ++mFirstIndex;
+    }
+
+    // -- notify the master membership list that an object has been removed from a group
+    GetScriptContext()->GetMasterMembershipList()->RemoveMembership(oe, this);
+
+    // -- indexed lookups don't depend on compaction (see GetEntryByIndex()), so compact only once the holes
+    // outnumber the objects - the cost is amortized across the removals
+    int32 hole_count = mObjectListCount - mUsed;
+    if (hole_count > mUsed && mObjectListCount >= kObjectGroupTableSize)
+        Compact();
+}
+
+// ====================================================================================================================
+// Compact():  Close the holes left by removed objects, updating the indices stored in each object entry.
+// ====================================================================================================================
+void CObjectSet::Compact()
+{
+    if (mObjectListCount == mUsed)
+        return;
+
+    // -- map the iterators first, while the original positions are still valid
+    // -- the new position is the number of objects preceding the old position
+    CSetIterator* iter = mIteratorList;
+    while (iter != nullptr)
+    {
+        if (iter->m_position >= 0)
+        {
+            int32 preceding = CountPreceding(iter->m_position < mObjectListCount ? iter->m_position
+                                                                                  : mObjectListCount);
+
+            // -- if the iterator was on a hole, it now refers to the object that followed it
+            if (iter->m_position >= mObjectListCount || mObjectList[iter->m_position] == nullptr)
+                iter->m_entryWasRemoved = true;
+            iter->m_position = preceding;
+        }
+        iter = iter->m_next;
+    }
+
+    int32 count = 0;
+    for (int32 i = 0; i < mObjectListCount; ++i)
+    {
+        CObjectEntry* oe = mObjectList[i];
+        if (oe == nullptr)
+            continue;
+
+        if (count != i)
+        {
+            mObjectList[count] = oe;
+            oe->SetMembershipIndex(this, count);
+        }
+        ++count;
+    }
+
+    mObjectListCount = count;
+    mFirstIndex = 0;
+    RebuildRankTree();
+}
+
+// ====================================================================================================================
+// Grow():  Double the size of the list.
+// ====================================================================================================================
+void CObjectSet::Grow()
+{
+    int32 new_size = mObjectListSize * 2;
+    CObjectEntry** new_list = TinAllocArray(ALLOC_ObjectGroup, CObjectEntry*, new_size);
+    memcpy(new_list, mObjectList, sizeof(CObjectEntry*) * mObjectListCount);
+    TinFreeArray(mObjectList);
+
+    mObjectList = new_list;
+    mObjectListSize = new_size;
+
+    TinFreeArray(mRankTree);
+    mRankTree = TinAllocArray(ALLOC_ObjectGroup, int32, mObjectListSize + 1);
+    RebuildRankTree();
+}
+
+// ====================================================================================================================
+// AddRank():  Updates the rank tree, as the object list position is occupied (delta 1), or vacated (delta -1).
+// ====================================================================================================================
+void CObjectSet::AddRank(int32 position, int32 delta)
+{
+    for (int32 i = position + 1; i <= mObjectListSize; i += (i & -i))
+        mRankTree[i] += delta;
+}
+
+// ====================================================================================================================
+// CountPreceding():  Returns the number of objects in the list before the given position.
+// ====================================================================================================================
+int32 CObjectSet::CountPreceding(int32 position) const
+{
+    int32 count = 0;
+    for (int32 i = position; i > 0; i -= (i & -i))
+        count += mRankTree[i];
+
+    return (count);
+}
+
+// ====================================================================================================================
+// RebuildRankTree():  Rebuilds the rank tree from the object list, in linear time.
+// ====================================================================================================================
+void CObjectSet::RebuildRankTree()
+{
+    memset(mRankTree, 0, sizeof(int32) * (mObjectListSize + 1));
+    for (int32 i = 1; i <= mObjectListSize; ++i)
+    {
+        if (i <= mObjectListCount && mObjectList[i - 1] != nullptr)
+            ++mRankTree[i];
+
+        // -- each node's count is also included in its parent's
+        int32 parent = i + (i & -i);
+        if (parent <= mObjectListSize)
+            mRankTree[parent] += mRankTree[i];
+    }
+}
+
+// ====================================================================================================================
+// GetEntryByIndex():  Returns the nth object in the set - the rank tree is descended, stepping over any holes.
+// ====================================================================================================================
+CObjectEntry* CObjectSet::GetEntryByIndex(int32 index)
+{
+    if (index < 0 || index >= mUsed)
+        return (nullptr);
+
+    // -- if there are no holes between objects, the position is direct
+    if (mObjectListCount - mFirstIndex == mUsed)
+        return (mObjectList[mFirstIndex + index]);
+
+    // -- otherwise find the position with exactly index objects before it, in O(log n)
+    int32 step = 1;
+    while ((step << 1) <= mObjectListSize)
+        step <<= 1;
+
+    int32 position = 0;
+    int32 remaining = index;
+    for (; step > 0; step >>= 1)
+    {
+        int32 next = position + step;
+        if (next <= mObjectListSize && mRankTree[next] <= remaining)
+        {
+            position = next;
+            remaining -= mRankTree[next];
+        }
+    }
+
+    return (mObjectList[position]);
 }
 
 // ====================================================================================================================
@@ -196,7 +539,8 @@ CObjectSet::~CObjectSet()
 // ====================================================================================================================
 bool8 CObjectSet::Contains(uint32 objectid)
 {
-    bool8 result = mObjectList->FindItem(objectid) != NULL;
+    CObjectEntry* oe = GetScriptContext()->FindObjectEntry(objectid);
+    bool8 result = oe != NULL && oe->FindMembershipIndex(this) >= 0;
     return (result);
 }
 
@@ -219,10 +563,13 @@ bool8 CObjectSet::IsInHierarchy(uint32 objectid)
     }
 
     // -- loop through the child list - if any of them are sets, see if the object is contained within their hierarchy
-    CObjectEntry* child_oe = mObjectList->First();
-    while (child_oe)
+    for (int32 i = 0; i < mObjectListCount; ++i)
     {
-        static uint32 object_set_hash = Hash("CObjectSet");
+        CObjectEntry* child_oe = mObjectList[i];
+        if (child_oe == nullptr)
+            continue;
+
+        const uint32 object_set_hash = HashLiteral_("CObjectSet");
         if (child_oe->HasNamespace(object_set_hash))
         {
             CObjectSet* child_set = static_cast<CObjectSet*>(GetScriptContext()->FindObject(child_oe->GetID()));
@@ -231,9 +578,6 @@ bool8 CObjectSet::IsInHierarchy(uint32 objectid)
                 return (true);
             }
         }
-
-        // -- next child
-        child_oe = mObjectList->Next();
     }
 
     // -- the object is not in the hierarchy
@@ -267,7 +611,7 @@ void CObjectSet::AddObject(uint32 objectid)
     }
 
     // -- ensure we don't create a circular ownership
-    static uint32 object_set_hash = Hash("CObjectSet");
+    const uint32 object_set_hash = HashLiteral_("CObjectSet");
     if (oe->HasNamespace(object_set_hash))
     {
         CObjectSet* object_set = static_cast<CObjectSet*>(GetScriptContext()->FindObject(objectid));
@@ -280,12 +624,9 @@ void CObjectSet::AddObject(uint32 objectid)
         }
     }
 
-    if (!mObjectList->FindItem(objectid))
+    if (oe->FindMembershipIndex(this) < 0)
     {
-        mObjectList->AddItem(*oe, objectid);
-
-        // -- notify the master membership list that an object has been added to a group
-        GetScriptContext()->GetMasterMembershipList()->AddMembership(oe, this);
+        AppendEntry(oe);
 
         // -- automatically call "OnAdd" for the group
         if (GetScriptContext()->HasMethod(this, "OnAdd"))
@@ -313,7 +654,7 @@ void CObjectSet::InsertObject(uint32 objectid, int32 index)
     }
 
     // -- ensure we don't create a circular ownership
-    static uint32 object_set_hash = Hash("CObjectSet");
+    const uint32 object_set_hash = HashLiteral_("CObjectSet");
     if (oe->HasNamespace(object_set_hash))
     {
         CObjectSet* object_set = static_cast<CObjectSet*>(GetScriptContext()->FindObject(objectid));
@@ -326,12 +667,9 @@ void CObjectSet::InsertObject(uint32 objectid, int32 index)
         }
     }
 
-    if (!mObjectList->FindItem(objectid))
+    if (oe->FindMembershipIndex(this) < 0)
     {
-        mObjectList->InsertItem(*oe, objectid, index);
-
-        // -- notify the master membership list that an object has been added to a group
-        GetScriptContext()->GetMasterMembershipList()->AddMembership(oe, this);
+        InsertEntry(oe, index);
 
         // -- automatically call "OnAdd" for the group
         if (GetScriptContext()->HasMethod(this, "OnAdd"))
@@ -354,16 +692,14 @@ void CObjectSet::RemoveObject(uint32 objectid)
         ScriptAssert_(GetScriptContext(), 0, "<internal>", -1,
                       "Error - [%d] CObjectSet::RemoveObject(): unable to find object %d\n",
                       GetScriptContext()->FindObjectByAddress(this)->GetID(), objectid);
+        return;
     }
 
-    if (mObjectList->FindItem(objectid))
+    if (oe->FindMembershipIndex(this) >= 0)
     {
-        mObjectList->RemoveItem(objectid);
+        RemoveEntry(oe);
 
-        // -- notify the master membership list that an object has been added to a group
-        GetScriptContext()->GetMasterMembershipList()->RemoveMembership(oe, this);
-
-        // -- automatically call "OnAdd" for the group
+        // -- automatically call "OnRemove" for the group
         if (GetScriptContext()->HasMethod(this, "OnRemove"))
         {
             int32 dummy = 0;
@@ -380,7 +716,7 @@ void CObjectSet::ListObjects(int32 indent)
     if (indent == 0)
         TinPrint(GetScriptContext(), "\n");
 
-    CObjectEntry* oe = mObjectList->First();
+    CObjectEntry* oe = mDefaultIterator->First();
     while (oe)
     {
         GetScriptContext()->PrintObject(oe, indent);
@@ -393,7 +729,7 @@ void CObjectSet::ListObjects(int32 indent)
         }
 
         // -- next object
-        oe = mObjectList->Next();
+        oe = mDefaultIterator->Next();
     }
 }
 
@@ -402,12 +738,11 @@ void CObjectSet::ListObjects(int32 indent)
 // ====================================================================================================================
 void CObjectSet::RemoveAll()
 {
-    int32 count = mObjectList->Used();
-    while (count > 0)
+    // -- removing from the end never leaves a hole
+    while (mObjectListCount > 0)
     {
-        CObjectEntry* oe = mObjectList->FindItemByIndex(count - 1);
+        CObjectEntry* oe = mObjectList[mObjectListCount - 1];
         RemoveObject(oe->GetID());
-        count = mObjectList->Used();
     }
 }
 
@@ -416,7 +751,7 @@ void CObjectSet::RemoveAll()
 // ====================================================================================================================
 uint32 CObjectSet::First()
 {
-    CObjectEntry* oe = mObjectList->First();
+    CObjectEntry* oe = mDefaultIterator->First();
     if (oe)
         return (oe->GetID());
     else
@@ -428,7 +763,7 @@ uint32 CObjectSet::First()
 // ====================================================================================================================
 uint32 CObjectSet::Next()
 {
-    CObjectEntry* oe = mObjectList->Next();
+    CObjectEntry* oe = mDefaultIterator->Next();
     if (oe)
         return (oe->GetID());
     else
@@ -440,7 +775,7 @@ uint32 CObjectSet::Next()
 // ====================================================================================================================
 uint32 CObjectSet::Prev()
 {
-    CObjectEntry* oe = mObjectList->Prev();
+    CObjectEntry* oe = mDefaultIterator->Prev();
     if (oe)
         return (oe->GetID());
     else
@@ -452,7 +787,7 @@ uint32 CObjectSet::Prev()
 // ====================================================================================================================
 uint32 CObjectSet::Last()
 {
-    CObjectEntry* oe = mObjectList->Last();
+    CObjectEntry* oe = mDefaultIterator->Last();
     if (oe)
         return (oe->GetID());
     else
@@ -464,7 +799,7 @@ uint32 CObjectSet::Last()
 // ====================================================================================================================
 uint32 CObjectSet::Current()
 {
-    CObjectEntry* oe = mObjectList->Current();
+    CObjectEntry* oe = mDefaultIterator->Current();
     if (oe)
         return (oe->GetID());
     else
@@ -476,11 +811,11 @@ uint32 CObjectSet::Current()
 // ====================================================================================================================
 bool8 CObjectSet::IsFirst(uint32 object_id)
 {
-    int32 count = mObjectList->Used();
-    if (count <= 0)
+    // -- leading holes are skipped as they're created
+    if (mUsed <= 0)
         return (false);
 
-    CObjectEntry* oe = mObjectList->FindItemByIndex(0);
+    CObjectEntry* oe = mObjectList[mFirstIndex];
     return (oe->GetID() == object_id);
 }
 
@@ -489,11 +824,11 @@ bool8 CObjectSet::IsFirst(uint32 object_id)
 // ====================================================================================================================
 bool8 CObjectSet::IsLast(uint32 object_id)
 {
-    int32 count = mObjectList->Used();
-    if (count <= 0)
+    // -- the trailing entry is never a hole
+    if (mObjectListCount <= 0)
         return (false);
 
-    CObjectEntry* oe = mObjectList->FindItemByIndex(count - 1);
+    CObjectEntry* oe = mObjectList[mObjectListCount - 1];
     return (oe->GetID() == object_id);
 }
 
@@ -504,11 +839,10 @@ uint32 CObjectSet::CreateIterator()
 {
     // -- find the object entry
     CObjectEntry* oe = GetScriptContext()->FindObjectByAddress(this);
-    CHashTable<CObjectEntry>::CHashTableIterator* newIterator = mObjectList->CreateIterator();
 
     // -- the iterator is a scriptable object
     // $$$TZA the memory tracker records the script file/line for created objects - can we find that here?
-    uint32 iteratorID = TinScript::GetContext()->CreateObject(TinScript::Hash("CGroupIterator"), 0, nullptr);
+    uint32 iteratorID = TinScript::GetContext()->CreateObject(HashLiteral_("CGroupIterator"), 0, nullptr);
     if (iteratorID == 0)
         return (0);
 
@@ -516,6 +850,7 @@ uint32 CObjectSet::CreateIterator()
     CGroupIterator* iteratorObject = (CGroupIterator*)(TinScript::GetContext()->FindObject(iteratorID));
 
     // -- initialize the iterator for the specific group
+    CSetIterator* newIterator = TinAlloc(ALLOC_ObjectGroup, CSetIterator, this);
     iteratorObject->Initialize(oe->GetID(), newIterator, iteratorID);
 
     // -- return the object
@@ -527,20 +862,386 @@ uint32 CObjectSet::CreateIterator()
 // ====================================================================================================================
 int32 CObjectSet::Used()
 {
-    return mObjectList->Used();
+    return (mUsed);
 }
 
 // ====================================================================================================================
-// GetObjectByIndex():  Returns the nth object added to this object set.  Also sets the internal iterator.
+// GetObjectByIndex():  Returns the nth object added to this object set.
 // ====================================================================================================================
 uint32 CObjectSet::GetObjectByIndex(int32 index)
 {
-    // -- sanity check
-    if (index < 0 || index >= Used())
-        return 0;
+    CObjectEntry* oe = GetEntryByIndex(index);
+    return (oe != nullptr ? oe->GetID() : 0);
+}
+
+// ====================================================================================================================
+// tParallelMethodCall:  A registered method call, resolved on the calling thread, to be dispatched by any thread.
+// ====================================================================================================================
+struct tParallelMethodCall
+{
+    void* mObjectAddr;
+    CRegFunctionBase* mRegObject;
+};
+
+// ====================================================================================================================
+// ParallelForEachNativeChunk():  Dispatches a chunk of registered method calls, on a parallel loop pool thread.
+// ====================================================================================================================
+static void ParallelForEachNativeChunk(void* user_data, int32 begin, int32 end)
+{
+    tParallelMethodCall* call_list = (tParallelMethodCall*)user_data;
+
+    // -- registered methods push their return value, which is discarded
+    CExecStack execstack;
+    eVarType return_type;
+    for (int32 i = begin; i < end; ++i)
+    {
+        call_list[i].mRegObject->DispatchFromStack(call_list[i].mObjectAddr, nullptr, execstack);
+        execstack.Pop(return_type);
+    }
+}
+
+// ====================================================================================================================
+// ParallelForEachNative():  Calls the method on every member concurrently - only thread safe registered methods.
+// ====================================================================================================================
+int32 CObjectSet::ParallelForEachNative(const char* method_name)
+{
+    if (method_name == nullptr || !method_name[0] || mUsed == 0)
+        return (0);
+
+    // -- resolve every member on this thread, before any method is called
+    Compact();
+    uint32 method_hash = HashValue(method_name);
+    int32 member_count = mUsed;
+    tParallelMethodCall* call_list = TinAllocArray(ALLOC_ObjectGroup, tParallelMethodCall, member_count);
+    int32 call_count = 0;
+    for (int32 i = 0; i < member_count; ++i)
+    {
+        CObjectEntry* oe = mObjectList[i];
+        CFunctionEntry* fe = oe != nullptr ? oe->GetFunctionEntry(0, method_hash) : nullptr;
+        if (fe == nullptr)
+            continue;
+
+        // -- a registered method can only be dispatched without a context, if it's been registered as thread safe,
+        // it takes no parameters, and its return value doesn't need the string table
+        // -- script methods need a VM, and a script context, so they're never dispatched in parallel
+        CRegFunctionBase* reg_object = fe->GetType() == eFuncTypeRegistered ? fe->GetRegObject() : nullptr;
+        if (reg_object == nullptr || !reg_object->IsThreadSafe() || !reg_object->HasStackDispatch() ||
+            fe->GetContext()->GetParameterCount() != 1 || fe->GetReturnType() == TYPE_string ||
+            fe->GetReturnType() == TYPE_hashtable)
+        {
+            ScriptAssert_(GetScriptContext(), 0, "<internal>", -1,
+                          "Error - ParallelForEachNative(): %s() for object %d is not a thread safe registered method"
+                          " without parameters - no methods called\n", method_name, oe->GetID());
+            TinFreeArray(call_list);
+            return (0);
+        }
+
+        call_list[call_count].mObjectAddr = oe->GetAddr();
+        call_list[call_count].mRegObject = reg_object;
+        ++call_count;
+    }
+
+    // -- the parallel loop returns once every call has completed
+    CParallelForPool::GetInstance()->ParallelFor(call_count, kParallelForChunkSize,
+                                                 ParallelForEachNativeChunk, call_list);
+
+    TinFreeArray(call_list);
+    return (call_count);
+}
+
+// ====================================================================================================================
+// tParallelMemberValue:  A member value copied between contexts - strings are copied as their hash, and found by
+// the other context in the shared string table.
+// ====================================================================================================================
+struct tParallelMemberValue
+{
+    uint32 mHash;
+    eVarType mType;
+    bool8 mIsDynamic;
+    uint32 mValue[MAX_TYPE_SIZE];
+};
+
+// ====================================================================================================================
+// tParallelForEachItem:  A member of the set, copied to be executed within a worker context.
+// ====================================================================================================================
+struct tParallelForEachItem
+{
+    uint32 mObjectID;
+    uint32 mNamespaceHash[kParallelForEachMaxNamespaces];
+    int32 mNamespaceCount;
+
+    // -- the item's members, within the loop's member array
+    int32 mFirstMember;
+    int32 mMemberCount;
+    int32 mMemberCapacity;
+
+    bool8 mSucceeded;
+};
+
+// ====================================================================================================================
+// tParallelForEach:  The items of a parallel loop, and the method each is called with.
+// ====================================================================================================================
+struct tParallelForEach
+{
+    uint32 mMethodHash;
+    tParallelForEachItem* mItems;
+    tParallelMemberValue* mMembers;
+};
+
+// ====================================================================================================================
+// AddSharedString():  Adds the string to the shared string table, so it can be found from any context.
+// ====================================================================================================================
+static void AddSharedString(CScriptContext* script_context, uint32 hash)
+{
+    const char* string = hash != 0 ? script_context->GetStringTable()->FindString(hash) : nullptr;
+    if (string != nullptr && string[0])
+        CSharedStringTable::GetInstance()->AddString(string, -1, hash);
+}
+
+// ====================================================================================================================
+// CopyParallelMemberTable():  Copies the values of the var table's members, returning the updated member count.
+// ====================================================================================================================
+static int32 CopyParallelMemberTable(CObjectEntry* oe, tVarTable* var_table, bool8 is_dynamic,
+                                     tParallelMemberValue* members, int32 count, int32 capacity)
+{
+    if (var_table == nullptr)
+        return (count);
+
+    CScriptContext* script_context = oe->GetScriptContext();
+    CVariableEntry* ve = var_table->First();
+    while (ve != nullptr)
+    {
+        // -- only values are copied - objects and hashtables only exist in their own context
+        eVarType type = ve->GetType();
+        if (!ve->IsArray() && type >= TYPE_string && type <= LAST_VALID_TYPE)
+        {
+            // -- a null member list only counts
+            if (members != nullptr && count < capacity)
+            {
+                tParallelMemberValue& member = members[count];
+                member.mHash = ve->GetHash();
+                member.mType = type;
+                member.mIsDynamic = is_dynamic;
+                memcpy(member.mValue, ve->GetAddr(oe->GetAddr()), gRegisteredTypeSize[type]);
+
+                // -- the other context finds string values, and the names of dynamic members, by hash
+                if (type == TYPE_string)
+                    AddSharedString(script_context, member.mValue[0]);
+                if (is_dynamic)
+                    AddSharedString(script_context, member.mHash);
+            }
+            ++count;
+        }
+        ve = var_table->Next();
+    }
 
-    CObjectEntry* oe = mObjectList->FindItemByIndex(index);
-    return (oe->GetID());
+    return (count);
+}
+
+// ====================================================================================================================
+// CopyParallelMembers():  Copies the object's member values (dynamic, then each namespace's), returning the number
+// of members - more than the capacity, if not every member was copied.
+// ====================================================================================================================
+static int32 CopyParallelMembers(CObjectEntry* oe, tParallelMemberValue* members, int32 capacity)
+{
+    int32 count = CopyParallelMemberTable(oe, oe->GetDynamicVarTable(), true, members, 0, capacity);
+    CNamespace* ns = oe->GetNamespace();
+    while (ns != nullptr)
+    {
+        count = CopyParallelMemberTable(oe, ns->GetVarTable(), false, members, count, capacity);
+        ns = ns->GetNext();
+    }
+
+    return (count);
+}
+
+// ====================================================================================================================
+// ApplyParallelMembers():  Sets the object's members to the copied values, adding dynamic members it doesn't have.
+// ====================================================================================================================
+static void ApplyParallelMembers(CObjectEntry* oe, const tParallelMemberValue* members, int32 count)
+{
+    CScriptContext* script_context = oe->GetScriptContext();
+    for (int32 i = 0; i < count; ++i)
+    {
+        const tParallelMemberValue& member = members[i];
+        CVariableEntry* ve = oe->GetVariableEntry(member.mHash);
+        if (ve == nullptr && member.mIsDynamic && oe->AddDynamicVariable(member.mHash, member.mType))
+            ve = oe->GetVariableEntry(member.mHash);
+
+        // -- a member of a different type (e.g. declared differently by each context) is left unchanged
+        if (ve == nullptr || ve->GetType() != member.mType || ve->IsArray())
+            continue;
+
+        // -- the string must be in this context's string table, before it's referenced
+        if (member.mType == TYPE_string && member.mValue[0] != 0)
+        {
+            const char* string = CSharedStringTable::GetInstance()->FindString(member.mValue[0]);
+            if (string != nullptr)
+                script_context->GetStringTable()->AddString(string, -1, member.mValue[0]);
+        }
+
+        ve->SetValue(oe->GetAddr(), (void*)member.mValue);
+    }
+}
+
+// ====================================================================================================================
+// ParallelForEachChunk():  Executes the method on a copy of each item, within the worker's context.
+// ====================================================================================================================
+static void ParallelForEachChunk(void* user_data, int32 begin, int32 end)
+{
+    tParallelForEach* loop = (tParallelForEach*)user_data;
+    CScriptContext* script_context = GetContext();
+    for (int32 i = begin; i < end; ++i)
+    {
+        tParallelForEachItem& item = loop->mItems[i];
+        tParallelMemberValue* members = &loop->mMembers[item.mFirstMember];
+
+        // -- link the namespace hierarchy, from the base class up, as it is in the calling context
+        CNamespace* parent_ns = nullptr;
+        for (int32 ns_index = item.mNamespaceCount - 1; ns_index >= 0; --ns_index)
+        {
+            CNamespace* ns = script_context->FindNamespace(item.mNamespaceHash[ns_index]);
+            if (ns == nullptr)
+                ns = script_context->FindOrCreateNamespace(UnHash(item.mNamespaceHash[ns_index]));
+            if (parent_ns != nullptr && ns->GetNext() == nullptr)
+                script_context->LinkNamespaces(ns, parent_ns);
+            parent_ns = ns;
+        }
+
+        // -- the copy is created (OnCreate() declaring its members), before the values are set
+        uint32 proxy_id = script_context->CreateObject(item.mNamespaceHash[0], 0);
+        CObjectEntry* proxy_oe = proxy_id != 0 ? script_context->FindObjectEntry(proxy_id) : nullptr;
+        if (proxy_oe == nullptr)
+            continue;
+
+        ApplyParallelMembers(proxy_oe, members, item.mMemberCount);
+        CThreadCommand command(loop->mMethodHash, proxy_id);
+        if (script_context->ExecuteThreadCommand(command))
+        {
+            // -- copy the values back - if the method added more members than there's room for, none are
+            int32 member_count = CopyParallelMembers(proxy_oe, members, item.mMemberCapacity);
+            if (member_count <= item.mMemberCapacity)
+            {
+                item.mMemberCount = member_count;
+                item.mSucceeded = true;
+            }
+            else
+            {
+                TinPrint(script_context, "Error - ParallelForEach(): %s() for object %d added more than %d members\n",
+                         UnHash(loop->mMethodHash), item.mObjectID, kParallelForEachNewMembers);
+            }
+        }
+
+        script_context->DestroyObject(proxy_id);
+    }
+}
+
+// ====================================================================================================================
+// ParallelForEach():  Calls the method on a copy of every member, within the worker contexts, and merges the results.
+// ====================================================================================================================
+int32 CObjectSet::ParallelForEach(const char* method_name)
+{
+    if (method_name == nullptr || !method_name[0] || mUsed == 0)
+        return (0);
+
+    // -- resolve every member on this thread, before any method is called
+    CScriptContext* script_context = GetScriptContext();
+    Compact();
+    uint32 method_hash = Hash(method_name);
+    int32 member_count = mUsed;
+    uint32* object_list = TinAllocArray(ALLOC_ObjectGroup, uint32, member_count);
+    int32 item_count = 0;
+    int32 value_count = 0;
+    for (int32 i = 0; i < member_count; ++i)
+    {
+        CObjectEntry* oe = mObjectList[i];
+        if (oe == nullptr || oe->GetFunctionEntry(0, method_hash) == nullptr)
+            continue;
+
+        object_list[item_count++] = oe->GetID();
+        value_count += CopyParallelMembers(oe, nullptr, 0) + kParallelForEachNewMembers;
+    }
+
+    // -- without a worker pool, call the method on each member in order
+    CScriptWorkerPool* worker_pool = script_context->GetWorkerPool();
+    if (worker_pool == nullptr)
+    {
+        int32 call_count = 0;
+        for (int32 i = 0; i < item_count; ++i)
+        {
+            CThreadCommand command(method_hash, object_list[i]);
+            if (script_context->FindObjectEntry(object_list[i]) != nullptr &&
+                script_context->ExecuteThreadCommand(command))
+            {
+                ++call_count;
+            }
+        }
+
+        TinFreeArray(object_list);
+        return (call_count);
+    }
+
+    // -- copy each member, including its namespace hierarchy, interning every string the workers will need
+    tParallelForEach loop;
+    loop.mMethodHash = method_hash;
+    loop.mItems = TinAllocArray(ALLOC_ObjectGroup, tParallelForEachItem, item_count);
+    loop.mMembers = TinAllocArray(ALLOC_ObjectGroup, tParallelMemberValue, value_count);
+    AddSharedString(script_context, method_hash);
+
+    int32 first_member = 0;
+    for (int32 i = 0; i < item_count; ++i)
+    {
+        CObjectEntry* oe = script_context->FindObjectEntry(object_list[i]);
+        tParallelForEachItem& item = loop.mItems[i];
+        item.mObjectID = object_list[i];
+        item.mNamespaceCount = 0;
+        item.mFirstMember = first_member;
+        item.mMemberCount = CopyParallelMembers(oe, &loop.mMembers[first_member], value_count - first_member);
+        item.mMemberCapacity = item.mMemberCount + kParallelForEachNewMembers;
+        item.mSucceeded = false;
+        first_member += item.mMemberCapacity;
+
+        CNamespace* ns = oe->GetNamespace();
+        while (ns != nullptr && item.mNamespaceCount < kParallelForEachMaxNamespaces)
+        {
+            item.mNamespaceHash[item.mNamespaceCount++] = ns->GetHash();
+            AddSharedString(script_context, ns->GetHash());
+            ns = ns->GetNext();
+        }
+
+        // -- a hierarchy too deep to be copied would create a copy of a different class
+        if (ns != nullptr)
+        {
+            ScriptAssert_(script_context, 0, "<internal>", -1,
+                          "Error - ParallelForEach(): object %d has more than %d namespaces - no methods called\n",
+                          item.mObjectID, kParallelForEachMaxNamespaces);
+            TinFreeArray(loop.mMembers);
+            TinFreeArray(loop.mItems);
+            TinFreeArray(object_list);
+            return (0);
+        }
+    }
+
+    // -- the parallel loop returns once every method has completed
+    worker_pool->ParallelFor(item_count, kParallelForEachChunkSize, ParallelForEachChunk, &loop);
+
+    // -- merge the results in the set's order, skipping any member destroyed by this thread in the meantime
+    int32 call_count = 0;
+    for (int32 i = 0; i < item_count; ++i)
+    {
+        tParallelForEachItem& item = loop.mItems[i];
+        CObjectEntry* oe = item.mSucceeded ? script_context->FindObjectEntry(item.mObjectID) : nullptr;
+        if (oe == nullptr)
+            continue;
+
+        ApplyParallelMembers(oe, &loop.mMembers[item.mFirstMember], item.mMemberCount);
+        ++call_count;
+    }
+
+    TinFreeArray(loop.mMembers);
+    TinFreeArray(loop.mItems);
+    TinFreeArray(object_list);
+    return (call_count);
 }
 
 // == class CObjectGroup ==============================================================================================
@@ -561,18 +1262,16 @@ CObjectGroup::~CObjectGroup()
 	mIsBeingDestroyed = true;
 
 	// -- object groups actually delete their children
-    if (mObjectList)
+    int32 count = Used();
+    while (count > 0)
     {
-        int32 count = mObjectList->Used();
-        while (count > 0)
-        {
-			// -- explicitly remove the object - if there's a registration issue with an object,
-			// this will otherwise become an infinite loop
-            CObjectEntry* oe = mObjectList->FindItemByIndex(count - 1);
-			RemoveObject(oe->GetID());
-            GetScriptContext()->DestroyObject(oe->GetID());
-            count = mObjectList->Used();
-        }
+		// -- explicitly remove the object - if there's a registration issue with an object,
+		// this will otherwise become an infinite loop
+        CObjectEntry* oe = GetEntryByIndex(count - 1);
+        uint32 object_id = oe->GetID();
+		RemoveObject(object_id);
+        GetScriptContext()->DestroyObject(object_id);
+        count = Used();
     }
 }
 
@@ -649,10 +1348,9 @@ CGroupIterator::CGroupIterator()
 }
 
 // ====================================================================================================================
-// Initialize():  Cache the members for the group to iterate on, and the actua hash table iterator.
+// Initialize():  Cache the members for the group to iterate on, and the actual set iterator.
 // ====================================================================================================================
-void CGroupIterator::Initialize(uint32 groupID, CHashTable<CObjectEntry>::CHashTableIterator* iterator,
-                                uint32 iter_object_id)
+void CGroupIterator::Initialize(uint32 groupID, CObjectSet::CSetIterator* iterator, uint32 iter_object_id)
 {
     // -- set the members to cache the group being iterated on, and the actual iterator
     m_groupID = groupID;
@@ -665,7 +1363,7 @@ void CGroupIterator::Initialize(uint32 groupID, CHashTable<CObjectEntry>::CHashT
 // ====================================================================================================================
 CGroupIterator::~CGroupIterator()
 {
-    // -- remove ourself from the hashtable iterator list
+    // -- remove ourself from the set's iterator list
     if (m_iterator != nullptr)
         TinFree(m_iterator);
 }
@@ -821,6 +1519,9 @@ REGISTER_METHOD(CObjectSet, GetObjectByIndex, GetObjectByIndex);
 
 REGISTER_METHOD(CObjectSet, CreateIterator, CreateIterator);
 
+REGISTER_METHOD(CObjectSet, ParallelForEachNative, ParallelForEachNative);
+REGISTER_METHOD(CObjectSet, ParallelForEach, ParallelForEach);
+
 // =====================================================================================================================
 // -- CObjectGroup member/method registration
 REGISTER_SCRIPT_CLASS_BEGIN(CObjectGroup, CObjectSet)
@@ -41,35 +41,64 @@ class CObjectSet;
 class CObjectEntry;
 
 // ====================================================================================================================
-// class CMasterMembershipList: This class is a "reverse lookup", where the has is the objectID, it returns
-// a list of all CObjectSet's that the object is a member of. 
+// class CMasterMembershipList: Maintains the "reverse lookup" - each object entry stores the list of CObjectSet's
+// that the object is a member of, along with the object's index within each set.
 // ====================================================================================================================
 class CMasterMembershipList
 {
     public:
-        typedef CHashTable<CObjectSet> tMembershipList;
-
-        CMasterMembershipList(CScriptContext* script_context = NULL, int32 _size = 0);
+        CMasterMembershipList(CScriptContext* script_context = NULL);
         virtual ~CMasterMembershipList();
 
         CScriptContext* GetScriptContext() { return (mContextOwner); }
 
-        void AddMembership(CObjectEntry* oe, CObjectSet* group);
+        void AddMembership(CObjectEntry* oe, CObjectSet* group, int32 index);
         void RemoveMembership(CObjectEntry* oe, CObjectSet* group);
 
         void OnDelete(CObjectEntry* oe);
 
     private:
         CScriptContext* mContextOwner;
-        CHashTable<tMembershipList>* mMasterMembershipList;
 };
 
 // ====================================================================================================================
 // class CObjectSet: A basic storage class for sets of registered objects
+// -- members are stored in a dense array, in the order added, and each member object stores its index,
+// -- so add, remove and contains are constant time.  A removed member leaves a hole, until the array is compacted.
 // ====================================================================================================================
 class CObjectSet
 {
     public:
+        // ============================================================================================================
+        // class CSetIterator:  Each set maintains a list of current iterators, so if we're in the middle of a loop
+        // iterating through, and an object is inserted/removed, the iterators are automatically updated.
+        // ============================================================================================================
+        class CSetIterator
+        {
+            public:
+                CSetIterator(CObjectSet* object_set);
+                ~CSetIterator();
+
+                CObjectEntry* First();
+                CObjectEntry* Next();
+                CObjectEntry* Prev();
+                CObjectEntry* Last();
+                CObjectEntry* Current();
+
+                // -- members for the iterator content
+                CObjectSet* m_objectSet;
+                uint32 m_objectID;
+                int32 m_position;
+                bool8 m_entryWasRemoved;
+
+                // -- members for maintaining the double linked list
+                CSetIterator* m_next;
+                CSetIterator* m_prev;
+
+            private:
+                CObjectEntry* ResolveRemoved();
+        };
+
         CObjectSet();
         virtual ~CObjectSet();
 
@@ -99,10 +128,52 @@ class CObjectSet
         int32 Used();
         uint32 GetObjectByIndex(int32 index);
 
+        // -- calls the native method on every member, concurrently, by the parallel loop pool, returning the number
+        // called - for script methods, use ParallelForEach()
+        // -- the method must be registered with REGISTER_THREADSAFE_METHOD(), and take no parameters - if any
+        // member's method isn't (e.g. a script method), the call is rejected, and no method is called
+        int32 ParallelForEachNative(const char* method_name);
+
+        // -- calls the (script or registered) method, without parameters, on every member, by the workers of this
+        // context's worker pool, returning the number of members it was successfully called on
+        // -- each member is copied to a worker context:  an object of the same namespace hierarchy is created, its
+        // member values set (OnCreate() is called first), the method is called, and the values are copied back
+        // -- the method may only read and modify its own object's members:  other objects, groups and globals are the
+        // worker context's own, and only string, float, int, bool and vector (not array, object or hashtable)
+        // members are copied, in either direction
+        // -- this is the merge point:  it returns once every method has completed, and the members are updated in
+        // the set's order, so the result doesn't depend on which worker executed which member
+        // -- without a worker pool, the method is called on each member in order, on this thread
+        int32 ParallelForEach(const char* method_name);
+
     protected:
+        CObjectEntry* GetEntryByIndex(int32 index);
+
         CScriptContext* mContextOwner;
-        CHashTable<CObjectEntry>* mObjectList;
 		bool mIsBeingDestroyed = false;
+
+    private:
+        void AppendEntry(CObjectEntry* oe);
+        void InsertEntry(CObjectEntry* oe, int32 index);
+        void RemoveEntry(CObjectEntry* oe);
+        void Compact();
+        void Grow();
+
+        void AddRank(int32 position, int32 delta);
+        int32 CountPreceding(int32 position) const;
+        void RebuildRankTree();
+
+        CObjectEntry** mObjectList;
+        int32 mObjectListSize;
+        int32 mObjectListCount;
+        int32 mFirstIndex;
+        int32 mUsed;
+
+        // -- Fenwick tree counting the occupied positions, so the nth object is found in O(log n), whatever the holes
+        int32* mRankTree;
+
+        CSetIterator* mIteratorList;
+        CSetIterator* mDefaultIterator;
 };
 
 // ====================================================================================================================
@@ -126,7 +197,7 @@ class CGroupIterator
 {
 	public:
         CGroupIterator();
-        void Initialize(uint32 groupID, CHashTable<CObjectEntry>::CHashTableIterator* iterator, uint32 iter_object_id);
+        void Initialize(uint32 groupID, CObjectSet::CSetIterator* iterator, uint32 iter_object_id);
 		virtual ~CGroupIterator();
 
 		uint32 First();
@@ -139,7 +210,7 @@ class CGroupIterator
 
     private:
         uint32 m_groupID;
-        CHashTable<CObjectEntry>::CHashTableIterator* m_iterator;
+        CObjectSet::CSetIterator* m_iterator;
 };
 
 } // TinScript
@@ -40,9 +40,11 @@
 #include "TinScheduler.h"
 #include "TinExecute.h"
 #include "TinExecStack.h"
+#include "TinCoroutine.h"
 #include "TinHashtable.h"
 #include "TinObjectGroup.h"
 #include "TinRegBinding.h"
+#include "mathutil.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -98,9 +100,10 @@ struct tPostUnaryOpEntry
     int32 m_postOpAdjust;
 };
 
+// -- per thread, as each worker context executes its own VM
 const int32 k_maxPostOpEntryCount = 32;
-int32 g_postOpEntryCount = 0;
-tPostUnaryOpEntry g_postOpEntryList[k_maxPostOpEntryCount];
+thread_local int32 g_postOpEntryCount = 0;
+thread_local tPostUnaryOpEntry g_postOpEntryList[k_maxPostOpEntryCount];
 
 bool8 AddPostUnaryOpEntry(eVarType value_type, void* value_addr, int32 adjust)
 {
@@ -632,6 +635,16 @@ bool8 PerformBinaryOpPush(CScriptContext* script_context, CExecStack& execstack,
 		return false;
 	}
 
+    return (PerformBinaryOpValues(script_context, execstack, op, val0type, val0, val1type, val1));
+}
+
+// ====================================================================================================================
+// PerformBinaryOpValues():  Perform the operation on two values already pulled from the stack, through the
+// registered type op overrides, and push the result.
+// ====================================================================================================================
+bool8 PerformBinaryOpValues(CScriptContext* script_context, CExecStack& execstack, eOpCode op,
+                            eVarType val0type, void* val0, eVarType val1type, void* val1)
+{
     // -- see if there's an override for the given types
     // -- NOTE:  We test in type order - float preceeds int, etc...
     eVarType priority_type = val0type < val1type ? val0type : val1type;
@@ -673,8 +686,9 @@ bool8 PerformBinaryOpPush(CScriptContext* script_context, CExecStack& execstack,
 
 // --------------------------------------------------------------------------------------------------------------------
 // -- for consecutive assignments, we need to push the previous assignment result back onto the stack
-eVarType g_lastAssignResultType = TYPE_void;
-uint32 g_lastAssignResultBuffer[MAX_TYPE_SIZE];
+// -- per thread, as each worker context executes its own VM
+thread_local eVarType g_lastAssignResultType = TYPE_void;
+thread_local uint32 g_lastAssignResultBuffer[MAX_TYPE_SIZE];
 
 // ====================================================================================================================
 // PerformAssignOp():  Consolidates all variations of the assignment operation execution.
@@ -1812,6 +1826,164 @@ bool8 OpExecPushMemberVal(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, C
     return (true);
 }
 
+// ====================================================================================================================
+// GetCachedMemberAddr():  Resolve a registered member through the site's cache, validated by the object's namespace.
+// -- returns nullptr if the member is not a registered (offset) member, the caller then uses the generic lookup
+// ====================================================================================================================
+void* GetCachedMemberAddr(CCodeBlock* cb, uint32 site_id, CObjectEntry* oe, uint32 varhash,
+                          CCodeBlock::tMemberCache*& out_cache)
+{
+    CNamespace* obj_ns = oe->GetNamespace();
+    void* objaddr = oe->GetAddr();
+    if (obj_ns == nullptr || objaddr == nullptr)
+        return (nullptr);
+
+    // -- on a miss, find the member through the hierarchy, and cache it if it's accessible by offset
+    // note:  strings, arrays and hashtables all need the variable entry to be accessed
+    CCodeBlock::tMemberCache* cache = cb->GetMemberCache(site_id);
+    if (cache->mNamespaceHash != obj_ns->GetHash())
+    {
+        CVariableEntry* ve = oe->GetVariableEntry(varhash);
+        if (ve == nullptr || ve->IsDynamic() || ve->IsScriptVar() || ve->IsArray() ||
+            ve->GetType() == TYPE_string || ve->GetType() == TYPE_hashtable)
+        {
+            return (nullptr);
+        }
+
+        cache->mNamespaceHash = obj_ns->GetHash();
+        cache->mOffset = ve->GetOffset();
+        cache->mType = ve->GetType();
+        cache->mVarEntry = ve;
+    }
+
+    out_cache = cache;
+    return ((void*)((char*)objaddr + cache->mOffset));
+}
+
+// ====================================================================================================================
+// OpExecPushMemberOffset():  Push an object member (variable) onto the exec stack, through the site's member cache.
+// ====================================================================================================================
+bool8 OpExecPushMemberOffset(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                             CFunctionCallStack& funccallstack)
+{
+    // -- next instructions are the member name, and the cache site
+    uint32 varhash = *instrptr++;
+    uint32 site_id = *instrptr++;
+
+    tStackEntry stack_entry_0;
+    if (!GetStackEntry(cb->GetScriptContext(), execstack, funccallstack, stack_entry_0) ||
+        stack_entry_0.valtype != TYPE_object || stack_entry_0.oe == nullptr)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - ExecStack should contain TYPE_object\n");
+        return false;
+    }
+
+    // -- a registered member is pushed as its type and address, the same as a POD member
+    // -- unless the debugger is watching for writes, which requires the variable entry
+    CCodeBlock::tMemberCache* cache = nullptr;
+    void* member_addr = GetCachedMemberAddr(cb, site_id, stack_entry_0.oe, varhash, cache);
+    if (member_addr != nullptr && !cache->mVarEntry->IsBreakOnWrite())
+    {
+#if BUILD_64
+        uint32 varbuf[3];
+        varbuf[0] = cache->mType;
+        varbuf[1] = kPointer64UpperUInt32(member_addr);
+        varbuf[2] = kPointer64LowerUInt32(member_addr);
+#else
+        uint32 varbuf[2];
+        varbuf[0] = cache->mType;
+        varbuf[1] = (uint32)member_addr;
+#endif
+        execstack.Push((void*)varbuf, TYPE__podmember);
+        DebugTrace(op, "Obj Mem %s: %s", UnHash(varhash), DebugPrintVar(member_addr, cache->mType));
+        return (true);
+    }
+
+    // -- otherwise, push the member to be resolved by its hash
+    if (stack_entry_0.oe->GetVariableEntry(varhash) == nullptr)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - object %d does not contain member: %s\n", stack_entry_0.oe->GetID(),
+                        UnHash(varhash));
+        return false;
+    }
+
+    uint32 member[2];
+    member[0] = stack_entry_0.oe->GetID();
+    member[1] = varhash;
+    execstack.Push((void*)member, TYPE__member);
+    DebugTrace(op, "Obj Mem %s: %s", UnHash(varhash), DebugPrintVar(stack_entry_0.valaddr, stack_entry_0.valtype));
+
+    return (true);
+}
+
+// ====================================================================================================================
+// OpExecPushMemberOffsetVal():  Push an object member value onto the exec stack, through the site's member cache.
+// ====================================================================================================================
+bool8 OpExecPushMemberOffsetVal(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                                CFunctionCallStack& funccallstack)
+{
+    // -- next instructions are the member name, and the cache site
+    uint32 varhash = *instrptr++;
+    uint32 site_id = *instrptr++;
+
+    tStackEntry stack_entry_0;
+    if (!GetStackEntry(cb->GetScriptContext(), execstack, funccallstack, stack_entry_0) ||
+        stack_entry_0.valtype != TYPE_object)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - ExecStack should contain TYPE_object\n");
+        return false;
+    }
+
+    if (stack_entry_0.oe == nullptr)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - Unable to find object %d\n", *(uint32*)stack_entry_0.valaddr);
+        return false;
+    }
+
+    // -- a registered member is a guarded load
+    CCodeBlock::tMemberCache* cache = nullptr;
+    void* member_addr = GetCachedMemberAddr(cb, site_id, stack_entry_0.oe, varhash, cache);
+    if (member_addr != nullptr)
+    {
+        execstack.Push(member_addr, cache->mType);
+        DebugTrace(op, "Obj Mem %s: %s", UnHash(varhash), DebugPrintVar(member_addr, cache->mType));
+        return (true);
+    }
+
+    // -- otherwise, find the variable entry from the object's namespace variable table, or dynamic variables
+    CObjectEntry* oe = stack_entry_0.oe;
+    CVariableEntry* ve = oe->GetVariableEntry(varhash);
+    if (!ve)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - Unable to find member %s for object %d\n",
+                        UnHash(varhash), oe->GetID());
+        return false;
+    }
+
+    // -- an array has no value except itself (the value will be an upcoming arrayhash instruction)
+    if (!ve->IsArray())
+    {
+        void* val = ve->GetAddr(oe->GetAddr());
+        execstack.Push(val, ve->GetType());
+        DebugTrace(op, "Obj Mem %s: %s", UnHash(varhash), DebugPrintVar(val, ve->GetType()));
+    }
+    else
+    {
+        uint32 varbuf[3];
+        varbuf[0] = 0;
+        varbuf[1] = oe->GetID();
+        varbuf[2] = ve->GetHash();
+        execstack.Push((void*)varbuf, TYPE__var);
+    }
+
+    return (true);
+}
+
 // ====================================================================================================================
 // OpExecPushPODMember():  Push the member of a POD type onto the exec stack.
 // ====================================================================================================================
@@ -2009,7 +2181,7 @@ bool8 OpExecForeachIterNext(CCodeBlock* cb, eOpCode op, const uint32*& instrptr,
         uint32 objectid = *(uint32*)stack_entry_container.valaddr;
 
         // -- find the object, and see if it's an object set
-        static uint32 object_set_hash = Hash("CObjectSet");
+        const uint32 object_set_hash = HashLiteral_("CObjectSet");
         CObjectEntry* oe = cb->GetScriptContext()->FindObjectEntry(objectid);
         void* obj_addr = oe != nullptr ? oe->GetAddr() : nullptr;
         if (obj_addr != nullptr && oe->HasNamespace(object_set_hash))
@@ -2206,6 +2378,147 @@ bool8 OpExecMod(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack&
     return (PerformBinaryOpPush(cb->GetScriptContext(), execstack, funccallstack, op));
 }
 
+// ====================================================================================================================
+// PerformVectorOp():  Direct SIMD implementation of vector3f/vector4f add/sub, and scaling by a float or int.
+// Returns false if the operand types aren't a supported combination.
+// ====================================================================================================================
+static bool8 PerformVectorOp(eOpCode op, eVarType& result_type, void* result_addr, eVarType val0type, void* val0,
+                             eVarType val1type, void* val1)
+{
+    // -- add/sub require matching vector types
+    if (op == OP_Add || op == OP_Sub)
+    {
+        if (val0type != val1type)
+            return (false);
+
+        if (val0type == TYPE_vector3f)
+        {
+            const CVector3f& v0 = *(CVector3f*)val0;
+            const CVector3f& v1 = *(CVector3f*)val1;
+            *(CVector3f*)result_addr = (op == OP_Add) ? v0 + v1 : v0 - v1;
+        }
+        else if (val0type == TYPE_vector4f)
+        {
+            const CVector4f& v0 = *(CVector4f*)val0;
+            const CVector4f& v1 = *(CVector4f*)val1;
+            *(CVector4f*)result_addr = (op == OP_Add) ? v0 + v1 : v0 - v1;
+        }
+        else
+            return (false);
+
+        result_type = val0type;
+        return (true);
+    }
+
+    // -- scaling requires a vector and a scalar (in either order for mult, vector first for div)
+    if (op != OP_Mult && op != OP_Div)
+        return (false);
+
+    eVarType vector_type = val0type;
+    void* vector_val = val0;
+    eVarType scalar_type = val1type;
+    void* scalar_val = val1;
+    if (op == OP_Mult && (val1type == TYPE_vector3f || val1type == TYPE_vector4f))
+    {
+        vector_type = val1type;
+        vector_val = val1;
+        scalar_type = val0type;
+        scalar_val = val0;
+    }
+
+    float32 scalar = 0.0f;
+    if (scalar_type == TYPE_float)
+        scalar = *(float32*)scalar_val;
+    else if (scalar_type == TYPE_int)
+        scalar = (float32)(*(int32*)scalar_val);
+    else
+        return (false);
+
+    if (vector_type == TYPE_vector3f)
+    {
+        const CVector3f& v = *(CVector3f*)vector_val;
+        *(CVector3f*)result_addr = (op == OP_Mult) ? v * scalar : v / scalar;
+    }
+    else if (vector_type == TYPE_vector4f)
+    {
+        const CVector4f& v = *(CVector4f*)vector_val;
+        *(CVector4f*)result_addr = (op == OP_Mult) ? v * scalar : v / scalar;
+    }
+    else
+        return (false);
+
+    result_type = vector_type;
+    return (true);
+}
+
+// ====================================================================================================================
+// PerformVectorOpPush():  The typed vector operations are only emitted when the compiler knows the operand types,
+// but the types are still verified here - any mismatch falls back to the registered type op overrides.
+// ====================================================================================================================
+bool8 PerformVectorOpPush(CScriptContext* script_context, CExecStack& execstack, CFunctionCallStack& funccallstack,
+                          eOpCode op)
+{
+	eVarType val0type;
+	void* val0 = NULL;
+	eVarType val1type;
+	void* val1 = NULL;
+	if (!GetBinOpValues(script_context, execstack, funccallstack, val0, val0type, val1, val1type))
+    {
+        TinPrint(TinScript::GetContext(), "Error - failed GetBinopValues() for operation: %s\n",
+				GetOperationString(op));
+		return false;
+	}
+
+    char result[MAX_TYPE_SIZE * sizeof(uint32)];
+    eVarType result_type = TYPE__resolve;
+    if (!PerformVectorOp(op, result_type, (void*)result, val0type, val0, val1type, val1))
+        return (PerformBinaryOpValues(script_context, execstack, op, val0type, val0, val1type, val1));
+
+    // -- apply any post-unary ops (increment/decrement)
+    ApplyPostUnaryOpEntry(val0type, val0);
+    ApplyPostUnaryOpEntry(val1type, val1);
+
+    execstack.Push((void*)result, result_type);
+    DebugTrace(op, "%s", DebugPrintVar(result, result_type));
+    return (true);
+}
+
+// ====================================================================================================================
+// OpExecVectorAdd():  Add operation, with operands known at compile time to be vectors.
+// ====================================================================================================================
+bool8 OpExecVectorAdd(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                      CFunctionCallStack& funccallstack)
+{
+    return (PerformVectorOpPush(cb->GetScriptContext(), execstack, funccallstack, OP_Add));
+}
+
+// ====================================================================================================================
+// OpExecVectorSub():  Sub operation, with operands known at compile time to be vectors.
+// ====================================================================================================================
+bool8 OpExecVectorSub(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                      CFunctionCallStack& funccallstack)
+{
+    return (PerformVectorOpPush(cb->GetScriptContext(), execstack, funccallstack, OP_Sub));
+}
+
+// ====================================================================================================================
+// OpExecVectorMult():  Mult operation, with operands known at compile time to be a vector and a scalar.
+// ====================================================================================================================
+bool8 OpExecVectorMult(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                       CFunctionCallStack& funccallstack)
+{
+    return (PerformVectorOpPush(cb->GetScriptContext(), execstack, funccallstack, OP_Mult));
+}
+
+// ====================================================================================================================
+// OpExecVectorDiv():  Div operation, with operands known at compile time to be a vector and a scalar.
+// ====================================================================================================================
+bool8 OpExecVectorDiv(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                      CFunctionCallStack& funccallstack)
+{
+    return (PerformVectorOpPush(cb->GetScriptContext(), execstack, funccallstack, OP_Div));
+}
+
 // ====================================================================================================================
 // PerformCompareOp():  Perform comparisons, returning success and a float result.
 // ====================================================================================================================
@@ -2422,6 +2735,10 @@ bool8 OpExecBranch(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecSta
     }
 #endif
 
+    // -- a backward branch is a loop's back edge - reclaim the intermediate strings the iteration left behind
+    if (jumpcount < 0)
+        ReclaimTransientStrings(cb->GetScriptContext(), execstack, funccallstack);
+
     DebugTrace(op, "count: %d", jumpcount);
     return (true);
 }
@@ -2470,6 +2787,8 @@ bool8 OpExecBranchCond(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExe
         }
 #endif
 
+        if (jumpcount < 0)
+            ReclaimTransientStrings(cb->GetScriptContext(), execstack, funccallstack);
     }
 
 	DebugTrace(op, "%s, count: %d", *convertAddr ? "true" : "false", jumpcount);
@@ -2540,6 +2859,32 @@ bool8 OpExecFuncDeclEnd(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CEx
     return (true);
 }
 
+// ====================================================================================================================
+// PushFunctionCall():  Push the function entry, and initialize its parameters, before the arguments are assigned.
+// ====================================================================================================================
+static void PushFunctionCall(CFunctionEntry* fe, CExecStack& execstack, CFunctionCallStack& funccallstack)
+{
+    // -- push the function entry onto the call stack
+    // -- we're also going to initialize the parameters to the default values (if set, zero otherwise)
+    // -- note:  registered functions using a stack frame never touch the function context parameters
+    bool8 uses_stack_frame = fe->UsesRegisteredStackFrame();
+    if (!uses_stack_frame)
+        fe->GetContext()->InitDefaultArgs(fe);
+
+    int32 stacktop = execstack.GetStackTop();
+    funccallstack.Push(fe, NULL, stacktop);
+
+    // -- create space on the execstack, if this is a script function, or a registered function's arg frame
+    if (fe->GetType() != eFuncTypeRegistered || uses_stack_frame)
+    {
+        int32 localvarcount = fe->GetContext()->CalculateLocalVarStackSize();
+        execstack.Reserve(localvarcount * MAX_TYPE_SIZE);
+    }
+
+    if (uses_stack_frame)
+        fe->GetContext()->InitDefaultStackArgs(fe, execstack, stacktop);
+}
+
 // ====================================================================================================================
 // OpExecFuncCallArgs():  Preparation to call a function after we've assigned all the arguments.
 // ====================================================================================================================
@@ -2570,20 +2915,9 @@ bool8 OpExecFuncCallArgs(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CE
         return false;
     }
 
-    // -- push the function entry onto the call stack
-    // -- we're also going to initialize the parameters to the default values (if set, zero otherwise)
-    fe->GetContext()->InitDefaultArgs(fe);
-
-    funccallstack.Push(fe, NULL, execstack.GetStackTop());
+    PushFunctionCall(fe, execstack, funccallstack);
     DebugTrace(op, "%s", UnHash(fe->GetHash()));
 
-    // -- create space on the execstack, if this is a script function
-    if (fe->GetType() != eFuncTypeRegistered)
-    {
-        int32 localvarcount = fe->GetContext()->CalculateLocalVarStackSize();
-        execstack.Reserve(localvarcount * MAX_TYPE_SIZE);
-    }
-
     return (true);
 }
 
@@ -2731,18 +3065,24 @@ bool8 OpExecMethodCallArgs(CCodeBlock* cb, eOpCode op, const uint32*& instrptr,
 
     // -- push the function entry onto the call stack
     // -- we're also going to initialize the parameters to the default values (if set, zero otherwise)
-    fe->GetContext()->InitDefaultArgs(fe);
+    bool8 uses_stack_frame = fe->UsesRegisteredStackFrame();
+    if (!uses_stack_frame)
+        fe->GetContext()->InitDefaultArgs(fe);
 
     // -- push the function entry onto the call stack
-    funccallstack.Push(fe, oe, execstack.GetStackTop());
+    int32 stacktop = execstack.GetStackTop();
+    funccallstack.Push(fe, oe, stacktop);
 
-    // -- create space on the execstack, if this is a script function
-    if (fe->GetType() != eFuncTypeRegistered)
+    // -- create space on the execstack, if this is a script function, or a registered method's arg frame
+    if (fe->GetType() != eFuncTypeRegistered || uses_stack_frame)
     {
         int32 localvarcount = fe->GetContext()->CalculateLocalVarStackSize();
         execstack.Reserve(localvarcount * MAX_TYPE_SIZE);
     }
 
+    if (uses_stack_frame)
+        fe->GetContext()->InitDefaultStackArgs(fe, execstack, stacktop);
+
     DebugTrace(op, "obj: %d, ns: %s, func: %s", oe->GetID(), UnHash(nshash),
                UnHash(fe->GetHash()));
     return (true);
@@ -2888,6 +3228,10 @@ bool8 OpExecFuncCall(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecS
         return false;
     }
 
+    // -- if the function called wait(), there's no return value yet - we continue from here once resumed
+    if (funccallstack.IsSuspending())
+        return (true);
+
     // -- the return value of the call is guaranteed - even void is forced to push a 0
     // -- don't pop it, however, as it could also be used in an assignment - use Peek()
     eVarType return_valtype;
@@ -2908,6 +3252,143 @@ bool8 OpExecFuncCall(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecS
     return (true);
 }
 
+// ====================================================================================================================
+// FuncCallNativeFallback():  The function is no longer stack dispatchable (e.g. it's been redefined in script),
+// so the resolved args are assigned to its parameters, exactly as OP_FuncCallArgs, OP_PushParam, OP_Assign would.
+// ====================================================================================================================
+static bool8 FuncCallNativeFallback(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                                    CFunctionCallStack& funccallstack, CFunctionEntry* fe,
+                                    const tDispatchArg* args, int32 arg_count)
+{
+    if (arg_count >= fe->GetContext()->GetParameterCount())
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - too many parameters calling function: %s\n", UnHash(fe->GetHash()));
+        return false;
+    }
+
+    PushFunctionCall(fe, execstack, funccallstack);
+    DebugTrace(op, "%s (fallback)", UnHash(fe->GetHash()));
+
+    // -- parameter 0 is the return value
+    for (int32 i = 0; i < arg_count; ++i)
+    {
+        uint32 varbuf[3];
+        varbuf[0] = fe->GetNamespaceHash();
+        varbuf[1] = fe->GetHash();
+        varbuf[2] = fe->GetContext()->GetParameter(i + 1)->GetHash();
+        execstack.Push((void*)varbuf, TYPE__var);
+        execstack.Push((void*)args[i].value, args[i].type);
+        if (!OpExecAssign(cb, OP_Assign, instrptr, execstack, funccallstack))
+            return false;
+    }
+
+    // -- OP_FuncCall handles the return value, suspension, and a function reloaded by the debugger
+    return (OpExecFuncCall(cb, OP_FuncCall, instrptr, execstack, funccallstack));
+}
+
+// ====================================================================================================================
+// OpExecFuncCallNative():  Call a registered function, with the arguments taken directly from the exec stack.
+// -- the compiler only emits this for global registered functions, called with all of their (value type) arguments,
+// -- so the args are never assigned to the function context's parameters
+// ====================================================================================================================
+bool8 OpExecFuncCallNative(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                           CFunctionCallStack& funccallstack)
+{
+    // -- get the hash of the function name, and the number of arguments pushed
+    uint32 funchash = *instrptr++;
+    int32 arg_count = (int32)(*instrptr++);
+
+    // -- the function may have been redefined since the call was compiled - if it no longer supports stack
+    // dispatch, the args are still popped, and then assigned to its parameters as usual
+    CFunctionEntry* fe = cb->GetScriptContext()->GetGlobalNamespace()->GetFuncTable()->FindItem(funchash);
+    if (!fe)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - undefined function: %s()\n", UnHash(funchash));
+        return false;
+    }
+
+    // -- pop the arguments (in reverse order), resolving each to its value before the function begins executing,
+    // -- as stack variables are relative to the calling function
+    // -- a function (e.g. redefined in script) may take more args than could ever be dispatched - those are
+    // -- resolved into an allocated array, and always assigned by the fallback
+    tDispatchArg stack_args[kMaxRegisteredParameterCount];
+    bool8 exceeds_dispatch = arg_count > kMaxRegisteredParameterCount;
+    tDispatchArg* args = !exceeds_dispatch ? stack_args : TinAllocArray(ALLOC_FuncCallEntry, tDispatchArg, arg_count);
+    for (int32 i = arg_count - 1; i >= 0; --i)
+    {
+        eVarType valtype;
+        void* valaddr = execstack.Pop(valtype);
+        CVariableEntry* ve = NULL;
+        CObjectEntry* oe = NULL;
+        if (!GetStackValue(cb->GetScriptContext(), execstack, funccallstack, valaddr, valtype, ve, oe) ||
+            gRegisteredTypeSize[valtype] > (int32)sizeof(args[i].value))
+        {
+            DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                            "Error - unable to resolve argument %d calling function: %s()\n", i + 1,
+                            UnHash(funchash));
+            if (exceeds_dispatch)
+                TinFreeArray(args);
+            return false;
+        }
+
+        args[i].type = valtype;
+        memset(args[i].value, 0, sizeof(args[i].value));
+        memcpy(args[i].value, valaddr, gRegisteredTypeSize[valtype]);
+    }
+
+    if (exceeds_dispatch)
+    {
+        bool8 result = FuncCallNativeFallback(cb, op, instrptr, execstack, funccallstack, fe, args, arg_count);
+        TinFreeArray(args);
+        return (result);
+    }
+
+    if (!fe->UsesRegisteredStackFrame() || fe->GetContext()->GetParameterCount() != arg_count + 1)
+        return (FuncCallNativeFallback(cb, op, instrptr, execstack, funccallstack, fe, args, arg_count));
+
+    // -- push the function entry onto the call stack, and notify that we're executing
+    // -- (so registered functions calling back into script will see the correct stack)
+    funccallstack.Push(fe, NULL, execstack.GetStackTop());
+    funccallstack.BeginExecution(instrptr - 1);
+    DebugTrace(op, "func: %s", UnHash(fe->GetHash()));
+
+    // -- dispatch - the return value is pushed directly (void functions push a 0)
+    if (!fe->GetRegObject()->DispatchFromStack(NULL, args, execstack))
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - Failure executing function: %s()\n", UnHash(fe->GetHash()));
+        return false;
+    }
+
+    // -- there's no OP_FuncReturn for a registered function - pop the function call stack
+    CObjectEntry* oe = NULL;
+    int32 var_offset = 0;
+    funccallstack.Pop(oe, var_offset);
+
+    // -- an async function suspends the calling script, once we've returned to Execute()
+    if (fe->IsAsync())
+        AsyncCallSuspend(cb->GetScriptContext(), fe, execstack, funccallstack);
+
+    // -- store the return value in the code block, so ExecF has something to retrieve (don't pop it)
+    eVarType return_valtype;
+    CVariableEntry* return_ve = NULL;
+    CObjectEntry* return_oe = NULL;
+    void* return_val = execstack.Peek(return_valtype);
+    if (!GetStackValue(cb->GetScriptContext(), execstack, funccallstack, return_val, return_valtype, return_ve,
+                       return_oe))
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - no return value (even void pushes 0) from function: %s()\n", UnHash(fe->GetHash()));
+        return false;
+    }
+
+    cb->GetScriptContext()->SetFunctionReturnValue(return_val, return_valtype);
+
+    return (true);
+}
+
 // ====================================================================================================================
 // OpExecFuncReturn():  Return from a function operation.
 // ====================================================================================================================
@@ -3034,9 +3515,24 @@ bool8 OpExecArrayHash(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExec
             return false;
         }
 
-        // -- ensure it actually is a string
-        void* val1addr = TypeConvert(cb->GetScriptContext(), stack_entry.valtype, stack_entry.valaddr, TYPE_string);
-		if (val1addr == nullptr)
+        // -- format the value as a string - but only the complete key is hashed, so non-string values
+        // -- (e.g. integer indices) are formatted directly, and not added to the string table
+        const char* val1String = nullptr;
+        if (stack_entry.valtype == TYPE_string)
+        {
+            val1String = UnHash(*(uint32*)stack_entry.valaddr);
+        }
+        else
+        {
+            char* val1Buffer = cb->GetScriptContext()->GetScratchBuffer();
+            if (gRegisteredTypeToString[stack_entry.valtype](cb->GetScriptContext(), stack_entry.valaddr,
+                                                             val1Buffer, kMaxTokenLength))
+            {
+                val1String = val1Buffer;
+            }
+        }
+
+		if (val1String == nullptr)
         {
             DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
                             "Error - Failed to pop string to hash\n");
@@ -3055,7 +3551,6 @@ bool8 OpExecArrayHash(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExec
 
         // -- calculate the updated hash (note:  we only append a '_' between hash string elements)
         // -- this allows us to view a hashtable key of an unappended string, the same as hash(string)
-        const char* val1String = UnHash(*(uint32*)val1addr);
         uint32 hash = *(uint32*)contentptr;
         if (hash != 0)
         {
@@ -3391,7 +3886,7 @@ bool8 OpExecHashtableCopy(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, C
         {
             // -- this is unusual to have the VM reference a registered class directly, however,
             // it is a built-in TinScript class that we use as a way to pass hashtables to registered functions
-            static uint32 has_CHashtable = Hash("CHashtable");
+            const uint32 has_CHashtable = HashLiteral_("CHashtable");
             if (!target_ht_oe->HasNamespace(has_CHashtable))
             {
                 target_ht_oe = nullptr;
@@ -3677,8 +4172,12 @@ bool8 OpExecScheduleBegin(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, C
         return false;
     }
 
-    // -- read the next instruction - see if this is an immediate execution call
-    uint32 immediate_execution = *instrptr++;
+    // -- read the next instruction - see if this is an immediate execution call, and the priority class
+    uint32 schedule_flags = *instrptr++;
+    uint32 immediate_execution = schedule_flags & kScheduleImmediateMask;
+    uint32 priority_flag = schedule_flags >> kSchedulePriorityShift;
+    eSchedulePriority priority = priority_flag > 0 && priority_flag <= eSchedulePriorityCount
+                                 ? (eSchedulePriority)(priority_flag - 1) : eSchedulePriorityNormal;
 
     // -- the function hash will have been pushed most recently
     eVarType contenttype;
@@ -3740,7 +4239,7 @@ bool8 OpExecScheduleBegin(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, C
     cb->GetScriptContext()->GetScheduler()->mCurrentSchedule =
         cb->GetScriptContext()->GetScheduler()->ScheduleCreate(objectid, delaytime, funchash,
                                                                immediate_execution != 0 ? true : false,
-                                                               repeat, schedule_origin);
+                                                               repeat, schedule_origin, priority);
 
     if (objectid > 0)
         DebugTrace(op, "Obj Id [%d] Function: %s", objectid, UnHash(funchash));
@@ -3983,6 +4482,59 @@ bool8 OpExecDestroyObject(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, C
     return (true);
 }
 
+// ====================================================================================================================
+// OpExecWait():  Suspends the VM as a coroutine, for the scheduler to resume after the given number of milliseconds.
+// ====================================================================================================================
+bool8 OpExecWait(CCodeBlock* cb, eOpCode op, const uint32*& instrptr, CExecStack& execstack,
+                 CFunctionCallStack& funccallstack)
+{
+    // -- what will previously have been pushed on the stack, is the wait time
+    tStackEntry stack_entry;
+    if (!GetStackEntry(cb->GetScriptContext(), execstack, funccallstack, stack_entry))
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - ExecStack should contain TYPE_int\n");
+        return false;
+    }
+
+    void* wait_addr = TypeConvert(cb->GetScriptContext(), stack_entry.valtype, stack_entry.valaddr, TYPE_int);
+    if (!wait_addr)
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - wait() requires an int (milliseconds)\n");
+        return false;
+    }
+    int32 wait_ms = *(int32*)wait_addr;
+
+    // -- only a scheduled function can be suspended - anywhere else, there's no one to resume it,
+    // and the caller is waiting on a return value
+    if (!funccallstack.IsResumable())
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - wait()/yield is only valid within a scheduled function - ignored\n");
+        return (true);
+    }
+
+    // -- a pending assignment to an address outside the stack (e.g. obj.position.x = FuncThatWaits();) may not be
+    // valid by the time we resume
+    eVarType address_type = TYPE_NULL;
+    if (!CCoroutine::CanSuspend(execstack, funccallstack, address_type))
+    {
+        DebuggerAssert_(false, cb, instrptr, execstack, funccallstack,
+                        "Error - wait()/yield with a pending %s address on the stack can't be suspended - ignored\n",
+                        GetRegisteredTypeName(address_type));
+        return (true);
+    }
+
+    // -- the coroutine needs a frame for each Execute() level, one per function on the call stack
+    CCoroutine* coroutine = TinAlloc(ALLOC_Coroutine, CCoroutine, cb->GetScriptContext(),
+                                     funccallstack.GetStackDepth(), wait_ms);
+    funccallstack.BeginSuspend(coroutine);
+
+    DebugTrace(op, "wait: %d ms", wait_ms);
+    return (true);
+}
+
 // ====================================================================================================================
 // OpExecEOF():  Notification of the end of the script file.
 // ====================================================================================================================
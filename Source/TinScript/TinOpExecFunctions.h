@@ -65,6 +65,9 @@ bool8 GetBinOpValues(CScriptContext* script_context, CExecStack& execstack,
                      void*& val0, eVarType& val0type,
                       void*& val1, eVarType& val1type);
 
+bool8 PerformBinaryOpValues(CScriptContext* script_context, CExecStack& execstack, eOpCode op,
+                            eVarType val0type, void* val0, eVarType val1type, void* val1);
+
 bool8 ObjectNumericalBinOp(CScriptContext* script_context, eOpCode op, eVarType val0type,
                            void* val0addr, eVarType val1type, void* val1addr, int32& result);
 
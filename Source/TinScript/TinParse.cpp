@@ -39,6 +39,7 @@
 #include "TinStringTable.h"
 #include "TinFunctionEntry.h"
 #include "TinRegBinding.h"
+#include "TinScheduler.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -933,7 +934,7 @@ const char* ReadFileAllocBuf(const char* filename)
     // -- if we didn't (or couldn't) have anything to read...
     if (bytesread <= 0)
     {
-		delete[] filebuf;
+		TinFreeArray(filebuf);
 		fclose(filehandle);
 		return (NULL);
 	}
@@ -2002,6 +2003,12 @@ bool8 TryParseStatement(CCodeBlock* codeblock, tReadToken& filebuf, CCompileTree
         return (true);
     }
 
+    // -- check for a wait or yield statement
+    if (TryParseWait(codeblock, filebuf, link))
+    {
+        return (true);
+    }
+
     // -- check for a create statement
     if (TryParseCreateObject(codeblock, filebuf, link))
     {
@@ -3913,7 +3920,7 @@ bool8 TryParseFuncDefinition(CCodeBlock* codeblock, tReadToken& filebuf, CCompil
 
     // -- first parameter is always the return type
     int32 paramcount = 0;
-    funccontext->AddParameter("__return", Hash("__return"), regreturntype, 1, 0);
+    funccontext->AddParameter("__return", HashLiteral_("__return"), regreturntype, 1, 0);
     ++paramcount;
 
     // -- now we build the parameter list
@@ -4045,7 +4052,7 @@ bool8 TryParseFuncDefinition(CCodeBlock* codeblock, tReadToken& filebuf, CCompil
     // -- see if this is an OnCreate() function, and if we're "deriving" the namespace
     // -- syntax is:  void ChildNamespace::OnCreate() : ParentNamespace { ... }
     uint32 derived_hash = 0;
-    static uint32 oncreate_hash = Hash("OnCreate");
+    const uint32 oncreate_hash = HashLiteral_("OnCreate");
     if (funchash == oncreate_hash && !usenamespace)
     {
         ScriptAssert_(codeblock->GetScriptContext(), 0, codeblock->GetFileName(),
@@ -5207,10 +5214,30 @@ bool8 TryParseSchedule(CCodeBlock* codeblock, tReadToken& filebuf, CCompileTreeN
 
     // -- format is schedule(objid, time, funchash, arg1, ... argn);
     // -- formate is execute(objid, funchash, arg1, ... argn);
+    // -- a schedule or repeat may specify a priority class, e.g. schedule:high(objid, time, funchash, ...);
     // -- ensure the next token is an open parenthesis, making this a function call
     if (!GetToken(peektoken))
         return (false);
 
+    int32 priority = -1;
+    if (peektoken.type == TOKEN_COLON && !immediate_execution)
+    {
+        if (!GetToken(peektoken) || peektoken.type != TOKEN_IDENTIFIER)
+            return (false);
+
+        priority = CScheduler::GetPriorityFromName(peektoken.tokenptr, peektoken.length);
+        if (priority < 0)
+        {
+            ScriptAssert_(codeblock->GetScriptContext(), 0, codeblock->GetFileName(), peektoken.linenumber,
+                          "Error - unknown schedule priority '%.*s', expecting low, normal or high\n",
+                          peektoken.length, peektoken.tokenptr);
+            return (false);
+        }
+
+        if (!GetToken(peektoken))
+            return (false);
+    }
+
     if (peektoken.type != TOKEN_PAREN_OPEN)
         return (false);
 
@@ -5289,7 +5316,7 @@ bool8 TryParseSchedule(CCodeBlock* codeblock, tReadToken& filebuf, CCompileTreeN
     // -- add a CSchedFuncNode node
     CSchedFuncNode* schedulefunc = TinAlloc(ALLOC_TreeNode, CSchedFuncNode, codeblock,
                                             schedulenode->rightchild, filebuf.linenumber,
-                                            immediate_execution);
+                                            immediate_execution, priority);
 
     // -- the left child is the tree resolving to a function hash
     result = TryParseStatement(codeblock, filebuf, schedulefunc->leftchild);
@@ -5502,6 +5529,69 @@ bool8 TryParseDestroyObject(CCodeBlock* codeblock, tReadToken& filebuf, CCompile
     return (true);
 }
 
+// ====================================================================================================================
+// TryParseWait():  "wait(ms);" and "yield;" suspend a scheduled function, to be resumed by the scheduler.
+// ====================================================================================================================
+bool8 TryParseWait(CCodeBlock* codeblock, tReadToken& filebuf, CCompileTreeNode*& link)
+{
+    // -- a wait is a statement, not part of an expression
+    if (gGlobalExprParenDepth > 0)
+        return (false);
+
+    // -- ensure the next token is the 'wait' or 'yield' keyword
+    tReadToken peektoken(filebuf);
+    if (!GetToken(peektoken) || peektoken.type != TOKEN_KEYWORD)
+        return (false);
+
+	int32 reservedwordtype = GetReservedKeywordType(peektoken.tokenptr, peektoken.length);
+    if (reservedwordtype != KEYWORD_wait && reservedwordtype != KEYWORD_yield)
+        return (false);
+
+    // -- committed
+    filebuf = peektoken;
+
+    // -- only a function can be suspended
+    int32 stacktopdummy = 0;
+    CObjectEntry* dummy = NULL;
+    CFunctionEntry* curfunction = codeblock->smFuncDefinitionStack->GetTop(dummy, stacktopdummy);
+    if (curfunction == nullptr)
+    {
+        ScriptAssert_(codeblock->GetScriptContext(), 0, codeblock->GetFileName(), filebuf.linenumber,
+                      "Error - '%s' statement not within a function definition\n",
+                      reservedwordtype == KEYWORD_wait ? "wait" : "yield");
+        return (false);
+    }
+
+    CWaitNode* waitnode = TinAlloc(ALLOC_TreeNode, CWaitNode, codeblock, link, filebuf.linenumber);
+
+    // -- a yield is simply a wait of 0 - resumed on the next scheduler update
+    if (reservedwordtype == KEYWORD_yield)
+    {
+        if (!GetToken(peektoken) || peektoken.type != TOKEN_SEMICOLON)
+        {
+            ScriptAssert_(codeblock->GetScriptContext(), 0, codeblock->GetFileName(), filebuf.linenumber,
+                          "Error - 'yield' found, expecting a ';'\n");
+            return (false);
+        }
+        filebuf = peektoken;
+
+        CValueNode* waittime = TinAlloc(ALLOC_TreeNode, CValueNode, codeblock, waitnode->leftchild,
+                                        filebuf.linenumber, "", 0, false, TYPE_int);
+        Unused_(waittime);
+        return (true);
+    }
+
+    // -- otherwise, the statement is the wait time in milliseconds
+    if (!TryParseStatement(codeblock, filebuf, waitnode->leftchild) || !waitnode->leftchild)
+    {
+        ScriptAssert_(codeblock->GetScriptContext(), 0, codeblock->GetFileName(), filebuf.linenumber,
+                      "Error - 'wait' found, expecting a time (ms) statement, e.g. wait(100);\n");
+        return (false);
+    }
+
+    return (true);
+}
+
 // ====================================================================================================================
 // ParseStatementBlocK():  Parse a sequence of (any type of) statements, delineated by {}'s.
 // ====================================================================================================================
@@ -6440,6 +6530,9 @@ CFunctionEntry* FuncDeclaration(CScriptContext* script_context, CNamespace* nsen
                                                    funchash, type, (void*)NULL);
 	uint32 hash = fe->GetHash();
 	nsentry->GetFuncTable()->AddItem(*fe, hash);
+
+    // -- any cached OnCreate()/OnDestroy() chains may now be stale
+    script_context->InvalidateLifecycleChains();
     return fe;
 }
 
@@ -37,7 +37,8 @@
 // -- Registration macros
 
 #define REGISTER_SCRIPT_CLASS_NO_CONSTRUCT_BEGIN(classname, parentname)                                             \
-    static classname* __##classname##_Create() {                                                                    \
+    static classname* __##classname##_Create(void* addr) {                                                          \
+        Unused_(addr);                                                                                              \
         assert(0 && #classname " cannot be constructed from script");                                               \
         return nullptr;                                                                                             \
     }                                                                                                               \
@@ -50,7 +51,7 @@
                                   ::TinScript::CNamespace* classnamespace);                                         \
     ::TinScript::CNamespaceReg reg_##classname(#classname, #parentname, ::TinScript::GetTypeID<classname*>(),       \
                                                (void*)__##classname##_Create, (void*)__##classname##_Destroy,       \
-                                               (void*)__##classname##_Register);                                    \
+                                               (void*)__##classname##_Register, 0);                                 \
     REGISTER_DEFAULT_METHODS(classname);                                                                            \
     void __##classname##_Register(::TinScript::CScriptContext* script_context,                                      \
                                   ::TinScript::CNamespace* classnamespace)                                          \
@@ -59,21 +60,21 @@
         Unused_(classnamespace);
 
 #define REGISTER_SCRIPT_CLASS_BEGIN(classname, parentname)                                                          \
-    static classname* __##classname##_Create() {                                                                    \
-        classname* newobj = TinAlloc(ALLOC_CreateObj, classname);                                                   \
+    static classname* __##classname##_Create(void* addr) {                                                          \
+        classname* newobj = new (addr) classname();                                                                 \
         return newobj;                                                                                              \
     }                                                                                                               \
     static void __##classname##_Destroy(void* addr) {                                                               \
         if (addr) {                                                                                                 \
             classname* obj = static_cast<classname*>(addr);                                                         \
-            TinFree(obj);                                                                                           \
+            obj->~classname();                                                                                      \
 	    }                                                                                                           \
     }                                                                                                               \
     void __##classname##_Register(::TinScript::CScriptContext* script_context,                                      \
                                   ::TinScript::CNamespace* classnamespace);                                         \
     ::TinScript::CNamespaceReg reg_##classname(#classname, #parentname, ::TinScript::GetTypeID<classname*>(),       \
                                                (void*)__##classname##_Create, (void*)__##classname##_Destroy,       \
-                                               (void*)__##classname##_Register);                                    \
+                                               (void*)__##classname##_Register, sizeof(classname));                 \
     REGISTER_DEFAULT_METHODS(classname);                                                                            \
     void __##classname##_Register(::TinScript::CScriptContext* script_context,                                      \
                                   ::TinScript::CNamespace* classnamespace)                                          \
@@ -87,7 +88,8 @@
 #define REGISTER_MEMBER(classname, scriptname, membername)                                              \
     {                                                                                                   \
         classname* classptr = reinterpret_cast<classname*>(0);                                          \
-        uint32 varhash = ::TinScript::Hash(#scriptname);                                                \
+        uint32 varhash = HashLiteralUnlisted_(#scriptname);                                             \
+        script_context->GetStringTable()->AddString(#scriptname, -1, varhash, true);                    \
         ::TinScript::CVariableEntry* ve =                                                               \
             TinAlloc(ALLOC_VarEntry, ::TinScript::CVariableEntry, script_context, #scriptname, varhash, \
             ::TinScript::GetRegisteredType(::TinScript::GetTypeID(classptr->membername)),               \
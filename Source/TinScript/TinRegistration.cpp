@@ -257,16 +257,21 @@ CFunctionContext* CRegFunctionBase::CreateContext()
     CFunctionContext* found = GetContext();
     if (found == nullptr)
     {
-        CFunctionEntry* fe =
-            new CFunctionEntry(m_ClassNameHash, m_FunctionName, m_FunctionNameHash, eFuncTypeRegistered, this);
+        CFunctionEntry* fe = TinAlloc(ALLOC_FuncEntry, CFunctionEntry, m_ClassNameHash, m_FunctionName,
+                                      m_FunctionNameHash, eFuncTypeRegistered, this);
 
         // -- we also want to be sure the function and class names are in the string table
         if (m_ClassNameHash != 0)
             TinScript::GetContext()->GetStringTable()->AddString(m_ClassName,-1, m_ClassNameHash,true);
         TinScript::GetContext()->GetStringTable()->AddString(m_FunctionName, -1, m_FunctionNameHash, true);
 
-        tFuncTable* methodtable = TinScript::GetContext()->FindNamespace(m_ClassNameHash)->GetFuncTable();
+        // -- a POD method's type namespace is only created by the context that registered the types,
+        // so any other context creates it on demand
+        CNamespace* ns = m_isPODMethod ? TinScript::GetContext()->FindOrCreateNamespace(m_ClassName)
+                                       : TinScript::GetContext()->FindNamespace(m_ClassNameHash);
+        tFuncTable* methodtable = ns->GetFuncTable();
         methodtable->AddItem(*fe, m_FunctionNameHash);
+        TinScript::GetContext()->InvalidateLifecycleChains();
         found = fe->GetContext();
 
         // -- mark this context as a POD method, if applicable -
@@ -278,13 +283,50 @@ CFunctionContext* CRegFunctionBase::CreateContext()
     return (found);
 }
 
+// ====================================================================================================================
+// InitStackFrame():  if all parameters are single values, the function's args are stored on the exec stack
+// -- each VM call reserves its own frame, so the call is reentrant, and the function context is never written to
+// -- a context without an entry for this function (e.g. registered by a different context) is left untouched
+// ====================================================================================================================
+void CRegFunctionBase::InitStackFrame()
+{
+    // -- POD methods assign their parameters by reference
+    if (m_isPODMethod || !HasStackDispatch())
+        return;
+
+    CNamespace* ns = TinScript::GetContext() ? TinScript::GetContext()->FindNamespace(m_ClassNameHash) : nullptr;
+    CFunctionEntry* fe = ns != nullptr ? ns->GetFuncTable()->FindItem(m_FunctionNameHash) : nullptr;
+    CFunctionContext* func_context = fe != nullptr ? fe->GetContext() : nullptr;
+    if (func_context == nullptr || fe->GetRegObject() != this || fe->UsesRegisteredStackFrame() ||
+        func_context->GetParameterCount() > kMaxRegisteredParameterCount + 1)
+    {
+        return;
+    }
+
+    // -- hashtables and arrays are still passed through the parameter variable entries
+    for (int32 i = 0; i < func_context->GetParameterCount(); ++i)
+    {
+        CVariableEntry* ve = func_context->GetParameter(i);
+        eVarType param_type = ve->GetType();
+        if (i == 0 && param_type == TYPE_void)
+            continue;
+
+        if (param_type <= TYPE_hashtable || param_type > LAST_VALID_TYPE || ve->IsArray())
+            return;
+    }
+
+    // -- the frame is the same layout as a script function's parameters
+    func_context->InitStackVarOffsets(fe);
+    fe->SetUsesRegisteredStackFrame();
+}
+
 // ====================================================================================================================
 // GetContext():  returns the function context (parameter list) for a registered function
 // ====================================================================================================================
 CFunctionContext* CRegFunctionBase::GetContext()
 {
     // -- set the flag - this is essentially ensuring we're registered
-    m_isRegistered = true;
+    m_isRegistered.store(true, std::memory_order_relaxed);
 
     // -- if we don't have a TinScript context (registering outside of the context being valid?)
     // or if we don't have a namespace for this registered function
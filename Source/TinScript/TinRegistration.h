@@ -27,6 +27,7 @@
 
 // -- includes
 
+#include <atomic>
 #include <tuple>
 #include <type_traits>
 
@@ -123,15 +124,36 @@ class CRegFunctionBase
 
         virtual void DispatchFunction(void*) = 0;
 
-        bool IsRegistered() const { return m_isRegistered;  }
+        // -- registered functions generated from the variadic templates can also be dispatched with arguments
+        // taken directly from the exec stack, and will push their return value, bypassing the parameter entries
+        virtual bool HasStackDispatch() const { return (false); }
+        virtual bool DispatchFromStack(void*, tDispatchArg*, CExecStack&) { return (false); }
+
+        // -- registered functions dispatched from the exec stack have their parameters assigned to a frame reserved
+        // on the calling VM's exec stack, exactly like a script function, instead of to the shared function context
+        // -- the decision is stored on the current context's function entry - this object is shared by every context
+        void InitStackFrame();
+
+        // -- async functions return a pending handle, and suspend the calling (scheduled) script until it completes
+        bool SetAsync() { m_isAsync = true; return (m_isAsync); }
+        bool IsAsync() const { return (m_isAsync); }
+
+        // -- thread safe methods opt in to being dispatched from threads without a script context
+        bool SetThreadSafe() { m_isThreadSafe = true; return (m_isThreadSafe); }
+        bool IsThreadSafe() const { return (m_isThreadSafe); }
+
+        bool IsRegistered() const { return (m_isRegistered.load(std::memory_order_relaxed)); }
         virtual bool Register() = 0;
         CRegFunctionBase* GetNext() { return (next); }
 
         static CRegFunctionBase* gRegistrationList;
 
     private:
-        bool m_isRegistered = false;
+        // -- set as each context registers, so worker threads may write it concurrently
+        std::atomic<bool> m_isRegistered { false };
         bool m_isPODMethod = false;
+        bool m_isAsync = false;
+        bool m_isThreadSafe = false;
         const char* m_ClassName;
         const char* m_FunctionName;
         uint32 m_ClassNameHash;
@@ -27,7 +27,10 @@
 #include "TinScheduler.h"
 
 // -- includes
+#include <chrono>
+
 #include "stdio.h"
+#include "string.h"
 
 #include "socket.h"
 
@@ -35,6 +38,7 @@
 #include "TinRegistration.h"
 #include "TinInterface.h"
 #include "TinExecute.h"
+#include "TinCoroutine.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -53,6 +57,26 @@ CScheduler::CScheduler(CScriptContext* script_context)
     mCurrentSimTime = 0;
     mCurrentSchedule = NULL;
     mSimTimeScale = 1.0f;
+
+    mFrameBudgetUS = kScheduleDefaultFrameBudget;
+    mMaxDeferralFrames = kScheduleMaxDeferralFrames;
+    for (int32 i = 0; i < eSchedulePriorityCount; ++i)
+    {
+        mReadyHead[i] = NULL;
+        mReadyTail[i] = NULL;
+    }
+    mReadyCount = 0;
+
+    mCoroutineHeap = NULL;
+    mCoroutineHeapSize = 0;
+    mCoroutineHeapCapacity = 0;
+    mCoroutineCount = 0;
+    mCoroutineSequence = 0;
+
+    mAsyncWaiting = NULL;
+    mAsyncWaitCount = 0;
+    mAsyncCompletions = NULL;
+    mAsyncNextHandle.store(1, std::memory_order_relaxed);
 }
 
 // ====================================================================================================================
@@ -67,6 +91,31 @@ CScheduler::~CScheduler()
         TinFree(mHead);
         mHead = next;
     }
+
+    // -- and any due commands carried over
+    for (int32 i = 0; i < eSchedulePriorityCount; ++i)
+    {
+        while (mReadyHead[i])
+            TinFree(PopReady(i));
+    }
+
+    // -- and any suspended coroutines
+    for (int32 i = 0; i < mCoroutineHeapSize; ++i)
+    {
+        if (mCoroutineHeap[i].mCoroutine)
+            TinFree(mCoroutineHeap[i].mCoroutine);
+    }
+    if (mCoroutineHeap)
+        TinFreeArray(mCoroutineHeap);
+
+    // -- and any waiting on an async handle - completions still queued are simply discarded
+    if (mAsyncWaiting)
+    {
+        mAsyncWaiting->DestroyAll();
+        TinFree(mAsyncWaiting);
+    }
+    if (mAsyncCompletions)
+        TinFree(mAsyncCompletions);
 }
 
 // ====================================================================================================================
@@ -76,6 +125,22 @@ void CScheduler::Update(uint32 curtime)
 {
     // -- cache the current time
     mCurrentSimTime = curtime;
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+    // -- completed async calls are ready to resume, along with the coroutines whose wait has elapsed
+    if (mAsyncCompletions != NULL)
+        ProcessAsyncCompletions();
+
+    // -- coroutines are resumed first - they're already part way through, and their wait has elapsed
+    if (mCoroutineHeapSize > 0)
+        ResumeCoroutines(start_time);
+
+    // -- with a frame budget (or due commands still carried over from when we had one), dispatch by priority
+    if (mFrameBudgetUS > 0 || mReadyCount > 0)
+    {
+        UpdateBudgeted(start_time);
+        return;
+    }
 
     // -- execute all commands scheduled for dispatch by this time
     while (mHead && mHead->mDispatchTime <= curtime)
@@ -87,60 +152,468 @@ void CScheduler::Update(uint32 curtime)
             curcommand->mNext->mPrev = NULL;
         mHead = curcommand->mNext;
 
-        // -- notify the debugger
-        DebuggerRemoveSchedule(curcommand->mReqID);
+        DispatchCommand(curcommand);
+    }
+}
+
+// ====================================================================================================================
+// UpdateBudgeted():  Dispatches the due commands by priority class, until the frame budget is spent.
+// ====================================================================================================================
+void CScheduler::UpdateBudgeted(std::chrono::steady_clock::time_point start_time)
+{
+    // -- move every due command to the ready queue for its priority class - within a class, the dispatch order is
+    // preserved, and commands carried over from previous frames stay ahead of the new arrivals
+    while (mHead && mHead->mDispatchTime <= mCurrentSimTime)
+    {
+        CCommand* curcommand = mHead;
+        if (curcommand->mNext)
+            curcommand->mNext->mPrev = NULL;
+        mHead = curcommand->mNext;
+
+        PushReady(curcommand);
+    }
 
-        // -- dispatch the command - see if it's a direct function call, or a command buf
-        if (curcommand->mFuncHash != 0)
+    // -- starvation guarantee:  commands deferred for the max number of frames are dispatched first, regardless
+    // of the budget - being the oldest in their class, they're always at the front of the queue
+    int32 dispatch_count = 0;
+    if (mMaxDeferralFrames > 0)
+    {
+        for (int32 priority = eSchedulePriorityCount - 1; priority >= 0; --priority)
         {
-            if (!ExecuteScheduledFunction(GetScriptContext(), curcommand->mObjectID, 0, curcommand->mFuncHash,
-                                          curcommand->mFuncContext))
+            while (mReadyHead[priority] && mReadyHead[priority]->mDeferredFrames >= mMaxDeferralFrames)
             {
-                const char* command_origin = "";
-#if MEMORY_TRACKER_ENABLE
-                command_origin = curcommand->mCommandOrigin;
-#endif
-                if (command_origin[0] != '\0')
-                {
-                    ScriptAssert_(GetScriptContext(), 0, "<internal>", -1,
-                                  "Error - schedule() failed\norigin: %s\n", command_origin);
+                DispatchCommand(PopReady(priority));
+                ++dispatch_count;
+            }
+        }
+    }
 
-                }
-                else
+    // -- dispatch the rest, highest priority first, until the budget is spent
+    // -- at least one command is dispatched each frame, so a budget smaller than any command still makes progress
+    bool8 budget_spent = false;
+    for (int32 priority = eSchedulePriorityCount - 1; priority >= 0 && !budget_spent; --priority)
+    {
+        while (mReadyHead[priority])
+        {
+            if (dispatch_count > 0 && mFrameBudgetUS > 0)
+            {
+                int64 elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start_time).count();
+                if (elapsed_us >= mFrameBudgetUS)
                 {
-                    ScriptAssert_(GetScriptContext(), 0, "<internal>", -1, "Error - schedule() failed\n");
+                    budget_spent = true;
+                    break;
                 }
             }
+
+            DispatchCommand(PopReady(priority));
+            ++dispatch_count;
         }
-        else
+    }
+
+    // -- whatever is left is carried over to the next frame
+    for (int32 priority = 0; priority < eSchedulePriorityCount; ++priority)
+    {
+        for (CCommand* curcommand = mReadyHead[priority]; curcommand != NULL; curcommand = curcommand->mNext)
+            ++curcommand->mDeferredFrames;
+    }
+}
+
+// ====================================================================================================================
+// DispatchCommand():  Executes a command already removed from the list, and either re-inserts (repeat) or frees it.
+// ====================================================================================================================
+void CScheduler::DispatchCommand(CCommand* curcommand)
+{
+    // -- notify the debugger
+    DebuggerRemoveSchedule(curcommand->mReqID);
+
+    // -- dispatch the command - see if it's a direct function call, or a command buf
+    if (curcommand->mFuncHash != 0)
+    {
+        if (!ExecuteScheduledFunction(GetScriptContext(), curcommand->mObjectID, 0, curcommand->mFuncHash,
+                                      curcommand->mFuncContext, this))
         {
-            if(curcommand->mObjectID > 0)
+            const char* command_origin = "";
+#if MEMORY_TRACKER_ENABLE
+            command_origin = curcommand->mCommandOrigin;
+#endif
+            if (command_origin[0] != '\0')
             {
-                int32 dummy = 0;
-                ObjExecF(curcommand->mObjectID, dummy, curcommand->mCommandBuf);
+                ScriptAssert_(GetScriptContext(), 0, "<internal>", -1,
+                              "Error - schedule() failed\norigin: %s\n", command_origin);
+
             }
             else
             {
-                GetScriptContext()->ExecCommand(curcommand->mCommandBuf);
+                ScriptAssert_(GetScriptContext(), 0, "<internal>", -1, "Error - schedule() failed\n");
             }
         }
-
-        // -- if the command is to be repeated, re-insert it back into the list
-        if (curcommand->mRepeatTime > 0)
+    }
+    else
+    {
+        if(curcommand->mObjectID > 0)
         {
-            // -- first, update the dispatch time
-            curcommand->mDispatchTime = mCurrentSimTime + curcommand->mRepeatTime;
+            int32 dummy = 0;
+            ObjExecF(curcommand->mObjectID, dummy, curcommand->mCommandBuf);
+        }
+        else
+        {
+            GetScriptContext()->ExecCommand(curcommand->mCommandBuf);
+        }
+    }
 
-            // -- insert the command back into the list
-            InsertCommand(curcommand);
+    // -- if the command is to be repeated, re-insert it back into the list
+    if (curcommand->mRepeatTime > 0)
+    {
+        // -- first, update the dispatch time
+        curcommand->mDispatchTime = mCurrentSimTime + curcommand->mRepeatTime;
+        curcommand->mDeferredFrames = 0;
 
-            // -- notify the debugger
-            DebuggerAddSchedule(*curcommand);
+        // -- insert the command back into the list
+        InsertCommand(curcommand);
+
+        // -- notify the debugger
+        DebuggerAddSchedule(*curcommand);
+    }
+    else
+    {
+        // -- delete the command
+        TinFree(curcommand);
+    }
+}
+
+// ====================================================================================================================
+// PushReady():  Appends a due command to the ready queue for its priority class.
+// ====================================================================================================================
+void CScheduler::PushReady(CCommand* command)
+{
+    int32 priority = command->mPriority;
+    command->mNext = NULL;
+    command->mPrev = mReadyTail[priority];
+    if (mReadyTail[priority])
+        mReadyTail[priority]->mNext = command;
+    else
+        mReadyHead[priority] = command;
+    mReadyTail[priority] = command;
+    ++mReadyCount;
+}
+
+// ====================================================================================================================
+// PopReady():  Removes and returns the oldest due command of the given priority class.
+// ====================================================================================================================
+CScheduler::CCommand* CScheduler::PopReady(int32 priority)
+{
+    CCommand* command = mReadyHead[priority];
+    if (command)
+        RemoveReady(command);
+    return (command);
+}
+
+// ====================================================================================================================
+// RemoveReady():  Unlinks a command from the ready queue of its priority class.
+// ====================================================================================================================
+void CScheduler::RemoveReady(CCommand* command)
+{
+    int32 priority = command->mPriority;
+    if (command->mPrev)
+        command->mPrev->mNext = command->mNext;
+    else
+        mReadyHead[priority] = command->mNext;
+    if (command->mNext)
+        command->mNext->mPrev = command->mPrev;
+    else
+        mReadyTail[priority] = command->mPrev;
+    command->mPrev = NULL;
+    command->mNext = NULL;
+    --mReadyCount;
+}
+
+// ====================================================================================================================
+// AddCoroutine():  Takes ownership of a suspended coroutine, to be resumed once its wait has elapsed.
+// ====================================================================================================================
+void CScheduler::AddCoroutine(CCoroutine* coroutine)
+{
+    // -- a coroutine suspended by an async call waits for its handle, not for time
+    int32 async_handle = coroutine->GetAsyncHandle();
+    if (async_handle != 0)
+    {
+        if (mAsyncWaiting == NULL)
+            mAsyncWaiting = TinAlloc(ALLOC_HashTable, CHashTable<CCoroutine>, kAsyncWaitTableSize);
+        mAsyncWaiting->AddItem(*coroutine, (uint32)async_handle);
+        ++mAsyncWaitCount;
+        return;
+    }
+
+    tCoroutineEntry entry;
+    entry.mWakeTime = mCurrentSimTime + (uint32)coroutine->GetWaitTime();
+    entry.mSequence = mCoroutineSequence++;
+    entry.mCoroutine = coroutine;
+    CoroutineHeapPush(entry);
+    ++mCoroutineCount;
+}
+
+// ====================================================================================================================
+// ResumeCoroutines():  Resumes the coroutines whose wait has elapsed, in wake order, within the frame budget.
+// ====================================================================================================================
+void CScheduler::ResumeCoroutines(std::chrono::steady_clock::time_point start_time)
+{
+    // -- a coroutine that waits again while being resumed is re-added with a later sequence, so even a yield (or
+    // a wait shorter than the frame) is resumed on the next update, and never twice within this one
+    uint32 end_sequence = mCoroutineSequence;
+    int32 resume_count = 0;
+    while (mCoroutineHeapSize > 0 && mCoroutineHeap[0].mWakeTime <= mCurrentSimTime &&
+           (int32)(mCoroutineHeap[0].mSequence - end_sequence) < 0)
+    {
+        // -- cancelled coroutines leave an empty entry
+        CCoroutine* coroutine = mCoroutineHeap[0].mCoroutine;
+        if (coroutine == NULL)
+        {
+            CoroutineHeapPop();
+            continue;
         }
+
+        // -- as with commands, at least one is resumed each frame - the rest wait for the next, still in order
+        if (resume_count > 0 && mFrameBudgetUS > 0)
+        {
+            int64 elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start_time).count();
+            if (elapsed_us >= mFrameBudgetUS)
+                break;
+        }
+
+        CoroutineHeapPop();
+        --mCoroutineCount;
+        ResumeCoroutine(this, coroutine);
+        ++resume_count;
+    }
+
+    // -- if cancelled entries make up most of the heap, rebuild it without them
+    if (mCoroutineHeapSize > kCoroutineHeapInitialSize && mCoroutineCount < mCoroutineHeapSize / 2)
+        CoroutineHeapCompact();
+}
+
+// ====================================================================================================================
+// AsyncBegin():  Issues a handle for an async function call - called by the registered function, on the context thread.
+// ====================================================================================================================
+int32 CScheduler::AsyncBegin()
+{
+    // -- the queue must exist before the first handle is visible to another thread
+    if (mAsyncCompletions == NULL)
+        mAsyncCompletions = TinAllocShared(ALLOC_ThreadQueue, CThreadCommandQueue);
+
+    // -- handles are never 0, which is the value of a coroutine that isn't waiting on one
+    int32 handle = mAsyncNextHandle.load(std::memory_order_relaxed);
+    int32 next_handle = handle < 0x7fffffff ? handle + 1 : 1;
+    mAsyncNextHandle.store(next_handle, std::memory_order_release);
+    return (handle);
+}
+
+// ====================================================================================================================
+// AsyncComplete():  Queues the result for an async handle - safe to call from any thread.
+// ====================================================================================================================
+bool8 CScheduler::AsyncComplete(int32 handle, eVarType result_type, const void* result_addr)
+{
+    // -- the acquire ensures we see the queue created by the AsyncBegin() that issued the handle
+    if (handle <= 0)
+        return (false);
+    mAsyncNextHandle.load(std::memory_order_acquire);
+    if (mAsyncCompletions == NULL)
+        return (false);
+
+    // -- only value types can cross threads - a hashtable is owned by the context
+    CThreadCommand completion(0, (uint32)handle);
+    if (result_type > TYPE_hashtable && result_type <= LAST_VALID_TYPE && result_addr != NULL)
+    {
+        if (!completion.AddParam(result_type, result_addr))
+            return (false);
+    }
+    else if (result_type != TYPE_void && result_type != TYPE_NULL)
+    {
+        return (false);
+    }
+
+    return (mAsyncCompletions->Push(completion));
+}
+
+// ====================================================================================================================
+// ProcessAsyncCompletions():  Moves the coroutines whose async call completed into the heap, to resume this frame.
+// ====================================================================================================================
+void CScheduler::ProcessAsyncCompletions()
+{
+    // -- only the completions already queued - any pushed while we process, wait for the next update
+    int32 count = mAsyncCompletions->GetCount();
+    CThreadCommand completion(0, 0);
+    for (int32 i = 0; i < count && mAsyncCompletions->Pop(completion); ++i)
+    {
+        // -- a handle no longer waited on (cancelled, or never awaited), is discarded
+        uint32 handle = completion.GetObjectID();
+        CCoroutine* coroutine = mAsyncWaiting != NULL ? mAsyncWaiting->FindItem(handle) : NULL;
+        if (coroutine == NULL)
+            continue;
+
+        mAsyncWaiting->RemoveItem(handle);
+        --mAsyncWaitCount;
+
+        if (completion.GetParamCount() > 0)
+            coroutine->SetAsyncResult(completion.GetParamType(0), completion.GetParamAddr(0));
         else
+            coroutine->SetAsyncResult(TYPE_void, NULL);
+
+        // -- no longer waiting on the handle, the coroutine is due immediately
+        AddCoroutine(coroutine);
+    }
+}
+
+// ====================================================================================================================
+// CancelCoroutines():  Frees the suspended coroutines executing a method of the object, or the given function.
+// ====================================================================================================================
+void CScheduler::CancelCoroutines(uint32 objectid, CFunctionEntry* fe)
+{
+    // -- note:  freeing a coroutine may destroy its local objects, which cancels again (re-entrant) - the heap
+    // entries are only ever cleared here, never moved
+    for (int32 i = 0; i < mCoroutineHeapSize; ++i)
+    {
+        CCoroutine* coroutine = mCoroutineHeap[i].mCoroutine;
+        if (coroutine == NULL)
+            continue;
+
+        if ((objectid > 0 && coroutine->ReferencesObject(objectid)) ||
+            (fe != NULL && coroutine->ReferencesFunction(fe)))
         {
-            // -- delete the command
-            TinFree(curcommand);
+            mCoroutineHeap[i].mCoroutine = NULL;
+            --mCoroutineCount;
+            TinFree(coroutine);
+        }
+    }
+
+    // -- the coroutines waiting on an async handle are removed from the table before any is freed, so a re-entrant
+    // cancel never sees a coroutine being freed - the completion for the handle will find no one waiting
+    if (mAsyncWaitCount > 0)
+    {
+        CCoroutine** cancelled = TinAllocArray(ALLOC_Coroutine, CCoroutine*, mAsyncWaitCount);
+        int32 cancelled_count = 0;
+        uint32 handle = 0;
+        CCoroutine* coroutine = mAsyncWaiting->First(&handle);
+        while (coroutine != NULL)
+        {
+            if ((objectid > 0 && coroutine->ReferencesObject(objectid)) ||
+                (fe != NULL && coroutine->ReferencesFunction(fe)))
+            {
+                cancelled[cancelled_count++] = coroutine;
+            }
+            coroutine = mAsyncWaiting->Next(&handle);
+        }
+
+        for (int32 i = 0; i < cancelled_count; ++i)
+        {
+            mAsyncWaiting->RemoveItem((uint32)cancelled[i]->GetAsyncHandle());
+            --mAsyncWaitCount;
+        }
+        for (int32 i = 0; i < cancelled_count; ++i)
+            TinFree(cancelled[i]);
+        TinFreeArray(cancelled);
+    }
+}
+
+// ====================================================================================================================
+// NotifyFunctionDeleted():  A suspended coroutine can't resume a function that no longer exists.
+// ====================================================================================================================
+void CScheduler::NotifyFunctionDeleted(CFunctionEntry* fe)
+{
+    if (fe == NULL || GetCoroutineCount() == 0)
+        return;
+    CancelCoroutines(0, fe);
+}
+
+// ====================================================================================================================
+// CoroutineWakesBefore():  The heap order - by wake time, then by the order the coroutines were suspended.
+// ====================================================================================================================
+static bool8 CoroutineWakesBefore(uint32 wake_a, uint32 seq_a, uint32 wake_b, uint32 seq_b)
+{
+    return (wake_a < wake_b || (wake_a == wake_b && (int32)(seq_a - seq_b) < 0));
+}
+
+// ====================================================================================================================
+// CoroutineHeapPush():  Adds an entry to the coroutine heap, growing the heap as needed.
+// ====================================================================================================================
+void CScheduler::CoroutineHeapPush(const tCoroutineEntry& entry)
+{
+    if (mCoroutineHeapSize >= mCoroutineHeapCapacity)
+    {
+        int32 new_capacity = mCoroutineHeapCapacity > 0 ? mCoroutineHeapCapacity * 2 : kCoroutineHeapInitialSize;
+        tCoroutineEntry* new_heap = TinAllocArray(ALLOC_Coroutine, tCoroutineEntry, new_capacity);
+        if (mCoroutineHeap)
+        {
+            memcpy(new_heap, mCoroutineHeap, sizeof(tCoroutineEntry) * mCoroutineHeapSize);
+            TinFreeArray(mCoroutineHeap);
+        }
+        mCoroutineHeap = new_heap;
+        mCoroutineHeapCapacity = new_capacity;
+    }
+
+    // -- sift up
+    int32 index = mCoroutineHeapSize++;
+    while (index > 0)
+    {
+        int32 parent = (index - 1) / 2;
+        if (!CoroutineWakesBefore(entry.mWakeTime, entry.mSequence, mCoroutineHeap[parent].mWakeTime,
+                                  mCoroutineHeap[parent].mSequence))
+        {
+            break;
+        }
+        mCoroutineHeap[index] = mCoroutineHeap[parent];
+        index = parent;
+    }
+    mCoroutineHeap[index] = entry;
+}
+
+// ====================================================================================================================
+// CoroutineHeapPop():  Removes the top (earliest) entry from the coroutine heap.
+// ====================================================================================================================
+void CScheduler::CoroutineHeapPop()
+{
+    if (mCoroutineHeapSize <= 0)
+        return;
+
+    // -- sift the last entry down from the top
+    tCoroutineEntry last = mCoroutineHeap[--mCoroutineHeapSize];
+    int32 index = 0;
+    while (true)
+    {
+        int32 child = index * 2 + 1;
+        if (child >= mCoroutineHeapSize)
+            break;
+        if (child + 1 < mCoroutineHeapSize &&
+            CoroutineWakesBefore(mCoroutineHeap[child + 1].mWakeTime, mCoroutineHeap[child + 1].mSequence,
+                                 mCoroutineHeap[child].mWakeTime, mCoroutineHeap[child].mSequence))
+        {
+            ++child;
+        }
+        if (!CoroutineWakesBefore(mCoroutineHeap[child].mWakeTime, mCoroutineHeap[child].mSequence,
+                                  last.mWakeTime, last.mSequence))
+        {
+            break;
+        }
+        mCoroutineHeap[index] = mCoroutineHeap[child];
+        index = child;
+    }
+    if (mCoroutineHeapSize > 0)
+        mCoroutineHeap[index] = last;
+}
+
+// ====================================================================================================================
+// CoroutineHeapCompact():  Removes the cancelled entries, and rebuilds the heap.
+// ====================================================================================================================
+void CScheduler::CoroutineHeapCompact()
+{
+    int32 count = mCoroutineHeapSize;
+    mCoroutineHeapSize = 0;
+    for (int32 i = 0; i < count; ++i)
+    {
+        if (mCoroutineHeap[i].mCoroutine)
+        {
+            tCoroutineEntry entry = mCoroutineHeap[i];
+            CoroutineHeapPush(entry);
         }
     }
 }
@@ -162,6 +635,34 @@ void CScheduler::SetSimTimeScale(float time_scale)
     }
 }
 
+// ====================================================================================================================
+// SetFrameBudget():  Limits the time (microseconds) spent dispatching schedules each frame, 0 for unlimited.
+// ====================================================================================================================
+void CScheduler::SetFrameBudget(int32 budget_us, int32 max_deferral_frames)
+{
+    mFrameBudgetUS = budget_us > 0 ? budget_us : 0;
+    mMaxDeferralFrames = max_deferral_frames > 0 ? max_deferral_frames : 0;
+}
+
+// ====================================================================================================================
+// GetPriorityFromName():  Returns the priority class for a schedule:<priority>() name, or -1 if not found.
+// ====================================================================================================================
+static const char* gSchedulePriorityNames[eSchedulePriorityCount] = { "low", "normal", "high" };
+int32 CScheduler::GetPriorityFromName(const char* name, int32 length)
+{
+    if (name == nullptr)
+        return (-1);
+
+    for (int32 i = 0; i < eSchedulePriorityCount; ++i)
+    {
+        if ((int32)strlen(gSchedulePriorityNames[i]) == length && !strncmp(name, gSchedulePriorityNames[i], length))
+            return (i);
+    }
+
+    // -- not found
+    return (-1);
+}
+
 // ====================================================================================================================
 // CancelObject():  On destruction of an object, cancel all scheduled method calls.
 // ====================================================================================================================
@@ -170,6 +671,10 @@ void CScheduler::CancelObject(uint32 objectid)
     if(objectid == 0)
         return;
     Cancel(objectid, 0);
+
+    // -- a coroutine suspended within one of the object's methods can't resume either
+    if (GetCoroutineCount() > 0)
+        CancelCoroutines(objectid, NULL);
 }
 
 // ====================================================================================================================
@@ -205,7 +710,7 @@ void CScheduler::Cancel(uint32 objectid, int32 reqid)
 
             // -- we're done, if we have no objectid
             if (objectid == 0)
-                break;
+                return;
         }
         else
         {
@@ -213,6 +718,25 @@ void CScheduler::Cancel(uint32 objectid, int32 reqid)
             curcommand = curcommand->mNext;
         }
     }
+
+    // -- then the due commands, still waiting in the ready queues
+    for (int32 priority = 0; priority < eSchedulePriorityCount; ++priority)
+    {
+        curcommand = mReadyHead[priority];
+        while (curcommand)
+        {
+            CCommand* nextcommand = curcommand->mNext;
+            if ((objectid > 0 && curcommand->mObjectID == objectid) || curcommand->mReqID == reqid)
+            {
+                DebuggerRemoveSchedule(curcommand->mReqID);
+                RemoveReady(curcommand);
+                TinFree(curcommand);
+                if (objectid == 0)
+                    return;
+            }
+            curcommand = nextcommand;
+        }
+    }
 }
 
 // ====================================================================================================================
@@ -220,21 +744,31 @@ void CScheduler::Cancel(uint32 objectid, int32 reqid)
 // ====================================================================================================================
 void CScheduler::Dump()
 {
-    // -- loop through and delete any schedules pending for this object
-    CCommand* curcommand = mHead;
-    while (curcommand)
+    // -- the due commands carried over are listed first, since they'll be dispatched first
+    for (int32 list_index = eSchedulePriorityCount - 1; list_index >= -1; --list_index)
     {
-        if (curcommand->mFuncHash != 0)
-        {
-            TinPrint(GetScriptContext(), "ReqID: %d, ObjID: %d, Function: %s\n", curcommand->mReqID,
-                     curcommand->mObjectID, UnHash(curcommand->mFuncHash));
-        }
-        else
+        // -- loop through and delete any schedules pending for this object
+        CCommand* curcommand = list_index >= 0 ? mReadyHead[list_index] : mHead;
+        while (curcommand)
         {
-            TinPrint(GetScriptContext(), "ReqID: %d, ObjID: %d, Command: %s\n", curcommand->mReqID,
-                     curcommand->mObjectID, curcommand->mCommandBuf);
+            if (curcommand->mFuncHash != 0)
+            {
+                TinPrint(GetScriptContext(), "ReqID: %d, ObjID: %d, Function: %s\n", curcommand->mReqID,
+                         curcommand->mObjectID, UnHash(curcommand->mFuncHash));
+            }
+            else
+            {
+                TinPrint(GetScriptContext(), "ReqID: %d, ObjID: %d, Command: %s\n", curcommand->mReqID,
+                         curcommand->mObjectID, curcommand->mCommandBuf);
+            }
+            curcommand = curcommand->mNext;
         }
-        curcommand = curcommand->mNext;
+    }
+
+    if (GetCoroutineCount() > 0)
+    {
+        TinPrint(GetScriptContext(), "Suspended coroutines: %d (%d waiting on async calls)\n", GetCoroutineCount(),
+                 mAsyncWaitCount);
     }
 }
 
@@ -251,12 +785,15 @@ void CScheduler::DebuggerListSchedules()
     // -- this is a good time to notify the debugger of our current timescale, as it tends to be called "on connect"
     SocketManager::SendCommandf("DebuggerNotifyTimeScale(%f);", mSimTimeScale);
 
-    // -- loop through and delete any schedules pending for this object
-    CCommand* curcommand = mHead;
-    while (curcommand)
+    // -- loop through and delete any schedules pending for this object (due commands carried over included)
+    for (int32 list_index = eSchedulePriorityCount - 1; list_index >= -1; --list_index)
     {
-        DebuggerAddSchedule(*curcommand);
-        curcommand = curcommand->mNext;
+        CCommand* curcommand = list_index >= 0 ? mReadyHead[list_index] : mHead;
+        while (curcommand)
+        {
+            DebuggerAddSchedule(*curcommand);
+            curcommand = curcommand->mNext;
+        }
     }
 }
 
@@ -328,6 +865,9 @@ CScheduler::CCommand::CCommand(CScriptContext* script_context, int32 _reqid, uin
     mNext = nullptr;
     mPrev = nullptr;
 
+    mPriority = eSchedulePriorityNormal;
+    mDeferredFrames = 0;
+
     // -- command string, null out the direct function call members
     mFuncHash = 0;
     mFuncContext = NULL;
@@ -357,6 +897,9 @@ CScheduler::CCommand::CCommand(CScriptContext* script_context, int32 _reqid, uin
     mNext = nullptr;
     mPrev = nullptr;
 
+    mPriority = eSchedulePriorityNormal;
+    mDeferredFrames = 0;
+
     // -- command string, null out the direct function call members
     mFuncHash = _funchash;
     mFuncContext = TinAlloc(ALLOC_FuncContext, CFunctionContext);
@@ -380,7 +923,8 @@ CScheduler::CCommand::~CCommand()
 // Schedule():  Schedule a raw text command.
 // ====================================================================================================================
 static int32 gScheduleID = 0;
-int32 CScheduler::Schedule(uint32 objectid, int32 delay, bool8 repeat, const char* commandstring)
+int32 CScheduler::Schedule(uint32 objectid, int32 delay, bool8 repeat, const char* commandstring,
+                           eSchedulePriority priority)
 {
     ++gScheduleID;
 
@@ -396,6 +940,7 @@ int32 CScheduler::Schedule(uint32 objectid, int32 delay, bool8 repeat, const cha
     // -- create the new command
     CCommand* newcommand = TinAlloc(ALLOC_SchedCmd, CCommand, GetScriptContext(), gScheduleID,
                                     objectid, dispatchtime, repeat_time, commandstring);
+    newcommand->mPriority = priority;
 
     // -- insert the command into the list
     InsertCommand(newcommand);
@@ -444,7 +989,7 @@ void CScheduler::InsertCommand(CCommand* newcommand)
 // ScheduleCreate():  Create a schedule request.
 // ====================================================================================================================
 CScheduler::CCommand* CScheduler::ScheduleCreate(uint32 objectid, int32 delay, uint32 funchash, bool8 immediate,
-                                                 bool8 repeat, const char* call_origin)
+                                                 bool8 repeat, const char* call_origin, eSchedulePriority priority)
 {
     ++gScheduleID;
 
@@ -456,9 +1001,10 @@ CScheduler::CCommand* CScheduler::ScheduleCreate(uint32 objectid, int32 delay, u
     // -- create the new command
     CCommand* newcommand = TinAlloc(ALLOC_SchedCmd, CCommand, GetScriptContext(), gScheduleID,
                                     objectid, dispatchtime, repeat_time, funchash, immediate, call_origin);
+    newcommand->mPriority = priority;
 
     // -- add space to store a return value
-    newcommand->mFuncContext->AddParameter("__return", Hash("__return"), TYPE__resolve, 1, 0);
+    newcommand->mFuncContext->AddParameter("__return", HashLiteral_("__return"), TYPE__resolve, 1, 0);
 
     // -- insert the command into the list
     InsertCommand(newcommand);
@@ -479,7 +1025,7 @@ CScheduler::CCommand* CScheduler::RemoteScheduleCreate(uint32 funchash)
     CCommand* new_command = TinAlloc(ALLOC_SchedCmd, CCommand, GetScriptContext(), -1, 0, 0, 0, funchash, true);
 
     // -- add space to store a return value
-    new_command->mFuncContext->AddParameter("__return", Hash("__return"), TYPE__resolve, 1, 0);
+    new_command->mFuncContext->AddParameter("__return", HashLiteral_("__return"), TYPE__resolve, 1, 0);
 
     // -- return the command
     return (new_command);
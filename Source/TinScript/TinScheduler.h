@@ -25,7 +25,11 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "integration.h"
+#include "TinHash.h"
+#include "TinThreadQueue.h"
 
 // == namespace TinScript =============================================================================================
 
@@ -35,6 +39,25 @@ namespace TinScript
 // --------------------------------------------------------------------------------------------------------------------
 // -- forward declarations
 class CFunctionContext;
+class CFunctionEntry;
+class CCoroutine;
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- schedule priority classes, only meaningful when the scheduler has a frame budget
+// -- in script:  schedule:high(...), repeat:low(...) - a schedule without a class is normal priority
+enum eSchedulePriority
+{
+    eSchedulePriorityLow,
+    eSchedulePriorityNormal,
+    eSchedulePriorityHigh,
+
+    eSchedulePriorityCount
+};
+
+// -- the OP_ScheduleBegin operand holds the immediate flag in the low byte, and (priority + 1) in the next,
+// so a zero means "unspecified", and defaults to normal
+const uint32 kScheduleImmediateMask = 0xff;
+const uint32 kSchedulePriorityShift = 8;
 
 // ====================================================================================================================
 // class CScheduler:  Manages the requests for deferred function and method calls.
@@ -54,6 +77,34 @@ class CScheduler
         float GetSimTimeScale() const { return (mSimTimeScale); }
         void SetSimTimeScale(float sim_time_scale);
 
+        // -- a budget of 0 (the default) dispatches every due command, in dispatch time order
+        // -- otherwise, due commands are dispatched by priority class until the budget (microseconds) is spent,
+        // and the rest are carried over - a command deferred for max_deferral_frames is dispatched regardless
+        void SetFrameBudget(int32 budget_us, int32 max_deferral_frames = kScheduleMaxDeferralFrames);
+        int32 GetFrameBudget() const { return (mFrameBudgetUS); }
+        int32 GetMaxDeferralFrames() const { return (mMaxDeferralFrames); }
+
+        // -- the number of due commands carried over from the previous frame
+        int32 GetBacklogCount() const { return (mReadyCount); }
+
+        // -- returns the priority class for a name (e.g. "high"), or -1 if not found
+        static int32 GetPriorityFromName(const char* name, int32 length);
+
+        // -- coroutines are scheduled functions suspended by wait() - the scheduler owns them, and resumes each
+        // in place once its wait has elapsed, ahead of the commands due that frame
+        // -- a coroutine suspended by an async function call instead waits until its handle is completed
+        void AddCoroutine(CCoroutine* coroutine);
+        void NotifyFunctionDeleted(CFunctionEntry* fe);
+        int32 GetCoroutineCount() const { return (mCoroutineCount + mAsyncWaitCount); }
+        int32 GetAsyncWaitCount() const { return (mAsyncWaitCount); }
+
+        // -- async functions:  the registered function calls AsyncBegin() (context thread only) and returns the handle,
+        // and the host later calls AsyncComplete() from any thread - the value (TYPE_void for none) is copied, and
+        // delivered to the suspended script during the next Update()
+        // -- AsyncComplete() returns false if the completion queue is full, or no handle was ever issued
+        int32 AsyncBegin();
+        bool8 AsyncComplete(int32 handle, eVarType result_type, const void* result_addr);
+
         // ============================================================================================================
         // class CCommand: Stores the details of a a deferred function/method call request.
         // ============================================================================================================
@@ -81,6 +132,9 @@ class CScheduler
                 bool8 mImmediateExec;
                 char mCommandBuf[kMaxTokenLength];
 
+                eSchedulePriority mPriority;
+                int32 mDeferredFrames;
+
                 uint32 mFuncHash;
                 CFunctionContext* mFuncContext;
 
@@ -89,7 +143,8 @@ class CScheduler
 #endif
         };
 
-        int32 Schedule(uint32 objectid, int32 delay, bool8 repeat, const char* commandstring);
+        int32 Schedule(uint32 objectid, int32 delay, bool8 repeat, const char* commandstring,
+                       eSchedulePriority priority = eSchedulePriorityNormal);
         void CancelObject(uint32 objectid);
         void CancelRequest(int32 reqid);
         void Cancel(uint32 objectid, int32 reqid);
@@ -102,7 +157,8 @@ class CScheduler
 
         void InsertCommand(CCommand* curcommand);
         CCommand* ScheduleCreate(uint32 objectid, int32 delay, uint32 funchash, bool8 immediate, bool8 repeat,
-                                 const char* call_origin = nullptr);
+                                 const char* call_origin = nullptr,
+                                 eSchedulePriority priority = eSchedulePriorityNormal);
         CScheduler::CCommand* mCurrentSchedule;
 
         // -- an optimized way of allowing a remote connection to execute a function locally, without having to
@@ -110,11 +166,53 @@ class CScheduler
         CCommand* RemoteScheduleCreate(uint32 funchash);
 
     private:
+        void UpdateBudgeted(std::chrono::steady_clock::time_point start_time);
+        void DispatchCommand(CCommand* curcommand);
+        void PushReady(CCommand* command);
+        CCommand* PopReady(int32 priority);
+        void RemoveReady(CCommand* command);
+
+        struct tCoroutineEntry
+        {
+            uint32 mWakeTime;
+            uint32 mSequence;
+            CCoroutine* mCoroutine;
+        };
+
+        void ResumeCoroutines(std::chrono::steady_clock::time_point start_time);
+        void CancelCoroutines(uint32 objectid, CFunctionEntry* fe);
+        void CoroutineHeapPush(const tCoroutineEntry& entry);
+        void CoroutineHeapPop();
+        void CoroutineHeapCompact();
+        void ProcessAsyncCompletions();
+
         CScriptContext* mContextOwner;
 
         CCommand* mHead;
         uint32 mCurrentSimTime;
         float mSimTimeScale;
+
+        // -- due commands waiting for budget, a FIFO per priority class, carried over from frame to frame
+        int32 mFrameBudgetUS;
+        int32 mMaxDeferralFrames;
+        CCommand* mReadyHead[eSchedulePriorityCount];
+        CCommand* mReadyTail[eSchedulePriorityCount];
+        int32 mReadyCount;
+
+        // -- suspended coroutines, a binary min-heap on (wake time, sequence) - a cancelled coroutine is freed
+        // immediately, but its entry stays in the heap (null) until it reaches the top
+        tCoroutineEntry* mCoroutineHeap;
+        int32 mCoroutineHeapSize;
+        int32 mCoroutineHeapCapacity;
+        int32 mCoroutineCount;
+        uint32 mCoroutineSequence;
+
+        // -- coroutines waiting on an async handle, and the (lock free) queue of completions from any thread
+        // -- both are created with the first async call
+        CHashTable<CCoroutine>* mAsyncWaiting;
+        int32 mAsyncWaitCount;
+        CThreadCommandQueue* mAsyncCompletions;
+        std::atomic<int32> mAsyncNextHandle;
 };
 
 } // TinScript
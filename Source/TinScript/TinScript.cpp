@@ -37,6 +37,7 @@
 #include <chrono>
 #include <iostream>
 #include <iomanip>
+#include <sys/stat.h>
 
 #include "socket.h"
 #include "TinHash.h"
@@ -73,7 +74,7 @@ const char* CScriptContext::kGlobalNamespace = "_global";
 uint32 CScriptContext::kGlobalNamespaceHash = Hash(CScriptContext::kGlobalNamespace);
 
 // -- this is a *thread* variable, each thread can reference a separate context
-_declspec(thread) CScriptContext* gThreadContext = NULL;
+thread_local CScriptContext* gThreadContext = NULL;
 CScriptContext* gMainThreadContext = NULL;
 
 // == Interface implementation ========================================================================================
@@ -81,9 +82,10 @@ CScriptContext* gMainThreadContext = NULL;
 // ====================================================================================================================
 // CreateContext():  Creates a singleton context, max of one for each thread
 // ====================================================================================================================
-CScriptContext* CreateContext(TinPrintHandler printhandler, TinAssertHandler asserthandler, bool is_main_thread)
+CScriptContext* CreateContext(TinPrintHandler printhandler, TinAssertHandler asserthandler, bool is_main_thread,
+                              CScriptAllocator* allocator)
 {
-    CScriptContext* script_context = CScriptContext::Create(printhandler, asserthandler, is_main_thread);
+    CScriptContext* script_context = CScriptContext::Create(printhandler, asserthandler, is_main_thread, allocator);
     return (script_context);
 }
 
@@ -194,6 +196,17 @@ void SetTimeScale(float time_scale)
     script_context->GetScheduler()->SetSimTimeScale(time_scale);
 }
 
+// ====================================================================================================================
+// SetScheduleBudget():  Limits the time (microseconds) spent dispatching schedules each frame, 0 for unlimited
+// -- due schedules over budget are carried over, but never for more than max_deferral_frames
+// ====================================================================================================================
+void SetScheduleBudget(int32 budget_us, int32 max_deferral_frames)
+{
+    CScriptContext* script_context = GetContext();
+    assert(script_context != NULL);
+    script_context->GetScheduler()->SetFrameBudget(budget_us, max_deferral_frames);
+}
+
 // -- Registration ----------------------------------------------------------------------------------------------------
 
 REGISTER_FUNCTION(Compile, CompileScript);
@@ -233,7 +246,7 @@ void CScriptContext::ResetAssertStack()
 // Create():  Static interface - only one context per thread
 // ====================================================================================================================
 CScriptContext* CScriptContext::Create(TinPrintHandler printhandler, TinAssertHandler asserthandler,
-                                       bool is_main_thread)
+                                       bool is_main_thread, CScriptAllocator* allocator)
 {
     // -- only one script context per thread
     if (gThreadContext != NULL)
@@ -243,7 +256,7 @@ CScriptContext* CScriptContext::Create(TinPrintHandler printhandler, TinAssertHa
     }
 
     // -- set the thread context
-    TinAlloc(ALLOC_ScriptContext, CScriptContext, printhandler, asserthandler, is_main_thread);
+    TinAlloc(ALLOC_ScriptContext, CScriptContext, printhandler, asserthandler, is_main_thread, allocator);
     return (gThreadContext);
 }
 
@@ -261,9 +274,18 @@ void CScriptContext::Destroy()
     // -- atm, this only sets a bool and prevents thread commands from processing
     gThreadContext->ThreadShutdown();
 
+    // -- the parallel loop threads are shared by every context, and shut down with the main thread
+    if (gThreadContext->IsMainThread())
+        CParallelForPool::Shutdown();
+
     // -- shutdown the memory tracker
     CMemoryTracker::Shutdown();
 
+    // -- the allocator outlives the context, so everything the context owns can still be freed
+    CScriptAllocator* allocator = gThreadContext->mAllocator;
+    bool8 owns_allocator = gThreadContext->mOwnsAllocator;
+    TinPrintHandler print_handler = gThreadContext->GetPrintHandler();
+
     // -- cleanup the namespace context
     // -- note:  the global namespace is owned by the namespace dictionary
     // -- within the context - it'll be automatically cleaned up
@@ -286,12 +308,22 @@ void CScriptContext::Destroy()
     // -- clean up the scheduler
     TinFree(gThreadContext->mScheduler);
 
+    // -- objects are all destroyed, so any notifications still queued are discarded
+    TinFree(gThreadContext->mDebuggerSync);
+
+    // -- any thread commands still queued are discarded
+    TinFree(gThreadContext->mThreadCommandQueue);
+
     // -- cleanup the membership list
     TinFree(gThreadContext->mMasterMembershipList);
 
     // -- clean up the string table
     TinFree(gThreadContext->mStringTable);
 
+    // -- the shared string table is used by threads without a context, so it's freed with the main thread context
+    if (gThreadContext->mIsMainThread)
+        CSharedStringTable::Shutdown();
+
     // -- clean up the CHashtable class
     CHashtable::Shutdown();
 
@@ -309,16 +341,36 @@ void CScriptContext::Destroy()
 	CScriptContext* currentContext = gThreadContext;
 	gThreadContext = NULL;
 	TinFree(currentContext);
+
+    // -- free the blocks returned from other threads, and report anything the context never freed
+    // -- the allocator is released regardless (a pool allocator releases its pools in bulk), so nothing may
+    // free those blocks later
+    CMemoryTracker::SetThreadAllocator(nullptr);
+    allocator->ProcessRemoteFrees();
+    allocator->ReportLiveBlocks(print_handler);
+    if (owns_allocator)
+        allocator->Release();
 }
 
 // ====================================================================================================================
 // Constructor
 // ====================================================================================================================
-CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler asserthandler, bool is_main_thread)
+CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler asserthandler, bool is_main_thread,
+                               CScriptAllocator* allocator)
 {
     // -- set the flag
     mIsMainThread = is_main_thread;
 
+    // -- set the allocator first, as every allocation from here on is served by it
+    // -- note:  the allocator itself comes from the heap, as it can't allocate itself
+    mOwnsAllocator = (allocator == nullptr);
+    mAllocator = allocator != nullptr ? allocator : new CPoolAllocator();
+    CMemoryTracker::SetThreadAllocator(mAllocator);
+
+    // -- the object creation tracking is only performed on the main thread
+    if (is_main_thread)
+        CMemoryTracker::Initialize();
+
     // -- initialize the ID generator
     mObjectIDGenerator = 0;
 
@@ -334,7 +386,7 @@ CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler a
     }
 
     // -- initialize and populate the string table
-    mStringTable = TinAlloc(ALLOC_StringTable, CStringTable, this, kStringTableSize);
+    mStringTable = TinAlloc(ALLOC_StringTable, CStringTable, this);
     LoadStringTable();
 
     // -- initialize the current working directory
@@ -363,7 +415,8 @@ CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler a
     while (regfunc != NULL)
     {
         // -- note:  manually registered functions don't need to be registered again....
-        if (!regfunc->IsRegistered() && !regfunc->Register())
+        // -- but each context has its own namespaces, so anything registered by another context is registered here too
+        if (regfunc->GetContext() == nullptr && !regfunc->Register())
         {
             if (regfunc->GetClassNameHash() != 0)
             {
@@ -378,6 +431,10 @@ CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler a
                 assert(0);
             }
         }
+
+        // -- registered calls with single value params use a frame on the exec stack for their args
+        regfunc->InitStackFrame();
+
         regfunc = regfunc->GetNext();
     }
 
@@ -395,8 +452,11 @@ CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler a
     // -- initialize the scheduler
     mScheduler = TinAlloc(ALLOC_SchedCmd, CScheduler, this);
 
+    // -- initialize the debugger notification queue
+    mDebuggerSync = TinAlloc(ALLOC_Debugger, CDebuggerSync, this);
+
     // -- initialize the master object list
-    mMasterMembershipList = TinAlloc(ALLOC_ObjectGroup, CMasterMembershipList, this, kMasterMembershipTableSize);
+    mMasterMembershipList = TinAlloc(ALLOC_ObjectGroup, CMasterMembershipList, this);
 
     // -- initialize the code block hash table
     mCodeBlockList = TinAlloc(ALLOC_HashTable, CHashTable<CCodeBlock>, kGlobalFuncTableSize);
@@ -426,6 +486,7 @@ CScriptContext::CScriptContext(TinPrintHandler printfunction, TinAssertHandler a
 
     // -- initialize the thread command
     mThreadBufPtr = NULL;
+    mThreadCommandQueue = TinAllocShared(ALLOC_ThreadQueue, CThreadCommandQueue);
 
     m_socketCommandList = nullptr;
     m_socketCurrentCommand = nullptr;
@@ -444,6 +505,9 @@ void CScriptContext::InitializeDictionaries()
     mAddressDictionary = TinAlloc(ALLOC_HashTable, CHashTable<CObjectEntry>, kObjectTableSize);
     mNameDictionary = TinAlloc(ALLOC_HashTable, CHashTable<CObjectEntry>, kObjectTableSize);
 
+    // -- allocate the pool for the object entries
+    mObjectEntryPool = TinAlloc(ALLOC_ObjEntry, CMemoryPool, ALLOC_ObjEntry, sizeof(CObjectEntry));
+
     // $$$TZA still working on how we're going to handle different threads
     // -- for now, every thread populates its dictionaries from the same list of registered objects
     CNamespaceReg* tempptr = CNamespaceReg::head;
@@ -476,7 +540,7 @@ void CScriptContext::InitializeDictionaries()
             found_unregistered = regptr;
 
             // -- see if this namespace still requires its parent to be registered
-            static const uint32 nullparenthash = Hash("VOID");
+            const uint32 nullparenthash = HashLiteral_("VOID");
             CNamespace* parentnamespace = NULL;
             if (regptr->GetParentHash() != nullparenthash)
             {
@@ -501,7 +565,8 @@ void CScriptContext::InitializeDictionaries()
                                                     this, regptr->GetName(),
                                                     regptr->GetTypeID(),
                                                     regptr->GetCreateFunction(),
-                                                    regptr->GetDestroyFunction());
+                                                    regptr->GetDestroyFunction(),
+                                                    regptr->GetInstanceSize());
 
                 // -- add the creation method to the hash dictionary
                 mNamespaceDictionary->AddItem(*newnamespace, regptr->GetHash());
@@ -571,13 +636,27 @@ void CScriptContext::ShutdownDictionaries()
     }
 
     // -- delete the Object dictionaries
+    // -- note:  the entries are owned by the pool, so we can't simply DestroyAll()
     if (mObjectDictionary)
     {
-        mObjectDictionary->DestroyAll();
+        CObjectEntry* oe = mObjectDictionary->First();
+        while (oe != nullptr)
+        {
+            mObjectEntryPool->Destruct(oe);
+            oe = mObjectDictionary->Next();
+        }
+
+        mObjectDictionary->RemoveAll();
         TinFree(mObjectDictionary);
         mObjectDictionary = nullptr;
     }
 
+    if (mObjectEntryPool)
+    {
+        TinFree(mObjectEntryPool);
+        mObjectEntryPool = nullptr;
+    }
+
     // -- objects will have been destroyed above, so simply clear this hash table
     if (mAddressDictionary)
     {
@@ -598,17 +677,56 @@ void CScriptContext::Update(uint32 curtime)
 {
     mScheduler->Update(curtime);
 
+    // -- free any memory returned from a different thread, even if we haven't allocated since
+    mAllocator->ProcessRemoteFrees();
+
     // -- execute any commands queued from a different thread
     ProcessThreadCommands();
 
+    // -- send the debugger the object notifications queued since the last update
+    mDebuggerSync->Update();
+
+    // -- execute the callbacks for any jobs completed by our worker pool
+    if (mWorkerPool != nullptr && !mIsShuttingDown)
+        mWorkerPool->Update();
+
+    // -- continue removing unreferenced strings, if the budget was spent before the delete list was empty
+    mStringTable->RemoveUnreferencedStrings(kStringTableRemoveBudget);
+
     // $$$TZA This doesn't need to happen every frame...
     CCodeBlock::DestroyUnusedCodeBlocks(mCodeBlockList);
 }
 
 // ====================================================================================================================
 // Hash():  A core function for converting strings, used primarily for hash table keys.
+// -- the string is also added to the string table, so it can be UnHash()'d
 // ====================================================================================================================
 uint32 Hash(const char *string, int32 length, bool add_to_table)
+{
+    uint32 h = HashValue(string, length);
+    if (h == 0)
+        return (0);
+
+    // $$$TZA this should only happen in a DEBUG build
+    // -- only the calling thread's own string table is populated - a thread without a context (e.g. a parallel
+    // loop thread) adds to the shared table instead, so the string can still be UnHash()'d
+    if (TinScript::GetContext() && TinScript::GetContext()->GetStringTable())
+    {
+        TinScript::GetContext()->GetStringTable()->AddString(string, length, h, add_to_table);
+    }
+    else if (add_to_table)
+    {
+        TinScript::CSharedStringTable::GetInstance()->AddString(string, length, h);
+    }
+
+	return h;
+}
+
+// ====================================================================================================================
+// HashValue():  Uses the same algorithm as Hash(), but never touches the string table.
+// -- for callers that only need the value (e.g. to look up an existing entry), and is safe to call from any thread
+// ====================================================================================================================
+uint32 HashValue(const char *string, int32 length)
 {
 	if (!string || !string[0])
 		return 0;
@@ -630,14 +748,6 @@ uint32 Hash(const char *string, int32 length, bool add_to_table)
 		h = ((h << 5) + h) + c;
 	}
 
-    // $$$TZA this should only happen in a DEBUG build
-    // $$$TZA This is also not thread safe - only the main thread should be allowed to populate the
-    // -- the string dictionary
-    if (TinScript::GetContext() && TinScript::GetContext()->GetStringTable())
-    {
-        TinScript::GetContext()->GetStringTable()->AddString(string, length, h, add_to_table);
-    }
-
 	return h;
 }
 
@@ -665,11 +775,19 @@ uint32 HashAppend(uint32 h, const char *string, int32 length)
 // ====================================================================================================================
 const char* UnHash(uint32 hash)
 {
-    const char* string = TinScript::GetContext()->GetStringTable()->FindString(hash);
+    const char* string = nullptr;
+    if (TinScript::GetContext() && TinScript::GetContext()->GetStringTable())
+        string = TinScript::GetContext()->GetStringTable()->FindString(hash);
+
+    // -- strings hashed on threads without a context are in the shared table
+    if (!string && TinScript::CSharedStringTable::FindInstance() != nullptr)
+        string = TinScript::CSharedStringTable::FindInstance()->FindString(hash);
+
     if (!string || !string[0])
     {
-        static char buffers[8][20];
-        static int32 bufindex = -1;
+        // -- any thread may UnHash(), so each has its own buffers
+        static thread_local char buffers[8][20];
+        static thread_local int32 bufindex = -1;
         bufindex = (bufindex + 1) % 8;
         snprintf(buffers[bufindex], 20, "<hash:0x%08x>", hash);
         return buffers[bufindex];
@@ -703,10 +821,6 @@ void SaveStringTable()
     if (string_table_src == nullptr)
         return;
 
-    const CHashTable<CStringTable::tStringEntry>* string_table = string_table_src->GetStringDictionary();
-    if (!string_table)
-        return;
-
     // -- before we write, lets remove all unreferenced strings
     string_table_src->RemoveUnreferencedStrings();
 
@@ -725,17 +839,15 @@ void SaveStringTable()
 		return;
     }
 
-    uint32 ste_hash = 0;
-	CStringTable::tStringEntry* ste = string_table->First(&ste_hash);
-	while (ste)
+    int32 index_size = string_table_src->GetIndexSize();
+    for (int32 slot = 0; slot < index_size; ++slot)
     {
         // -- only write out ref-counted strings (the remaining haven't been cleaned up)
-        if (ste->mRefCount <= 0)
-        {
-            // -- next entry
-       	    ste = string_table->Next(&ste_hash);
+        CStringTable::tStringEntry* ste = string_table_src->GetIndexEntry(slot);
+        if (ste == nullptr || ste->mRefCount <= 0)
             continue;
-        }
+
+        uint32 ste_hash = ste->mHash;
 
         const char* string = ste->mString;
         int32 length = (int32)strlen(string);
@@ -778,9 +890,6 @@ void SaveStringTable()
             ScriptAssert_(script_context, 0, "<internal>", -1, "Error - unable to write file %s\n", string_table_fn);
             return;
         }
-
-        // -- next entry
-       	ste = string_table->Next(&ste_hash);
 	}
 
     // -- close the file before we leave
@@ -1018,6 +1127,7 @@ bool8 NeedToCompile(const char* full_path_name, const char* binfilename, bool ch
         std::time_t force_compile_time;
         if (GetDebugForceCompile(force_compile_time))
         {
+#if defined(_WIN32)
             // -- convert the const char* to a wchar_t*
             std::string binfilename_str(binfilename);
             std::wstring binfilename_wstr = std::wstring(binfilename_str.begin(), binfilename_str.end());
@@ -1026,6 +1136,13 @@ bool8 NeedToCompile(const char* full_path_name, const char* binfilename, bool ch
             {
                 return true;
             }
+#else
+            struct stat fileInfo;
+            if (stat(binfilename, &fileInfo) != 0)
+            {
+                return true;
+            }
+#endif
             std::time_t file_time = fileInfo.st_mtime;
             return (file_time < force_compile_time);
         }
@@ -1199,6 +1316,11 @@ CCodeBlock* CScriptContext::CompileScript(const char* filename)
     if (!SaveBinary(codeblock, binfilename))
         return NULL;
 
+    // -- publish the compiled image, so other contexts executing this binary can share it
+    std::filesystem::file_time_type binary_ft;
+    if (GetLastWriteTime(binfilename, binary_ft))
+        codeblock->PublishImage(binary_ft);
+
     // -- save the string table - *if* we're the main thread
     if (mIsMainThread)
         SaveStringTable();
@@ -1372,7 +1494,7 @@ bool8 CScriptContext::ExecScript(const char* filename, bool8 must_exist, bool8 r
         // -- if we already have this codeblock loaded, we're done
         if (!re_exec)
         {
-            uint32 filename_hash = Hash(full_path, -1, false);
+            uint32 filename_hash = HashValue(full_path);
             CCodeBlock* already_executed = GetCodeBlockList()->FindItem(filename_hash);
             if (already_executed)
             {
@@ -1380,14 +1502,33 @@ bool8 CScriptContext::ExecScript(const char* filename, bool8 must_exist, bool8 r
             }
         }
 
-        bool8 old_version = false;
-        codeblock = LoadBinary(this, full_path, binfilename, must_exist, old_version);
-
-        // -- if we have an old version, recompile
-        if (!codeblock && old_version)
+        // -- if another context has already loaded (or compiled) this binary, share its image
+        std::filesystem::file_time_type binary_ft;
+        bool8 found_binary_ft = GetLastWriteTime(binfilename, binary_ft);
+        CCodeBlockImage* image = found_binary_ft ? CCodeBlockImage::Acquire(HashValue(full_path), binary_ft,
+                                                                             GetStringTable())
+                                                 : nullptr;
+        if (image != nullptr)
         {
-            // -- note:  Compile() also prepends the CWD, so we use filename to call CompileScript()
-            codeblock = CompileScript(filename);
+            codeblock = TinAlloc(ALLOC_CodeBlock, CCodeBlock, this, full_path);
+            codeblock->SetImage(image);
+            codeblock->SetFinishedParsing();
+        }
+        else
+        {
+            bool8 old_version = false;
+            codeblock = LoadBinary(this, full_path, binfilename, must_exist, old_version);
+
+            // -- if we have an old version, recompile
+            if (!codeblock && old_version)
+            {
+                // -- note:  Compile() also prepends the CWD, so we use filename to call CompileScript()
+                codeblock = CompileScript(filename);
+            }
+            else if (codeblock && found_binary_ft)
+            {
+                codeblock->PublishImage(binary_ft);
+            }
         }
     }
 
@@ -1594,7 +1735,7 @@ void CScriptContext::SetDebuggerConnected(bool connected)
         CCodeBlock* code_block = GetCodeBlockList()->First();
         while (code_block)
         {
-            if (code_block->GetFilenameHash() != Hash("<stdin>"))
+            if (code_block->GetFilenameHash() != HashLiteral_("<stdin>"))
                 DebuggerCodeblockLoaded(code_block->GetFilenameHash());
             code_block = GetCodeBlockList()->Next();
         }
@@ -3310,6 +3451,15 @@ void CScriptContext::DebuggerSendWatchVariable(CDebuggerWatchVarEntry* watch_var
     // -- send the packet
     SocketManager::SendDataPacket(newPacket);
 
+    // -- send the array entries or object members
+    DebuggerSendWatchChildren(watch_var_entry);
+}
+
+// ====================================================================================================================
+// DebuggerSendWatchChildren():  Send the entries of an array variable, or the members of an object variable.
+// ====================================================================================================================
+void CScriptContext::DebuggerSendWatchChildren(CDebuggerWatchVarEntry* watch_var_entry)
+{
     // -- if this watch variable is an array, we need to send the array entries as well
     if (watch_var_entry->mArraySize > 1)
     {
@@ -3362,7 +3512,7 @@ void CScriptContext::DebuggerSendArrayEntries(const CDebuggerWatchVarEntry& watc
 
     // -- get the object that owns this variable as a member
     void* obj_addr = nullptr;
-    if (watch_var.mVarObjectID != 0)
+    if (watch_var.mObjectID != 0)
     {
         CObjectEntry* oe = FindObjectEntry(watch_var.mObjectID);
         if (oe == nullptr || oe->GetAddr() == nullptr)
@@ -3407,11 +3557,8 @@ void CScriptContext::DebuggerSendArrayEntries(const CDebuggerWatchVarEntry& watc
         total_size += sizeof(int32);
         total_size += valueLength;
 
-        // -- declare a header
-        SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::DATA, total_size);
-
-        // -- create the packet (null data, as we'll fill in the data directly into the packet)
-        SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header, NULL);
+        // -- create the packet (through the debugger sync, which also serves a loopback client)
+        SocketManager::tDataPacket* newPacket = mDebuggerSync->CreatePacket(total_size);
         if (!newPacket)
         {
             TinPrint(this, "Error - DebuggerSendArrayEntries(): unable to send\n");
@@ -3445,19 +3592,24 @@ void CScriptContext::DebuggerSendArrayEntries(const CDebuggerWatchVarEntry& watc
         dataPtr += (valueLength / 4);
 
         // -- send the packet
-        SocketManager::SendDataPacket(newPacket);
+        mDebuggerSync->SendPacket(newPacket);
     }
 }
 
 // ====================================================================================================================
 // void DebuggerSendObjectMembers():  Given an object ID, send the entire hierarchy of members to the debugger
 // ====================================================================================================================
-void CScriptContext::DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFunction, uint32 object_id)
+void CScriptContext::DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFunction, uint32 object_id,
+                                               eDebuggerMemberSync sync_mode)
 {
     CObjectEntry* oe = FindObjectEntry(object_id);
     if (!oe)
         return;
 
+    // -- the members are sent as blocks of rows, sharing the calling function and object
+    CDebuggerSync::tMemberBlock previous_block = mDebuggerSync->BeginMemberBlock(callingFunction, object_id,
+                                                                                 sync_mode);
+
     // -- send the dynamic var table
     if (oe->GetDynamicVarTable())
     {
@@ -3473,7 +3625,7 @@ void CScriptContext::DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFu
         watch_entry.mFunctionObjectID = callingFunction ? callingFunction->mFunctionObjectID : 0;
 
         watch_entry.mObjectID = object_id;
-        watch_entry.mNamespaceHash = Hash("self");
+        watch_entry.mNamespaceHash = HashLiteral_("self");
 
         // -- TYPE_void marks this as a namespace label, and set the object's name as the value
         watch_entry.mType = TYPE_void;
@@ -3487,8 +3639,8 @@ void CScriptContext::DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFu
         watch_entry.mVarHash = watch_entry.mNamespaceHash;
         watch_entry.mVarObjectID = 0;
 
-        // -- send to the Debugger
-        DebuggerSendWatchVariable(&watch_entry);
+        // -- add to the member block
+        mDebuggerSync->AddMember(watch_entry);
 
         // -- now send var table members
         DebuggerSendObjectVarTable(callingFunction, oe, watch_entry.mNamespaceHash, oe->GetDynamicVarTable());
@@ -3523,8 +3675,8 @@ void CScriptContext::DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFu
         ns_entry.mVarHash = ns_entry.mNamespaceHash;
         ns_entry.mVarObjectID = 0;
 
-        // -- send to the Debugger
-        DebuggerSendWatchVariable(&ns_entry);
+        // -- add to the member block
+        mDebuggerSync->AddMember(ns_entry);
 
         // -- dump the vtable
         DebuggerSendObjectVarTable(callingFunction, oe, ns_entry.mNamespaceHash, ns->GetVarTable());
@@ -3532,6 +3684,9 @@ void CScriptContext::DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFu
         // -- get the next namespace
         ns = ns->GetNext();
     }
+
+    // -- send the remaining rows
+    mDebuggerSync->EndMemberBlock(previous_block);
 }
 
 // ====================================================================================================================
@@ -3587,8 +3742,8 @@ void CScriptContext::DebuggerSendObjectVarTable(CDebuggerWatchVarEntry* callingF
         void* val_addr = member->GetAddr(oe->GetAddr());
         member_entry.mSourceVarAddr = val_addr;
 
-        // -- send to the debugger
-        DebuggerSendWatchVariable(&member_entry);
+        // -- add to the member block (begun by DebuggerSendObjectMembers())
+        mDebuggerSync->AddMember(member_entry);
 
         // -- get the next member
         member = var_table->Next();
@@ -4125,186 +4280,55 @@ void CScriptContext::DebuggerSendFunctionAssistEntry(const CDebuggerFunctionAssi
 }
 
 // ====================================================================================================================
-// DebuggerNotifyCreateObject():  Send an object entry to the debugger, with the object's name and derivation.
+// DebuggerNotifyCreateObject():  Queue an object entry for the debugger, with the object's name and derivation.
 // ====================================================================================================================
 void CScriptContext::DebuggerNotifyCreateObject(CObjectEntry* oe)
 {
     // -- sanity check
-    int32 debugger_session = 0;
-    if (!oe || !IsDebuggerConnected(debugger_session))
-        return;
-
-    // -- create the derivation string
-    char derivation_buf[kMaxNameLength * 2];
-    char* derivation_ptr = derivation_buf;
-    *derivation_ptr = '\0';
-    int32 remaining = kMaxNameLength;
-    bool8 first = true;
-    CNamespace* ns = oe->GetNamespace();
-    while (ns && remaining > 0)
-    {
-        // -- if this is registered class, highlight it
-        if (ns->IsRegisteredClass())
-            snprintf(derivation_ptr, remaining, "%s[%s]", !first ? "-->" : " ", UnHash(ns->GetHash()));
-        else
-            snprintf(derivation_ptr, remaining, "%s%s", !first ? "-->" : " ", UnHash(ns->GetHash()));
-
-        // -- update the pointer
-        int32 length = (int32)strlen(derivation_ptr);
-        remaining -= length;
-        derivation_ptr += length;
-
-        // -- next namespace in the hierarchy
-        first = false;
-        ns = ns->GetNext();
-    }
-
-    // -- ensure the buffer is null terminated
-    derivation_buf[kMaxNameLength - 1] = '\0';
-
-    // -- get the file/line from where this object was created
-    int32 stack_size = 0;
-    uint32 created_file_array[kDebuggerCallstackSize];
-    int32 created_lines_array[kDebuggerCallstackSize];
-    if (!CMemoryTracker::GetCreatedCallstack(oe->GetID(), stack_size, created_file_array, created_lines_array) || stack_size <= 0)
-    {
-        // -- memory tracking is disabled - ensure we have a zero stack size
-        stack_size = 0;
-    }
-
-    // -- because we're sending the entire origin callstack, we need to use a data packet instead of a remote SendExec()
-    // -- calculate the size of the data
-    int32 total_size = 0;
-
-    // -- first int32 will be identifying this data packet
-    total_size += sizeof(int32);
-
-    // -- object ID
-    total_size += sizeof(int32);
-
-    // -- get the object name and length (plus EOL)
-    const char* obj_name = oe->GetNameHash() != 0 ? oe->GetName() : "<unnamed>";
-    int32 obj_name_length = (int32)strlen(obj_name) + 1;
-    obj_name_length += 4 - (obj_name_length % 4);
-
-    // -- object name length
-    total_size += sizeof(int32);
-    total_size += obj_name_length;
-
-    // -- derivation string length
-    // -- the next will be mName - we'll round up to a 4-byte aligned length (including the EOL)
-    int32 derivation_length = (int32)strlen(derivation_buf) + 1;
-    derivation_length += 4 - (derivation_length % 4);
-
-    // -- we send first the string length, then the string
-    total_size += sizeof(int32);
-    total_size += derivation_length;
-
-    // -- stack size
-    total_size += sizeof(int32);
-
-    // -- filename_array
-    total_size += sizeof(int32) * stack_size;
-
-    // -- linenumber_array
-    total_size += sizeof(int32) * stack_size;
-
-    // -- now create the packet
-    // -- declare a header
-    // -- note, if we ever implement a request/acknowledge approach, we can use the mID field
-    SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::DATA, total_size);
-
-    // -- create the packet (null data, as we'll fill in the data directly into the packet)
-    SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header,NULL);
-    if (!newPacket)
-    {
-        TinPrint(this,"Error - DebuggerNotifyCreateObject():  unable to send - not connected\n");
+    if (!oe || mDebuggerSync == nullptr || !mDebuggerSync->IsActive())
         return;
-    }
-
-    // -- initialize the ptr to the data buffer
-    int32* dataPtr = (int32*)newPacket->mData;
-
-    // -- write the identifier - defined in the debugger constants near the top of TinScript.h
-    *dataPtr++ = k_DebuggerObjectCreatedID;
-
-    // -- object ID
-    *dataPtr++ = oe->GetID();
-
-    // -- name length
-    *dataPtr++ = obj_name_length;
 
-    // -- name string
-    SafeStrcpy((char*)dataPtr, obj_name_length, obj_name, obj_name_length);
-    dataPtr += (obj_name_length / 4);
-
-    // -- derivation string length
-    *dataPtr++ = derivation_length;
-
-    // -- write the derivation string
-    SafeStrcpy((char*)dataPtr, derivation_length, derivation_buf, derivation_length);
-    dataPtr += (derivation_length / 4);
-
-    // -- origin stack size
-    *dataPtr++ = stack_size;
-
-    // -- if we don't have memory tracking enabled, we'll have a zero stack_size
-    if (stack_size > 0)
-    {
-        // -- file array
-        memcpy(dataPtr, created_file_array, sizeof(uint32) * stack_size);
-        dataPtr += stack_size;
-
-        // -- line number array
-        memcpy(dataPtr, created_lines_array, sizeof(int32) * stack_size);
-        dataPtr += stack_size;
-    }
-
-    // -- send the packet
-    SocketManager::SendDataPacket(newPacket);
+    // -- the name, derivation, and origin callstack are written when the batch is sent (if the object still exists)
+    mDebuggerSync->NotifyCreateObject(oe->GetID());
 }
 
 // ====================================================================================================================
-// DebuggerNotifyDestroyObject():  Send notification to the debugger of an object's destruction.
+// DebuggerNotifyDestroyObject():  Queue notification to the debugger of an object's destruction.
 // ====================================================================================================================
 void CScriptContext::DebuggerNotifyDestroyObject(uint32 object_id)
 {
     // -- sanity check
-    int32 debugger_session = 0;
-    if (object_id == 0 || !IsDebuggerConnected(debugger_session))
+    if (object_id == 0 || mDebuggerSync == nullptr || !mDebuggerSync->IsActive())
         return;
 
-    // -- send the entry
-    SocketManager::SendCommandf("DebuggerNotifyDestroyObject(%d);", object_id);
+    // -- queue the notification - if the creation was never sent, neither is the destruction
+    mDebuggerSync->NotifyDestroyObject(object_id);
 }
 
 // ====================================================================================================================
-// DebuggerNotifySetAddObject():  Send notification to the debugger of an object's new membership.
+// DebuggerNotifySetAddObject():  Queue notification to the debugger of an object's new membership.
 // ====================================================================================================================
 void CScriptContext::DebuggerNotifySetAddObject(uint32 parent_id, uint32 object_id, bool8 owned)
 {
     // -- sanity check
-    int32 debugger_session = 0;
-    if (parent_id == 0 || object_id == 0 || !IsDebuggerConnected(debugger_session))
+    if (parent_id == 0 || object_id == 0 || mDebuggerSync == nullptr || !mDebuggerSync->IsActive())
         return;
 
-    // -- send the entry
-    SocketManager::SendCommandf("DebuggerNotifySetAddObject(%d, %d, %s);", parent_id, object_id,
-                                owned ? "true" : "false");
+    // -- queue the notification
+    mDebuggerSync->NotifySetAddObject(parent_id, object_id, owned);
 }
 
 // ====================================================================================================================
-// DebuggerNotifySetRemoveObject():  Send notification to the debugger of an object's discontinued membership.
+// DebuggerNotifySetRemoveObject():  Queue notification to the debugger of an object's discontinued membership.
 // ====================================================================================================================
 void CScriptContext::DebuggerNotifySetRemoveObject(uint32 parent_id, uint32 object_id)
 {
     // -- sanity check
-    int32 debugger_session = 0;
-    if (parent_id == 0 || object_id == 0 || !IsDebuggerConnected(debugger_session))
+    if (parent_id == 0 || object_id == 0 || mDebuggerSync == nullptr || !mDebuggerSync->IsActive())
         return;
 
-    // -- send the entry
-    SocketManager::SendCommandf("DebuggerNotifySetRemoveObject(%d, %d);", parent_id, object_id);
+    // -- queue the notification
+    mDebuggerSync->NotifySetRemoveObject(parent_id, object_id);
 }
 
 // ====================================================================================================================
@@ -4313,8 +4337,7 @@ void CScriptContext::DebuggerNotifySetRemoveObject(uint32 parent_id, uint32 obje
 void CScriptContext::DebuggerListObjects(uint32 parent_id, uint32 object_id)
 {
     // -- ensure we have a debugger connected
-	int32 debugger_session = 0;
-    if (!IsDebuggerConnected(debugger_session))
+    if (!mDebuggerSync->IsActive())
         return;
 
     // -- see if we're supposed to list all objects
@@ -4334,7 +4357,8 @@ void CScriptContext::DebuggerListObjects(uint32 parent_id, uint32 object_id)
         }
 
         // -- notify the debugger we've completed sending the list of objects
-        SocketManager::SendExec(Hash("DebuggerListObjectsComplete"));
+        // -- note:  queued, so it arrives after the objects listed
+        mDebuggerSync->NotifyListObjectsComplete();
     }
 
     // -- else we have a specific object to dump
@@ -4353,7 +4377,7 @@ void CScriptContext::DebuggerListObjects(uint32 parent_id, uint32 object_id)
             }
 
             // -- if the object is an object set, recursively send its children
-            static uint32 object_set_hash = Hash("CObjectSet");
+            const uint32 object_set_hash = HashLiteral_("CObjectSet");
             if (oe->HasNamespace(object_set_hash))
             {
                 CObjectSet* object_set = static_cast<CObjectSet*>(FindObject(oe->GetID()));
@@ -4377,8 +4401,7 @@ void CScriptContext::DebuggerListObjects(uint32 parent_id, uint32 object_id)
 void CScriptContext::DebuggerInspectObject(uint32 object_id)
 {
     // -- ensure we have a debugger connected
-	int32 debugger_session = 0;
-    if (!IsDebuggerConnected(debugger_session) || object_id == 0)
+    if (!mDebuggerSync->IsActive() || object_id == 0)
         return;
 
     // -- see if we're supposed to list all objects
@@ -4386,7 +4409,24 @@ void CScriptContext::DebuggerInspectObject(uint32 object_id)
     if (oe)
     {
         // -- send a dump of the object to the debugger
-        DebuggerSendObjectMembers(nullptr, object_id);
+        // -- the values sent are recorded, so a refresh need only send what's changed
+        DebuggerSendObjectMembers(nullptr, object_id, eMemberSyncInspect);
+    }
+}
+
+// ====================================================================================================================
+// DebuggerRefreshObject():  Send the object members whose values have changed since the last inspect or refresh.
+// ====================================================================================================================
+void CScriptContext::DebuggerRefreshObject(uint32 object_id)
+{
+    // -- ensure we have a debugger connected
+    if (!mDebuggerSync->IsActive() || object_id == 0)
+        return;
+
+    CObjectEntry* oe = FindObjectEntry(object_id);
+    if (oe)
+    {
+        DebuggerSendObjectMembers(nullptr, object_id, eMemberSyncRefresh);
     }
 }
 
@@ -4956,6 +4996,19 @@ void CScriptContext::ProcessThreadCommands()
     if (mIsShuttingDown)
         return;
 
+    // -- typed commands are executed first, up to the per-update limit
+    // -- note:  not while we're at a debugger break - they're not debugger commands, and the VM is mid-function
+    if (mDebuggerBreakFuncCallStack == nullptr)
+    {
+        CThreadCommand thread_command;
+        for (int32 i = 0; i < kThreadCommandProcessMax && !mIsShuttingDown; ++i)
+        {
+            if (!mThreadCommandQueue->Pop(thread_command))
+                break;
+            ExecuteThreadCommand(thread_command);
+        }
+    }
+
     // -- if there's nothing to process, we're done
     if (mThreadBufPtr == NULL && m_socketCommandList == nullptr)
         return;
@@ -5163,6 +5216,95 @@ void CScriptContext::QueueThreadExec()
     mThreadLock.Unlock();
 }
 
+// ====================================================================================================================
+// PostThreadCommand():  Adds a typed command to the lock-free queue, to be executed during the normal update
+// ====================================================================================================================
+bool8 CScriptContext::PostThreadCommand(const CThreadCommand& command)
+{
+    // -- sanity check
+    if (command.GetFuncHash() == 0 || IsShuttingDown())
+        return (false);
+
+    return (mThreadCommandQueue->Push(command));
+}
+
+// ====================================================================================================================
+// GetThreadCommandCount():  Returns the number of typed commands waiting to be executed
+// ====================================================================================================================
+int32 CScriptContext::GetThreadCommandCount() const
+{
+    return (mThreadCommandQueue->GetCount());
+}
+
+// ====================================================================================================================
+// GetThreadCommandRejectedCount():  Returns the number of typed commands rejected because the queue was full
+// ====================================================================================================================
+uint32 CScriptContext::GetThreadCommandRejectedCount() const
+{
+    return (mThreadCommandQueue->GetRejectedCount());
+}
+
+// ====================================================================================================================
+// ExecuteThreadCommand():  Assigns the typed parameters directly to the function context, and executes it
+// ====================================================================================================================
+bool8 CScriptContext::ExecuteThreadCommand(CThreadCommand& command)
+{
+    // -- find the function (or method)
+    CObjectEntry* oe = nullptr;
+    CFunctionEntry* fe = nullptr;
+    if (command.GetObjectID() != 0)
+    {
+        oe = FindObjectEntry(command.GetObjectID());
+        if (oe == nullptr)
+        {
+            TinPrint(this, "Error - ExecuteThreadCommand(): unable to find object: %d, calling %s()\n",
+                           command.GetObjectID(), UnHash(command.GetFuncHash()));
+            return (false);
+        }
+
+        fe = oe->GetFunctionEntry(0, command.GetFuncHash());
+    }
+    else
+    {
+        fe = GetGlobalNamespace()->GetFuncTable()->FindItem(command.GetFuncHash());
+    }
+
+    if (fe == nullptr)
+    {
+        TinPrint(this, "Error - ExecuteThreadCommand(): unable to find function: %s()\n",
+                       UnHash(command.GetFuncHash()));
+        return (false);
+    }
+
+    // -- set the parameter values, converting to the types required by the function
+    // note:  parameter 0 is the return value
+    CFunctionContext* fe_context = fe->GetContext();
+    for (int32 i = 0; i < command.GetParamCount(); ++i)
+    {
+        CVariableEntry* ve_param = fe_context->GetParameter(i + 1);
+        if (ve_param == nullptr)
+        {
+            TinPrint(this, "Error - ExecuteThreadCommand(): function %s() expects no more than %d parameters\n",
+                           UnHash(command.GetFuncHash()), fe_context->GetParameterCount() - 1);
+            return (false);
+        }
+
+        void* convert_addr = TypeConvert(this, command.GetParamType(i), command.GetParamAddr(i),
+                                         ve_param->GetType());
+        if (convert_addr == nullptr)
+        {
+            TinPrint(this, "Error - ExecuteThreadCommand(): function %s() unable to convert parameter %d\n",
+                           UnHash(command.GetFuncHash()), i + 1);
+            return (false);
+        }
+
+        ve_param->SetValueAddr(nullptr, convert_addr);
+    }
+
+    // -- execute the function
+    return (ExecuteScheduledFunction(this, command.GetObjectID(), 0, command.GetFuncHash(), fe_context));
+}
+
 // ====================================================================================================================
 // ThreadShutdown():  Cleanup any threadding issues- mark the context so we don't try to process commands, etc...
 // ====================================================================================================================
@@ -5365,9 +5507,8 @@ void DebuggerListObjects(int32 root_object_id)
     if (!script_context)
         return;
 
-    // -- ensure we're connected
-    int32 debugger_session = 0;
-    if (!script_context->IsDebuggerConnected(debugger_session))
+    // -- ensure we're connected (or have a loopback client)
+    if (!script_context->GetDebuggerSync()->IsActive())
         return;
 
     // -- send the list of objects
@@ -5384,15 +5525,40 @@ void DebuggerInspectObject(int32 object_id)
     if (!script_context)
         return;
 
-    // -- ensure we're connected
-    int32 debugger_session = 0;
-    if (!script_context->IsDebuggerConnected(debugger_session))
+    // -- ensure we're connected (or have a loopback client)
+    if (!script_context->GetDebuggerSync()->IsActive())
         return;
 
     // -- send the list of objects
     script_context->DebuggerInspectObject(object_id);
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+// DebuggerRefreshObject():  Send the connected debugger, the object's members changed since it was last inspected.
+// --------------------------------------------------------------------------------------------------------------------
+void DebuggerRefreshObject(int32 object_id)
+{
+    // -- ensure we have a script context
+    CScriptContext* script_context = GetContext();
+    if (!script_context)
+        return;
+
+    script_context->DebuggerRefreshObject(object_id);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// DebuggerSetBandwidthCap():  Limits the bytes per second used by object notifications, 0 for uncapped.
+// --------------------------------------------------------------------------------------------------------------------
+void DebuggerSetBandwidthCap(int32 bytes_per_second)
+{
+    // -- ensure we have a script context
+    CScriptContext* script_context = GetContext();
+    if (!script_context)
+        return;
+
+    script_context->GetDebuggerSync()->SetBandwidthCap(bytes_per_second);
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // DebuggerListSchedules():  Send the connected debugger, a dump of the current pending schedules.
 // --------------------------------------------------------------------------------------------------------------------
@@ -5544,6 +5710,8 @@ REGISTER_FUNCTION(DebuggerRequestStringUnhash, DebuggerRequestStringUnhash);
 
 REGISTER_FUNCTION(DebuggerListObjects, DebuggerListObjects);
 REGISTER_FUNCTION(DebuggerInspectObject, DebuggerInspectObject);
+REGISTER_FUNCTION(DebuggerRefreshObject, DebuggerRefreshObject);
+REGISTER_FUNCTION(DebuggerSetBandwidthCap, DebuggerSetBandwidthCap);
 
 REGISTER_FUNCTION(DebuggerListSchedules, DebuggerListSchedules);
 REGISTER_FUNCTION(DebuggerRequestFunctionAssist, DebuggerRequestFunctionAssist);
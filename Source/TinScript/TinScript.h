@@ -30,6 +30,9 @@
 #include <stddef.h>
 #include <stdarg.h>
 #include <typeinfo>
+#if defined(__GNUC__)
+    #include <cxxabi.h>
+#endif
 #include <chrono>
 #include <mutex>
 #include <filesystem>
@@ -39,6 +42,9 @@
 #include "TinTypes.h"
 #include "TinNamespace.h"
 #include "TinScheduler.h"
+#include "TinThreadQueue.h"
+#include "TinWorkerPool.h"
+#include "TinDebuggerSync.h"
 
 // --------------------------------------------------------------------------------------------------------------------
 // -- only case_sensitive has been extensively tested, however theoretically TinScript should function as a
@@ -50,10 +56,16 @@
 #endif
 
 // -- templatized method to get *just* the class name, with no type word, or namespace
+// -- gcc and clang return the mangled name from typeid(), so it's demangled once per type, and kept
 template<typename C>
 inline const char* __GetClassName()
 {
+#if defined(__GNUC__)
+    static char* demangled_name = abi::__cxa_demangle(typeid(C).name(), nullptr, nullptr, nullptr);
+    const char* class_name = demangled_name != nullptr ? demangled_name : typeid(C).name();
+#else
     const char* class_name = typeid(C).name();
+#endif
     const char* colon_ptr = strrchr(class_name, ':');
     const char* space_ptr = strrchr(class_name, ' ');
     if (colon_ptr != nullptr)
@@ -77,6 +89,8 @@ const int32 k_DebuggerPrintMsgPacketID              = 0x09;
 const int32 k_DebuggerFunctionAssistPacketID        = 0x0a;
 const int32 k_DebuggerObjectCreatedID               = 0x0b;
 const int32 k_DebuggerArrayEntryPacketID            = 0x0c;
+const int32 k_DebuggerObjectBatchPacketID           = 0x0d;
+const int32 k_DebuggerMemberBlockPacketID           = 0x0e;
 const int32 k_DebuggerMaxPacketID                   = 0xff;
 
 // == namespace TinScript =============================================================================================
@@ -263,8 +277,10 @@ class CScriptContext
 {
     public:
         // -- static constructor/destructor, to create without having to directly use allocators
+        // -- if no allocator is provided, the context creates (and owns) a CPoolAllocator
+        // -- a provided allocator is released by the application (see CScriptAllocator::Release()), after the context
         static CScriptContext* Create(TinPrintHandler printhandler = NULL, TinAssertHandler asserthandler = NULL,
-                                      bool is_main_thread = true);
+                                      bool is_main_thread = true, CScriptAllocator* allocator = NULL);
         static void Destroy();
 
         void InitializeDictionaries();
@@ -274,6 +290,7 @@ class CScriptContext
         void Update(uint32 curtime);
 
         bool8 IsMainThread() const { return (mIsMainThread); }
+        CScriptAllocator* GetAllocator() const { return (mAllocator); }
 
         void InitializeDirectory(bool init_exe);
         bool8 SetDirectory(const char* path);
@@ -312,6 +329,7 @@ class CScriptContext
 
         CHashTable<CNamespace>* GetNamespaceDictionary() { return (mNamespaceDictionary); }
         CHashTable<CObjectEntry>* GetObjectDictionary() { return (mObjectDictionary); }
+        CMemoryPool* GetObjectEntryPool() { return (mObjectEntryPool); }
         CHashTable<CObjectEntry>* GetAddressDictionary() { return (mAddressDictionary); }
         CHashTable<CObjectEntry>* GetNameDictionary() { return (mNameDictionary); }
 
@@ -324,6 +342,10 @@ class CScriptContext
         bool8 FunctionExists(uint32 function_hash, uint32 ns_hash);
         bool8 FunctionExists(const char* function_name, const char* ns_name);
 
+        // -- namespaces cache their OnCreate()/OnDestroy() chains, invalidated when any function or link changes
+        uint32 GetLifecycleGeneration() const { return (mLifecycleGeneration); }
+        void InvalidateLifecycleChains() { ++mLifecycleGeneration; }
+
         bool IsDefiningFunction(uint32 function_hash, uint32 ns_hash);
         void NotifyFunctionDefinition(CFunctionEntry* new_fe);
         void ClearDefiningFunctionsList() { mDefiningFunctionsList->RemoveAll(); }
@@ -455,8 +477,10 @@ class CScriptContext
         bool DebuggerVarFormatValue(eVarType type, void* val_addr, char* out_value, uint32 max_size);
         void DebuggerWatchFormatValue(CDebuggerWatchVarEntry* watch_var_entry);
         void DebuggerSendWatchVariable(CDebuggerWatchVarEntry* watch_var_entry);
+        void DebuggerSendWatchChildren(CDebuggerWatchVarEntry* watch_var_entry);
         void DebuggerSendArrayEntries(const CDebuggerWatchVarEntry& watch_var);
-        void DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFunction, uint32 objectID);
+        void DebuggerSendObjectMembers(CDebuggerWatchVarEntry* callingFunction, uint32 objectID,
+                                       eDebuggerMemberSync sync_mode = eMemberSyncSnapshot);
         void DebuggerSendObjectVarTable(CDebuggerWatchVarEntry* callingFunction, CObjectEntry* oe, uint32 ns_hash,
                                         tVarTable* var_table);
         void DebuggerSendAssert(const char* assert_msg, uint32 codeblock_hash, int32 line_number);
@@ -469,6 +493,10 @@ class CScriptContext
         void DebuggerNotifySetRemoveObject(uint32 parent_id, uint32 object_id);
         void DebuggerListObjects(uint32 parent_id, uint32 object_id);
         void DebuggerInspectObject(uint32 object_id);
+        void DebuggerRefreshObject(uint32 object_id);
+
+        // -- object notifications are queued and batched, and object members sent as blocks
+        CDebuggerSync* GetDebuggerSync() { return (mDebuggerSync); }
 
         // -- methods to send schedule updates to the debugger
         void DebuggerListSchedules();
@@ -510,6 +538,28 @@ class CScriptContext
         bool8 AddThreadExecParam(eVarType param_type, void* value);
         void QueueThreadExec();
 
+        // -- typed thread commands bypass both the parsing/compiling, and the thread lock
+        // -- any thread may post, and the commands are executed by ProcessThreadCommands() on this context's thread
+        // -- returns false if the queue is full - the command is rejected (and counted), never blocked
+        bool8 PostThreadCommand(const CThreadCommand& command);
+        int32 GetThreadCommandCount() const;
+        uint32 GetThreadCommandRejectedCount() const;
+
+        // -- executes a typed command immediately, on the calling thread (which must own this context)
+        bool8 ExecuteThreadCommand(CThreadCommand& command);
+
+        // -- a function registered with REGISTER_ASYNC_FUNCTION() returns the handle from AsyncBegin(), and any thread
+        // may complete it - the scheduled script that made the call resumes with the result, during Update()
+        int32 AsyncBegin() { return (mScheduler->AsyncBegin()); }
+        bool8 AsyncComplete(int32 handle, eVarType result_type, const void* result_addr)
+        {
+            return (mScheduler->AsyncComplete(handle, result_type, result_addr));
+        }
+
+        // -- a worker pool created by this context's thread has its results collected during Update()
+        void SetWorkerPool(CScriptWorkerPool* worker_pool) { mWorkerPool = worker_pool; }
+        CScriptWorkerPool* GetWorkerPool() const { return (mWorkerPool); }
+
         // -- we may have to 
         void ThreadShutdown();
         bool IsShuttingDown() const { return mIsShuttingDown; }
@@ -518,7 +568,7 @@ class CScriptContext
         friend class CMemoryTracker;
         // -- use the static Create() method
         CScriptContext(TinPrintHandler printhandler = NULL, TinAssertHandler asserthandler = NULL,
-                       bool is_main_thread = true);
+                       bool is_main_thread = true, CScriptAllocator* allocator = NULL);
 
         // -- use the static Destroy() method
         // -- not virtual - this is a final class
@@ -530,6 +580,10 @@ class CScriptContext
         bool mIsMainThread = false;
         uint32 mObjectIDGenerator = 0;
 
+        // -- every TinAlloc() from this context's thread is served by the context allocator
+        CScriptAllocator* mAllocator = nullptr;
+        bool8 mOwnsAllocator = false;
+
         // -- we're going to use an ID for each print message, since some
         // (e.g. errors) have a callstack associated with them
         uint32 mDebuggerPrintMsgId = 0;
@@ -548,6 +602,7 @@ class CScriptContext
         // -- context codeblock list
         CHashTable<CCodeBlock>* mCodeBlockList = nullptr;
         CHashTable<CFunctionEntry>* mDefiningFunctionsList = nullptr;
+        uint32 mLifecycleGeneration = 1;
 
         int32 mCompileErrorFileCount = 0;
         uint32 mCompileErrorFileList[kDebuggerCallstackSize];
@@ -561,9 +616,15 @@ class CScriptContext
         CHashTable<CObjectEntry>* mAddressDictionary = nullptr;
         CHashTable<CObjectEntry>* mNameDictionary = nullptr;
 
+        // -- object entries are created/destroyed with every object, so they're allocated from a pool
+        CMemoryPool* mObjectEntryPool = nullptr;
+
         // -- context scheduler
         CScheduler* mScheduler = nullptr;
 
+        // -- the batched (and bandwidth capped) object notifications, sent to the debugger
+        CDebuggerSync* mDebuggerSync = nullptr;
+
         // -- current working directory 
         char mExecutableDirectory[kMaxNameLength];
         char mCurrentWorkingDirectory[kMaxNameLength];
@@ -592,6 +653,10 @@ class CScriptContext
         CThreadMutex mThreadLock;
         char mThreadExecBuffer[kThreadExecBufferSize];
         char* mThreadBufPtr = nullptr;
+
+        // -- typed commands posted from other threads
+        CThreadCommandQueue* mThreadCommandQueue = nullptr;
+        CScriptWorkerPool* mWorkerPool = nullptr;
 };
 
 }  // TinScript
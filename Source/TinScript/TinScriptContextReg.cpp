@@ -258,7 +258,7 @@ void ContextListMethods(const char* ns_name, const char* partial)
     if (ns_name == nullptr || ns_name[0] == '\0')
         return;
     CScriptContext* script_context = TinScript::GetContext();
-    CNamespace* ns = script_context->FindNamespace(Hash(ns_name, -1, false));
+    CNamespace* ns = script_context->FindNamespace(HashValue(ns_name));
     if (ns == nullptr)
         return;
 
@@ -398,7 +398,7 @@ void ContextFindMethod(const char* partial, bool exact = false)
     if (partial == nullptr || partial[0] == '\0')
         return;
 
-    uint32 method_hash = Hash(partial, -1, false);
+    uint32 method_hash = HashValue(partial);
     CScriptContext* script_context = TinScript::GetContext();
     CHashTable<CNamespace>* namespaces = script_context->GetNamespaceDictionary();
 
@@ -501,6 +501,33 @@ void ContextScheduleCancelObject(uint32 objectid)
     script_context->GetScheduler()->CancelObject(objectid);
 }
 
+// ====================================================================================================================
+// ContextScheduleSetBudget():  Limits the time (microseconds) spent dispatching schedules each frame, 0 for unlimited.
+// ====================================================================================================================
+void ContextScheduleSetBudget(int32 budget_us, int32 max_deferral_frames)
+{
+    CScriptContext* script_context = TinScript::GetContext();
+    script_context->GetScheduler()->SetFrameBudget(budget_us, max_deferral_frames);
+}
+
+// ====================================================================================================================
+// ContextScheduleBacklogCount():  The number of due schedules carried over, waiting for the frame budget.
+// ====================================================================================================================
+int32 ContextScheduleBacklogCount()
+{
+    CScriptContext* script_context = TinScript::GetContext();
+    return (script_context->GetScheduler()->GetBacklogCount());
+}
+
+// ====================================================================================================================
+// ContextScheduleCoroutineCount():  The number of scheduled functions suspended by wait() or an async call.
+// ====================================================================================================================
+int32 ContextScheduleCoroutineCount()
+{
+    CScriptContext* script_context = TinScript::GetContext();
+    return (script_context->GetScheduler()->GetCoroutineCount());
+}
+
 // ====================================================================================================================
 // ContextSetAssertConnectTime():  On Assert, if the IDE is not connected, how long do we wait for a connection.
 // ====================================================================================================================
@@ -553,6 +580,9 @@ REGISTER_FUNCTION(SaveObjects, ContextSaveObjects);
 REGISTER_FUNCTION(ListSchedules, ContextListSchedules);
 REGISTER_FUNCTION(ScheduleCancel, ContextScheduleCancel);
 REGISTER_FUNCTION(ScheduleCancelObject, ContextScheduleCancelObject);
+REGISTER_FUNCTION(ScheduleSetBudget, ContextScheduleSetBudget);
+REGISTER_FUNCTION(ScheduleBacklogCount, ContextScheduleBacklogCount);
+REGISTER_FUNCTION(ScheduleCoroutineCount, ContextScheduleCoroutineCount);
 
 REGISTER_FUNCTION(SetAssertConnectTime, ContextSetAssertConnectTime);
 REGISTER_FUNCTION(SetAssertStackDepth, ContextSetAssertStackDepth);
@@ -0,0 +1,226 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinStringBuilder.cpp
+// ====================================================================================================================
+
+// -- class include
+#include "TinStringBuilder.h"
+
+// -- includes
+#include "string.h"
+
+#include "TinScript.h"
+#include "TinStringTable.h"
+#include "TinRegBinding.h"
+
+// -- use the DECLARE_FILE/REGISTER_FILE macros to prevent deadstripping
+DECLARE_FILE(tinstringbuilder_cpp);
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+// == class CStringBuilder ============================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CStringBuilder::CStringBuilder()
+{
+    mBuffer = nullptr;
+    mLength = 0;
+    mCapacity = 0;
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CStringBuilder::~CStringBuilder()
+{
+    if (mBuffer != nullptr)
+    {
+        TinFreeArray(mBuffer);
+    }
+}
+
+// ====================================================================================================================
+// Append():  Append each of the (non-empty) strings to the buffer.
+// ====================================================================================================================
+void CStringBuilder::Append(const char* str0, const char* str1, const char* str2, const char* str3,
+                            const char* str4, const char* str5, const char* str6, const char* str7)
+{
+    AppendString(str0);
+    AppendString(str1);
+    AppendString(str2);
+    AppendString(str3);
+    AppendString(str4);
+    AppendString(str5);
+    AppendString(str6);
+    AppendString(str7);
+}
+
+// ====================================================================================================================
+// AppendLine():  Append each of the (non-empty) strings to the buffer, followed by a '\n'.
+// ====================================================================================================================
+void CStringBuilder::AppendLine(const char* str0, const char* str1, const char* str2, const char* str3,
+                                const char* str4, const char* str5, const char* str6, const char* str7)
+{
+    Append(str0, str1, str2, str3, str4, str5, str6, str7);
+    AppendString("\n", 1);
+}
+
+// ====================================================================================================================
+// Format():  Append the format string, replacing each "%s" with the next argument, and "%%" with '%'.
+// ====================================================================================================================
+void CStringBuilder::Format(const char* format, const char* arg0, const char* arg1, const char* arg2,
+                            const char* arg3, const char* arg4, const char* arg5, const char* arg6)
+{
+    if (format == nullptr)
+        return;
+
+    const char* args[] = { arg0, arg1, arg2, arg3, arg4, arg5, arg6 };
+    const int32 arg_count = (int32)(sizeof(args) / sizeof(args[0]));
+    int32 arg_index = 0;
+
+    // -- append the literal spans between each format specifier
+    const char* span_start = format;
+    const char* format_ptr = format;
+    while (*format_ptr != '\0')
+    {
+        if (format_ptr[0] != '%' || (format_ptr[1] != 's' && format_ptr[1] != '%'))
+        {
+            ++format_ptr;
+            continue;
+        }
+
+        AppendString(span_start, (int32)kPointerDiffUInt32(format_ptr, span_start));
+        if (format_ptr[1] == '%')
+            AppendString("%", 1);
+        else if (arg_index < arg_count)
+            AppendString(args[arg_index++]);
+
+        format_ptr += 2;
+        span_start = format_ptr;
+    }
+
+    AppendString(span_start, (int32)kPointerDiffUInt32(format_ptr, span_start));
+}
+
+// ====================================================================================================================
+// Clear():  Empty the buffer - the capacity is retained, so a builder can be reused without reallocating.
+// ====================================================================================================================
+void CStringBuilder::Clear()
+{
+    mLength = 0;
+    if (mBuffer != nullptr)
+        mBuffer[0] = '\0';
+}
+
+// ====================================================================================================================
+// ToString():  Add the contents to the string table - this is the only time the builder hashes a string.
+// ====================================================================================================================
+const char* CStringBuilder::ToString()
+{
+    CScriptContext* script_context = TinScript::GetContext();
+    if (script_context == nullptr || mLength == 0)
+        return ("");
+
+    return (script_context->GetStringTable()->AddString(mBuffer, mLength));
+}
+
+// ====================================================================================================================
+// Print():  Print the contents, without adding them to the string table.
+// ====================================================================================================================
+void CStringBuilder::Print()
+{
+    TinPrint(TinScript::GetContext(), "%s\n", GetBuffer());
+}
+
+// ====================================================================================================================
+// AppendString():  Append the string (or the given length of it), growing the buffer if needed.
+// ====================================================================================================================
+void CStringBuilder::AppendString(const char* str, int32 length)
+{
+    if (str == nullptr)
+        return;
+
+    if (length < 0)
+        length = (int32)strlen(str);
+
+    if (length == 0)
+        return;
+
+    Reserve(mLength + length + 1);
+    memcpy(&mBuffer[mLength], str, length);
+    mLength += length;
+    mBuffer[mLength] = '\0';
+}
+
+// ====================================================================================================================
+// Reserve():  Ensure the buffer can hold the given size (including the terminator), doubling the capacity.
+// ====================================================================================================================
+void CStringBuilder::Reserve(int32 capacity)
+{
+    if (capacity <= mCapacity)
+        return;
+
+    int32 new_capacity = mCapacity > 0 ? mCapacity : kStringBuilderInitialSize;
+    while (new_capacity < capacity)
+        new_capacity *= 2;
+
+    char* new_buffer = TinAllocArray(ALLOC_StringBuilder, char, new_capacity);
+    if (mBuffer != nullptr)
+    {
+        memcpy(new_buffer, mBuffer, mLength + 1);
+        TinFreeArray(mBuffer);
+    }
+    else
+    {
+        new_buffer[0] = '\0';
+    }
+
+    mBuffer = new_buffer;
+    mCapacity = new_capacity;
+}
+
+// == Registration =====================================================================================================
+
+// =====================================================================================================================
+// -- CStringBuilder member/method registration
+REGISTER_SCRIPT_CLASS_BEGIN(CStringBuilder, VOID)
+REGISTER_SCRIPT_CLASS_END()
+
+REGISTER_METHOD(CStringBuilder, Append, Append);
+REGISTER_METHOD(CStringBuilder, AppendLine, AppendLine);
+REGISTER_METHOD(CStringBuilder, Format, Format);
+REGISTER_METHOD(CStringBuilder, Clear, Clear);
+REGISTER_METHOD(CStringBuilder, Length, Length);
+REGISTER_METHOD(CStringBuilder, ToString, ToString);
+REGISTER_METHOD(CStringBuilder, Print, Print);
+
+} // TinScript
+
+// =====================================================================================================================
+// EOF
+// =====================================================================================================================
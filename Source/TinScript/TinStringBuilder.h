@@ -0,0 +1,78 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//  
+//  Copyright (c) 2013 Tim Andersen
+//  
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//  
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//  
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinStringBuilder.h
+// ====================================================================================================================
+
+#ifndef __TINSTRINGBUILDER_H
+#define __TINSTRINGBUILDER_H
+
+// -- includes --------------------------------------------------------------------------------------------------------
+
+#include "integration.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+// ====================================================================================================================
+// class CStringBuilder:  A growable string buffer, registered for script.
+// -- script strings are string table hashes, so every intermediate concatenation is added to the string table
+// -- the builder appends into its own buffer, and only ToString() adds the result to the string table
+// ====================================================================================================================
+class CStringBuilder
+{
+    public:
+        CStringBuilder();
+        virtual ~CStringBuilder();
+
+        void Append(const char* str0, const char* str1, const char* str2, const char* str3, const char* str4,
+                    const char* str5, const char* str6, const char* str7);
+        void AppendLine(const char* str0, const char* str1, const char* str2, const char* str3, const char* str4,
+                        const char* str5, const char* str6, const char* str7);
+        void Format(const char* format, const char* arg0, const char* arg1, const char* arg2, const char* arg3,
+                    const char* arg4, const char* arg5, const char* arg6);
+        void Clear();
+
+        int32 Length() { return (mLength); }
+        const char* GetBuffer() const { return (mBuffer != nullptr ? mBuffer : ""); }
+
+        const char* ToString();
+        void Print();
+
+    private:
+        void AppendString(const char* str, int32 length = -1);
+        void Reserve(int32 capacity);
+
+        char* mBuffer;
+        int32 mLength;
+        int32 mCapacity;
+};
+
+} // TinScript
+
+#endif
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
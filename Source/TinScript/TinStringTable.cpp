@@ -28,6 +28,8 @@
 
 // -- includes
 #include "string.h"
+#include <assert.h>
+#include <chrono>
 
 // -- TinScript includes
 #include "TinScript.h"
@@ -40,68 +42,53 @@ namespace TinScript
 
 // == CStringTable ====================================================================================================
 
+// -- the marker left in the index, when an entry is removed
+CStringTable::tStringEntry CStringTable::sRemovedEntry;
+
+// -- when removing strings within a budget, we only check the time every this many entries
+static const int32 kRemoveBudgetCheckCount = 32;
+
 // ====================================================================================================================
 // Constructor
 // ====================================================================================================================
-CStringTable::CStringTable(CScriptContext* owner, uint32 _size)
+CStringTable::CStringTable(CScriptContext* owner)
 {
     mContextOwner = owner;
+    mOwnerThread = std::this_thread::get_id();
+
+    // -- the index size must be a power of 2, so we can mask the hash - it's doubled as needed
+    static_assert((kStringTableIndexSize & (kStringTableIndexSize - 1)) == 0,
+                  "kStringTableIndexSize must be a power of 2");
+    mIndex = AllocIndex(kStringTableIndexSize);
+    mIndexSize = kStringTableIndexSize;
+    mIndexUsed = 0;
+    mIndexRemovedCount = 0;
+
+    // -- initialize the pools - each slab is (at least) kStringTableSlabSize
+    int32 entry_slab_count = kStringTableSlabSize / (int32)sizeof(tStringEntry);
+    mEntryPool = TinAlloc(ALLOC_StringTable, CMemoryPool, ALLOC_StringTable, (int32)sizeof(tStringEntry),
+                          entry_slab_count);
+    for (int32 size_class = 0; size_class < k_sizeClassCount; ++size_class)
+    {
+        int32 string_size = GetSizeClassStringSize(size_class);
+        int32 slab_count = kStringTableSlabSize / string_size;
+        if (slab_count < 4)
+            slab_count = 4;
+        mStringPools[size_class] = TinAlloc(ALLOC_StringTable, CMemoryPool, ALLOC_StringTable, string_size,
+                                            slab_count);
+    }
 
-    assert(_size > 0);
-    mSize = _size;
-    mBuffer = TinAllocArray(ALLOC_StringTable, char, mSize);
-    mBufptr = mBuffer;
-
-    mStringDictionary = TinAlloc(ALLOC_StringTable, CHashTable<tStringEntry>, kStringTableDictionarySize);
+    mDeleteList = nullptr;
+    mDeleteListCount = 0;
 
-#if STRING_TABLE_USE_POOLS
-    // -- initialize all the pools
-    for (int32 pool = (int32)eStringPool::Size16; pool < (int32)eStringPool::Count; ++pool)
-    {
-        // -- get the count
-        int32 pool_count = kStringPoolSizesCount[pool];
-        assert(pool_count > 0);
-
-        // -- get the size (note:  if we change the strategy to not use 16, 32, ...  then adjust this
-        int32 string_size = GetPoolStringSize(pool);
-        assert(string_size > 0);
-
-        // -- get the total size of the string pool
-        int32 pool_size = string_size * pool_count;
-
-        // -- allocate the pool buffer;
-        mStringPoolBuffer[pool] = TinAllocArray(ALLOC_StringTable, char, pool_size);
-        assert(mStringPoolBuffer[pool] != nullptr);
-
-        // allocate the string entry buffer for the pool
-        mStringPoolFreeList[pool] = nullptr;
-        mStringPoolEntryBuffer[pool] = TinAllocArray(ALLOC_StringTable, tStringEntry, pool_count);
-        assert(mStringPoolEntryBuffer[pool] != nullptr);
-
-        // -- initialize all string pool entries
-        char* pool_buffer_ptr = mStringPoolBuffer[pool];
-        tStringEntry* pool_entry_ptr = mStringPoolEntryBuffer[pool];
-        for (int32 entry_index = 0; entry_index < pool_count; ++entry_index)
-        {
-            // -- construct the entry in-place, set the pool member, and hook it into the free list
-            pool_entry_ptr->mPool = (eStringPool)pool;
-            pool_entry_ptr->mNextFree = mStringPoolFreeList[pool];
-            mStringPoolFreeList[pool] = pool_entry_ptr;
-
-            // -- initialize the actual string buffer
-            pool_entry_ptr->mString = pool_buffer_ptr;
-            pool_buffer_ptr[0] = '\0';
-
-            // -- update the ptrs
-            pool_buffer_ptr += string_size;
-            pool_entry_ptr++;
-        }
+    mBytesUsed = 0;
+    mBytesPeak = 0;
+    mBytesReclaimed = 0;
 
-        // -- initialize the used and high watermark counts
-        mStringPoolEntryUsedCount[pool] = 0;
-        mStringPoolEntryHighCount[pool] = 0;
-    }
-#endif
+    // -- add the literals the engine hashes at compile time, so they're permanently available to UnHash()
+    #define HashLiteralEntry(s) AddString(s, -1, HashLiteral_(s), true);
+    HashLiteralTuple
+    #undef HashLiteralEntry
 }
 
 // ====================================================================================================================
@@ -111,42 +98,51 @@ CStringTable::~CStringTable()
 {
     DumpStringTableStats();
 
-    // -- zero out the ref count for all strings, and then remove unreferenced strings
-    // -- this will return pool entries to the pool, and allocated entries will be deleted
-    tStringEntry* ste = mStringDictionary->First();
-    while (ste != nullptr)
+    // -- pooled strings and entries are released with their pools, but long strings are allocated individually
+    int32 index_size = GetIndexSize();
+    for (int32 slot = 0; slot < index_size; ++slot)
     {
-        ste->mRefCount = 0;
-        ste = mStringDictionary->Next();
+        tStringEntry* ste = GetIndexEntry(slot);
+        if (ste != nullptr && ste->mSizeClass == k_sizeClassLarge)
+        {
+            char* string_buf = const_cast<char*>(ste->mString);
+            TinFreeArray(string_buf);
+        }
     }
-    RemoveUnreferencedStrings();
 
-    // -- destroy the table and buffer
-    TinFree(mStringDictionary);
-    TinFree(mBuffer);
+    // -- destroy the index and pools
+    TinFreeArray(mIndex);
+    TinFree(mEntryPool);
+    for (int32 size_class = 0; size_class < k_sizeClassCount; ++size_class)
+        TinFree(mStringPools[size_class]);
+}
 
-#if STRING_TABLE_USE_POOLS
-    // -- destroy the pools
-    for (int32 pool = (int32)eStringPool::Size16; pool < (int32)eStringPool::Count; ++pool)
+// ====================================================================================================================
+// GetSizeClass():  Returns the pool to store a string of the given size (including terminator), or -1 if too long.
+// ====================================================================================================================
+int32 CStringTable::GetSizeClass(int32 size)
+{
+    int32 size_class = 0;
+    int32 class_size = k_sizeClassMin;
+    while (class_size < size)
     {
-        TinFreeArray(mStringPoolBuffer[pool]);
-        TinFreeArray(mStringPoolEntryBuffer[pool]);
+        class_size <<= 1;
+        if (++size_class >= k_sizeClassCount)
+            return (-1);
     }
-#endif
+
+    return (size_class);
 }
 
 // ====================================================================================================================
-// GetPoolStringSize():  we're using sizes of 16, 32, 64, 128 by default...  we use this function in case this changes
+// GetSizeClassStringSize():  Returns the size of the strings stored in the given size class pool.
 // ====================================================================================================================
-int32 CStringTable::GetPoolStringSize(int32 pool) const
+int32 CStringTable::GetSizeClassStringSize(int32 size_class)
 {
-#if STRING_TABLE_USE_POOLS
-    if (pool >= 0 && pool < (int32)eStringPool::Count)
-    {
-        return 16 * (int32)pow(2, pool);
-    }
-#endif
-    return 0;
+    if (size_class < 0 || size_class >= k_sizeClassCount)
+        return (0);
+
+    return (k_sizeClassMin << size_class);
 }
 
 // ====================================================================================================================
@@ -154,134 +150,69 @@ int32 CStringTable::GetPoolStringSize(int32 pool) const
 // ====================================================================================================================
 const char* CStringTable::AddString(const char* s, int length, uint32 hash, bool inc_refcount)
 {
+    // -- the table is not thread safe
+    assert(IsOwnerThread());
+
     // -- sanity check
     if (!s)
         return "";
 
     if (hash == 0)
-        hash = Hash(s, length);
+        hash = HashValue(s, length);
 
     // -- see if the string is already in the dictionary
-    const char* exists = FindString(hash);
+    tStringEntry* exists = FindEntry(hash);
     if (!exists)
     {
         if (length < 0)
             length = (int32)strlen(s);
 
-#if STRING_TABLE_USE_POOLS
-        int32 pool = (int32)eStringPool::None;
-        int32 pool_string_size = 0;
-        for (; pool < (int32)eStringPool::Count; ++pool)
+        if (!ReserveIndexSlot())
         {
-            // --remember to leave room for the terminator
-            pool_string_size = GetPoolStringSize(pool);
-            if (length + 1 <= pool_string_size)
-            {
-                break;
-            }
+            ScriptAssert_(mContextOwner, 0, "<internal>", -1,
+                          "Error - StringTable index of size %d is full!\n", GetIndexSize());
+            return (NULL);
         }
 
-        // -- see if we can add the string to the pool
-        if (pool < (int32)eStringPool::Count)
-        {
-            if (mStringPoolFreeList[pool] != nullptr)
-            {
-                // -- pop an entry off the free list
-                tStringEntry* pool_entry = mStringPoolFreeList[pool];
-                mStringPoolFreeList[pool] = pool_entry->mNextFree;
-                pool_entry->mNextFree = nullptr;
-
-                // -- initialize the ref count
-                if (inc_refcount)
-                {
-                    pool_entry->mRefCount = 1;
-                    pool_entry->mMarkedForDelete = false;
-                }
-                else
-                {
-                    // -- because we're not referencing, this string may be temporary - we'll add it now
-                    // to the pool delete list, so if it's still unreferenced, it can be cleaned
-                    // at when the current execution stack has concluded
-                    pool_entry->mRefCount = 0;
-                    pool_entry->mNextFree = mPoolDeleteList;
-                    mPoolDeleteList = pool_entry;
-                    pool_entry->mMarkedForDelete = true;
-                }
-
-                // -- copy the string
-                SafeStrcpy(const_cast<char*>(pool_entry->mString), pool_string_size, s, length + 1);
-
-                // -- add to the dictionary
-                pool_entry->mHash = hash;
-                mStringDictionary->AddItem(*pool_entry, hash);
-
-                // -- update the count - if we've depleted the pool the first time, send an assert message
-                mStringPoolEntryUsedCount[pool]++;
-                if (mStringPoolEntryUsedCount[pool] == kStringPoolSizesCount[pool] &&
-                    mStringPoolEntryHighCount[pool] < kStringPoolSizesCount[pool])
-                {
-                    // -- no free entries - assert, and fall through - the string will be added to the
-                    // regular string table
-                    ScriptAssert_(TinScript::GetContext(), 0, "<internal>", -1,
-                                  "Warning - StringTable pool of size %d is full\n", pool_string_size);
-                }
+        tStringEntry* new_entry = AllocEntry(s, length, hash);
+        if (new_entry == nullptr)
+            return (NULL);
 
-                if (mStringPoolEntryUsedCount[pool] > mStringPoolEntryHighCount[pool])
-                    mStringPoolEntryHighCount[pool] = mStringPoolEntryUsedCount[pool];
+        InsertEntry(mIndex, mIndexSize, new_entry);
+        ++mIndexUsed;
 
-                return pool_entry->mString;
-            }
+        // -- if this item is meant to persist, increment the ref count
+        if (inc_refcount)
+        {
+            new_entry->mRefCount++;
         }
-#endif
 
-        // -- space left
-        int32 remaining = int32(mSize - (kPointerToUInt32(mBufptr) -
-                                            kPointerToUInt32(mBuffer)));
-        if (remaining < length + 1)
+        // -- because we're not referencing, this string may be temporary - we'll add it now
+        // to the delete list, so if it's still unreferenced, it can be cleaned
+        // at when the current execution stack has concluded
+        else
         {
-            ScriptAssert_(mContextOwner, 0,
-                            "<internal>", -1, "Error - StringTable of size %d is full!\n",
-                            mSize);
-            return NULL;
+            PushDeleteList(new_entry);
         }
-        const char* stringptr = mBufptr;
-        SafeStrcpy(mBufptr, remaining, s, length + 1);
-        mBufptr += length + 1;
-
-        // -- create the string table entry, also add it to the tail list
-        tStringEntry* new_entry = TinAlloc(ALLOC_StringTable, tStringEntry, stringptr);
-        new_entry->mNextFree = mTailEntryList;
-        mTailEntryList = new_entry;
-
-        // -- add the entry to the dictionary
-        new_entry->mHash = hash;
-        mStringDictionary->AddItem(*new_entry, hash);
-
-        // -- if this item is meant to persist, increment the ref count
-        if (inc_refcount)
-            new_entry->mRefCount++;
 
-        return (stringptr);
+        return (new_entry->mString);
     }
 
-    // -- else check for a collision
-    else
-    {
-        if (length < 0)
-            length = (int32)strlen(s);
+    // -- check for a collision
+    if (length < 0)
+        length = (int32)strlen(s);
 
-        if (strncmp(exists, s, length) != 0)
-        {
-            ScriptAssert_(mContextOwner, 0, "<internal>", -1,
-                          "Error - Hash collision [0x%x]: '%s', '%s'\n", hash, exists, s);
-        }
+    if (strncmp(exists->mString, s, length) != 0)
+    {
+        ScriptAssert_(mContextOwner, 0, "<internal>", -1,
+                      "Error - Hash collision [0x%x]: '%s', '%s'\n", hash, exists->mString, s);
+    }
 
-        // -- if this item is meant to persist, increment the ref count
-        if (inc_refcount)
-            RefCountIncrement(hash);
+    // -- if this item is meant to persist, increment the ref count
+    if (inc_refcount)
+        RefCountIncrement(hash);
 
-        return exists;
-    }
+    return (exists->mString);
 }
 
 // ====================================================================================================================
@@ -289,11 +220,13 @@ const char* CStringTable::AddString(const char* s, int length, uint32 hash, bool
 // ====================================================================================================================
 const char* CStringTable::FindString(uint32 hash)
 {
+    assert(IsOwnerThread());
+
     // -- sanity check
     if (hash == 0)
         return ("");
 
-    tStringEntry* ste = mStringDictionary->FindItem(hash);
+    tStringEntry* ste = FindEntry(hash);
     return (ste ? ste->mString : NULL);
 }
 
@@ -302,11 +235,13 @@ const char* CStringTable::FindString(uint32 hash)
 // ====================================================================================================================
 void CStringTable::RefCountIncrement(uint32 hash)
 {
+    assert(IsOwnerThread());
+
     // -- sanity check
     if (hash == 0)
         return;
 
-    tStringEntry* ste = mStringDictionary->FindItem(hash);
+    tStringEntry* ste = FindEntry(hash);
     if (ste)
         ste->mRefCount++;
 }
@@ -316,111 +251,602 @@ void CStringTable::RefCountIncrement(uint32 hash)
 // ====================================================================================================================
 void CStringTable::RefCountDecrement(uint32 hash)
 {
+    assert(IsOwnerThread());
+
     // -- sanity check
     if (hash == 0)
         return;
 
-    tStringEntry* ste = mStringDictionary->FindItem(hash);
+    tStringEntry* ste = FindEntry(hash);
     if (!ste)
         return;
 
-    // -- decrement the ref count
-    ste->mRefCount--;
+    // -- decrement the ref count - push it onto the delete list, we'll delete *after* completion of
+    // the execution stack... (in case the value is still needed)
+    if (--ste->mRefCount == 0)
+        PushDeleteList(ste);
+}
 
-#if STRING_TABLE_USE_POOLS
-    if (ste->mPool != eStringPool::None && ste->mRefCount == 0)
+// ====================================================================================================================
+// RemoveUnreferencedStrings():  Free the strings on the delete list, that are still unreferenced.
+// -- must be called on the owning thread, between executions (e.g. from the context's update), or at a loop's back
+// edge, with the stack's string locals referenced - see ReclaimTransientStrings()
+// -- any entries left when the budget is spent, remain on the delete list for the next call
+// ====================================================================================================================
+int32 CStringTable::RemoveUnreferencedStrings(int32 budget_us)
+{
+    assert(IsOwnerThread());
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    int32 reclaimed = 0;
+    int32 processed = 0;
+    while (mDeleteList != nullptr)
     {
-        // -- we only want to add to the delete list once of course
-        if (!ste->mMarkedForDelete)
+        // -- see if we've spent our budget
+        if (budget_us > 0 && (++processed % kRemoveBudgetCheckCount) == 0)
         {
-            // -- push it onto the delete list - we'll delete *after* completion of
-            // the execution stack... (in case the value is still needed)
-            ste->mNextFree = mPoolDeleteList;
-            mPoolDeleteList = ste;
-            ste->mMarkedForDelete = true;
+            auto current_time = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<float, std::micro> elapsed_micro = current_time - time_start;
+            if (elapsed_micro.count() >= (float)budget_us)
+                break;
+        }
+
+        // -- pop the entry off the front of the delete list
+        tStringEntry* ste = mDeleteList;
+        mDeleteList = ste->mNextFree;
+        --mDeleteListCount;
+        ste->mNextFree = nullptr;
+        ste->mMarkedForDelete = false;
+
+        // -- if the ref count is *still* 0, remove it from the dictionary, and free it
+        if (ste->mRefCount <= 0)
+        {
+            RemoveEntry(ste);
+            reclaimed += FreeEntry(ste);
         }
     }
-#endif
+
+    mBytesReclaimed += reclaimed;
+
+    // -- once enough entries have been removed, rebuild the index so lookups aren't probing past markers
+    if (mIndexRemovedCount > (mIndexSize >> 3))
+        RebuildIndex(mIndexSize);
+
+    return (reclaimed);
 }
 
 // ====================================================================================================================
-// RemoveUnreferencedStrings():  All strings at the *end* of the dictionary, to which there are no variables
-// assigned are removed.
-// $$$TZA Convert this to an actual string handle system, allowing all unreferenced strings to be removed
-// and the buffer fragmentation to be reduced
+// AllocEntry():  Copy the string into a size class pool, or an individual allocation if it's too long.
 // ====================================================================================================================
-void CStringTable::RemoveUnreferencedStrings()
+CStringTable::tStringEntry* CStringTable::AllocEntry(const char* s, int32 length, uint32 hash)
 {
-    // -- loop back from the end of the linked list, removing all entries
-    // -- with a zero refcount (note:  entries from the main buffer, not pooled entries
-    while (mTailEntryList != nullptr)
+    int8 size_class = k_sizeClassLarge;
+    char* string_buf = AllocPooled(length + 1, size_class);
+
+    tStringEntry* new_entry = string_buf != nullptr ? mEntryPool->Construct<tStringEntry>(string_buf) : nullptr;
+    if (new_entry == nullptr)
     {
-        // -- if we hit an entry that is still being used (e.g. assigned to
-        // -- a variable) we're done
-        if (mTailEntryList->mRefCount > 0)
-            break;
+        if (string_buf != nullptr && size_class >= 0)
+        {
+            mStringPools[size_class]->Free(string_buf);
+            mBytesUsed -= GetSizeClassStringSize(size_class);
+        }
+        else if (string_buf != nullptr)
+        {
+            TinFreeArray(string_buf);
+            mBytesUsed -= length + 1;
+        }
 
-        // -- remove the entry from the dictionary
-        tStringEntry* delete_me = mTailEntryList;
-        mTailEntryList = mTailEntryList->mNextFree;
-        mStringDictionary->RemoveItem(delete_me->mHash);
+        ScriptAssert_(mContextOwner, 0, "<internal>", -1,
+                      "Error - StringTable unable to allocate a string of length %d\n", length);
+        return (nullptr);
+    }
 
-        // -- back up the buf ptr, to store the next string
-        mBufptr = const_cast<char*>(delete_me->mString);
+    SafeStrcpy(string_buf, length + 1, s, length + 1);
+    new_entry->mHash = hash;
+    new_entry->mSizeClass = size_class;
 
-        // -- delete the entry
-        TinFree(delete_me);
+    return (new_entry);
+}
+
+// ====================================================================================================================
+// FreeEntry():  Return the entry and its string to the pools - returns the number of bytes reclaimed.
+// ====================================================================================================================
+int32 CStringTable::FreeEntry(tStringEntry* entry)
+{
+    char* string_buf = const_cast<char*>(entry->mString);
+    int32 string_size = 0;
+    if (entry->mSizeClass >= 0)
+    {
+        string_size = GetSizeClassStringSize(entry->mSizeClass);
+        mStringPools[entry->mSizeClass]->Free(string_buf);
     }
+    else
+    {
+        string_size = (int32)strlen(string_buf) + 1;
+        TinFreeArray(string_buf);
+    }
+
+    mEntryPool->Destruct(entry);
+    mBytesUsed -= string_size;
 
-#if STRING_TABLE_USE_POOLS
-    while (mPoolDeleteList != nullptr)
+    return (string_size);
+}
+
+// ====================================================================================================================
+// AllocPooled():  Allocate string storage from the size class pools, or individually if it's too long.
+// ====================================================================================================================
+char* CStringTable::AllocPooled(int32 size, int8& out_size_class)
+{
+    int32 size_class = GetSizeClass(size);
+    int32 string_size = size_class >= 0 ? GetSizeClassStringSize(size_class) : size;
+    char* string_buf = nullptr;
+    if (size_class >= 0)
     {
-        // -- pop the entry off the front of the delete list
-        tStringEntry* ste = mPoolDeleteList;
-        mPoolDeleteList = ste->mNextFree;
-        ste->mMarkedForDelete = false;
+        string_buf = (char*)mStringPools[size_class]->Alloc();
+        out_size_class = (int8)size_class;
+    }
+    else
+    {
+        string_buf = TinAllocArray(ALLOC_StringTable, char, string_size);
+        out_size_class = k_sizeClassLarge;
+    }
+
+    if (string_buf == nullptr)
+        return (nullptr);
+
+    mBytesUsed += string_size;
+    if (mBytesUsed > mBytesPeak)
+        mBytesPeak = mBytesUsed;
 
-        // -- if the ref count is *still* 0, reset the entry and return to the free list
-        if (ste->mRefCount == 0)
+    return (string_buf);
+}
+
+// ====================================================================================================================
+// PushDeleteList():  Queue an unreferenced entry, to be freed once the execution stack has concluded.
+// ====================================================================================================================
+void CStringTable::PushDeleteList(tStringEntry* entry)
+{
+    // -- we only want to add to the delete list once of course
+    if (entry->mMarkedForDelete)
+        return;
+
+    entry->mNextFree = mDeleteList;
+    mDeleteList = entry;
+    ++mDeleteListCount;
+    entry->mMarkedForDelete = true;
+}
+
+// ====================================================================================================================
+// AllocIndex():  Allocate an index of the given size (a power of 2), with every slot empty.
+// ====================================================================================================================
+CStringTable::tStringEntry** CStringTable::AllocIndex(int32 size)
+{
+    tStringEntry** index = TinAllocArray(ALLOC_StringTable, tStringEntry*, size);
+    if (index == nullptr)
+        return (nullptr);
+
+    memset(index, 0, sizeof(tStringEntry*) * size);
+    return (index);
+}
+
+// ====================================================================================================================
+// InsertEntry():  Store the entry in the first empty slot of its probe sequence - the entry must not already exist.
+// ====================================================================================================================
+void CStringTable::InsertEntry(tStringEntry** index, int32 index_size, tStringEntry* entry)
+{
+    uint32 mask = (uint32)(index_size - 1);
+    uint32 slot = entry->mHash & mask;
+    while (index[slot] != nullptr)
+        slot = (slot + 1) & mask;
+
+    index[slot] = entry;
+}
+
+// ====================================================================================================================
+// GetIndexEntry():  Returns the entry in the given index slot, or nullptr if the slot is empty.
+// ====================================================================================================================
+CStringTable::tStringEntry* CStringTable::GetIndexEntry(int32 slot) const
+{
+    if (slot < 0 || slot >= mIndexSize)
+        return (nullptr);
+
+    tStringEntry* ste = mIndex[slot];
+    return (ste != &sRemovedEntry ? ste : nullptr);
+}
+
+// ====================================================================================================================
+// FindEntry():  Probe the index from the hash slot, until we find the entry or an empty slot.
+// ====================================================================================================================
+CStringTable::tStringEntry* CStringTable::FindEntry(uint32 hash) const
+{
+    uint32 mask = (uint32)(mIndexSize - 1);
+    uint32 slot = hash & mask;
+    for (int32 probe = 0; probe < mIndexSize; ++probe)
+    {
+        tStringEntry* ste = mIndex[slot];
+        if (ste == nullptr)
+            return (nullptr);
+
+        if (ste != &sRemovedEntry && ste->mHash == hash)
+            return (ste);
+
+        slot = (slot + 1) & mask;
+    }
+
+    return (nullptr);
+}
+
+// ====================================================================================================================
+// ReserveIndexSlot():  Ensure there's room in the index for one more entry, growing it if needed - returns false if
+// the index couldn't be grown.
+// ====================================================================================================================
+bool CStringTable::ReserveIndexSlot()
+{
+    // -- keep the load factor low enough that probe sequences stay short - if most of the used slots are
+    // removed markers, rebuilding at the same size is enough
+    if (mIndexUsed < ((mIndexSize >> 2) * 3))
+        return (true);
+
+    int32 new_size = mIndexRemovedCount >= (mIndexUsed >> 1) ? mIndexSize : mIndexSize << 1;
+    return (new_size > 0 && RebuildIndex(new_size));
+}
+
+// ====================================================================================================================
+// RemoveEntry():  Replace the entry's slot with the removed marker, so probe sequences through it remain intact.
+// ====================================================================================================================
+void CStringTable::RemoveEntry(tStringEntry* entry)
+{
+    uint32 mask = (uint32)(mIndexSize - 1);
+    uint32 slot = entry->mHash & mask;
+    for (int32 probe = 0; probe < mIndexSize; ++probe)
+    {
+        tStringEntry* ste = mIndex[slot];
+        if (ste == nullptr)
+            return;
+
+        if (ste == entry)
         {
-            // -- pop the ste back onto its free list
-            ste->mNextFree = mStringPoolFreeList[(int32)ste->mPool];
-            mStringPoolFreeList[(int32)ste->mPool] = ste;
-            const_cast<char*>(ste->mString)[0] = '\0';
+            mIndex[slot] = &sRemovedEntry;
+            ++mIndexRemovedCount;
+            return;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
 
-            // -- remove it from the dictionary
-            mStringDictionary->RemoveItem(ste->mHash);
-            ste->mHash = 0;
+// ====================================================================================================================
+// RebuildIndex():  Reinsert all live entries into a new index of the given size, discarding the removed markers.
+// ====================================================================================================================
+bool CStringTable::RebuildIndex(int32 new_size)
+{
+    tStringEntry** new_index = AllocIndex(new_size);
+    if (new_index == nullptr)
+        return (false);
 
-            // -- decrement the used count
-            mStringPoolEntryUsedCount[(int32)ste->mPool]--;
+    mIndexUsed = 0;
+    mIndexRemovedCount = 0;
+    for (int32 slot = 0; slot < mIndexSize; ++slot)
+    {
+        tStringEntry* ste = mIndex[slot];
+        if (ste != nullptr && ste != &sRemovedEntry)
+        {
+            InsertEntry(new_index, new_size, ste);
+            ++mIndexUsed;
         }
     }
-#endif
+
+    TinFreeArray(mIndex);
+    mIndex = new_index;
+    mIndexSize = new_size;
+
+    return (true);
 }
 
 // ====================================================================================================================
-// DumpStringTableStats():  print out the used and high pool entry stats
+// DumpStringTableStats():  print out the memory used, and the used/capacity for each size class pool
 // ====================================================================================================================
 void CStringTable::DumpStringTableStats()
 {
     CScriptContext* script_context = TinScript::GetContext();
     TinPrint(script_context, "### StringTable Stats:\n");
-    int32 remaining = int32(mSize - (kPointerToUInt32(mBufptr) - kPointerToUInt32(mBuffer)));
-    int32 used = kStringTableSize - remaining;
-    TinPrint(script_context, "    Main Buffer used %d / %d, %.2f%%%%\n", used,
-                             kStringTableSize, (float(used) / float(kStringTableSize)) * 100.0f);
+    TinPrint(script_context, "    String bytes used %d, peak: %d, reclaimed: %d\n", mBytesUsed, mBytesPeak,
+                             mBytesReclaimed);
+    TinPrint(script_context, "    Index used %d / %d, removed: %d\n", mIndexUsed, GetIndexSize(),
+                             mIndexRemovedCount);
 
-#if STRING_TABLE_USE_POOLS
-    for (int32 pool = 0; pool < (int32)eStringPool::Count; ++pool)
+    for (int32 size_class = 0; size_class < k_sizeClassCount; ++size_class)
     {
-        int string_size = GetPoolStringSize(pool);
-        TinPrint(script_context, "    Pool %d used: %d, high: %d, max: %d  [%.2f%%%%]\n", string_size,
-                                 mStringPoolEntryUsedCount[pool], mStringPoolEntryHighCount[pool],
-                                 kStringPoolSizesCount[pool],
-                                 (float(mStringPoolEntryHighCount[pool]) / float(kStringPoolSizesCount[pool])) * 100.0f);
+        CMemoryPool* pool = mStringPools[size_class];
+        TinPrint(script_context, "    Pool %d used: %d, capacity: %d\n", GetSizeClassStringSize(size_class),
+                                 pool->GetUsed(), pool->GetCapacity());
     }
-#endif
+}
+
+// == CSharedStringTable ==============================================================================================
+
+std::atomic<CSharedStringTable*> CSharedStringTable::gInstance(nullptr);
+
+// ====================================================================================================================
+// GetInstance():  Returns the shared table, creating it on first use - any thread may be first.
+// ====================================================================================================================
+CSharedStringTable* CSharedStringTable::GetInstance()
+{
+    CSharedStringTable* instance = gInstance.load(std::memory_order_acquire);
+    if (instance == nullptr)
+    {
+        // -- if another thread publishes its table first, we use that one, and discard ours
+        CSharedStringTable* new_instance = TinAllocShared(ALLOC_StringTable, CSharedStringTable);
+        if (gInstance.compare_exchange_strong(instance, new_instance, std::memory_order_acq_rel,
+                                              std::memory_order_acquire))
+        {
+            instance = new_instance;
+        }
+        else
+        {
+            TinFree(new_instance);
+        }
+    }
+
+    return (instance);
+}
+
+// ====================================================================================================================
+// Shutdown():  Frees the shared table, and every string in it.
+// ====================================================================================================================
+void CSharedStringTable::Shutdown()
+{
+    CSharedStringTable* instance = gInstance.exchange(nullptr, std::memory_order_acq_rel);
+    if (instance != nullptr)
+    {
+        TinFree(instance);
+    }
+}
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CSharedStringTable::CSharedStringTable()
+    : mChunks(nullptr)
+    , mStringCount(0)
+{
+    static_assert((kSharedStringTableIndexSize & (kSharedStringTableIndexSize - 1)) == 0,
+                  "kSharedStringTableIndexSize must be a power of 2");
+    mFirstLevel = TinAllocShared(ALLOC_StringTable, tLevel, kSharedStringTableIndexSize);
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CSharedStringTable::~CSharedStringTable()
+{
+    tLevel* level = mFirstLevel;
+    while (level != nullptr)
+    {
+        tLevel* next = level->mNext.load(std::memory_order_relaxed);
+        TinFree(level);
+        level = next;
+    }
+
+    tChunk* chunk = mChunks.load(std::memory_order_relaxed);
+    while (chunk != nullptr)
+    {
+        tChunk* prev = chunk->mPrev;
+        TinFreeArray(reinterpret_cast<char*>(chunk));
+        chunk = prev;
+    }
+}
+
+// ====================================================================================================================
+// tLevel:  Constructor - every slot starts empty.
+// ====================================================================================================================
+CSharedStringTable::tLevel::tLevel(int32 size)
+    : mSize(size)
+    , mNext(nullptr)
+{
+    mSlots = TinAllocSharedArray(ALLOC_StringTable, std::atomic<tSharedString*>, size);
+    for (int32 i = 0; i < size; ++i)
+        mSlots[i].store(nullptr, std::memory_order_relaxed);
+}
+
+// ====================================================================================================================
+// tLevel:  Destructor
+// ====================================================================================================================
+CSharedStringTable::tLevel::~tLevel()
+{
+    TinFreeArray(mSlots);
+}
+
+// ====================================================================================================================
+// AddString():  Add a string to the table, if it isn't already - returns the table's copy of the string.
+// -- every thread adding the same hash follows the same probe sequence, and the first empty slot within
+// kSharedStringTableMaxProbe is claimed by CAS - so a string is only ever added once
+// ====================================================================================================================
+const char* CSharedStringTable::AddString(const char* s, int32 length, uint32 hash)
+{
+    // -- sanity check
+    if (!s)
+        return ("");
+
+    if (length < 0)
+        length = (int32)strlen(s);
+
+    if (hash == 0)
+        hash = HashValue(s, length);
+
+    if (hash == 0)
+        return ("");
+
+    tSharedString* new_entry = nullptr;
+    tLevel* level = mFirstLevel;
+    while (level != nullptr)
+    {
+        uint32 mask = (uint32)(level->mSize - 1);
+        uint32 slot = hash & mask;
+        for (int32 probe = 0; probe < kSharedStringTableMaxProbe; ++probe)
+        {
+            tSharedString* entry = level->mSlots[slot].load(std::memory_order_acquire);
+            if (entry == nullptr)
+            {
+                // -- the entry is only allocated once we know we'll need it, and is reused if we lose the slot
+                if (new_entry == nullptr)
+                {
+                    new_entry = AllocEntry(s, length, hash);
+                    if (new_entry == nullptr)
+                        return (nullptr);
+                }
+
+                if (level->mSlots[slot].compare_exchange_strong(entry, new_entry, std::memory_order_acq_rel,
+                                                                std::memory_order_acquire))
+                {
+                    mStringCount.fetch_add(1, std::memory_order_relaxed);
+                    return (new_entry->mString);
+                }
+
+                // -- another thread claimed the slot first - entry is now what it stored
+            }
+
+            if (entry->mHash == hash)
+            {
+                // -- note:  if we allocated an entry and lost the slot to the same string, the entry is simply
+                // left unused in its chunk - this is rare, and only when two threads add the same new string
+                // -- the calling thread may not have a context (or an assert handler), so a collision is a plain assert
+                Assert_(strncmp(entry->mString, s, length) == 0 && entry->mString[length] == '\0');
+                return (entry->mString);
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        // -- every slot within reach is taken by another string, try the next level
+        level = GetNextLevel(level);
+    }
+
+    return (nullptr);
+}
+
+// ====================================================================================================================
+// FindString():  Finds a string in the table, without locking - returns nullptr if the hash hasn't been added.
+// ====================================================================================================================
+const char* CSharedStringTable::FindString(uint32 hash) const
+{
+    // -- sanity check
+    if (hash == 0)
+        return ("");
+
+    for (tLevel* level = mFirstLevel; level != nullptr; level = level->mNext.load(std::memory_order_acquire))
+    {
+        uint32 mask = (uint32)(level->mSize - 1);
+        uint32 slot = hash & mask;
+        for (int32 probe = 0; probe < kSharedStringTableMaxProbe; ++probe)
+        {
+            tSharedString* entry = level->mSlots[slot].load(std::memory_order_acquire);
+
+            // -- an empty slot ends the search - AddString() would have claimed it
+            if (entry == nullptr)
+                return (nullptr);
+
+            if (entry->mHash == hash)
+                return (entry->mString);
+
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    return (nullptr);
+}
+
+// ====================================================================================================================
+// GetLevelCount():  Returns the number of index levels, for stats and testing.
+// ====================================================================================================================
+int32 CSharedStringTable::GetLevelCount() const
+{
+    int32 count = 0;
+    for (tLevel* level = mFirstLevel; level != nullptr; level = level->mNext.load(std::memory_order_acquire))
+        ++count;
+
+    return (count);
+}
+
+// ====================================================================================================================
+// AllocEntry():  Allocate an entry and a copy of the string, from the shared chunks.
+// ====================================================================================================================
+CSharedStringTable::tSharedString* CSharedStringTable::AllocEntry(const char* s, int32 length, uint32 hash)
+{
+    char* storage = AllocStorage((int32)sizeof(tSharedString) + length + 1);
+    if (storage == nullptr)
+        return (nullptr);
+
+    tSharedString* entry = reinterpret_cast<tSharedString*>(storage);
+    char* string = storage + sizeof(tSharedString);
+    memcpy(string, s, length);
+    string[length] = '\0';
+
+    entry->mHash = hash;
+    entry->mString = string;
+    return (entry);
+}
+
+// ====================================================================================================================
+// AllocStorage():  Bump allocate from the current chunk, or publish a new chunk by CAS once it's full.
+// ====================================================================================================================
+char* CSharedStringTable::AllocStorage(int32 size)
+{
+    // -- keep every entry aligned
+    const int32 align = (int32)alignof(tSharedString);
+    size = (size + align - 1) & ~(align - 1);
+
+    tChunk* chunk = mChunks.load(std::memory_order_acquire);
+    while (true)
+    {
+        if (chunk != nullptr)
+        {
+            int32 offset = chunk->mUsed.fetch_add(size, std::memory_order_relaxed);
+            if (offset + size <= chunk->mSize)
+                return (reinterpret_cast<char*>(chunk + 1) + offset);
+        }
+
+        // -- the new chunk is created with our allocation already reserved
+        int32 chunk_size = size > kSharedStringTableChunkSize ? size : kSharedStringTableChunkSize;
+        char* chunk_mem = TinAllocSharedArray(ALLOC_StringTable, char, (int32)sizeof(tChunk) + chunk_size);
+        if (chunk_mem == nullptr)
+            return (nullptr);
+
+        tChunk* new_chunk = reinterpret_cast<tChunk*>(chunk_mem);
+        new_chunk->mPrev = chunk;
+        new_chunk->mSize = chunk_size;
+        new (&new_chunk->mUsed) std::atomic<int32>(size);
+
+        // -- if another thread replaced the full chunk first, we discard ours, and allocate from theirs
+        if (mChunks.compare_exchange_strong(chunk, new_chunk, std::memory_order_acq_rel, std::memory_order_acquire))
+            return (reinterpret_cast<char*>(new_chunk + 1));
+
+        TinFreeArray(chunk_mem);
+    }
+}
+
+// ====================================================================================================================
+// GetNextLevel():  Returns the level after the given one, creating it (twice the size) if needed.
+// ====================================================================================================================
+CSharedStringTable::tLevel* CSharedStringTable::GetNextLevel(tLevel* level)
+{
+    tLevel* next = level->mNext.load(std::memory_order_acquire);
+    if (next == nullptr)
+    {
+        tLevel* new_level = TinAllocShared(ALLOC_StringTable, tLevel, level->mSize * 2);
+        if (level->mNext.compare_exchange_strong(next, new_level, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire))
+        {
+            next = new_level;
+        }
+        else
+        {
+            TinFree(new_level);
+        }
+    }
+
+    return (next);
 }
 
 } // TinScript
@@ -27,6 +27,8 @@
 
 // -- lib includes
 #include <string.h>
+#include <atomic>
+#include <thread>
 
 // -- includes
 #include "integration.h"
@@ -37,31 +39,34 @@
 namespace TinScript
 {
 
+class CMemoryPool;
+
 // ====================================================================================================================
 // class CStringTable
 // Used to create a dictionary of hashed strings, refcounted to allow unused strings to be deleted
+// -- a string table belongs to its context's thread, and is not thread safe:  Hash() only ever adds to the calling
+// -- thread's own context - threads without a context add to the CSharedStringTable, and callers needing only the
+// -- value use HashValue(), which never touches a table
+// -- the index is open addressed, and grown (or rebuilt) as needed
+// -- a string never moves once added, as its const char* may have been handed out (e.g. by UnHash()) - intermediate
+// -- values are pooled like any other string, so each is freed individually once unreferenced
 // ====================================================================================================================
 class CStringTable
 {
     public:
 
-        // the string table "as is", only ever "frees" unused strings from the end of the mBuffer...
-        // we can help avoid fragmentation, if we set up pools for strings of size 16, 32, 64, 128
-        // to use this, enable STRING_TABLE_USE_POOLS in integration.h
-        enum class eStringPool : int8
-        {
-            None = -1,
-            Size16,
-            Size32,
-            Size64,
-            Size128,
-            Count
-        };
+        // -- strings are stored in size class pools (16, 32, ... 2048 bytes, including the terminator), so any
+        // -- unreferenced string can be freed, and its memory reused - longer strings are allocated individually
+        static const int32 k_sizeClassCount = 8;
+        static const int32 k_sizeClassMin = 16;
+
+        // -- entries too long for a size class pool
+        static const int8 k_sizeClassLarge = -1;
 
         // -- each string table entry is a ref counted const char*, so when a string is no longer
-        // -- being used, it can be deleted from the dictionary buffer
-        // -- without garbage collection, we simply remove unreferenced strings from the end
-        // -- of the linked list
+        // -- being used, it can be deleted from the dictionary
+        // -- entries that are added unreferenced, or whose ref count drops to zero, are pushed onto the
+        // -- delete list, and freed by RemoveUnreferencedStrings() if they're still unreferenced
         struct tStringEntry
         {
             tStringEntry(const char* _string = nullptr)
@@ -72,51 +77,151 @@ class CStringTable
             {
             }
 
-            int32 mRefCount = 0;
+            int32 mRefCount;
             const char* mString = nullptr;
             uint32 mHash = 0;
             tStringEntry* mNextFree = nullptr;
-            eStringPool mPool = eStringPool::None;
+            int8 mSizeClass = -1;
             bool mMarkedForDelete = false;
         };
 
-        int32 GetPoolStringSize(int32 pool) const;
+        static int32 GetSizeClass(int32 length);
+        static int32 GetSizeClassStringSize(int32 size_class);
 
-        CStringTable(CScriptContext* owner, uint32 _size);
+        CStringTable(CScriptContext* owner);
         virtual ~CStringTable();
 
         CScriptContext* GetScriptContext() { return (mContextOwner); }
 
+        // -- the table is created on its context's thread
+        bool IsOwnerThread() const { return (std::this_thread::get_id() == mOwnerThread); }
+
         const char* AddString(const char* s, int length = -1, uint32 hash = 0, bool inc_refcount = false);
         const char* FindString(uint32 hash);
 
         void RefCountIncrement(uint32 hash);
         void RefCountDecrement(uint32 hash);
 
-        void RemoveUnreferencedStrings();
+        // -- frees unreferenced strings until the budget (in microseconds) is spent, 0 is unlimited
+        // -- returns the number of bytes reclaimed
+        int32 RemoveUnreferencedStrings(int32 budget_us = 0);
 
-        const CHashTable<tStringEntry>* GetStringDictionary() { return (mStringDictionary); }
+        // -- the number of strings in the dictionary, including unreferenced strings not yet removed
+        int32 GetStringCount() const { return (mIndexUsed - mIndexRemovedCount); }
+
+        // -- the number of strings waiting to be removed, if they're still unreferenced
+        int32 GetDeleteListCount() const { return (mDeleteListCount); }
+
+        // -- iterating the index is only safe on the owning thread
+        int32 GetIndexSize() const { return (mIndexSize); }
+        tStringEntry* GetIndexEntry(int32 slot) const;
 
         void DumpStringTableStats();
 
     private:
+
+        tStringEntry* AllocEntry(const char* s, int32 length, uint32 hash);
+        int32 FreeEntry(tStringEntry* entry);
+        void PushDeleteList(tStringEntry* entry);
+
+        char* AllocPooled(int32 size, int8& out_size_class);
+
+        static tStringEntry** AllocIndex(int32 size);
+        static void InsertEntry(tStringEntry** index, int32 index_size, tStringEntry* entry);
+
+        tStringEntry* FindEntry(uint32 hash) const;
+        bool ReserveIndexSlot();
+        void RemoveEntry(tStringEntry* entry);
+        bool RebuildIndex(int32 new_size);
+
         CScriptContext* mContextOwner;
+        std::thread::id mOwnerThread;
+
+        // -- the index maps hash to entry - a removed entry leaves a marker, until the index is rebuilt
+        static tStringEntry sRemovedEntry;
+        tStringEntry** mIndex;
+        int32 mIndexSize;
+
+        // -- used slots include the removed markers
+        int32 mIndexUsed;
+        int32 mIndexRemovedCount;
+
+        CMemoryPool* mEntryPool;
+        CMemoryPool* mStringPools[k_sizeClassCount];
+        tStringEntry* mDeleteList;
+        int32 mDeleteListCount;
+
+        // -- stats
+        int32 mBytesUsed;
+        int32 mBytesPeak;
+        int32 mBytesReclaimed;
+};
+
+// ====================================================================================================================
+// class CSharedStringTable
+// A process wide, insert only dictionary of hashed strings, safe to use from any thread without a lock
+// -- Hash() adds to it from threads without a context (e.g. the parallel loop threads), and UnHash() falls back to it
+// -- lookups never lock or wait:  the index is a list of open addressed levels, each twice the size of the previous,
+// -- and a slot is only ever changed once, from empty to an entry (by CAS) - a level is never resized or freed
+// -- strings are never removed, and are packed into shared chunks, so they're valid until the main context is destroyed
+// ====================================================================================================================
+class CSharedStringTable
+{
+    public:
+        // -- the table is created on first use, by whichever thread gets there first
+        static CSharedStringTable* GetInstance();
+
+        // -- returns null if nothing has been added yet, so lookups don't create the table
+        static CSharedStringTable* FindInstance() { return (gInstance.load(std::memory_order_acquire)); }
+
+        // -- called when the main thread context is destroyed, and no other thread may be using the table
+        static void Shutdown();
+
+        const char* AddString(const char* s, int32 length = -1, uint32 hash = 0);
+        const char* FindString(uint32 hash) const;
+
+        int32 GetStringCount() const { return (mStringCount.load(std::memory_order_relaxed)); }
+        int32 GetLevelCount() const;
+
+    private:
+        friend class CMemoryTracker;
+        CSharedStringTable();
+        ~CSharedStringTable();
+
+        // -- the string is stored immediately after its entry
+        struct tSharedString
+        {
+            uint32 mHash;
+            const char* mString;
+        };
+
+        struct tLevel
+        {
+            tLevel(int32 size);
+            ~tLevel();
+
+            int32 mSize;
+            std::atomic<tSharedString*>* mSlots;
+            std::atomic<tLevel*> mNext;
+        };
+
+        // -- strings are bump allocated from the current chunk, and the chunks are freed with the table
+        struct tChunk
+        {
+            tChunk* mPrev;
+            int32 mSize;
+            std::atomic<int32> mUsed;
+        };
+
+        tSharedString* AllocEntry(const char* s, int32 length, uint32 hash);
+        char* AllocStorage(int32 size);
+        tLevel* GetNextLevel(tLevel* level);
+
+        tLevel* mFirstLevel;
+        std::atomic<tChunk*> mChunks;
+        std::atomic<int32> mStringCount;
 
-        uint32 mSize;
-        char* mBuffer;
-        char* mBufptr;
-
-        CHashTable<tStringEntry>* mStringDictionary;
-        tStringEntry* mTailEntryList = nullptr;
-
-#if STRING_TABLE_USE_POOLS
-        char* mStringPoolBuffer[(int32)eStringPool::Count];
-        tStringEntry* mStringPoolEntryBuffer[(int32)eStringPool::Count];
-        tStringEntry* mStringPoolFreeList[(int32)eStringPool::Count];
-        int32 mStringPoolEntryUsedCount[(int32)eStringPool::Count];
-        int32 mStringPoolEntryHighCount[(int32)eStringPool::Count];
-        tStringEntry* mPoolDeleteList = nullptr;
-#endif
+        static std::atomic<CSharedStringTable*> gInstance;
 };
 
 } // TinScript
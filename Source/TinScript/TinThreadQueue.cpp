@@ -0,0 +1,208 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinThreadQueue.cpp
+// ====================================================================================================================
+
+// -- class include
+#include "TinThreadQueue.h"
+
+// -- includes
+#include "string.h"
+
+#include "TinScript.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+static_assert((kThreadCommandQueueSize & (kThreadCommandQueueSize - 1)) == 0,
+              "Error - kThreadCommandQueueSize must be a power of 2");
+
+// == class CThreadCommand ============================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CThreadCommand::CThreadCommand(uint32 func_hash, uint32 object_id)
+{
+    Reset(func_hash, object_id);
+}
+
+// ====================================================================================================================
+// Reset():  Clears the parameters, so the command can be reused for a new call
+// ====================================================================================================================
+void CThreadCommand::Reset(uint32 func_hash, uint32 object_id)
+{
+    mFuncHash = func_hash;
+    mObjectID = object_id;
+    mParamCount = 0;
+    mStringLength = 0;
+}
+
+// ====================================================================================================================
+// AddParam():  Appends a typed parameter value
+// ====================================================================================================================
+bool8 CThreadCommand::AddParam(eVarType param_type, const void* value)
+{
+    // -- sanity check
+    if (param_type < FIRST_VALID_TYPE || param_type > LAST_VALID_TYPE || value == nullptr ||
+        mParamCount >= kThreadCommandMaxParams)
+    {
+        return (false);
+    }
+
+    // -- strings are copied into the command, and the value is the offset into the string buffer
+    if (param_type == TYPE_string)
+    {
+        const char* string_value = (const char*)value;
+        int32 length = (int32)strlen(string_value) + 1;
+        if (mStringLength + length > kThreadCommandStringSize)
+            return (false);
+
+        memcpy(&mStringBuffer[mStringLength], string_value, length);
+        mParamValue[mParamCount][0] = (uint32)mStringLength;
+        mStringLength += length;
+    }
+    else
+    {
+        memcpy(mParamValue[mParamCount], value, gRegisteredTypeSize[param_type]);
+    }
+
+    mParamType[mParamCount++] = param_type;
+    return (true);
+}
+
+// ====================================================================================================================
+// GetParamAddr():  Returns the address of the parameter value (or the const char*, for a string)
+// ====================================================================================================================
+void* CThreadCommand::GetParamAddr(int32 index)
+{
+    if (index < 0 || index >= mParamCount)
+        return (nullptr);
+
+    if (mParamType[index] == TYPE_string)
+        return (&mStringBuffer[mParamValue[index][0]]);
+
+    return (mParamValue[index]);
+}
+
+// == class CThreadCommandQueue =======================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CThreadCommandQueue::CThreadCommandQueue()
+{
+    // -- the slots are written by producer threads, so they aren't owned by the consumer's context allocator
+    mSlots = TinAllocSharedArray(ALLOC_ThreadQueue, tSlot, kThreadCommandQueueSize);
+    for (int32 i = 0; i < kThreadCommandQueueSize; ++i)
+        mSlots[i].mSequence.store((uint32)i, std::memory_order_relaxed);
+
+    mEnqueuePos.store(0, std::memory_order_relaxed);
+    mDequeuePos.store(0, std::memory_order_relaxed);
+    mRejectedCount.store(0, std::memory_order_relaxed);
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CThreadCommandQueue::~CThreadCommandQueue()
+{
+    TinFreeArray(mSlots);
+}
+
+// ====================================================================================================================
+// Push():  Copies the command into the next free slot, returns false if the queue is full
+// ====================================================================================================================
+bool8 CThreadCommandQueue::Push(const CThreadCommand& command)
+{
+    uint32 pos = mEnqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        tSlot* slot = &mSlots[pos & (kThreadCommandQueueSize - 1)];
+        uint32 sequence = slot->mSequence.load(std::memory_order_acquire);
+        int32 diff = (int32)(sequence - pos);
+
+        // -- the slot is free for this position - try to claim it
+        if (diff == 0)
+        {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot->mCommand = command;
+                slot->mSequence.store(pos + 1, std::memory_order_release);
+                return (true);
+            }
+        }
+
+        // -- the slot still holds a command from the previous lap - the queue is full
+        else if (diff < 0)
+        {
+            mRejectedCount.fetch_add(1, std::memory_order_relaxed);
+            return (false);
+        }
+
+        // -- another producer claimed this position first
+        else
+        {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// ====================================================================================================================
+// Pop():  Copies out the oldest command, returns false if the queue is empty
+// ====================================================================================================================
+bool8 CThreadCommandQueue::Pop(CThreadCommand& command)
+{
+    // -- single consumer, so the dequeue position is only ever written here
+    uint32 pos = mDequeuePos.load(std::memory_order_relaxed);
+    tSlot* slot = &mSlots[pos & (kThreadCommandQueueSize - 1)];
+    uint32 sequence = slot->mSequence.load(std::memory_order_acquire);
+    if ((int32)(sequence - (pos + 1)) < 0)
+        return (false);
+
+    command = slot->mCommand;
+
+    // -- release the slot for the next lap
+    slot->mSequence.store(pos + kThreadCommandQueueSize, std::memory_order_release);
+    mDequeuePos.store(pos + 1, std::memory_order_relaxed);
+    return (true);
+}
+
+// ====================================================================================================================
+// GetCount():  Returns the number of commands waiting to be processed
+// ====================================================================================================================
+int32 CThreadCommandQueue::GetCount() const
+{
+    uint32 enqueue_pos = mEnqueuePos.load(std::memory_order_relaxed);
+    uint32 dequeue_pos = mDequeuePos.load(std::memory_order_relaxed);
+    int32 count = (int32)(enqueue_pos - dequeue_pos);
+    return (count > 0 ? count : 0);
+}
+
+} // TinScript
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
@@ -0,0 +1,120 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinThreadQueue.h
+// Typed script commands, posted from any thread, to be executed by the thread owning a script context
+// ====================================================================================================================
+
+#ifndef __TINTHREADQUEUE_H
+#define __TINTHREADQUEUE_H
+
+// -- includes --------------------------------------------------------------------------------------------------------
+
+#include <atomic>
+
+#include "integration.h"
+#include "TinTypes.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+// ====================================================================================================================
+// class CThreadCommand:  A pre-resolved function (or method) call, with typed parameters.
+// -- built on the posting thread, without touching the context (no string table, no allocations),
+// so string parameters are copied into the command itself
+// ====================================================================================================================
+class CThreadCommand
+{
+    public:
+        CThreadCommand(uint32 func_hash = 0, uint32 object_id = 0);
+
+        void Reset(uint32 func_hash, uint32 object_id = 0);
+
+        // -- for TYPE_string, value is the const char*, otherwise the address of the value
+        // -- returns false if the command is out of parameter or string space
+        bool8 AddParam(eVarType param_type, const void* value);
+
+        uint32 GetFuncHash() const { return (mFuncHash); }
+        uint32 GetObjectID() const { return (mObjectID); }
+        int32 GetParamCount() const { return (mParamCount); }
+        eVarType GetParamType(int32 index) const { return (mParamType[index]); }
+
+        // -- as with AddParam(), for TYPE_string this returns the const char*
+        void* GetParamAddr(int32 index);
+
+    private:
+        uint32 mFuncHash;
+        uint32 mObjectID;
+        int32 mParamCount;
+        int32 mStringLength;
+        eVarType mParamType[kThreadCommandMaxParams];
+        uint32 mParamValue[kThreadCommandMaxParams][MAX_TYPE_SIZE];
+        char mStringBuffer[kThreadCommandStringSize];
+};
+
+// ====================================================================================================================
+// class CThreadCommandQueue:  A bounded, lock-free, multi-producer single-consumer ring of thread commands.
+// -- each slot carries a sequence number, so producers claim a slot with a single CAS on the enqueue position,
+// and the consumer knows a slot is ready when its sequence catches up
+// -- a full queue rejects the command (the caller is told, and the rejection is counted), rather than blocking
+// ====================================================================================================================
+class CThreadCommandQueue
+{
+    public:
+        CThreadCommandQueue();
+        ~CThreadCommandQueue();
+
+        // -- any thread
+        bool8 Push(const CThreadCommand& command);
+
+        // -- only the thread owning the queue (the context thread)
+        bool8 Pop(CThreadCommand& command);
+
+        // -- approximate, if producers are active
+        int32 GetCount() const;
+        uint32 GetRejectedCount() const { return (mRejectedCount.load(std::memory_order_relaxed)); }
+
+    private:
+        struct tSlot
+        {
+            std::atomic<uint32> mSequence;
+            CThreadCommand mCommand;
+        };
+
+        tSlot* mSlots;
+
+        // -- the producer and consumer positions are kept on separate cache lines
+        std::atomic<uint32> mEnqueuePos;
+        char mPadding[kCacheLineSize];
+        std::atomic<uint32> mDequeuePos;
+        std::atomic<uint32> mRejectedCount;
+};
+
+} // TinScript
+
+#endif // __TINTHREADQUEUE_H
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
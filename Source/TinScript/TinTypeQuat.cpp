@@ -0,0 +1,354 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------------------------
+// TinTypeQuat.cpp : The registered type quat required methods
+// ------------------------------------------------------------------------------------------------
+
+// -- lib includes
+#include "stdio.h"
+#include "string.h"
+#include "stdlib.h"
+
+#include "mathutil.h"
+
+#include "integration.h"
+#include "TinHash.h"
+#include "TinCompile.h"
+#include "TinTypes.h"
+#include "TinScript.h"
+#include "TinStringTable.h"
+#include "TinOpExecFunctions.h"
+#include "TinRegBinding.h"
+
+namespace TinScript {
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- quat POD table
+tPODTypeTable* gQuatTable = nullptr;
+
+// --------------------------------------------------------------------------------------------------------------------
+// External type - CQuaternion is a POD type
+bool8 QuatToString(TinScript::CScriptContext* script_context, void* value, char* buf, int32 bufsize)
+{
+	if (value && buf && bufsize > 0)
+    {
+        CQuaternion* q = (CQuaternion*)value;
+        snprintf(buf, bufsize, "%.4f %.4f %.4f %.4f", q->x, q->y, q->z, q->w);
+		return (true);
+	}
+	return (false);
+}
+
+bool8 StringToQuat(TinScript::CScriptContext* script_context, void* addr, char* value)
+{
+	if (addr && value)
+    {
+        CQuaternion* varaddr = (CQuaternion*)addr;
+
+        // -- an empty string is the identity rotation
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+		float w = 1.0f;
+
+		// -- if the string is non-empty, ensure we can read in either space or comma delineated format
+		bool success = true;
+        if (value[0])
+        {
+			success = sscanf_s(value, "%f %f %f %f", &x, &y, &z, &w) == 4;
+			success = success || (sscanf_s(value, "%f, %f, %f, %f", &x, &y, &z, &w) == 4);
+		}
+
+		if (success)
+		{
+			*varaddr = CQuaternion(x, y, z, w);
+			return (true);
+        }
+	}
+	return (false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- quat * quat concatenates rotations, quat * vector3f rotates the vector
+bool8 QuatOpOverrides(CScriptContext* script_context, eOpCode op, eVarType& result_type, void* result_addr,
+                      eVarType val0_type, void* val0, eVarType val1_type, void* val1)
+{
+    // -- sanity check
+    if (!script_context || !result_addr || !val0 || !val1)
+        return (false);
+
+    // -- the lhs must be a quat
+    CQuaternion q0;
+    if (!TypeConvertValue<TYPE_quat>(script_context, val0_type, val0, q0))
+        return (false);
+
+    // -- rotating a vector is the only mixed-type operation
+    if (op == OP_Mult && val1_type == TYPE_vector3f)
+    {
+        *(CVector3f*)result_addr = q0.Rotate(*(CVector3f*)val1);
+        result_type = TYPE_vector3f;
+        return (true);
+    }
+
+    CQuaternion q1;
+    if (!TypeConvertValue<TYPE_quat>(script_context, val1_type, val1, q1))
+        return (false);
+
+    int32* int_result = (int32*)result_addr;
+
+    // -- perform the operation
+    switch (op)
+    {
+        case OP_Mult:
+            result_type = TYPE_quat;
+            *(CQuaternion*)result_addr = q0 * q1;
+            return (true);
+
+        // -- comparison operations (push a -1, 0, 1) for less than, equal, greater than
+        case OP_CompareEqual:
+            result_type = TYPE_int;
+            *int_result = (q0 == q1) ? 0 : 1;
+            return (true);
+
+        case OP_CompareNotEqual:
+            result_type = TYPE_int;
+            *int_result = (q0 != q1) ? 0 : 1;
+            return (true);
+    }
+
+    // -- fail
+    return (false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- Type conversion functions
+void* QuatToBoolConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
+{
+    // -- sanity check
+    if (!from_val || !to_buffer)
+        return (NULL);
+
+    // -- a quat is true unless it is the identity (no rotation)
+    if (from_type == TYPE_quat)
+    {
+		CQuaternion* q = (CQuaternion*)from_val;
+		*(bool*)to_buffer = (*q == CQuaternion::identity) ? 0 : 1;
+		return (to_buffer);
+	}
+
+    // -- no registered conversion
+    return (NULL);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- resolve the storage for a quat POD variable (the ref addr already includes any array and/or stack offsets)
+static CQuaternion* GetQuatAddr(CVariableEntry* ve_src)
+{
+    if (ve_src == nullptr || ve_src->GetType() != TYPE_quat)
+        return (nullptr);
+
+    if (ve_src->GetRefAddr() != nullptr)
+        return ((CQuaternion*)ve_src->GetRefAddr());
+
+    return ((CQuaternion*)ve_src->GetAddr(nullptr));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- this POD modifies the variable - notify the debugger
+static void NotifyQuatWrite(CVariableEntry* ve_src)
+{
+    int32 stack_var_offset = 0;
+    CExecStack* execstack = nullptr;
+    CFunctionCallStack* funccallstack = CFunctionCallStack::GetExecutionStackAtDepth(0, execstack, stack_var_offset);
+    ve_src->NotifyWrite(TinScript::GetContext(), execstack, funccallstack);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+bool TypeQuat_Contains(CVariableEntry* ve, CQuaternion q_val)
+{
+    int32 count = ve != nullptr ? ve->GetArraySize() : 0;
+    for (int i = 0; i < count; ++i)
+    {
+        void* array_val = ve->GetArrayVarAddr(nullptr, i);
+        if (array_val != nullptr && *(CQuaternion*)array_val == q_val)
+            return true;
+    }
+
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CQuaternion TypeQuat_Set(CVariableEntry* ve_src, float _x, float _y, float _z, float _w)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (CQuaternion::identity);
+
+    value->Set(_x, _y, _z, _w);
+    NotifyQuatWrite(ve_src);
+    return *value;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CQuaternion TypeQuat_SetAxisAngle(CVariableEntry* ve_src, CVector3f axis, float degrees)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (CQuaternion::identity);
+
+    value->SetAxisAngle(axis, degrees);
+    NotifyQuatWrite(ve_src);
+    return *value;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CQuaternion TypeQuat_Conjugate(CVariableEntry* ve_src)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (CQuaternion::identity);
+
+    // -- returns the conjugate, without modifying the original
+    return (value->Conjugate());
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CQuaternion TypeQuat_Normalized(CVariableEntry* ve_src)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (CQuaternion::identity);
+
+    // -- returns the normalized quat, without modifying the original
+    return (CQuaternion::Normalized(*value));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+float TypeQuat_Normalize(CVariableEntry* ve_src)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (0.0f);
+
+    // -- modify the given var by normalizing, return the length
+    float length = value->Normalize();
+    NotifyQuatWrite(ve_src);
+    return length;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+float TypeQuat_Length(CVariableEntry* ve_src)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (0.0f);
+
+    return (value->Length());
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CVector3f TypeQuat_Rotate(CVariableEntry* ve_src, CVector3f v)
+{
+    CQuaternion* value = GetQuatAddr(ve_src);
+    if (value == nullptr)
+        return (v);
+
+    return (value->Rotate(v));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- Configure the registered quat type, by registering the POD table and op functions
+bool8 QuatConfig(eVarType var_type, bool8 onInit)
+{
+    // -- see if this is the initialization or the shutdown
+    if (onInit)
+    {
+        // -- create the quat member lookup table (size 4 for 4x members)
+        if (gQuatTable == nullptr)
+        {
+            gQuatTable = TinAlloc(ALLOC_HashTable, CHashTable<tPODTypeMember>, 4);
+			size_t unit_size = sizeof(CQuaternion) / 4;
+            tPODTypeMember* member_x = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, 0);
+            tPODTypeMember* member_y = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size);
+            tPODTypeMember* member_z = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size * 2);
+            tPODTypeMember* member_w = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size * 3);
+            gQuatTable->AddItem(*member_x, HashLiteral_("x"));
+            gQuatTable->AddItem(*member_y, HashLiteral_("y"));
+            gQuatTable->AddItem(*member_z, HashLiteral_("z"));
+            gQuatTable->AddItem(*member_w, HashLiteral_("w"));
+        }
+
+        // -- now register the hashtable
+        RegisterPODTypeTable(var_type, gQuatTable);
+
+        // -- register the operation overrides
+        RegisterTypeOpOverride(OP_Mult, TYPE_quat, QuatOpOverrides);
+        RegisterTypeOpOverride(OP_CompareEqual, TYPE_quat, QuatOpOverrides);
+        RegisterTypeOpOverride(OP_CompareNotEqual, TYPE_quat, QuatOpOverrides);
+
+        // -- boolean operations - let type bool handle them
+        RegisterTypeOpOverride(OP_BooleanAnd, TYPE_quat, BooleanBinaryOp);
+        RegisterTypeOpOverride(OP_BooleanOr, TYPE_quat, BooleanBinaryOp);
+
+        // -- register the conversion from quat to bool
+        RegisterTypeConvert(TYPE_bool, TYPE_quat, QuatToBoolConvert);
+
+        // -- register the type methods (creates the namespace "TYPE_quat")
+        if (TinScript::GetContext()->FindNamespace(HashLiteral_("TYPE_quat")) == nullptr)
+        {
+            REGISTER_TYPE_METHOD(TYPE_quat, set, TypeQuat_Set);
+            REGISTER_TYPE_METHOD(TYPE_quat, setAxisAngle, TypeQuat_SetAxisAngle);
+            REGISTER_TYPE_METHOD(TYPE_quat, conjugate, TypeQuat_Conjugate);
+            REGISTER_TYPE_METHOD(TYPE_quat, normalized, TypeQuat_Normalized);
+            REGISTER_TYPE_METHOD(TYPE_quat, normalize, TypeQuat_Normalize);
+            REGISTER_TYPE_METHOD(TYPE_quat, length, TypeQuat_Length);
+            REGISTER_TYPE_METHOD(TYPE_quat, rotate, TypeQuat_Rotate);
+
+            REGISTER_TYPE_METHOD(TYPE_quat, initialized, TypeVariable_IsSet);
+            REGISTER_TYPE_METHOD(TYPE_quat, count, TypeVariable_Count);
+            REGISTER_TYPE_METHOD(TYPE_quat, contains, TypeQuat_Contains);
+            REGISTER_TYPE_METHOD(TYPE_quat, copy, TypeVariableArray_Copy);
+            REGISTER_TYPE_METHOD(TYPE_quat, resize, TypeVariableArray_Resize);
+        }
+    }
+
+    // -- shutdown
+    else
+    {
+        // -- memory cleanup for the quat lookup table
+        if (gQuatTable != nullptr)
+        {
+            gQuatTable->DestroyAll();
+            TinFree(gQuatTable);
+            gQuatTable = nullptr;
+        }
+    }
+
+    // -- success
+    return (true);
+}
+
+} // TinScript
+
+// ------------------------------------------------------------------------------------------------
+// eof
+// ------------------------------------------------------------------------------------------------
@@ -501,6 +501,157 @@ CVector3f TypeVector3f_Cross(CVariableEntry* ve_src, CVector3f v)
     return result;
 }
 
+// == vector3f array batch methods ====================================================================================
+// -- array elements are stored contiguously, so the whole array is handed to a batch kernel (see mathutil.h),
+// rather than interpreting a loop over each element
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- returns the address of the first element of a vector3f array, and its count
+static CVector3f* GetVector3fArray(CVariableEntry* ve, const char* method_name, int32& count)
+{
+    count = 0;
+    if (ve == nullptr || ve->GetType() != TYPE_vector3f || !ve->IsArray())
+    {
+        TinPrint(TinScript::GetContext(), "Error - vector3f[]:%s() var: %s, is not a vector3f array\n", method_name,
+                                          (ve ? UnHash(ve->GetHash()) : "<unknown>"));
+        return (nullptr);
+    }
+
+    count = ve->GetArraySize();
+    if (count < 1)
+    {
+        TinPrint(TinScript::GetContext(), "Error - vector3f[]:%s() var: %s, array has not been initialized\n",
+                                          method_name, UnHash(ve->GetHash()));
+        count = 0;
+        return (nullptr);
+    }
+
+    return ((CVector3f*)ve->GetArrayVarAddr(nullptr, 0));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- returns the address of the first element of a float array, that must hold at least count elements
+static float32* GetFloatArrayResult(CVariableEntry* ve, const char* method_name, int32 count)
+{
+    if (ve == nullptr || ve->GetType() != TYPE_float || !ve->IsArray() || ve->GetArraySize() < count)
+    {
+        TinPrint(TinScript::GetContext(), "Error - vector3f[]:%s() var: %s, result must be a float[] of size %d\n",
+                                          method_name, (ve ? UnHash(ve->GetHash()) : "<unknown>"), count);
+        return (nullptr);
+    }
+
+    return ((float32*)ve->GetArrayVarAddr(nullptr, 0));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+static void NotifyVector3fArrayWrite(CVariableEntry* ve)
+{
+    int32 stack_var_offset = 0;
+    CExecStack* execstack = nullptr;
+    CFunctionCallStack* funccallstack = CFunctionCallStack::GetExecutionStackAtDepth(0, execstack, stack_var_offset);
+    ve->NotifyWrite(TinScript::GetContext(), execstack, funccallstack);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- fills the float array with the length of each element, returns the number of elements written
+int32 TypeVector3fArray_Lengths(CVariableEntry* ve_src, CVariableEntry* ve_lengths)
+{
+    int32 count = 0;
+    CVector3f* src = GetVector3fArray(ve_src, "lengths", count);
+    float32* lengths = src != nullptr ? GetFloatArrayResult(ve_lengths, "lengths", count) : nullptr;
+    if (lengths == nullptr)
+        return (0);
+
+    V3fBatchLengths(src, count, lengths);
+    NotifyVector3fArrayWrite(ve_lengths);
+    return (count);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- fills the float array with the dot product of each element and v, returns the number of elements written
+int32 TypeVector3fArray_Dots(CVariableEntry* ve_src, CVector3f v, CVariableEntry* ve_dots)
+{
+    int32 count = 0;
+    CVector3f* src = GetVector3fArray(ve_src, "dots", count);
+    float32* dots = src != nullptr ? GetFloatArrayResult(ve_dots, "dots", count) : nullptr;
+    if (dots == nullptr)
+        return (0);
+
+    V3fBatchDot(src, count, v, dots);
+    NotifyVector3fArrayWrite(ve_dots);
+    return (count);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- returns the index of the element closest to p, or -1
+int32 TypeVector3fArray_NearestTo(CVariableEntry* ve_src, CVector3f p)
+{
+    int32 count = 0;
+    CVector3f* src = GetVector3fArray(ve_src, "nearest_to", count);
+    if (src == nullptr)
+        return (-1);
+
+    return (V3fBatchNearest(src, count, p));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- array[i] += other[i] * s, for the number of elements in the smaller of the two arrays
+bool TypeVector3fArray_AddScaled(CVariableEntry* ve_src, CVariableEntry* ve_other, float s)
+{
+    int32 count = 0;
+    int32 other_count = 0;
+    CVector3f* dst = GetVector3fArray(ve_src, "add_scaled", count);
+    CVector3f* other = dst != nullptr ? GetVector3fArray(ve_other, "add_scaled", other_count) : nullptr;
+    if (other == nullptr)
+        return (false);
+
+    V3fBatchAddScaled(dst, other, count < other_count ? count : other_count, s);
+    NotifyVector3fArrayWrite(ve_src);
+    return (true);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- normalizes each element in place, returns the number of elements
+int32 TypeVector3fArray_NormalizeAll(CVariableEntry* ve_src)
+{
+    int32 count = 0;
+    CVector3f* dst = GetVector3fArray(ve_src, "normalize_all", count);
+    if (dst == nullptr)
+        return (0);
+
+    V3fBatchNormalize(dst, count);
+    NotifyVector3fArrayWrite(ve_src);
+    return (count);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- returns the minimum corner of the array's bounding box
+CVector3f TypeVector3fArray_BoundsMin(CVariableEntry* ve_src)
+{
+    int32 count = 0;
+    CVector3f* src = GetVector3fArray(ve_src, "bounds_min", count);
+    CVector3f bounds_min;
+    CVector3f bounds_max;
+    if (src == nullptr || !V3fBatchBounds(src, count, bounds_min, bounds_max))
+        return (CVector3f::zero);
+
+    return (bounds_min);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- returns the maximum corner of the array's bounding box
+CVector3f TypeVector3fArray_BoundsMax(CVariableEntry* ve_src)
+{
+    int32 count = 0;
+    CVector3f* src = GetVector3fArray(ve_src, "bounds_max", count);
+    CVector3f bounds_min;
+    CVector3f bounds_max;
+    if (src == nullptr || !V3fBatchBounds(src, count, bounds_min, bounds_max))
+        return (CVector3f::zero);
+
+    return (bounds_max);
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // -- Configure the registered Vector3f type, by registering the POD table and op functions
 bool8 Vector3fConfig(eVarType var_type, bool8 onInit)
@@ -513,12 +664,12 @@ bool8 Vector3fConfig(eVarType var_type, bool8 onInit)
         {
             gVector3fTable = TinAlloc(ALLOC_HashTable, CHashTable<tPODTypeMember>, 3);
 			size_t unit_size = sizeof(Vector3fClass) / 3;
-            tPODTypeMember* member_x = new tPODTypeMember(TYPE_float, 0);
-            tPODTypeMember* member_y = new tPODTypeMember(TYPE_float, unit_size);
-            tPODTypeMember* member_z = new tPODTypeMember(TYPE_float, unit_size * 2);
-            gVector3fTable->AddItem(*member_x, Hash("x"));
-            gVector3fTable->AddItem(*member_y, Hash("y"));
-            gVector3fTable->AddItem(*member_z, Hash("z"));
+            tPODTypeMember* member_x = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, 0);
+            tPODTypeMember* member_y = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size);
+            tPODTypeMember* member_z = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size * 2);
+            gVector3fTable->AddItem(*member_x, HashLiteral_("x"));
+            gVector3fTable->AddItem(*member_y, HashLiteral_("y"));
+            gVector3fTable->AddItem(*member_z, HashLiteral_("z"));
         }
 
         // -- now register the hashtable
@@ -550,7 +701,7 @@ bool8 Vector3fConfig(eVarType var_type, bool8 onInit)
 
         // -- in addition to POD type member initialization, we want to have types have non-hierarchical methods
         // e.g.  float:isNan(), or vector3f:normalize(), etc...
-        if (TinScript::GetContext()->FindNamespace(Hash("TYPE_vector3f")) == nullptr)
+        if (TinScript::GetContext()->FindNamespace(HashLiteral_("TYPE_vector3f")) == nullptr)
         {
             // -- register methods for this type
             // note:  this will actually create a Namespace named "Type_vector3f"
@@ -563,6 +714,15 @@ bool8 Vector3fConfig(eVarType var_type, bool8 onInit)
             REGISTER_TYPE_METHOD(TYPE_vector3f, dot, TypeVector3f_Dot);
             REGISTER_TYPE_METHOD(TYPE_vector3f, cross, TypeVector3f_Cross);
 
+            // -- batch methods, for vector3f arrays
+            REGISTER_TYPE_METHOD(TYPE_vector3f, lengths, TypeVector3fArray_Lengths);
+            REGISTER_TYPE_METHOD(TYPE_vector3f, dots, TypeVector3fArray_Dots);
+            REGISTER_TYPE_METHOD(TYPE_vector3f, nearest_to, TypeVector3fArray_NearestTo);
+            REGISTER_TYPE_METHOD(TYPE_vector3f, add_scaled, TypeVector3fArray_AddScaled);
+            REGISTER_TYPE_METHOD(TYPE_vector3f, normalize_all, TypeVector3fArray_NormalizeAll);
+            REGISTER_TYPE_METHOD(TYPE_vector3f, bounds_min, TypeVector3fArray_BoundsMin);
+            REGISTER_TYPE_METHOD(TYPE_vector3f, bounds_max, TypeVector3fArray_BoundsMax);
+
             REGISTER_TYPE_METHOD(TYPE_vector3f, initialized, TypeVariable_IsSet);
             REGISTER_TYPE_METHOD(TYPE_vector3f, count, TypeVariable_Count);
             REGISTER_TYPE_METHOD(TYPE_vector3f, contains, TypeVector3f_Contains);
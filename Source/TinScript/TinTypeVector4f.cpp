@@ -0,0 +1,408 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------------------------
+// TinTypeVector4f.cpp : The registered type vector4f required methods
+// ------------------------------------------------------------------------------------------------
+
+// -- lib includes
+#include "stdio.h"
+#include "string.h"
+#include "stdlib.h"
+
+#include "mathutil.h"
+
+#include "integration.h"
+#include "TinHash.h"
+#include "TinCompile.h"
+#include "TinTypes.h"
+#include "TinScript.h"
+#include "TinStringTable.h"
+#include "TinOpExecFunctions.h"
+#include "TinRegBinding.h"
+
+namespace TinScript {
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- vector4f POD table
+tPODTypeTable* gVector4fTable = nullptr;
+
+// --------------------------------------------------------------------------------------------------------------------
+// External type - CVector4f is a POD type
+bool8 Vector4fToString(TinScript::CScriptContext* script_context, void* value, char* buf, int32 bufsize)
+{
+	if (value && buf && bufsize > 0)
+    {
+        CVector4f* v4 = (CVector4f*)value;
+        snprintf(buf, bufsize, "%.4f %.4f %.4f %.4f", v4->x, v4->y, v4->z, v4->w);
+		return (true);
+	}
+	return (false);
+}
+
+bool8 StringToVector4f(TinScript::CScriptContext* script_context, void* addr, char* value)
+{
+	if (addr && value)
+    {
+        CVector4f* varaddr = (CVector4f*)addr;
+
+		float x = 0.0f;
+		float y = 0.0f;
+		float z = 0.0f;
+		float w = 0.0f;
+
+		// -- if the string is non-empty, ensure we can read in either space or comma delineated format
+		bool success = true;
+        if (value[0])
+        {
+			success = sscanf_s(value, "%f %f %f %f", &x, &y, &z, &w) == 4;
+			success = success || (sscanf_s(value, "%f, %f, %f, %f", &x, &y, &z, &w) == 4);
+		}
+
+		if (success)
+		{
+			*varaddr = CVector4f(x, y, z, w);
+			return (true);
+        }
+	}
+	return (false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- Vector4f supports the same operations as vector3f
+bool8 Vector4fOpOverrides(CScriptContext* script_context, eOpCode op, eVarType& result_type, void* result_addr,
+                          eVarType val0_type, void* val0, eVarType val1_type, void* val1)
+{
+    // -- sanity check
+    if (!script_context || !result_addr || !val0 || !val1)
+        return (false);
+
+    // -- ensure the types are converted to vector4f (a vector3f converts with w = 0.0f)
+    CVector4f v0;
+    CVector4f v1;
+    if (!TypeConvertValue<TYPE_vector4f>(script_context, val0_type, val0, v0) ||
+        !TypeConvertValue<TYPE_vector4f>(script_context, val1_type, val1, v1))
+    {
+        return (false);
+    }
+
+    CVector4f* result = (CVector4f*)result_addr;
+    result_type = TYPE_vector4f;
+    int32* int_result = (int32*)result_addr;
+
+    // -- perform the operation
+    switch (op)
+    {
+        case OP_Add:
+            *result = v0 + v1;
+            return (true);
+
+        case OP_Sub:
+            *result = v0 - v1;
+            return (true);
+
+        // -- comparison operations (push a -1, 0, 1) for less than, equal, greater than
+        case OP_CompareEqual:
+            result_type = TYPE_int;
+            *int_result = (v0 == v1) ? 0 : 1;
+            return (true);
+
+        case OP_CompareNotEqual:
+            result_type = TYPE_int;
+            *int_result = (v0 != v1) ? 0 : 1;
+            return (true);
+    }
+
+    // -- fail
+    return (false);
+}
+
+bool8 Vector4fScale(CScriptContext* script_context, eOpCode op, eVarType& result_type, void* result_addr,
+                    eVarType val0_type, void* val0, eVarType val1_type, void* val1)
+{
+    // -- one of the types must be a vector4f, the other must be able to be converted to a float
+    // -- sanity check
+    if (!script_context || !result_addr || !val0 || !val1)
+        return (false);
+
+    // -- division is a scalar, but the order is relevent
+    CVector4f v;
+    float32 scalar = 0.0f;
+    bool8 valid = val0_type == TYPE_vector4f && TypeConvertValue<TYPE_float>(script_context, val1_type, val1, scalar);
+    if (valid)
+        v = *(CVector4f*)val0;
+    else if (op != OP_Div && val1_type == TYPE_vector4f &&
+             TypeConvertValue<TYPE_float>(script_context, val0_type, val0, scalar))
+    {
+        v = *(CVector4f*)val1;
+        valid = true;
+    }
+
+    // -- ensure we found valid types
+    if (!valid)
+        return (false);
+
+    // -- set up the result
+    CVector4f* result = (CVector4f*)result_addr;
+    result_type = TYPE_vector4f;
+
+    // -- perform the operation
+    switch (op)
+    {
+        case OP_Mult:
+            *result = v * scalar;
+            return (true);
+
+        case OP_Div:
+            *result = v / scalar;
+            return (true);
+    }
+
+    // -- fail
+    return (false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- Type conversion functions
+void* Vector4fToBoolConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
+{
+    // -- sanity check
+    if (!from_val || !to_buffer)
+        return (NULL);
+
+    // -- a non-zero vector4f is true, false otherwise
+    if (from_type == TYPE_vector4f)
+    {
+		CVector4f* v4 = (CVector4f*)from_val;
+		*(bool*)to_buffer = (*v4 == CVector4f::zero) ? 0 : 1;
+		return (to_buffer);
+	}
+
+    // -- no registered conversion
+    return (NULL);
+}
+
+void* Vector3fToVector4fConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
+{
+    // -- sanity check
+    if (!from_val || !to_buffer)
+        return (NULL);
+
+    // -- the conversion is lossless (w = 0.0f) - the reverse would drop w, so it is not registered
+    if (from_type == TYPE_vector3f)
+    {
+        *(CVector4f*)to_buffer = CVector4f(*(CVector3f*)from_val, 0.0f);
+		return (to_buffer);
+	}
+
+    // -- no registered conversion
+    return (NULL);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- resolve the storage for a vector4f POD variable (the ref addr already includes any array and/or stack offsets)
+static CVector4f* GetVector4fAddr(CVariableEntry* ve_src)
+{
+    if (ve_src == nullptr || ve_src->GetType() != TYPE_vector4f)
+        return (nullptr);
+
+    if (ve_src->GetRefAddr() != nullptr)
+        return ((CVector4f*)ve_src->GetRefAddr());
+
+    return ((CVector4f*)ve_src->GetAddr(nullptr));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+bool TypeVector4f_Contains(CVariableEntry* ve, CVector4f v4f_val)
+{
+    int32 count = ve != nullptr ? ve->GetArraySize() : 0;
+    for (int i = 0; i < count; ++i)
+    {
+        void* array_val = ve->GetArrayVarAddr(nullptr, i);
+        if (array_val != nullptr && *(CVector4f*)array_val == v4f_val)
+            return true;
+    }
+
+    return false;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CVector4f TypeVector4f_Set(CVariableEntry* ve_src, float _x, float _y, float _z, float _w)
+{
+    CVector4f* value = GetVector4fAddr(ve_src);
+    if (value == nullptr)
+        return (CVector4f::zero);
+
+    // -- modify the given variable, initializing to the new value
+    value->Set(_x, _y, _z, _w);
+
+    // -- this POD modifies the variable - notify the debugger
+    int32 stack_var_offset = 0;
+    CExecStack* execstack = nullptr;
+    CFunctionCallStack* funccallstack = CFunctionCallStack::GetExecutionStackAtDepth(0, execstack, stack_var_offset);
+    ve_src->NotifyWrite(TinScript::GetContext(), execstack, funccallstack);
+
+    return *value;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CVector4f TypeVector4f_Normalized(CVariableEntry* ve_src)
+{
+    CVector4f* value = GetVector4fAddr(ve_src);
+    if (value == nullptr)
+        return (CVector4f::zero);
+
+    // -- returns the normalized vector, without modifying the original
+    return (CVector4f::Normalized(*value));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+float TypeVector4f_Normalize(CVariableEntry* ve_src)
+{
+    CVector4f* value = GetVector4fAddr(ve_src);
+    if (value == nullptr)
+        return (0.0f);
+
+    // -- modify the given var by normalizing, return the length
+    float length = value->Normalize();
+
+    // -- this POD modifies the variable - notify the debugger
+    int32 stack_var_offset = 0;
+    CExecStack* execstack = nullptr;
+    CFunctionCallStack* funccallstack = CFunctionCallStack::GetExecutionStackAtDepth(0, execstack, stack_var_offset);
+    ve_src->NotifyWrite(TinScript::GetContext(), execstack, funccallstack);
+
+    return length;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+float TypeVector4f_Length(CVariableEntry* ve_src)
+{
+    CVector4f* value = GetVector4fAddr(ve_src);
+    if (value == nullptr)
+        return (0.0f);
+
+    return (value->Length());
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+float TypeVector4f_Dot(CVariableEntry* ve_src, CVector4f v)
+{
+    CVector4f* value = GetVector4fAddr(ve_src);
+    if (value == nullptr)
+        return (0.0f);
+
+    return (CVector4f::Dot(*value, v));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+CVector3f TypeVector4f_XYZ(CVariableEntry* ve_src)
+{
+    CVector4f* value = GetVector4fAddr(ve_src);
+    if (value == nullptr)
+        return (CVector3f::zero);
+
+    return (CVector3f(value->x, value->y, value->z));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- Configure the registered Vector4f type, by registering the POD table and op functions
+bool8 Vector4fConfig(eVarType var_type, bool8 onInit)
+{
+    // -- see if this is the initialization or the shutdown
+    if (onInit)
+    {
+        // -- create the vector4f member lookup table (size 4 for 4x members)
+        if (gVector4fTable == nullptr)
+        {
+            gVector4fTable = TinAlloc(ALLOC_HashTable, CHashTable<tPODTypeMember>, 4);
+			size_t unit_size = sizeof(CVector4f) / 4;
+            tPODTypeMember* member_x = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, 0);
+            tPODTypeMember* member_y = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size);
+            tPODTypeMember* member_z = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size * 2);
+            tPODTypeMember* member_w = TinAlloc(ALLOC_HashTable, tPODTypeMember, TYPE_float, unit_size * 3);
+            gVector4fTable->AddItem(*member_x, HashLiteral_("x"));
+            gVector4fTable->AddItem(*member_y, HashLiteral_("y"));
+            gVector4fTable->AddItem(*member_z, HashLiteral_("z"));
+            gVector4fTable->AddItem(*member_w, HashLiteral_("w"));
+        }
+
+        // -- now register the hashtable
+        RegisterPODTypeTable(var_type, gVector4fTable);
+
+        // -- register the operation overrides
+        RegisterTypeOpOverride(OP_Add, TYPE_vector4f, Vector4fOpOverrides);
+        RegisterTypeOpOverride(OP_Sub, TYPE_vector4f, Vector4fOpOverrides);
+
+        RegisterTypeOpOverride(OP_CompareEqual, TYPE_vector4f, Vector4fOpOverrides);
+        RegisterTypeOpOverride(OP_CompareNotEqual, TYPE_vector4f, Vector4fOpOverrides);
+
+        // -- boolean operations - let type bool handle them
+        RegisterTypeOpOverride(OP_BooleanAnd, TYPE_vector4f, BooleanBinaryOp);
+        RegisterTypeOpOverride(OP_BooleanOr, TYPE_vector4f, BooleanBinaryOp);
+
+        // -- scalar operations use both a vector4f and a float
+        RegisterTypeOpOverride(OP_Mult, TYPE_vector4f, Vector4fScale);
+        RegisterTypeOpOverride(OP_Div, TYPE_vector4f, Vector4fScale);
+
+        // -- register the conversions to bool, and from vector3f
+        RegisterTypeConvert(TYPE_bool, TYPE_vector4f, Vector4fToBoolConvert);
+        RegisterTypeConvert(TYPE_vector4f, TYPE_vector3f, Vector3fToVector4fConvert);
+
+        // -- register the type methods (creates the namespace "TYPE_vector4f")
+        if (TinScript::GetContext()->FindNamespace(HashLiteral_("TYPE_vector4f")) == nullptr)
+        {
+            REGISTER_TYPE_METHOD(TYPE_vector4f, set, TypeVector4f_Set);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, normalized, TypeVector4f_Normalized);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, normalize, TypeVector4f_Normalize);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, length, TypeVector4f_Length);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, dot, TypeVector4f_Dot);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, xyz, TypeVector4f_XYZ);
+
+            REGISTER_TYPE_METHOD(TYPE_vector4f, initialized, TypeVariable_IsSet);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, count, TypeVariable_Count);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, contains, TypeVector4f_Contains);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, copy, TypeVariableArray_Copy);
+            REGISTER_TYPE_METHOD(TYPE_vector4f, resize, TypeVariableArray_Resize);
+        }
+    }
+
+    // -- shutdown
+    else
+    {
+        // -- memory cleanup for the vector4f lookup table
+        if (gVector4fTable != nullptr)
+        {
+            gVector4fTable->DestroyAll();
+            TinFree(gVector4fTable);
+            gVector4fTable = nullptr;
+        }
+    }
+
+    // -- success
+    return (true);
+}
+
+} // TinScript
+
+// ------------------------------------------------------------------------------------------------
+// eof
+// ------------------------------------------------------------------------------------------------
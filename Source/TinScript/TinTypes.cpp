@@ -30,6 +30,7 @@
 #include "stdio.h"
 #include "string.h"
 #include "stdlib.h"
+#include <algorithm>
 
 #include "mathutil.h"
 
@@ -350,6 +351,9 @@ TypeOpOverride GetTypeOpOverride(eOpCode op, eVarType var0_type)
     return (gRegisteredTypeOpTable[op][var0_type]);
 }
 
+// -- forward declarations
+void RegisterDefaultTypeConverts();
+
 // ====================================================================================================================
 // InitializeTypes():  Perform any initialization for registered types.
 // ====================================================================================================================
@@ -373,6 +377,9 @@ void InitializeTypes()
         }
     }
 
+    // -- populate the default (string and numeric) conversions
+    RegisterDefaultTypeConverts();
+
     // -- call the config function for each type (if one is given), with a "true" init flag
 	for (eVarType i = TYPE_void; i < TYPE_COUNT; i = eVarType(i + 1))
     {
@@ -433,18 +440,16 @@ void* TypeConvert(CScriptContext* script_context, eVarType fromtype, void* froma
     if (! fromaddr)
         return (NULL);
 
-    // -- each script context maintains an array of scratch buffers...
-    // -- this allows us to have a place to do conversions, without memory management
-    char* bufferptr = script_context->GetScratchBuffer();
-    
     // -- if the type remains the same, no conversion is necessary, except in the case of objects
     // from code, an object could be the physical address - we want to ensure what we pass to script
     // is the object *ID*!
-    if (fromtype == totype || !fromaddr)
+    if (fromtype == totype)
     {
         // -- note:  if we're passing a type object, and the address is an actual
         // object address - we need to convert it to the ID
-        if (fromaddr && fromtype == TYPE_object)
+        // -- an ID is only 32 bits, so on 64-bit the pointer read also takes the next stack word - a valid ID is
+        // returned as is, rather than risk it (and the stale word) resembling the address of another object
+        if (fromtype == TYPE_object && script_context->FindObjectEntry(*(uint32*)fromaddr) == nullptr)
         {
             void** obj_addr_ptr = (void**)fromaddr;
             void* actual_obj_addr = *obj_addr_ptr;
@@ -462,76 +467,50 @@ void* TypeConvert(CScriptContext* script_context, eVarType fromtype, void* froma
         return fromaddr;
     }
 
-    // -- if the types we're converting between are variable or hashtable, they're interchangeable by definition
-    //if ((totype == TYPE__var || totype == TYPE_hashtable) && (fromtype == TYPE__var || fromtype == TYPE_hashtable))
-    //    return fromaddr;
-
-    // -- if the "to type" is a string, use the registered string conversion function
-    if (totype == TYPE_string)
-    {
-        bool8 success = gRegisteredTypeToString[fromtype](script_context, fromaddr, bufferptr, kMaxTokenLength);
-        if (!success)
-        {
-            ScriptAssert_(TinScript::GetContext(), false, "<internal>", -1,
-                          "Error - failed to convert to string from type %s\n", GetRegisteredTypeName(fromtype));
-            return ((void*)"");
-        }
+    // -- the conversion table is fully populated at initialization (including to and from strings),
+    // -- so any pair without an entry has no conversion
+    TypeConvertFunction convert_function = gRegisteredTypeConvertTable[totype][fromtype];
+    if (convert_function == NULL)
+        return (NULL);
 
-        // -- Type_string actually stores an STE value, so we must convert the char* bufferptr to an STE
-        char* stebuf = script_context->GetScratchBuffer();
-        success = gRegisteredStringToType[TYPE_string](script_context, (void*)stebuf, (char*)bufferptr);
-        if (!success)
-        {
-            ScriptAssert_(TinScript::GetContext(), false, "<internal>", -1,
-                          "Error - Bad StringTableEntry value\n");
-            return ((void*)"");
-        }
+    // -- each script context maintains an array of scratch buffers...
+    // -- this allows us to have a place to do conversions, without memory management
+    char* bufferptr = script_context->GetScratchBuffer();
+    return (convert_function(script_context, fromtype, fromaddr, bufferptr));
+}
 
-        // -- return the converted value
-        return ((void*)stebuf);
-    }
+// ====================================================================================================================
+// TypeConvertValue():  Convert between types, writing the result of the requested type into to_buffer
+// ====================================================================================================================
+bool8 TypeConvertValue(CScriptContext* script_context, eVarType fromtype, void* fromaddr, eVarType totype,
+                       void* to_buffer)
+{
+    // -- sanity check
+    if (!fromaddr || !to_buffer)
+        return (false);
 
-    // -- else if we're converting from a string...
-    else if (fromtype == TYPE_string)
+    // -- same type conversions (including resolving object addresses to IDs) are handled by TypeConvert()
+    void* result = NULL;
+    if (fromtype == totype)
     {
-        // -- note:  string variables are actually STE's, and need to be converted to char*
-        // -- before converting to another type
-        char* stringbuf = script_context->GetScratchBuffer();
-        bool8 success = gRegisteredTypeToString[TYPE_string](script_context, fromaddr, stringbuf, kMaxTokenLength);
-        if (!success)
-        {
-            ScriptAssert_(TinScript::GetContext(), false, "<internal>", -1,
-                          "Error - Bad StringTableEntry value\n");
-            return ((void*)"");
-        }
-
-        // -- now convert from the actual char* to the requested type
-        success = gRegisteredStringToType[totype](script_context, (void*)bufferptr, (char*)stringbuf);
-        if (!success)
-        {
-            ScriptAssert_(TinScript::GetContext(), false, "<internal>", -1,
-                "Error - failed to convert string to type %s\n", GetRegisteredTypeName(totype));
-            return ((void*)"");
-        }
-
-        // -- return the converted value
-        return (bufferptr);
+        result = TypeConvert(script_context, fromtype, fromaddr, totype);
     }
-
-    // -- see if we have a registered conversion function
-    else if (gRegisteredTypeConvertTable[totype][fromtype])
+    else
     {
-        // -- note:  bufferptr is a static buffer within this function, and is obviously
-        // -- larger than the memsize of any of the registered types
-        void* result = gRegisteredTypeConvertTable[totype][fromtype](script_context, fromtype, fromaddr, bufferptr);
-        if (result)
-        {
-            return (result);
-        }
+        TypeConvertFunction convert_function = gRegisteredTypeConvertTable[totype][fromtype];
+        if (convert_function == NULL)
+            return (false);
+        result = convert_function(script_context, fromtype, fromaddr, to_buffer);
     }
 
-    // -- no conversion found
-    return (NULL);
+    if (result == NULL)
+        return (false);
+
+    // -- some conversions return the source address (e.g. a validated object ID) rather than filling the buffer
+    if (result != to_buffer)
+        memcpy(to_buffer, result, gRegisteredTypeSize[totype]);
+
+    return (true);
 }
 
 // ====================================================================================================================
@@ -705,32 +684,121 @@ int32 Atoi(const char* src, int32 length)
 
 // == Type Conversion functions =======================================================================================
 
+// -- the numeric types convert directly between each other - every pair is generated from this tuple
+#define NumericTypeTuple        \
+    NumericTypeEntry(float)     \
+    NumericTypeEntry(int)       \
+    NumericTypeEntry(bool)      \
+
+template <typename TO, typename FROM>
+struct tNumericConvert
+{
+    static TO Convert(FROM value) { return ((TO)value); }
+};
+
+template <typename FROM>
+struct tNumericConvert<bool8, FROM>
+{
+    static bool8 Convert(FROM value) { return (value != 0); }
+};
+
 // ====================================================================================================================
-// FloatConvert():  Convert the given value to a float, for valid source types.
+// NumericConvert():  Convert directly between two numeric types.
 // ====================================================================================================================
-void* FloatConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
+template <eVarType TO, eVarType FROM>
+void* NumericConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
 {
+    typedef typename tVarTypeTraits<TO>::tValueType tTo;
+    typedef typename tVarTypeTraits<FROM>::tValueType tFrom;
+
     // -- sanity check
     if (!from_val || !to_buffer)
         return (NULL);
 
-    switch (from_type)
+    *(tTo*)(to_buffer) = tNumericConvert<tTo, tFrom>::Convert(*(tFrom*)(from_val));
+    return (to_buffer);
+}
+
+// ====================================================================================================================
+// TypeToStringConvert():  Convert any type to a string, using the registered TypeToString function.
+// ====================================================================================================================
+void* TypeToStringConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
+{
+    // -- sanity check
+    if (!from_val || !to_buffer)
+        return (NULL);
+
+    char* stringbuf = script_context->GetScratchBuffer();
+    if (!gRegisteredTypeToString[from_type](script_context, from_val, stringbuf, kMaxTokenLength))
     {
-        case TYPE_int:
-            *(float32*)(to_buffer) = (float32)*(int32*)(from_val);
-             return (void*)(to_buffer);
+        ScriptAssert_(script_context, false, "<internal>", -1,
+                      "Error - failed to convert to string from type %s\n", GetRegisteredTypeName(from_type));
+        *(uint32*)(to_buffer) = 0;
+        return (to_buffer);
+    }
 
-        case TYPE_bool:
-            *(float32*)(to_buffer) = *(bool8*)from_val ? 1.0f : 0.0f;
-            return (void*)(to_buffer);
+    // -- Type_string actually stores an STE value, so we must convert the formatted string to an STE
+    gRegisteredStringToType[TYPE_string](script_context, to_buffer, stringbuf);
+    return (to_buffer);
+}
+
+// ====================================================================================================================
+// StringToTypeConvert():  Convert a string directly from the string table, using the registered StringToType.
+// ====================================================================================================================
+template <eVarType TO>
+void* StringToTypeConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
+{
+    // -- sanity check
+    if (!from_val || !to_buffer)
+        return (NULL);
+
+    // -- the string parsers don't modify the string, so we can parse the string table entry in place
+    const char* string = script_context->GetStringTable()->FindString(*(uint32*)from_val);
+    if (string == NULL)
+        string = "";
+
+    if (!gRegisteredStringToType[TO](script_context, to_buffer, (char*)string))
+    {
+        ScriptAssert_(script_context, false, "<internal>", -1,
+                      "Error - failed to convert string to type %s\n", GetRegisteredTypeName(TO));
+        memset(to_buffer, 0, gRegisteredTypeSize[TO]);
     }
 
-    // -- no registered conversion
-    return (NULL);
+    return (to_buffer);
+}
+
+// ====================================================================================================================
+// RegisterDefaultTypeConverts():  Populate the conversion table with the string and numeric conversions.
+// -- called before the type config functions, which may register (or override) type specific conversions
+// ====================================================================================================================
+template <eVarType TO>
+void RegisterNumericConvertRow()
+{
+    #define NumericTypeEntry(a) if (TO != TYPE_##a) RegisterTypeConvert(TO, TYPE_##a, NumericConvert<TO, TYPE_##a>);
+    NumericTypeTuple
+    #undef NumericTypeEntry
+}
+
+void RegisterDefaultTypeConverts()
+{
+    // -- every type converts to and from a string
+    #define VarTypeEntry(a, b, c, d, e, f)                                                  \
+        if (TYPE_##a != TYPE_string)                                                        \
+        {                                                                                   \
+            RegisterTypeConvert(TYPE_string, TYPE_##a, TypeToStringConvert);                \
+            RegisterTypeConvert(TYPE_##a, TYPE_string, StringToTypeConvert<TYPE_##a>);      \
+        }
+    VarTypeTuple
+    #undef VarTypeEntry
+
+    // -- the numeric types convert directly between each other
+    #define NumericTypeEntry(a) RegisterNumericConvertRow<TYPE_##a>();
+    NumericTypeTuple
+    #undef NumericTypeEntry
 }
 
 // ====================================================================================================================
-// IntegerConvert():  Convert the given value to an integer, for valid source types.
+// IntegerConvert():  Convert the given value to an integer, for non-numeric source types.
 // ====================================================================================================================
 void* IntegerConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
 {
@@ -740,14 +808,6 @@ void* IntegerConvert(CScriptContext* script_context, eVarType from_type, void* f
 
     switch (from_type)
     {
-        case TYPE_bool:
-            *(int32*)(to_buffer) = *(bool8*)from_val ? 1 : 0;
-            return (void*)(to_buffer);
-
-        case TYPE_float:
-            *(int32*)(to_buffer) = (int32)*(float32*)(from_val);
-            return (void*)(to_buffer);
-
         // -- since objects are referred to by their IDs, we need to determine if the
         // from_val is the physical address of an object, or the ID
         case TYPE_object:
@@ -781,7 +841,7 @@ void* IntegerConvert(CScriptContext* script_context, eVarType from_type, void* f
 }
 
 // ====================================================================================================================
-// BoolConvert():  Convert the given value to a bool, for valid source types.
+// BoolConvert():  Convert the given value to a bool, for non-numeric source types.
 // ====================================================================================================================
 void* BoolConvert(CScriptContext* script_context, eVarType from_type, void* from_val, void* to_buffer)
 {
@@ -791,14 +851,6 @@ void* BoolConvert(CScriptContext* script_context, eVarType from_type, void* from
 
     switch (from_type)
     {
-        case TYPE_int:
-            *(bool8*)(to_buffer) = (*(int32*)(from_val) != 0);
-            return (void*)(to_buffer);
-
-        case TYPE_float:
-            *(bool8*)(to_buffer) = (*(float32*)(from_val) != 0.0f);
-            return (void*)(to_buffer);
-
         case TYPE_object:
         {
             CObjectEntry* oe = script_context->FindObjectEntry(*(uint32*)from_val);
@@ -860,13 +912,13 @@ bool8 ObjectBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resul
         return (false);
 
     // -- ensure the types are converted to Type_object
-    void* val0addr = TypeConvert(script_context, val0_type, val0, TYPE_object);
-    void* val1addr = TypeConvert(script_context, val1_type, val1, TYPE_object);
-    if (!val0addr || !val1addr)
+    uint32 v0 = 0;
+    uint32 v1 = 0;
+    if (!TypeConvertValue<TYPE_object>(script_context, val0_type, val0, v0) ||
+        !TypeConvertValue<TYPE_object>(script_context, val1_type, val1, v1))
+    {
         return (false);
-
-    uint32 v0 = *(uint32*)val0addr;
-    uint32 v1 = *(uint32*)val1addr;
+    }
     int32* result = (int32*)result_addr;
     result_type = TYPE_int;
 
@@ -905,8 +957,8 @@ bool8 StringBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resul
     {
         if (op == OP_CompareEqual || op == OP_CompareNotEqual)
         {
-            uint32 str_0_hash = *(uint32*)TypeConvert(script_context, val0_type, val0, TYPE_string);
-            uint32 str_1_hash = *(uint32*)TypeConvert(script_context, val1_type, val1, TYPE_string);
+            uint32 str_0_hash = *(uint32*)val0;
+            uint32 str_1_hash = *(uint32*)val1;
             int32* result = (int32*)result_addr;
             result_type = TYPE_int;
             *result = (str_0_hash == str_1_hash) ? 0 : 1;
@@ -915,26 +967,22 @@ bool8 StringBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resul
     }
 
     // -- if we cannot convert the string to a float non-zero value, convert it as an integer
-    bool val0_float = true;
-    void* val0addr = TypeConvert(script_context, val0_type, val0, TYPE_float);
-    if (!val0addr || *(float32*)(val0addr) == 0.0f)
-    {
-        val0addr = TypeConvert(script_context, val0_type, val0, TYPE_int);
-        val0_float = false;
-    }
-
-    bool val1_float = true;
-    void* val1addr = TypeConvert(script_context, val1_type, val1, TYPE_float);
-    if (!val1addr || *(float32*)(val1addr) == 0.0f)
-    {
-        val1addr = TypeConvert(script_context, val1_type, val1, TYPE_int);
-        val1_float = false;
-    }
+    // -- (converted by value into locals, as this is every string operand - not into the scratch buffers)
+    float32 val0_f = 0.0f;
+    int32 val0_i = 0;
+    bool8 val0_float = TypeConvertValue<TYPE_float>(script_context, val0_type, val0, val0_f) && val0_f != 0.0f;
+    if (!val0_float && !TypeConvertValue<TYPE_int>(script_context, val0_type, val0, val0_i))
+        return (false);
 
-    // -- ensure we at least got two numerical types
-    if (!val0addr || !val1addr)
+    float32 val1_f = 0.0f;
+    int32 val1_i = 0;
+    bool8 val1_float = TypeConvertValue<TYPE_float>(script_context, val1_type, val1, val1_f) && val1_f != 0.0f;
+    if (!val1_float && !TypeConvertValue<TYPE_int>(script_context, val1_type, val1, val1_i))
         return (false);
 
+    void* val0addr = val0_float ? (void*)&val0_f : (void*)&val0_i;
+    void* val1addr = val1_float ? (void*)&val1_f : (void*)&val1_i;
+
     // -- if either is a float, perform a float operation
     if (val0_float || val1_float)
     {
@@ -960,14 +1008,14 @@ bool8 FloatBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& result
     if (!script_context || !result_addr || !val0 || !val1)
         return (false);
 
-    // -- ensure the types are converted to vector3f
-    void* val0addr = TypeConvert(script_context, val0_type, val0, TYPE_float);
-    void* val1addr = TypeConvert(script_context, val1_type, val1, TYPE_float);
-    if (!val0addr || !val1addr)
+    // -- convert the values directly to TYPE_float, without consuming scratch buffers
+    float32 v0 = 0;
+    float32 v1 = 0;
+    if (!TypeConvertValue<TYPE_float>(script_context, val0_type, val0, v0) ||
+        !TypeConvertValue<TYPE_float>(script_context, val1_type, val1, v1))
+    {
         return (false);
-
-    float32* v0 = (float32*)val0addr;
-    float32* v1 = (float32*)val1addr;
+    }
     float32* result = (float32*)result_addr;
     result_type = TYPE_float;
 
@@ -975,36 +1023,36 @@ bool8 FloatBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& result
     switch (op)
     {
         case OP_Add:
-            *result = *v0 + *v1;
+            *result = v0 + v1;
             return (true);
 
         case OP_Sub:
-            *result = *v0 - *v1;
+            *result = v0 - v1;
             return (true);
 
         case OP_Mult:
-            *result = *v0 * *v1;
+            *result = v0 * v1;
             return (true);
 
         case OP_Div:
-            if (*v1 == 0.0f)
+            if (v1 == 0.0f)
             {
                 TinError(script_context, "Error - OP_Div division by 0.0f\n");
                 *result = 0.0f;
                 return (false);
             }
-            *result = *v0 / *v1;
+            *result = v0 / v1;
             return (true);
 
         case OP_Mod:
-            if (*v1 == 0.0f)
+            if (v1 == 0.0f)
             {
                 TinError(script_context, "Error - OP_Mod division by 0.0f\n");
                 *result = 0.0f;
                 return (false);
             }
 
-            *result = *v0 - (float32)((int32)(*v0 / *v1) * *v1);
+            *result = v0 - (float32)((int32)(v0 / v1) * v1);
             return (true);
 
         // -- comparison operations (push a -1, 0, 1) for less than, equal, greater than
@@ -1014,7 +1062,7 @@ bool8 FloatBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& result
         case OP_CompareLessEqual:
         case OP_CompareGreater:
         case OP_CompareGreaterEqual:
-            *result = (*v0 - *v1) < 0.0f ? -1.0f : (*v0 - *v1) == 0.0f ? 0.0f : 1.0f;
+            *result = (v0 - v1) < 0.0f ? -1.0f : (v0 - v1) == 0.0f ? 0.0f : 1.0f;
             return (true);
 
         default:
@@ -1032,14 +1080,14 @@ bool8 IntegerBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resu
     if (!result_addr || !val0 || !val1)
         return (false);
 
-    // -- ensure the types are converted to vector3f
-    void* val0addr = TypeConvert(script_context, val0_type, val0, TYPE_int);
-    void* val1addr = TypeConvert(script_context, val1_type, val1, TYPE_int);
-    if (!val0addr || !val1addr)
+    // -- convert the values directly to TYPE_int, without consuming scratch buffers
+    int32 v0 = 0;
+    int32 v1 = 0;
+    if (!TypeConvertValue<TYPE_int>(script_context, val0_type, val0, v0) ||
+        !TypeConvertValue<TYPE_int>(script_context, val1_type, val1, v1))
+    {
         return (false);
-
-    int32* v0 = (int32*)val0addr;
-    int32* v1 = (int32*)val1addr;
+    }
     int32* result = (int32*)result_addr;
     result_type = TYPE_int;
 
@@ -1047,36 +1095,36 @@ bool8 IntegerBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resu
     switch (op)
     {
         case OP_Add:
-            *result = *v0 + *v1;
+            *result = v0 + v1;
             return (true);
 
         case OP_Sub:
-            *result = *v0 - *v1;
+            *result = v0 - v1;
             return (true);
 
         case OP_Mult:
-            *result = *v0 * *v1;
+            *result = v0 * v1;
             return (true);
 
         case OP_Div:
-            if (*v1 == 0)
+            if (v1 == 0)
             {
                 TinError(script_context, "Error - OP_Div division by 0\n");
                 *result = 0;
                 return (false);
             }
-            *result = *v0 / *v1;
+            *result = v0 / v1;
             return (true);
 
         case OP_Mod:
-            if (*v1 == 0)
+            if (v1 == 0)
             {
                 TinError(script_context, "Error - OP_Mod division by 0\n");
                 *result = 0;
                 return (false);
             }
 
-            *result = *v0 - ((*v0 / *v1) * *v1);
+            *result = v0 - ((v0 / v1) * v1);
             return (true);
 
         // -- comparison operations (push a -1, 0, 1) for less than, equal, greater than
@@ -1086,28 +1134,28 @@ bool8 IntegerBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resu
         case OP_CompareLessEqual:
         case OP_CompareGreater:
         case OP_CompareGreaterEqual:
-            *result = *v0 - *v1;
+            *result = v0 - v1;
             return (true);
 
         // -- Bit operations
         case OP_BitLeftShift:
-            *result = *v0 << *v1;
+            *result = v0 << v1;
             return (true);
 
         case OP_BitRightShift:
-            *result = *v0 >> *v1;
+            *result = v0 >> v1;
             return (true);
 
         case OP_BitAnd:
-            *result = *v0 & *v1;
+            *result = v0 & v1;
             return (true);
 
         case OP_BitOr:
-            *result = *v0 | *v1;
+            *result = v0 | v1;
             return (true);
 
         case OP_BitXor:
-            *result = *v0 ^ *v1;
+            *result = v0 ^ v1;
             return (true);
 
         default:
@@ -1125,14 +1173,14 @@ bool8 BooleanBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resu
     if (!script_context || !result_addr || !val0 || !val1)
         return (false);
 
-    // -- ensure the types are converted to vector3f
-    void* val0addr = TypeConvert(script_context, val0_type, val0, TYPE_bool);
-    void* val1addr = TypeConvert(script_context, val1_type, val1, TYPE_bool);
-    if (!val0addr || !val1addr)
+    // -- convert the values directly to TYPE_bool, without consuming scratch buffers
+    bool8 v0 = false;
+    bool8 v1 = false;
+    if (!TypeConvertValue<TYPE_bool>(script_context, val0_type, val0, v0) ||
+        !TypeConvertValue<TYPE_bool>(script_context, val1_type, val1, v1))
+    {
         return (false);
-
-    bool8* v0 = (bool8*)val0addr;
-    bool8* v1 = (bool8*)val1addr;
+    }
     int32* result = (int32*)result_addr;
     result_type = TYPE_int;
 
@@ -1141,18 +1189,18 @@ bool8 BooleanBinaryOp(CScriptContext* script_context, eOpCode op, eVarType& resu
     switch (op)
     {
         case OP_BooleanAnd:
-            *result = *v0 && *v1 ? 1 : 0;
+            *result = v0 && v1 ? 1 : 0;
             return (true);
 
         case OP_BooleanOr:
-            *result = *v0 || *v1 ? 1 : 0;
+            *result = v0 || v1 ? 1 : 0;
             return (true);
 
         // -- note: all comparisons follow the same result as, say, strcmp()...
         // -- '0' is equal, -1 is (a < b), '1' is (a > b)
         case OP_CompareEqual:
         case OP_CompareNotEqual:
-            *result = *v0 == *v1 ? 0 : 1;
+            *result = v0 == v1 ? 0 : 1;
             return (true);
     }
 
@@ -1310,6 +1358,395 @@ bool TypeVariableArray_Resize(CVariableEntry* ve_src, int32 new_size)
     return (true);
 }
 
+// == numeric array methods ===========================================================================================
+// -- int and float arrays are stored contiguously, so reductions and transforms run natively over the whole array
+// -- note:  float kernels use the 4-wide SIMD wrapper (so a float sum is accumulated in four lanes);
+// the int kernels are simple loops, left for the compiler to vectorize
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- returns the address of the first element of an int or float array, and its count
+template <typename T>
+static T* GetNumericArray(CVariableEntry* ve, eVarType array_type, const char* method_name, int32& count)
+{
+    count = 0;
+    if (ve == nullptr || ve->GetType() != array_type || !ve->IsArray())
+    {
+        TinPrint(TinScript::GetContext(), "Error - %s[]:%s() var: %s, is not a %s array\n",
+                                          GetRegisteredTypeName(array_type), method_name,
+                                          (ve ? UnHash(ve->GetHash()) : "<unknown>"), GetRegisteredTypeName(array_type));
+        return (nullptr);
+    }
+
+    count = ve->GetArraySize();
+    if (count < 1)
+    {
+        TinPrint(TinScript::GetContext(), "Error - %s[]:%s() var: %s, array has not been initialized\n",
+                                          GetRegisteredTypeName(array_type), method_name, UnHash(ve->GetHash()));
+        count = 0;
+        return (nullptr);
+    }
+
+    return ((T*)ve->GetArrayVarAddr(nullptr, 0));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- sum
+static float32 NumericArraySum(const float32* values, int32 count)
+{
+    tSimd4f sum = Simd4fSplat(0.0f);
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+        sum = Simd4fAdd(sum, Simd4fLoad(&values[i]));
+
+    float32 result = Simd4fSum(sum);
+    for (; i < count; ++i)
+        result += values[i];
+    return (result);
+}
+
+static int32 NumericArraySum(const int32* values, int32 count)
+{
+    int32 result = 0;
+    for (int32 i = 0; i < count; ++i)
+        result += values[i];
+    return (result);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- min/max, count must be at least 1
+static float32 NumericArrayMin(const float32* values, int32 count)
+{
+    float32 result = values[0];
+    int32 i = 0;
+    if (count >= 4)
+    {
+        tSimd4f min_v = Simd4fLoad(&values[0]);
+        for (i = 4; i + 4 <= count; i += 4)
+            min_v = Simd4fMin(min_v, Simd4fLoad(&values[i]));
+
+        float32 lanes[4];
+        Simd4fStore(lanes, min_v);
+        result = lanes[0];
+        for (int32 lane = 1; lane < 4; ++lane)
+            result = lanes[lane] < result ? lanes[lane] : result;
+    }
+
+    for (; i < count; ++i)
+        result = values[i] < result ? values[i] : result;
+    return (result);
+}
+
+static float32 NumericArrayMax(const float32* values, int32 count)
+{
+    float32 result = values[0];
+    int32 i = 0;
+    if (count >= 4)
+    {
+        tSimd4f max_v = Simd4fLoad(&values[0]);
+        for (i = 4; i + 4 <= count; i += 4)
+            max_v = Simd4fMax(max_v, Simd4fLoad(&values[i]));
+
+        float32 lanes[4];
+        Simd4fStore(lanes, max_v);
+        result = lanes[0];
+        for (int32 lane = 1; lane < 4; ++lane)
+            result = lanes[lane] > result ? lanes[lane] : result;
+    }
+
+    for (; i < count; ++i)
+        result = values[i] > result ? values[i] : result;
+    return (result);
+}
+
+static int32 NumericArrayMin(const int32* values, int32 count)
+{
+    int32 result = values[0];
+    for (int32 i = 1; i < count; ++i)
+        result = values[i] < result ? values[i] : result;
+    return (result);
+}
+
+static int32 NumericArrayMax(const int32* values, int32 count)
+{
+    int32 result = values[0];
+    for (int32 i = 1; i < count; ++i)
+        result = values[i] > result ? values[i] : result;
+    return (result);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- dot product
+static float32 NumericArrayDot(const float32* v0, const float32* v1, int32 count)
+{
+    tSimd4f sum = Simd4fSplat(0.0f);
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+        sum = Simd4fMulAdd(sum, Simd4fLoad(&v0[i]), Simd4fLoad(&v1[i]));
+
+    float32 result = Simd4fSum(sum);
+    for (; i < count; ++i)
+        result += v0[i] * v1[i];
+    return (result);
+}
+
+static int32 NumericArrayDot(const int32* v0, const int32* v1, int32 count)
+{
+    int32 result = 0;
+    for (int32 i = 0; i < count; ++i)
+        result += v0[i] * v1[i];
+    return (result);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- fill and scale, in place
+static void NumericArrayFill(float32* values, int32 count, float32 value)
+{
+    tSimd4f fill = Simd4fSplat(value);
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+        Simd4fStore(&values[i], fill);
+    for (; i < count; ++i)
+        values[i] = value;
+}
+
+static void NumericArrayFill(int32* values, int32 count, int32 value)
+{
+    for (int32 i = 0; i < count; ++i)
+        values[i] = value;
+}
+
+static void NumericArrayScale(float32* values, int32 count, float32 scale)
+{
+    tSimd4f scale_v = Simd4fSplat(scale);
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+        Simd4fStore(&values[i], Simd4fMul(Simd4fLoad(&values[i]), scale_v));
+    for (; i < count; ++i)
+        values[i] *= scale;
+}
+
+static void NumericArrayScale(int32* values, int32 count, int32 scale)
+{
+    for (int32 i = 0; i < count; ++i)
+        values[i] *= scale;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- the index of the first min/max element
+template <typename T>
+static int32 NumericArrayArgMin(const T* values, int32 count)
+{
+    int32 result = 0;
+    for (int32 i = 1; i < count; ++i)
+    {
+        if (values[i] < values[result])
+            result = i;
+    }
+    return (result);
+}
+
+template <typename T>
+static int32 NumericArrayArgMax(const T* values, int32 count)
+{
+    int32 result = 0;
+    for (int32 i = 1; i < count; ++i)
+    {
+        if (values[i] > values[result])
+            result = i;
+    }
+    return (result);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- binary search of an array sorted in ascending order, returns the index of the first match, or -1
+template <typename T>
+static int32 NumericArrayBinarySearch(const T* values, int32 count, T value)
+{
+    const T* found = std::lower_bound(values, values + count, value);
+    if (found == values + count || *found != value)
+        return (-1);
+    return ((int32)(found - values));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- registered float[] methods
+float32 TypeFloatArray_Sum(CVariableEntry* ve)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "sum", count);
+    return (values != nullptr ? NumericArraySum(values, count) : 0.0f);
+}
+
+float32 TypeFloatArray_Min(CVariableEntry* ve)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "minimum", count);
+    return (values != nullptr ? NumericArrayMin(values, count) : 0.0f);
+}
+
+float32 TypeFloatArray_Max(CVariableEntry* ve)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "maximum", count);
+    return (values != nullptr ? NumericArrayMax(values, count) : 0.0f);
+}
+
+int32 TypeFloatArray_ArgMin(CVariableEntry* ve)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "argmin", count);
+    return (values != nullptr ? NumericArrayArgMin(values, count) : -1);
+}
+
+int32 TypeFloatArray_ArgMax(CVariableEntry* ve)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "argmax", count);
+    return (values != nullptr ? NumericArrayArgMax(values, count) : -1);
+}
+
+bool TypeFloatArray_Sort(CVariableEntry* ve)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "sort", count);
+    if (values == nullptr)
+        return (false);
+
+    std::sort(values, values + count);
+    return (true);
+}
+
+int32 TypeFloatArray_BinarySearch(CVariableEntry* ve, float32 value)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "binary_search", count);
+    return (values != nullptr ? NumericArrayBinarySearch(values, count, value) : -1);
+}
+
+bool TypeFloatArray_Fill(CVariableEntry* ve, float32 value)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "fill", count);
+    if (values == nullptr)
+        return (false);
+
+    NumericArrayFill(values, count, value);
+    return (true);
+}
+
+bool TypeFloatArray_Scale(CVariableEntry* ve, float32 scale)
+{
+    int32 count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "scale", count);
+    if (values == nullptr)
+        return (false);
+
+    NumericArrayScale(values, count, scale);
+    return (true);
+}
+
+// -- the dot product is over the number of elements in the smaller of the two arrays
+float32 TypeFloatArray_Dot(CVariableEntry* ve, CVariableEntry* ve_other)
+{
+    int32 count = 0;
+    int32 other_count = 0;
+    float32* values = GetNumericArray<float32>(ve, TYPE_float, "dot", count);
+    float32* other = values != nullptr ? GetNumericArray<float32>(ve_other, TYPE_float, "dot", other_count) : nullptr;
+    if (other == nullptr)
+        return (0.0f);
+
+    return (NumericArrayDot(values, other, count < other_count ? count : other_count));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- registered int[] methods
+int32 TypeIntArray_Sum(CVariableEntry* ve)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "sum", count);
+    return (values != nullptr ? NumericArraySum(values, count) : 0);
+}
+
+int32 TypeIntArray_Min(CVariableEntry* ve)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "minimum", count);
+    return (values != nullptr ? NumericArrayMin(values, count) : 0);
+}
+
+int32 TypeIntArray_Max(CVariableEntry* ve)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "maximum", count);
+    return (values != nullptr ? NumericArrayMax(values, count) : 0);
+}
+
+int32 TypeIntArray_ArgMin(CVariableEntry* ve)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "argmin", count);
+    return (values != nullptr ? NumericArrayArgMin(values, count) : -1);
+}
+
+int32 TypeIntArray_ArgMax(CVariableEntry* ve)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "argmax", count);
+    return (values != nullptr ? NumericArrayArgMax(values, count) : -1);
+}
+
+bool TypeIntArray_Sort(CVariableEntry* ve)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "sort", count);
+    if (values == nullptr)
+        return (false);
+
+    std::sort(values, values + count);
+    return (true);
+}
+
+int32 TypeIntArray_BinarySearch(CVariableEntry* ve, int32 value)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "binary_search", count);
+    return (values != nullptr ? NumericArrayBinarySearch(values, count, value) : -1);
+}
+
+bool TypeIntArray_Fill(CVariableEntry* ve, int32 value)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "fill", count);
+    if (values == nullptr)
+        return (false);
+
+    NumericArrayFill(values, count, value);
+    return (true);
+}
+
+bool TypeIntArray_Scale(CVariableEntry* ve, int32 scale)
+{
+    int32 count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "scale", count);
+    if (values == nullptr)
+        return (false);
+
+    NumericArrayScale(values, count, scale);
+    return (true);
+}
+
+int32 TypeIntArray_Dot(CVariableEntry* ve, CVariableEntry* ve_other)
+{
+    int32 count = 0;
+    int32 other_count = 0;
+    int32* values = GetNumericArray<int32>(ve, TYPE_int, "dot", count);
+    int32* other = values != nullptr ? GetNumericArray<int32>(ve_other, TYPE_int, "dot", other_count) : nullptr;
+    if (other == nullptr)
+        return (0);
+
+    return (NumericArrayDot(values, other, count < other_count ? count : other_count));
+}
+
 // ====================================================================================================================
 // ObjectConfig():  Called from InitializeTypes() to register object operations and conversions
 // ====================================================================================================================
@@ -1363,7 +1800,7 @@ bool TypeString_Contains(CVariableEntry* ve, const char* string_val)
     if (string_val == nullptr)
         return false;
 
-    uint32 string_val_hash = TinScript::Hash(string_val, -1, false);
+    uint32 string_val_hash = TinScript::HashValue(string_val);
     int32 count = ve != nullptr ? ve->GetArraySize() : 0;
     for (int i = 0; i < count; ++i)
     {
@@ -1443,9 +1880,7 @@ bool8 FloatConfig(eVarType var_type, bool8 onInit)
         RegisterTypeOpOverride(OP_BooleanAnd, TYPE_float, BooleanBinaryOp);
         RegisterTypeOpOverride(OP_BooleanOr, TYPE_float, BooleanBinaryOp);
 
-        // -- register the conversion methods
-        RegisterTypeConvert(TYPE_float, TYPE_int, FloatConvert);
-        RegisterTypeConvert(TYPE_float, TYPE_bool, FloatConvert);
+        // -- note:  conversions to float are registered by RegisterDefaultTypeConverts()
 
         // -- register the POD methods
         REGISTER_TYPE_METHOD(TYPE_float, initialized, TypeVariable_IsSet);
@@ -1453,6 +1888,17 @@ bool8 FloatConfig(eVarType var_type, bool8 onInit)
         REGISTER_TYPE_METHOD(TYPE_float, contains, TypeFloat_Contains);
         REGISTER_TYPE_METHOD(TYPE_float, copy, TypeVariableArray_Copy);
         REGISTER_TYPE_METHOD(TYPE_float, resize, TypeVariableArray_Resize);
+
+        REGISTER_TYPE_METHOD(TYPE_float, sum, TypeFloatArray_Sum);
+        REGISTER_TYPE_METHOD(TYPE_float, minimum, TypeFloatArray_Min);
+        REGISTER_TYPE_METHOD(TYPE_float, maximum, TypeFloatArray_Max);
+        REGISTER_TYPE_METHOD(TYPE_float, argmin, TypeFloatArray_ArgMin);
+        REGISTER_TYPE_METHOD(TYPE_float, argmax, TypeFloatArray_ArgMax);
+        REGISTER_TYPE_METHOD(TYPE_float, sort, TypeFloatArray_Sort);
+        REGISTER_TYPE_METHOD(TYPE_float, binary_search, TypeFloatArray_BinarySearch);
+        REGISTER_TYPE_METHOD(TYPE_float, fill, TypeFloatArray_Fill);
+        REGISTER_TYPE_METHOD(TYPE_float, scale, TypeFloatArray_Scale);
+        REGISTER_TYPE_METHOD(TYPE_float, dot, TypeFloatArray_Dot);
     }
 
     // -- success
@@ -1507,8 +1953,6 @@ bool8 IntegerConfig(eVarType var_type, bool8 onInit)
         RegisterTypeOpOverride(OP_BitXor, TYPE_int, IntegerBinaryOp);
 
         // -- register the conversion methods
-        RegisterTypeConvert(TYPE_int, TYPE_float, IntegerConvert);
-        RegisterTypeConvert(TYPE_int, TYPE_bool, IntegerConvert);
         RegisterTypeConvert(TYPE_int, TYPE_object, IntegerConvert);
 
         // -- register the POD methods
@@ -1517,6 +1961,17 @@ bool8 IntegerConfig(eVarType var_type, bool8 onInit)
         REGISTER_TYPE_METHOD(TYPE_int, contains, TypeInt_Contains);
         REGISTER_TYPE_METHOD(TYPE_int, copy, TypeVariableArray_Copy);
         REGISTER_TYPE_METHOD(TYPE_int, resize, TypeVariableArray_Resize);
+
+        REGISTER_TYPE_METHOD(TYPE_int, sum, TypeIntArray_Sum);
+        REGISTER_TYPE_METHOD(TYPE_int, minimum, TypeIntArray_Min);
+        REGISTER_TYPE_METHOD(TYPE_int, maximum, TypeIntArray_Max);
+        REGISTER_TYPE_METHOD(TYPE_int, argmin, TypeIntArray_ArgMin);
+        REGISTER_TYPE_METHOD(TYPE_int, argmax, TypeIntArray_ArgMax);
+        REGISTER_TYPE_METHOD(TYPE_int, sort, TypeIntArray_Sort);
+        REGISTER_TYPE_METHOD(TYPE_int, binary_search, TypeIntArray_BinarySearch);
+        REGISTER_TYPE_METHOD(TYPE_int, fill, TypeIntArray_Fill);
+        REGISTER_TYPE_METHOD(TYPE_int, scale, TypeIntArray_Scale);
+        REGISTER_TYPE_METHOD(TYPE_int, dot, TypeIntArray_Dot);
     }
 
     // -- success
@@ -1551,8 +2006,6 @@ bool8 BoolConfig(eVarType var_type, bool8 onInit)
         RegisterTypeOpOverride(OP_BooleanOr, TYPE_bool, BooleanBinaryOp);
 
         // -- register the conversion methods
-        RegisterTypeConvert(TYPE_bool, TYPE_float, BoolConvert);
-        RegisterTypeConvert(TYPE_bool, TYPE_int, BoolConvert);
         RegisterTypeConvert(TYPE_bool, TYPE_object, BoolConvert);
 
         // -- register the POD methods
@@ -1616,7 +2069,7 @@ bool TypeHashtable_HasKey(CVariableEntry* ht_ve, const char* key0, const char* k
         }
         else
         {
-            key_hash = Hash(key_table[i], -1, false);
+            key_hash = HashValue(key_table[i]);
         }
     }
 
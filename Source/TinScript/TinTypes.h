@@ -29,6 +29,11 @@
 #include "integration.h"
 #include "TinHash.h"
 
+// -- forward declarations
+class CVector3f;
+class CVector4f;
+class CQuaternion;
+
 // == namespace TinScript =============================================================================================
 
 namespace TinScript
@@ -100,14 +105,14 @@ struct tGetTypeStruct
 template <typename T, std::enable_if_t<!std::is_pointer<T>::value, bool> = true>
 uint32 GetTypeID()
 {
-    void* ptr = (void*)tGetTypeStruct<std::remove_const<T>::type>::GetType();
+    void* ptr = (void*)tGetTypeStruct<typename std::remove_const<T>::type>::GetType();
     return (kPointerToUInt32(ptr));
 }
 
 template <typename T, std::enable_if_t<std::is_pointer<T>::value, bool> = true>
 uint32 GetTypeID()
 {
-    void* ptr = (void*)tGetTypeStruct<std::remove_const<std::remove_pointer<T>::type>::type>::GetTypePointer();
+    void* ptr = (void*)tGetTypeStruct<typename std::remove_const<typename std::remove_pointer<T>::type>::type>::GetTypePointer();
     return (kPointerToUInt32(ptr));
 }
 
@@ -377,6 +382,12 @@ bool8 HashtableConfig(eVarType var_type, bool8 onInit);
 bool8 Vector3fToString(TinScript::CScriptContext* script_context, void* value, char* buf, int32 bufsize);
 bool8 StringToVector3f(TinScript::CScriptContext* script_context, void* addr, char* value);
 bool8 Vector3fConfig(eVarType var_type, bool8 onInit);
+bool8 Vector4fToString(TinScript::CScriptContext* script_context, void* value, char* buf, int32 bufsize);
+bool8 StringToVector4f(TinScript::CScriptContext* script_context, void* addr, char* value);
+bool8 Vector4fConfig(eVarType var_type, bool8 onInit);
+bool8 QuatToString(TinScript::CScriptContext* script_context, void* value, char* buf, int32 bufsize);
+bool8 StringToQuat(TinScript::CScriptContext* script_context, void* addr, char* value);
+bool8 QuatConfig(eVarType var_type, bool8 onInit);
 
 // -- UnrealEngine types (guarded by PLATFORM_UE4)
 bool8 FVectorToString(TinScript::CScriptContext* script_context, void* value, char* buf, int32 bufsize);
@@ -442,7 +453,7 @@ typedef void* (*TypeConvertFunction)(CScriptContext* script_context, eVarType fr
 
 // -- these are the script
 #define FIRST_VALID_TYPE TYPE_hashtable
-#define LAST_VALID_TYPE TYPE_vector3f
+#define LAST_VALID_TYPE TYPE_quat
 
 #define VarTypeTuple \
 	VarTypeEntry(NULL,		    0,			VoidToString,		StringToVoid,       uint8,          nullptr)            \
@@ -460,6 +471,8 @@ typedef void* (*TypeConvertFunction)(CScriptContext* script_context, eVarType fr
 	VarTypeEntry(int,		    4,			IntToString,		StringToInt,        int32,          IntegerConfig)      \
 	VarTypeEntry(bool,		    1,			BoolToString,		StringToBool,       bool8,          BoolConfig)         \
 	VarTypeEntry(vector3f,	   12,			Vector3fToString,   StringToVector3f,   Vector3fClass,  Vector3fConfig)		\
+	VarTypeEntry(vector4f,	   16,			Vector4fToString,   StringToVector4f,   CVector4f,      Vector4fConfig)		\
+	VarTypeEntry(quat,	       16,			QuatToString,       StringToQuat,       CQuaternion,    QuatConfig)		    \
 	VarTypeEntry(ue_vector,	   24,			FVectorToString,	StringToFVector,	Vector3dClass,	nullptr)			\
 
 // -- 4x words actually, 16x bytes, the size of a HashVar
@@ -474,6 +487,14 @@ enum eVarType : int16_t
 	TYPE_COUNT
 };
 
+// -- compile-time mapping from each registered type to its C++ type (note:  strings are stored as a uint32 hash)
+template <eVarType T>
+struct tVarTypeTraits;
+
+#define VarTypeEntry(a, b, c, d, e, f) template<> struct tVarTypeTraits<TYPE_##a> { typedef e tValueType; };
+VarTypeTuple
+#undef VarTypeEntry
+
 // -- interface -------------------------------------------------------------------------------------------------------
 
 // -- system API
@@ -494,6 +515,18 @@ void RegisterTypeConvert(eVarType to_type, eVarType from_type, TypeConvertFuncti
 // ====================================================================================================================
 void* TypeConvert(CScriptContext* script_context, eVarType fromtype, void* fromaddr, eVarType totype);
 
+// -- converts directly into the caller's buffer, without consuming a scratch buffer
+bool8 TypeConvertValue(CScriptContext* script_context, eVarType fromtype, void* fromaddr, eVarType totype,
+                       void* to_buffer);
+
+template <eVarType T>
+inline bool8 TypeConvertValue(CScriptContext* script_context, eVarType fromtype, void* fromaddr,
+                              typename tVarTypeTraits<T>::tValueType& out_value)
+{
+    static_assert(T != TYPE_string, "TypeConvertValue<TYPE_string>() - strings are stored as a uint32 hash");
+    return (TypeConvertValue(script_context, fromtype, fromaddr, T, (void*)&out_value));
+}
+
 // ====================================================================================================================
 // -- only two types of functions: registered (from code), and script
 #define FunctionTypeTuple \
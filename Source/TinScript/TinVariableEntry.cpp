@@ -936,6 +936,57 @@ uint32 CVariableEntry::GetDispatchConvertFromObject()
      return copy_ve;
  }
 
+// ====================================================================================================================
+// GetStackVarAddrAtDepth():  Returns the address of a stack variable, in the function call at the given depth.
+// ====================================================================================================================
+void* GetStackVarAddrAtDepth(CVariableEntry* ve_src, int32 stack_depth)
+{
+    // -- by definition, we're executing a function call for this method, so we want the
+    // calling function's stack offset, which will likely be at 1 (stack_depth) below us on the stack
+    int32 stack_var_offset = 0;
+    CExecStack* execstack = nullptr;
+    CFunctionCallStack* funccallstack = CFunctionCallStack::GetExecutionStackAtDepth(stack_depth, execstack,
+                                                                                        stack_var_offset);
+    return (funccallstack != nullptr ? execstack->GetStackVarAddr(stack_var_offset, ve_src->GetStackOffset())
+                                     : nullptr);
+}
+
+// ====================================================================================================================
+// PushDispatchReturnValue():  Pushes the return value of a registered function dispatched from the exec stack.
+// ====================================================================================================================
+void PushDispatchReturnValue(CExecStack& execstack, eVarType return_type, void* return_addr)
+{
+    // -- all functions must push a return value
+    if (return_type <= TYPE_void)
+    {
+        int32 empty = 0;
+        execstack.Push(&empty, TYPE_int);
+    }
+
+    // -- strings are returned from code as a const char*, but script values are always the string table hash
+    // -- the string is added unreferenced - pushing it onto the stack is the only reference
+    else if (return_type == TYPE_string)
+    {
+        uint32 string_hash = return_addr != nullptr ? Hash((const char*)return_addr, -1, false) : 0;
+        execstack.Push(&string_hash, TYPE_string);
+    }
+
+    // -- a hashtable is pushed by address
+    else if (return_type == TYPE_hashtable)
+    {
+        execstack.Push(return_addr, return_type);
+    }
+
+    // -- otherwise, push the value, padded to whole stack words - e.g. a bool is a single byte
+    else
+    {
+        uint32 return_value[MAX_TYPE_SIZE];
+        memset(return_value, 0, sizeof(return_value));
+        memcpy(return_value, return_addr, gRegisteredTypeSize[return_type]);
+        execstack.Push(return_value, return_type);
+    }
+}
+
 } // namespace TinScript
 
 // -- eof ------------------------------------------------------------------------------------------------------------
@@ -195,6 +195,7 @@ public:
     void SetStringArrayLiteralValue(void* objaddr, void* value, int32 array_index = 0);
 
     void ClearBreakOnWrite();
+    bool8 IsBreakOnWrite() const { return (mBreakOnWrite != nullptr); }
 	void SetBreakOnWrite(int32 varWatchRequestID, int32 debugger_session, bool8 break_on_write, const char* condition,
                          const char* trace, bool8 trace_on_cond);
 
@@ -336,60 +337,124 @@ bool8 SetGlobalVar(CScriptContext* script_context, const char* varname, T value)
 }
 
 // ====================================================================================================================
-// ConvertVariableForDispatch():  Converts a variable to the actual argument type, to pass to a registerd function.
+// ConvertObjectForDispatch():  Converts an object ID to the actual class pointer, to pass to a registered function.
 // ====================================================================================================================
 // A special case, where a registered parameter is an actual class pointer, not a uint32
 // -- we'll look up the object, and if it exists, ensure it's namespace hierarchy
 // -- contains the pointer type we're converting to... then we'll do the conversion
 template <typename T>
-T ConvertVariableForDispatch(CVariableEntry* ve)
+T ConvertObjectForDispatch(uint32 obj_id, uint32 conversion_type_id)
 {
-    T return_value;
-    uint32 conversion_type_id = ve->GetDispatchConvertFromObject();
-    if (conversion_type_id != 0)
+    CObjectEntry* oe = GetContext()->FindObjectEntry(obj_id);
+    if (oe)
     {
-        uint32 obj_id = convert_from_void_ptr<uint32>::Convert(ve->GetValueAddr(NULL));
-        CObjectEntry* oe = GetContext()->FindObjectEntry(obj_id);
-        if (oe)
+        // -- validate that the object is actually derived from the parameter expected
+        bool ns_type_found = false;
+        CNamespace* ns_entry = oe->GetNamespace();
+        while (ns_entry)
         {
-            // -- validate that the object is actually derived from the parameter expected
-            bool ns_type_found = false;
-            CNamespace* ns_entry = oe->GetNamespace();
-            while (ns_entry)
+            if (ns_entry->GetTypeID() == conversion_type_id)
             {
-                if (ns_entry->GetTypeID() == conversion_type_id)
-                {
-                    ns_type_found = true;
-                    break;
-                }
-                else
-                {
-                    ns_entry = ns_entry->GetNext();
-                }
+                ns_type_found = true;
+                break;
             }
-
-            if (!ns_type_found)
+            else
             {
-                ScriptAssert_(::TinScript::GetContext(), false, "<internal>", -1,
-                              "Error - object %d cannot be passed - invalid type\n", oe->GetID());
+                ns_entry = ns_entry->GetNext();
             }
+        }
+
+        if (!ns_type_found)
+        {
+            ScriptAssert_(::TinScript::GetContext(), false, "<internal>", -1,
+                          "Error - object %d cannot be passed - invalid type\n", oe->GetID());
+        }
+
+        return (convert_from_void_ptr<T>::Convert(oe->GetAddr()));
+    }
+
+    // -- invalid or not found - return NULL
+    return (convert_from_void_ptr<T>::Convert((void*)NULL));
+}
+
+// ====================================================================================================================
+// ConvertVariableForDispatch():  Converts a variable to the actual argument type, to pass to a registerd function.
+// ====================================================================================================================
+template <typename T>
+T ConvertVariableForDispatch(CVariableEntry* ve)
+{
+    uint32 conversion_type_id = ve->GetDispatchConvertFromObject();
+    if (conversion_type_id != 0)
+    {
+        uint32 obj_id = convert_from_void_ptr<uint32>::Convert(ve->GetValueAddr(NULL));
+        return (ConvertObjectForDispatch<T>(obj_id, conversion_type_id));
+    }
+
+    // -- return the value
+    return (convert_from_void_ptr<T>::Convert(ve->GetValueAddr(NULL)));
+}
 
-            return_value = convert_from_void_ptr<T>::Convert(oe->GetAddr());
-            return (return_value);
+// ====================================================================================================================
+// struct tDispatchArg:  An argument resolved from the exec stack, to be passed directly to a registered function.
+// ====================================================================================================================
+struct tDispatchArg
+{
+    eVarType type;
+    uint32 value[MAX_TYPE_SIZE];
+};
+
+// ====================================================================================================================
+// ConvertStackArgForDispatch():  Converts a value popped from the exec stack to the actual argument type.
+// -- this is the same conversion as assigning the value to the parameter, followed by ConvertVariableForDispatch(),
+// -- without the round trip through the function context's variable entry
+// ====================================================================================================================
+template <typename T>
+T ConvertStackArgForDispatch(tDispatchArg& arg)
+{
+    CScriptContext* script_context = GetContext();
+    eVarType param_type = GetRegisteredType(GetTypeID<T>());
+    void* value_addr = (void*)arg.value;
+    if (arg.type != param_type)
+    {
+        // -- convert by value, back into the arg itself, so the converted argument doesn't occupy a scratch buffer
+        uint32 converted[MAX_TYPE_SIZE];
+        if (TypeConvertValue(script_context, arg.type, value_addr, param_type, (void*)converted))
+        {
+            memcpy(arg.value, converted, sizeof(arg.value));
         }
+        else
+        {
+            ScriptAssert_(script_context, false, "<internal>", -1,
+                          "Error - unable to convert from type %s to %s\n", GetRegisteredTypeName(arg.type),
+                          GetRegisteredTypeName(param_type));
 
-        // -- invalid or not found - return NULL
-        return_value = convert_from_void_ptr<T>::Convert((void*)NULL);
+            // -- pass a zeroed argument, just as an unassigned parameter would be
+            memset(arg.value, 0, sizeof(arg.value));
+        }
+        arg.type = param_type;
     }
-    else
+
+    // -- strings are passed to code as the actual const char*, not the string table hash
+    if (param_type == TYPE_string)
     {
-        return_value = convert_from_void_ptr<T>::Convert(ve->GetValueAddr(NULL));
+        const char* string_value = script_context->GetStringTable()->FindString(*(uint32*)value_addr);
+        return (convert_from_void_ptr<T>::Convert((void*)(string_value ? string_value : "")));
     }
 
+    // -- parameters registered as pointers to a registered class are converted from the object ID
+    if (param_type == TYPE_object && GetTypeID<T>() != GetTypeID<uint32>())
+        return (ConvertObjectForDispatch<T>(*(uint32*)value_addr, GetTypeID<T>()));
+
     // -- return the value
-    return (return_value);
+    return (convert_from_void_ptr<T>::Convert(value_addr));
 }
 
+// -- pushes the return value of a stack dispatched registered function (void functions push an int 0)
+void PushDispatchReturnValue(CExecStack& execstack, eVarType return_type, void* return_addr);
+
+// -- returns the address of the stack variable, in the function call at the given depth of the execution stack
+void* GetStackVarAddrAtDepth(CVariableEntry* ve_src, int32 stack_depth);
+
 // ====================================================================================================================
 // GetPODStackVarAddr():  Templated helper for getting address of a value (by type) for a variable entry
 // ====================================================================================================================
@@ -403,13 +468,7 @@ T* GetPODStackVarAddr(CVariableEntry* ve_src, int32 stack_depth)
     // -- this is a stack variable, if it's owned by a function
     // -- by definition, we're executing a function call for this method, so we want the
     // calling function's stack offset, which will likely be at 1 (stack_depth) below us on the stack
-    int32 stack_var_offset = 0;
-    CExecStack* execstack = nullptr;
-    CFunctionCallStack* funccallstack = CFunctionCallStack::GetExecutionStackAtDepth(stack_depth, execstack,
-                                                                                        stack_var_offset);
-    T* value = funccallstack != nullptr
-               ? (T*)execstack->GetStackVarAddr(stack_var_offset, ve_src->GetStackOffset())
-               : nullptr;
+    T* value = (T*)GetStackVarAddrAtDepth(ve_src, stack_depth);
 
     // -- if we were not able to retrieve the value by now, we failed
     if (value == nullptr)
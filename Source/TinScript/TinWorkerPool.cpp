@@ -0,0 +1,720 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinWorkerPool.cpp
+// ====================================================================================================================
+
+// -- class include
+#include "TinWorkerPool.h"
+
+// -- includes
+#include "string.h"
+#include <chrono>
+
+#include "TinScript.h"
+#include "TinInterface.h"
+#include "TinStringTable.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+// == class CScriptJob ================================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CScriptJob::CScriptJob(const CThreadCommand& command, uint32 job_id, uint32 callback_hash)
+    : mCommand(command)
+    , mJobID(job_id)
+    , mCallbackHash(callback_hash)
+    , mState(eJobPending)
+    , mResultType(TYPE_NULL)
+    , mNext(nullptr)
+{
+    mResultString[0] = '\0';
+}
+
+// ====================================================================================================================
+// GetResultAddr():  Returns the address of the result value (or the const char*, for a string)
+// ====================================================================================================================
+void* CScriptJob::GetResultAddr()
+{
+    if (!IsComplete() || mResultType == TYPE_NULL)
+        return (nullptr);
+
+    if (mResultType == TYPE_string)
+        return (mResultString);
+
+    return (mResultValue);
+}
+
+// ====================================================================================================================
+// SetResult():  Called by the worker thread, copies the return value out of the worker context
+// ====================================================================================================================
+void CScriptJob::SetResult(CScriptContext* script_context, bool8 success)
+{
+    mResultType = TYPE_NULL;
+
+    void* return_value = nullptr;
+    eVarType return_type = TYPE_NULL;
+    if (success && script_context->GetFunctionReturnValue(return_value, return_type))
+    {
+        // -- strings are owned by the worker's string table, so the result holds a copy
+        if (return_type == TYPE_string)
+        {
+            const char* string_value = script_context->GetStringTable()->FindString(*(uint32*)return_value);
+            SafeStrcpy(mResultString, sizeof(mResultString), string_value ? string_value : "", kMaxArgLength);
+            mResultType = TYPE_string;
+        }
+
+        // -- a hashtable can't be copied out of the worker context
+        else if (return_type != TYPE_hashtable)
+        {
+            memcpy(mResultValue, return_value, gRegisteredTypeSize[return_type]);
+            mResultType = return_type;
+        }
+    }
+
+    // -- publish the result
+    mState.store(success ? eJobComplete : eJobFailed, std::memory_order_release);
+}
+
+// == class CScriptWorkerPool =========================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CScriptWorkerPool::CScriptWorkerPool(int32 worker_count, const char** script_files, int32 script_count)
+    : mOwnerContext(GetContext())
+    , mWorkerCount(0)
+    , mScriptFiles(script_files)
+    , mScriptCount(script_count)
+    , mStartedCount(0)
+    , mInitializedCount(0)
+    , mPendingHead(nullptr)
+    , mPendingTail(nullptr)
+    , mShuttingDown(false)
+    , mCompletedList(nullptr)
+    , mNextJobID(0)
+    , mActiveCount(0)
+    , mParallelFunc(nullptr)
+    , mParallelUserData(nullptr)
+    , mParallelGeneration(0)
+    , mParallelActive(false)
+    , mParallelWorkers(0)
+{
+    if (worker_count < 1)
+        worker_count = 1;
+    else if (worker_count > kWorkerPoolMaxThreads)
+        worker_count = kWorkerPoolMaxThreads;
+
+    // -- start each worker, and wait for it to execute the scripts, before starting the next
+    for (int32 i = 0; i < worker_count; ++i)
+    {
+        mThreads[i] = std::thread(WorkerThread, this, i);
+        ++mWorkerCount;
+
+        std::unique_lock<std::mutex> lock(mStartupLock);
+        mStartupSignal.wait(lock, [this, i]() { return (mStartedCount > i); });
+    }
+
+    // -- the script list is only needed during startup
+    mScriptFiles = nullptr;
+    mScriptCount = 0;
+
+    // -- results are collected during the owning context's update
+    mOwnerContext->SetWorkerPool(this);
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CScriptWorkerPool::~CScriptWorkerPool()
+{
+    // -- stop the workers - each exits once the pending jobs are all executed
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        mShuttingDown = true;
+    }
+    mJobSignal.notify_all();
+
+    for (int32 i = 0; i < mWorkerCount; ++i)
+        mThreads[i].join();
+
+    if (mOwnerContext->GetWorkerPool() == this)
+        mOwnerContext->SetWorkerPool(nullptr);
+
+    // -- completed jobs whose callbacks were never executed are freed
+    while (mCompletedList != nullptr)
+    {
+        CScriptJob* job = mCompletedList;
+        mCompletedList = job->mNext;
+        TinFree(job);
+    }
+}
+
+// ====================================================================================================================
+// Submit():  Queues a function call to be executed by the next available worker
+// ====================================================================================================================
+CScriptJob* CScriptWorkerPool::Submit(const CThreadCommand& command, uint32 callback_hash)
+{
+    // -- jobs are submitted (and freed) only by the owning context
+    if (GetContext() != mOwnerContext)
+    {
+        ScriptAssert_(mOwnerContext, false, "<internal>", -1,
+                      "Error - CScriptWorkerPool::Submit() called from a thread not owning the pool\n");
+        return (nullptr);
+    }
+
+    // -- the job is handed to a worker thread, and a future may be held past the owning context, so it's shared
+    CScriptJob* job = TinAllocShared(ALLOC_WorkerPool, CScriptJob, command, ++mNextJobID, callback_hash);
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        if (mShuttingDown)
+        {
+            TinFree(job);
+            return (nullptr);
+        }
+
+        if (mPendingTail != nullptr)
+            mPendingTail->mNext = job;
+        else
+            mPendingHead = job;
+        mPendingTail = job;
+        mActiveCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    mJobSignal.notify_one();
+    return (job);
+}
+
+// ====================================================================================================================
+// Release():  Frees a completed job, submitted without a callback
+// ====================================================================================================================
+void CScriptWorkerPool::Release(CScriptJob* job)
+{
+    if (job == nullptr)
+        return;
+
+    if (!job->IsComplete() || job->mCallbackHash != 0)
+    {
+        ScriptAssert_(mOwnerContext, false, "<internal>", -1,
+                      "Error - CScriptWorkerPool::Release() job %d is still pending, or owned by the pool\n",
+                      job->mJobID);
+        return;
+    }
+
+    TinFree(job);
+}
+
+// ====================================================================================================================
+// Update():  Executes the callbacks for completed jobs, in the order they were completed
+// ====================================================================================================================
+void CScriptWorkerPool::Update()
+{
+    CScriptJob* completed_list = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mCompletedLock);
+        completed_list = mCompletedList;
+        mCompletedList = nullptr;
+    }
+
+    // -- the list was built by pushing to the head, so reverse it
+    CScriptJob* ordered_list = nullptr;
+    while (completed_list != nullptr)
+    {
+        CScriptJob* job = completed_list;
+        completed_list = job->mNext;
+        job->mNext = ordered_list;
+        ordered_list = job;
+    }
+
+    // -- the callback receives the job ID, whether the job succeeded, and the result, if there is one
+    CThreadCommand callback;
+    while (ordered_list != nullptr)
+    {
+        CScriptJob* job = ordered_list;
+        ordered_list = job->mNext;
+
+        int32 job_id = (int32)job->mJobID;
+        bool8 success = job->Succeeded();
+        callback.Reset(job->mCallbackHash);
+        callback.AddParam(TYPE_int, &job_id);
+        callback.AddParam(TYPE_bool, &success);
+        if (job->GetResultAddr() != nullptr)
+            callback.AddParam(job->GetResultType(), job->GetResultAddr());
+
+        mOwnerContext->ExecuteThreadCommand(callback);
+        TinFree(job);
+        mActiveCount.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+// ====================================================================================================================
+// ParallelFor():  Executes the range in chunks, on the worker threads - the owning thread waits for every chunk
+// ====================================================================================================================
+void CScriptWorkerPool::ParallelFor(int32 count, int32 chunk_size, ParallelForFunc func, void* user_data)
+{
+    if (GetContext() != mOwnerContext)
+    {
+        ScriptAssert_(mOwnerContext, false, "<internal>", -1,
+                      "Error - CScriptWorkerPool::ParallelFor() called from a thread not owning the pool\n");
+        return;
+    }
+
+    // -- without a worker able to execute the chunks, none are
+    if (count <= 0 || func == nullptr || mInitializedCount == 0)
+        return;
+
+    // -- the owning thread doesn't take part - its context isn't a worker context
+    mParallelRanges.Split(count, mWorkerCount, chunk_size);
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        mParallelFunc = func;
+        mParallelUserData = user_data;
+        mParallelActive = true;
+        ++mParallelGeneration;
+    }
+    mJobSignal.notify_all();
+
+    // -- the merge point:  wait for every chunk to complete
+    while (!mParallelRanges.IsComplete())
+        std::this_thread::yield();
+
+    // -- and for every worker to leave the loop, before the ranges are reused
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        mParallelActive = false;
+    }
+    while (mParallelWorkers.load(std::memory_order_acquire) > 0)
+        std::this_thread::yield();
+}
+
+// ====================================================================================================================
+// WorkerThread():  The worker thread function - creates the worker context, and executes jobs until shutdown
+// ====================================================================================================================
+void CScriptWorkerPool::WorkerThread(CScriptWorkerPool* pool, int32 worker_index)
+{
+    bool8 initialized = pool->InitializeWorker(worker_index);
+
+    // -- signal the constructor to start the next worker
+    {
+        std::lock_guard<std::mutex> lock(pool->mStartupLock);
+        ++pool->mStartedCount;
+        if (initialized)
+            ++pool->mInitializedCount;
+    }
+    pool->mStartupSignal.notify_all();
+
+    // -- note:  a worker that failed to initialize still consumes jobs, failing each of them,
+    // so the submitting thread is never left waiting
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    uint32 parallel_generation = 0;
+    while (true)
+    {
+        bool8 join_parallel = false;
+        CScriptJob* job = pool->WaitForJob(parallel_generation, join_parallel);
+
+        // -- join a parallel loop once - a worker without a range of its own only steals
+        // -- note:  WaitForJob() has already counted us as a participant - a worker that failed to initialize
+        // executes no chunks, and its range is stolen by the others
+        if (join_parallel)
+        {
+            parallel_generation = pool->mParallelGeneration;
+            int32 participant_count = pool->mParallelRanges.GetParticipantCount();
+            if (initialized)
+            {
+                pool->mParallelRanges.ExecuteChunks(worker_index < participant_count ? worker_index : -1,
+                                                    pool->mParallelFunc, pool->mParallelUserData);
+            }
+            pool->mParallelWorkers.fetch_sub(1, std::memory_order_release);
+            continue;
+        }
+
+        if (job == nullptr)
+        {
+            // -- a null job and no shutdown is an idle timeout - update the worker context, to run any schedules
+            {
+                std::lock_guard<std::mutex> lock(pool->mJobLock);
+                if (pool->mShuttingDown && pool->mPendingHead == nullptr)
+                    break;
+            }
+
+            if (initialized)
+            {
+                uint32 elapsed_ms = (uint32)std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start_time).count();
+                UpdateContext(elapsed_ms);
+            }
+            continue;
+        }
+
+        // -- note:  once the result is set, a job without a callback may be released by the owner at any time
+        uint32 callback_hash = job->mCallbackHash;
+        CScriptContext* script_context = GetContext();
+        bool8 success = initialized && script_context->ExecuteThreadCommand(job->mCommand);
+        job->SetResult(script_context, success);
+        if (callback_hash != 0)
+            pool->CompleteJob(job);
+        else
+            pool->mActiveCount.fetch_sub(1, std::memory_order_release);
+    }
+
+    if (GetContext() != nullptr)
+        DestroyContext();
+}
+
+// ====================================================================================================================
+// InitializeWorker():  Creates the worker context, and executes the pool scripts
+// ====================================================================================================================
+bool8 CScriptWorkerPool::InitializeWorker(int32 worker_index)
+{
+    CScriptContext* script_context = CreateContext(mOwnerContext->GetPrintHandler(),
+                                                   mOwnerContext->GetAssertHandler(), false);
+    if (script_context == nullptr)
+        return (false);
+
+    for (int32 i = 0; i < mScriptCount; ++i)
+    {
+        if (!script_context->ExecScript(mScriptFiles[i], true, false))
+        {
+            TinPrint(script_context, "Error - worker %d unable to execute script: %s\n", worker_index,
+                     mScriptFiles[i]);
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
+// ====================================================================================================================
+// WaitForJob():  Returns the next pending job, or null on shutdown or after the idle timeout
+// -- a parallel loop the worker hasn't yet joined takes priority over the pending jobs
+// ====================================================================================================================
+CScriptJob* CScriptWorkerPool::WaitForJob(uint32 parallel_generation, bool8& out_join_parallel)
+{
+    std::unique_lock<std::mutex> lock(mJobLock);
+    mJobSignal.wait_for(lock, std::chrono::milliseconds(kWorkerPoolIdleUpdateMS), [this, parallel_generation]()
+    {
+        return (mPendingHead != nullptr || mShuttingDown ||
+                (mParallelActive && mParallelGeneration != parallel_generation));
+    });
+
+    out_join_parallel = mParallelActive && mParallelGeneration != parallel_generation;
+    if (out_join_parallel)
+    {
+        mParallelWorkers.fetch_add(1, std::memory_order_relaxed);
+        return (nullptr);
+    }
+
+    CScriptJob* job = mPendingHead;
+    if (job != nullptr)
+    {
+        mPendingHead = job->mNext;
+        if (mPendingHead == nullptr)
+            mPendingTail = nullptr;
+        job->mNext = nullptr;
+    }
+
+    return (job);
+}
+
+// ====================================================================================================================
+// CompleteJob():  Hands a job with a callback back to the owning thread
+// ====================================================================================================================
+void CScriptWorkerPool::CompleteJob(CScriptJob* job)
+{
+    std::lock_guard<std::mutex> lock(mCompletedLock);
+    job->mNext = mCompletedList;
+    mCompletedList = job;
+}
+
+// == class CParallelForPool ==========================================================================================
+
+CParallelForPool* CParallelForPool::gInstance = nullptr;
+
+// ====================================================================================================================
+// GetInstance():  Returns the pool, creating it on first use
+// ====================================================================================================================
+CParallelForPool* CParallelForPool::GetInstance()
+{
+    if (gInstance == nullptr)
+    {
+        // -- the calling thread participates, so the pool only needs one fewer thread than the hardware supports
+        int32 thread_count = (int32)std::thread::hardware_concurrency() - 1;
+        if (thread_count > kParallelForMaxThreads)
+            thread_count = kParallelForMaxThreads;
+        if (thread_count < 0)
+            thread_count = 0;
+
+        // -- the pool isn't owned by any context
+        gInstance = TinAllocShared(ALLOC_WorkerPool, CParallelForPool, thread_count);
+    }
+
+    return (gInstance);
+}
+
+// ====================================================================================================================
+// Shutdown():  Stops and joins the pool threads
+// ====================================================================================================================
+void CParallelForPool::Shutdown()
+{
+    if (gInstance != nullptr)
+    {
+        TinFree(gInstance);
+        gInstance = nullptr;
+    }
+}
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CParallelForPool::CParallelForPool(int32 thread_count)
+    : mThreadCount(thread_count)
+    , mGeneration(0)
+    , mJobActive(false)
+    , mShuttingDown(false)
+    , mFunc(nullptr)
+    , mUserData(nullptr)
+    , mActiveThreads(0)
+{
+    for (int32 i = 0; i < mThreadCount; ++i)
+        mThreads[i] = std::thread(PoolThread, this, i);
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+CParallelForPool::~CParallelForPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        mShuttingDown = true;
+    }
+    mJobSignal.notify_all();
+
+    for (int32 i = 0; i < mThreadCount; ++i)
+        mThreads[i].join();
+}
+
+// ====================================================================================================================
+// ParallelFor():  Executes the range in chunks, on the pool threads and the calling thread
+// ====================================================================================================================
+void CParallelForPool::ParallelFor(int32 count, int32 chunk_size, ParallelForFunc func, void* user_data)
+{
+    if (count <= 0 || func == nullptr)
+        return;
+
+    if (chunk_size < 1)
+        chunk_size = 1;
+
+    // -- not worth waking the pool for a single chunk
+    if (mThreadCount == 0 || count <= chunk_size)
+    {
+        func(user_data, 0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> parallel_lock(mParallelForLock);
+
+    // -- split the range evenly, the calling thread is the last participant
+    mRanges.Split(count, mThreadCount + 1, chunk_size);
+    int32 participant_count = mRanges.GetParticipantCount();
+
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        mFunc = func;
+        mUserData = user_data;
+        mJobActive = true;
+        ++mGeneration;
+    }
+    mJobSignal.notify_all();
+
+    mRanges.ExecuteChunks(participant_count - 1, func, user_data);
+
+    // -- the merge point:  wait for the chunks claimed by other threads to complete
+    while (!mRanges.IsComplete())
+        std::this_thread::yield();
+
+    // -- and for every thread to leave the loop, before the ranges are reused
+    {
+        std::lock_guard<std::mutex> lock(mJobLock);
+        mJobActive = false;
+    }
+    while (mActiveThreads.load(std::memory_order_acquire) > 0)
+        std::this_thread::yield();
+}
+
+// ====================================================================================================================
+// PoolThread():  The pool thread function - joins each loop, until shutdown
+// ====================================================================================================================
+void CParallelForPool::PoolThread(CParallelForPool* pool, int32 thread_index)
+{
+    uint32 generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(pool->mJobLock);
+            pool->mJobSignal.wait(lock, [pool, generation]()
+            {
+                return (pool->mShuttingDown || (pool->mJobActive && pool->mGeneration != generation));
+            });
+
+            if (pool->mShuttingDown)
+                break;
+
+            generation = pool->mGeneration;
+            pool->mActiveThreads.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // -- a thread without a range of its own (more threads than chunks) only steals
+        int32 participant_count = pool->mRanges.GetParticipantCount();
+        pool->mRanges.ExecuteChunks(thread_index < participant_count - 1 ? thread_index : -1, pool->mFunc,
+                                    pool->mUserData);
+        pool->mActiveThreads.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+// == class CWorkStealingRanges =======================================================================================
+
+// ====================================================================================================================
+// Constructor
+// ====================================================================================================================
+CWorkStealingRanges::CWorkStealingRanges()
+    : mParticipantCount(0)
+    , mChunkSize(1)
+    , mRemaining(0)
+{
+    for (int32 i = 0; i <= kParallelForMaxThreads; ++i)
+        mRanges[i].mRange.store(0, std::memory_order_relaxed);
+}
+
+// ====================================================================================================================
+// Split():  Splits [0, count) evenly, between no more participants than there are chunks
+// ====================================================================================================================
+void CWorkStealingRanges::Split(int32 count, int32 participant_count, int32 chunk_size)
+{
+    if (chunk_size < 1)
+        chunk_size = 1;
+
+    int32 chunk_count = (count + chunk_size - 1) / chunk_size;
+    if (participant_count > chunk_count)
+        participant_count = chunk_count;
+    if (participant_count > kParallelForMaxThreads + 1)
+        participant_count = kParallelForMaxThreads + 1;
+
+    for (int32 i = 0; i < participant_count; ++i)
+    {
+        uint64 begin = (uint64)(((int64)count * i) / participant_count);
+        uint64 end = (uint64)(((int64)count * (i + 1)) / participant_count);
+        mRanges[i].mRange.store((end << 32) | begin, std::memory_order_relaxed);
+    }
+
+    mParticipantCount = participant_count;
+    mChunkSize = chunk_size;
+    mRemaining.store(count, std::memory_order_release);
+}
+
+// ====================================================================================================================
+// ExecuteChunks():  Consumes the participant's own range, then steals from the others, until every range is empty
+// ====================================================================================================================
+void CWorkStealingRanges::ExecuteChunks(int32 participant_index, ParallelForFunc func, void* user_data)
+{
+    int32 begin = 0;
+    int32 end = 0;
+    while (true)
+    {
+        bool8 claimed = (participant_index >= 0 && ClaimFront(participant_index, begin, end)) ||
+                        StealBack(participant_index, begin, end);
+        if (!claimed)
+            break;
+
+        func(user_data, begin, end);
+        mRemaining.fetch_sub(end - begin, std::memory_order_release);
+    }
+}
+
+// ====================================================================================================================
+// ClaimFront():  Claims the next chunk from the front of the participant's own range
+// ====================================================================================================================
+bool8 CWorkStealingRanges::ClaimFront(int32 participant_index, int32& begin, int32& end)
+{
+    std::atomic<uint64>& range = mRanges[participant_index].mRange;
+    uint64 current = range.load(std::memory_order_acquire);
+    while (true)
+    {
+        uint32 range_begin = (uint32)(current & 0xffffffff);
+        uint32 range_end = (uint32)(current >> 32);
+        if (range_begin >= range_end)
+            return (false);
+
+        uint32 chunk_end = range_end - range_begin > (uint32)mChunkSize ? range_begin + mChunkSize : range_end;
+        uint64 claimed = ((uint64)range_end << 32) | chunk_end;
+        if (range.compare_exchange_weak(current, claimed, std::memory_order_acq_rel))
+        {
+            begin = (int32)range_begin;
+            end = (int32)chunk_end;
+            return (true);
+        }
+    }
+}
+
+// ====================================================================================================================
+// StealBack():  Claims a chunk from the back of another participant's range
+// ====================================================================================================================
+bool8 CWorkStealingRanges::StealBack(int32 participant_index, int32& begin, int32& end)
+{
+    for (int32 i = 0; i < mParticipantCount; ++i)
+    {
+        if (i == participant_index)
+            continue;
+
+        std::atomic<uint64>& range = mRanges[i].mRange;
+        uint64 current = range.load(std::memory_order_acquire);
+        while (true)
+        {
+            uint32 range_begin = (uint32)(current & 0xffffffff);
+            uint32 range_end = (uint32)(current >> 32);
+            if (range_begin >= range_end)
+                break;
+
+            uint32 chunk_begin = range_end - range_begin > (uint32)mChunkSize ? range_end - mChunkSize : range_begin;
+            uint64 claimed = ((uint64)chunk_begin << 32) | range_begin;
+            if (range.compare_exchange_weak(current, claimed, std::memory_order_acq_rel))
+            {
+                begin = (int32)chunk_begin;
+                end = (int32)range_end;
+                return (true);
+            }
+        }
+    }
+
+    return (false);
+}
+
+} // TinScript
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
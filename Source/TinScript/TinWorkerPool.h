@@ -0,0 +1,268 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// TinWorkerPool.h
+// A pool of worker threads, each owning its own script context, executing script functions as jobs
+// ====================================================================================================================
+
+#ifndef __TINWORKERPOOL_H
+#define __TINWORKERPOOL_H
+
+// -- includes --------------------------------------------------------------------------------------------------------
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "integration.h"
+#include "TinTypes.h"
+#include "TinThreadQueue.h"
+
+// == namespace TinScript =============================================================================================
+
+namespace TinScript
+{
+
+class CScriptContext;
+class CScriptWorkerPool;
+
+// -- the body of a data parallel loop, called for each chunk [begin, end) of the range
+typedef void (*ParallelForFunc)(void* user_data, int32 begin, int32 end);
+
+// ====================================================================================================================
+// class CWorkStealingRanges:  A range split evenly between the participants of a parallel loop.
+// -- each participant consumes its own range from the front, one chunk at a time - once empty, it steals chunks from
+// the back of the other ranges
+// ====================================================================================================================
+class CWorkStealingRanges
+{
+    public:
+        CWorkStealingRanges();
+
+        // -- only while no participant is executing chunks
+        void Split(int32 count, int32 participant_count, int32 chunk_size);
+
+        // -- returns once every range is empty - a participant index of -1 (no range of its own) only steals
+        void ExecuteChunks(int32 participant_index, ParallelForFunc func, void* user_data);
+
+        int32 GetParticipantCount() const { return (mParticipantCount); }
+
+        // -- true once every chunk has been executed, including those claimed by other participants
+        bool8 IsComplete() const { return (mRemaining.load(std::memory_order_acquire) <= 0); }
+
+    private:
+        bool8 ClaimFront(int32 participant_index, int32& begin, int32& end);
+        bool8 StealBack(int32 participant_index, int32& begin, int32& end);
+
+        // -- each participant's remaining range, packed as (end << 32) | begin, so both the owner (front) and
+        // thieves (back) claim chunks with a single CAS
+        struct tRange
+        {
+            std::atomic<uint64> mRange;
+            char mPadding[kCacheLineSize - sizeof(std::atomic<uint64>)];
+        };
+        tRange mRanges[kParallelForMaxThreads + 1];
+        int32 mParticipantCount;
+        int32 mChunkSize;
+
+        std::atomic<int32> mRemaining;
+};
+
+// ====================================================================================================================
+// class CScriptJob:  A function call submitted to the worker pool, and the future holding its result.
+// -- the result is copied out of the worker context (strings included), so it's valid on the submitting thread
+// ====================================================================================================================
+class CScriptJob
+{
+    public:
+        enum eJobState
+        {
+            eJobPending,
+            eJobComplete,
+            eJobFailed,
+        };
+
+        CScriptJob(const CThreadCommand& command, uint32 job_id, uint32 callback_hash);
+
+        uint32 GetJobID() const { return (mJobID); }
+
+        // -- any thread may poll, the result is only valid once the job is no longer pending
+        bool8 IsComplete() const { return (mState.load(std::memory_order_acquire) != eJobPending); }
+        bool8 Succeeded() const { return (mState.load(std::memory_order_acquire) == eJobComplete); }
+
+        // -- for TYPE_string, the address is the const char*, otherwise the address of the value
+        // -- a function returning void (or a hashtable) has a result type of TYPE_NULL, and a null address
+        // -- note:  an object result is the object ID within the worker context
+        eVarType GetResultType() const { return (mResultType); }
+        void* GetResultAddr();
+
+    private:
+        friend class CScriptWorkerPool;
+
+        void SetResult(CScriptContext* script_context, bool8 success);
+
+        CThreadCommand mCommand;
+        uint32 mJobID;
+        uint32 mCallbackHash;
+        std::atomic<int32> mState;
+
+        eVarType mResultType;
+        uint32 mResultValue[MAX_TYPE_SIZE];
+        char mResultString[kMaxArgLength];
+
+        // -- linked through the pending queue, and again through the completed list
+        CScriptJob* mNext;
+};
+
+// ====================================================================================================================
+// class CScriptWorkerPool:  Owns a set of worker threads, each with its own (non main thread) script context.
+// -- every worker executes the same list of scripts at startup, so any job can be executed by any worker
+// -- jobs are submitted from the thread that created the pool, and results are collected during that
+// thread's UpdateContext(), where the optional callback is executed in the submitting context
+// ====================================================================================================================
+class CScriptWorkerPool
+{
+    public:
+        // -- the scripts are executed by each worker in turn, before the next worker is started,
+        // so only the first worker ever compiles a stale script, and the rest share its compiled image
+        CScriptWorkerPool(int32 worker_count, const char** script_files, int32 script_count);
+        ~CScriptWorkerPool();
+
+        int32 GetWorkerCount() const { return (mWorkerCount); }
+
+        // -- returns the job (the future), or null if the pool is shutting down
+        // -- the callback, if given, is executed as:  callback(int job_id, bool success, <result>)
+        // -- a job submitted with a callback is released after its callback, so the pointer must not be kept,
+        // -- otherwise the caller owns the job, and must Release() it once complete
+        CScriptJob* Submit(const CThreadCommand& command, uint32 callback_hash = 0);
+        void Release(CScriptJob* job);
+
+        // -- called from the owning context's Update() - executes the callbacks for completed jobs
+        void Update();
+
+        // -- jobs not yet complete, or still waiting for their callback
+        int32 GetActiveCount() const { return (mActiveCount.load(std::memory_order_acquire)); }
+
+        // -- calls func(user_data, begin, end) for chunks covering [0, count), on the workers, each executing within
+        // its own worker context - the ranges are split evenly between the workers, and a worker busy with a job
+        // has its range stolen by the others
+        // -- called only by the owning thread, and returns once every chunk has been executed (the merge point) -
+        // if no worker initialized successfully, no chunk is executed
+        void ParallelFor(int32 count, int32 chunk_size, ParallelForFunc func, void* user_data);
+
+    private:
+        static void WorkerThread(CScriptWorkerPool* pool, int32 worker_index);
+        bool8 InitializeWorker(int32 worker_index);
+        CScriptJob* WaitForJob(uint32 parallel_generation, bool8& out_join_parallel);
+        void CompleteJob(CScriptJob* job);
+
+        CScriptContext* mOwnerContext;
+        int32 mWorkerCount;
+        std::thread mThreads[kWorkerPoolMaxThreads];
+
+        const char** mScriptFiles;
+        int32 mScriptCount;
+
+        // -- startup is serialized, one worker at a time
+        std::mutex mStartupLock;
+        std::condition_variable mStartupSignal;
+        int32 mStartedCount;
+        int32 mInitializedCount;
+
+        // -- pending jobs are a FIFO, shared by all workers
+        std::mutex mJobLock;
+        std::condition_variable mJobSignal;
+        CScriptJob* mPendingHead;
+        CScriptJob* mPendingTail;
+        bool8 mShuttingDown;
+
+        // -- completed jobs are collected by the owning thread
+        std::mutex mCompletedLock;
+        CScriptJob* mCompletedList;
+
+        uint32 mNextJobID;
+        std::atomic<int32> mActiveCount;
+
+        // -- the current parallel loop - workers join it when the generation changes (guarded by the job lock)
+        CWorkStealingRanges mParallelRanges;
+        ParallelForFunc mParallelFunc;
+        void* mParallelUserData;
+        uint32 mParallelGeneration;
+        bool8 mParallelActive;
+        std::atomic<int32> mParallelWorkers;
+};
+
+// ====================================================================================================================
+// class CParallelForPool:  A process-wide pool of plain threads (no script context), for data parallel loops.
+// -- the range is split between the participants (the calling thread included), as CWorkStealingRanges
+// -- ParallelFor() is the merge point:  it returns only once every chunk has been executed
+// ====================================================================================================================
+class CParallelForPool
+{
+    public:
+        // -- the pool is created on first use, and shut down with the main thread context
+        static CParallelForPool* GetInstance();
+        static void Shutdown();
+
+        int32 GetThreadCount() const { return (mThreadCount); }
+
+        // -- calls func(user_data, begin, end) for chunks covering [0, count), concurrently
+        // -- func must be thread safe, and must not touch any script context
+        void ParallelFor(int32 count, int32 chunk_size, ParallelForFunc func, void* user_data);
+
+    private:
+        friend class CMemoryTracker;
+        CParallelForPool(int32 thread_count);
+        ~CParallelForPool();
+
+        static void PoolThread(CParallelForPool* pool, int32 thread_index);
+
+        int32 mThreadCount;
+        std::thread mThreads[kParallelForMaxThreads];
+
+        // -- one loop executes at a time
+        std::mutex mParallelForLock;
+
+        // -- the threads wait for the generation to change, to join the current loop
+        std::mutex mJobLock;
+        std::condition_variable mJobSignal;
+        uint32 mGeneration;
+        bool8 mJobActive;
+        bool8 mShuttingDown;
+
+        ParallelForFunc mFunc;
+        void* mUserData;
+
+        CWorkStealingRanges mRanges;
+        std::atomic<int32> mActiveThreads;
+
+        static CParallelForPool* gInstance;
+};
+
+} // TinScript
+
+#endif // __TINWORKERPOOL_H
+
+// ====================================================================================================================
+// eof
+// ====================================================================================================================
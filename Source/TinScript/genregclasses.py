@@ -290,10 +290,10 @@ def GenerateClasses(maxparamcount, outputfilename):
         outputfile.write("    virtual bool Register() {\n");
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n");
         i = 1;
         while (i <= paramcount):
-            outputfile.write("        success = fc->AddParameter(\"_p%d\", TinScript::Hash(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
+            outputfile.write("        success = fc->AddParameter(\"_p%d\", HashLiteral_(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
             i = i + 1;
         outputfile.write("        return (success);\n");
         outputfile.write("    }\n");
@@ -398,10 +398,10 @@ def GenerateClasses(maxparamcount, outputfilename):
         outputfile.write("    virtual bool Register() {\n");
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
         i = 1;
         while (i <= paramcount):
-            outputfile.write("        success = fc->AddParameter(\"_p%d\", TinScript::Hash(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
+            outputfile.write("        success = fc->AddParameter(\"_p%d\", HashLiteral_(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
             i = i + 1;
         outputfile.write("\n");
         outputfile.write("        return (success);\n");
@@ -497,10 +497,10 @@ def GenerateClasses(maxparamcount, outputfilename):
         outputfile.write("    virtual bool Register() {\n");
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n");
         i = 1;
         while (i <= paramcount):
-            outputfile.write("        success = fc->AddParameter(\"_p%d\", TinScript::Hash(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
+            outputfile.write("        success = fc->AddParameter(\"_p%d\", HashLiteral_(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
             i = i + 1;
         outputfile.write("\n");
         outputfile.write("        return (success);\n");
@@ -599,10 +599,10 @@ def GenerateClasses(maxparamcount, outputfilename):
         outputfile.write("    virtual bool Register() {\n");
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
         i = 1;
         while (i <= paramcount):
-            outputfile.write("        success = fc->AddParameter(\"_p%d\", TinScript::Hash(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
+            outputfile.write("        success = fc->AddParameter(\"_p%d\", HashLiteral_(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
             i = i + 1;
         outputfile.write("\n");
         outputfile.write("        return (success);\n");
@@ -693,6 +693,58 @@ def GenerateDefaultArgs(maxparamcount, outputfilename):
 
     outputfile.close();
 
+# -----------------------------------------------------------------------------
+# -----------------------------------------------------------------------------
+# -- the stack dispatch converts each argument directly from the values popped from the exec stack,
+# -- and pushes the typed return value, bypassing the function context parameters entirely
+def OutputDispatchFromStack(outputfile, paramcount, has_return, is_method = False):
+    outputfile.write("    // -- virtual DispatchFromStack wrapper\n");
+    outputfile.write("    virtual bool HasStackDispatch() const { return (true); }\n");
+    if (is_method):
+        outputfile.write("    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)\n    {\n");
+    else:
+        outputfile.write("    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)\n    {\n");
+
+    i = 1;
+    while (i <= paramcount):
+        outputfile.write("        using T%d = typename std::tuple_element<%d, argument_types>::type;\n" % (i, i - 1));
+        i = i + 1;
+    if (paramcount > 0):
+        outputfile.write("\n");
+
+    i = 1;
+    while (i <= paramcount):
+        outputfile.write("        T%d p%d = TinScript::ConvertStackArgForDispatch<T%d>(args[%d]);\n" % (i, i, i, i - 1));
+        i = i + 1;
+    if (paramcount > 0):
+        outputfile.write("\n");
+
+    if (is_method):
+        outputfile.write("        C* object = (C*)(objaddr);\n");
+        callee = "(object->*methodptr)(";
+    else:
+        callee = "funcptr(";
+    if (has_return):
+        functioncall = "        R r = " + callee;
+    else:
+        functioncall = "        " + callee;
+    i = 1;
+    while (i <= paramcount):
+        if (i > 1):
+            functioncall = functioncall + ", ";
+        functioncall = functioncall + "p%d" % i;
+        i = i + 1;
+    functioncall = functioncall + ");\n";
+    outputfile.write(functioncall);
+
+    if (has_return):
+        outputfile.write("        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));\n");
+    else:
+        outputfile.write("        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);\n");
+    outputfile.write("        return (true);\n");
+    outputfile.write("    }\n");
+    outputfile.write("\n");
+
 # -----------------------------------------------------------------------------
 def GenerateVariadicClasses(maxparamcount, outputfilename):
     print("GenerateVariadicClasses - Output: %s" % outputfilename);
@@ -709,12 +761,22 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
     outputfile.write("\n\n");
 
     outputfile.write('#pragma once\n\n');
+    outputfile.write('#include <type_traits>\n\n');
 
     outputfile.write('#define REGISTER_FUNCTION(name, funcptr) \\\n');
     outputfile.write('    static const int gArgCount_##name = SignatureArgCount<decltype(funcptr)>::arg_count; \\\n');
     outputfile.write('    static CRegisterFunction<gArgCount_##name, decltype(funcptr)> _reg_##name(#name, funcptr);\n');
     outputfile.write("\n");
 
+    outputfile.write('// -- an async function returns the pending handle from CScriptContext::AsyncBegin() - the calling script is suspended\n');
+    outputfile.write('// until the handle is completed (from any thread), and receives the completion value as the function\'s result\n');
+    outputfile.write('#define REGISTER_ASYNC_FUNCTION(name, funcptr) \\\n');
+    outputfile.write('    static_assert(std::is_same<SignatureArgCount<decltype(funcptr)>::return_type, int32>::value, \\\n');
+    outputfile.write('                  "Error - an async function must return its int32 handle"); \\\n');
+    outputfile.write('    REGISTER_FUNCTION(name, funcptr) \\\n');
+    outputfile.write('    static const bool gIsAsync_##name = _reg_##name.SetAsync();\n');
+    outputfile.write("\n");
+
     outputfile.write("#if !PLATFORM_VS_2019\n");
     outputfile.write('    #define REGISTER_METHOD(classname, name, methodptr) \\\n');
     outputfile.write('        static const int gArgCount_##classname##_##name = SignatureArgCount<decltype(std::declval<classname>().methodptr)>::arg_count; \\\n');
@@ -725,6 +787,13 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
     outputfile.write('        static CRegisterMethod<gArgCount_##classname##_##name, classname, decltype(&classname::methodptr)> _reg_##classname##_##name(#name, &classname::methodptr);\n');
     outputfile.write("#endif\n");
 
+    outputfile.write('// -- a thread safe method may be dispatched from any thread (e.g. by CObjectSet::ParallelForEachNative()), without a\n');
+    outputfile.write('// script context - it must only read shared state, or modify its own object, and must not call into script\n');
+    outputfile.write('#define REGISTER_THREADSAFE_METHOD(classname, name, methodptr) \\\n');
+    outputfile.write('    REGISTER_METHOD(classname, name, methodptr) \\\n');
+    outputfile.write('    static const bool gIsThreadSafe_##classname##_##name = _reg_##classname##_##name.SetThreadSafe();\n');
+    outputfile.write("\n");
+
     outputfile.write('#define REGISTER_CLASS_FUNCTION(classname, name, methodptr) \\\n');
     outputfile.write('    static const int gArgCount_##classname##_##name = SignatureArgCount<decltype(std::declval<classname>().methodptr)>::arg_count; \\\n');
     outputfile.write('    static CRegisterFunction<gArgCount_##classname##_##name, decltype(std::declval<classname>().methodptr)> _reg_##classname##_##name(#name, &classname::methodptr); \\\n');
@@ -738,6 +807,7 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
     outputfile.write('{\n');
     outputfile.write('    public:\n');
     outputfile.write('        static const int arg_count = sizeof...(Args);\n');
+    outputfile.write('        typedef R return_type;\n');
     outputfile.write('};\n\n');
 
     outputfile.write('template<typename S>\n');
@@ -822,6 +892,8 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
         outputfile.write("    }\n");
         outputfile.write("\n");
 
+        OutputDispatchFromStack(outputfile, paramcount, True);
+
         outputfile.write("    // -- dispatch method\n");
         dispatch_string = "    R Dispatch(";
         i = 1;
@@ -877,10 +949,10 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
 
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n");
         i = 1;
         while (i <= paramcount):
-            outputfile.write("        success = fc->AddParameter(\"_p%d\", TinScript::Hash(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
+            outputfile.write("        success = fc->AddParameter(\"_p%d\", HashLiteral_(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
             i = i + 1;
         outputfile.write("\n");
         outputfile.write("        return (success);\n");
@@ -948,6 +1020,8 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
         outputfile.write("    }\n");
         outputfile.write("\n");
 
+        OutputDispatchFromStack(outputfile, paramcount, False);
+
         outputfile.write("    // -- dispatch method\n");
         dispatch_string = "    void Dispatch(";
         i = 1;
@@ -999,10 +1073,10 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
 
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
         i = 1;
         while (i <= paramcount):
-            outputfile.write("        success = fc->AddParameter(\"_p%d\", TinScript::Hash(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
+            outputfile.write("        success = fc->AddParameter(\"_p%d\", HashLiteral_(\"_p%d\"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n" % (i, i, i, i));
             i = i + 1;
         if (paramcount > 0):
             outputfile.write("\n");
@@ -1070,6 +1144,7 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
         outputfile.write(dispatch_string);
         outputfile.write('    }\n\n');
 
+        OutputDispatchFromStack(outputfile, paramcount, True, True);
 
         outputfile.write('    // -- dispatch method\n');
 
@@ -1129,11 +1204,11 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
 
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write('        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n');
+        outputfile.write('        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;\n');
 
         i = 1;
         while (i <= paramcount):
-            outputfile.write('        success = fc->AddParameter("_p%d", TinScript::Hash("_p%d"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n' % (i, i, i, i));
+            outputfile.write('        success = fc->AddParameter("_p%d", HashLiteral_("_p%d"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n' % (i, i, i, i));
             i = i + 1;
         if (paramcount > 0):
             outputfile.write("\n");
@@ -1201,6 +1276,8 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
         outputfile.write(dispatch_string);
         outputfile.write('    }\n\n');
 
+        OutputDispatchFromStack(outputfile, paramcount, False, True);
+
         outputfile.write('    // -- dispatch method\n');
 
         dispatch_string = "    void Dispatch(void* objaddr";
@@ -1255,11 +1332,11 @@ def GenerateVariadicClasses(maxparamcount, outputfilename):
         outputfile.write('\n');
         outputfile.write("        TinScript::CFunctionContext* fc = CreateContext();\n");
         outputfile.write("        bool success = true;\n");
-        outputfile.write("        success = fc->AddParameter(\"__return\", TinScript::Hash(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
+        outputfile.write("        success = fc->AddParameter(\"__return\", HashLiteral_(\"__return\"), TinScript::TYPE_void, 1, 0) && success;\n");
 
         i = 1;
         while (i <= paramcount):
-            outputfile.write('        success = fc->AddParameter("_p%d", TinScript::Hash("_p%d"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n' % (i, i, i, i));
+            outputfile.write('        success = fc->AddParameter("_p%d", HashLiteral_("_p%d"), TinScript::GetRegisteredType(TinScript::GetTypeID<T%d>()), 1, TinScript::GetTypeID<T%d>()) && success;\n' % (i, i, i, i));
             i = i + 1;
         if (paramcount > 0):
             outputfile.write("\n");
@@ -1456,7 +1533,7 @@ def GenerateExecs(maxparamcount, outputfilename):
         outputfile.write("    if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])\n");
         outputfile.write("        return false;\n\n");
 
-        call_string = "    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name)"
+        call_string = "    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name)"
         i = 1;
         while (i <= paramcount):
             call_string = call_string + ", p%d" % i;
@@ -1520,7 +1597,7 @@ def GenerateExecs(maxparamcount, outputfilename):
         outputfile.write('        ScriptAssert_(script_context, 0, "<internal>", -1, "Error - object not registered: 0x%x\\n", kPointerToUInt32(obj_addr));\n');
         outputfile.write("        return false;\n");
         outputfile.write("    }\n\n");
-        call_string = "    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name)"
+        call_string = "    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name)"
         i = 1;
         while (i <= paramcount):
             call_string = call_string + ", p%d" % i;
@@ -1610,7 +1687,7 @@ def GenerateExecs(maxparamcount, outputfilename):
         outputfile.write("    CScriptContext* script_context = TinScript::GetContext();\n");
         outputfile.write("    if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])\n");
         outputfile.write("        return false;\n\n");
-        call_string = "    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name)"
+        call_string = "    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name)"
         i = 1;
         while (i <= paramcount):
             call_string = call_string + ", p%d" % i;
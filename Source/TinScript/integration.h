@@ -32,17 +32,63 @@
 #include <new>
 #include <cstdint>
 
+// -- other compilers (e.g. gcc on Linux) are given the few MSVC secure CRT calls (and intrinsics) used
+#if !defined(_MSC_VER)
+    #include <cstdarg>
+    #include <cstdio>
+    #include <cstring>
+    #include <strings.h>
+
+    #define _stricmp strcasecmp
+    #define _strnicmp strncasecmp
+    #define sscanf_s sscanf
+    #define __debugbreak() __builtin_trap()
+
+    inline int vsprintf_s(char* buffer, size_t size, const char* format, va_list args)
+    {
+        return (vsnprintf(buffer, size, format, args));
+    }
+
+    inline int fopen_s(FILE** file, const char* filename, const char* mode)
+    {
+        *file = fopen(filename, mode);
+        return (*file != nullptr ? 0 : 1);
+    }
+
+    inline int strncpy_s(char* dest, size_t size, const char* src, size_t count)
+    {
+        size_t length = strnlen(src, count);
+        if (length >= size)
+            length = size - 1;
+        memcpy(dest, src, length);
+        dest[length] = '\0';
+        return (0);
+    }
+
+    template <size_t size>
+    inline int strncpy_s(char (&dest)[size], const char* src, size_t count)
+    {
+        return (strncpy_s(dest, size, src, count));
+    }
+#endif
+
 // -- The stack size is a limiting factor, if TinScript is to be used for any recursive scripting.
 // -- Highly recommended to avoid this, as there are no optimizations (such as tail-end recursion)
 // -- Testing with the implementation of Fibonacci(nth) found in unittest.ts, The maximum
 // -- depth with the default stack is Fibonacci(12).
 // -- Setting a stack size of 4Mb, Fibonacci(30) was successful, but prohibitively slow.
-#pragma comment(linker, "/STACK:4000000")
+#if defined(_MSC_VER)
+    #pragma comment(linker, "/STACK:4000000")
+#endif
 
 // -- takes more storage obviously, but will enable "Show Object Origin" for the callstack
 // of where an object was constructed, as well, as memory telemetry methods (MemoryDumpTotals(), etc..)
 #define MEMORY_TRACKER_ENABLE 1
 
+// -- every allocation header records its allocator's generation, and a free from another thread is verified against
+// the allocators still live - asserts on a free after the owning context was destroyed (use TinAllocShared() instead)
+#define MEMORY_CHECK_REMOTE_FREE 1
+
 // -- define whether we're 64-bit
 // note:  not overly robust, as otherwise, we force 32-bit
 // -- until we actually port TinScript to other platforms,
@@ -88,9 +134,6 @@
 // be logged
 #define LOG_FUNCTION_EXEC 0
 
-// -- enable the use of string pools, for smaller string, for less fragmentation
-#define STRING_TABLE_USE_POOLS 1
-
 // -- we can check whether a script has been modified, and notify when it needs to be recompiled
 #define NOTIFY_SCRIPTS_MODIFIED 1
 
@@ -98,6 +141,10 @@
 // (detecting infinite loops)
 #define VM_DETECT_INFINITE_LOOP 1
 
+// -- the vector3f/vector4f/quat types use SSE (x86/x64) or NEON (AArch64) where available - see mathsimd.h
+// -- disabling this forces the scalar implementation on every platform
+#define TIN_SIMD_ENABLE 1
+
 // ------------------------------------------------------------------------------------------------
 // -- TYPES
 // ------------------------------------------------------------------------------------------------
@@ -134,7 +181,11 @@ typedef float               float32;
     #define kPointer64LowerUInt32(a) ((uint32)(((uint64)a) & 0xffffffff))
 #endif
 
-#define Unused_(var) __pragma(warning(suppress:4100)) var
+#if defined(_MSC_VER)
+    #define Unused_(var) __pragma(warning(suppress:4100)) var
+#else
+    #define Unused_(var) (void)(var)
+#endif
 #define Offsetof_(s,m) (uint32)(unsigned long long)&(((s *)0)->m)
 
 #define Assert_(condition) assert(condition)
@@ -144,7 +195,12 @@ typedef float               float32;
 // ====================================================================================================================
 
 // -- 05/12 reworked the "stack top reserve", asserting if we ever pop into local var space
-const int32 kCompilerVersion = 18;
+// -- added OP_FuncCallNative, dispatching registered functions directly from the exec stack
+// -- added OP_PushMemberOffset/OP_PushMemberOffsetVal, object member access through a per-site cache
+// -- added the typed vector operations OP_VectorAdd/Sub/Mult/Div, and the vector4f and quat types
+// -- OP_ScheduleBegin's operand carries the schedule priority class, as well as the immediate flag
+// -- added OP_Wait, suspending a scheduled function as a coroutine (wait() and yield)
+const int32 kCompilerVersion = 23;
 
 const int32 kMaxNameLength = 256;
 const int32 kMaxTokenLength = 2048;
@@ -161,6 +217,14 @@ const int32 kScriptContextThreadSize = 7;
 
 const int32 kDebuggerCallstackSize = 32;
 const int32 kDebuggerWatchWindowSize = 128;
+
+// -- object notifications are sent to the debugger in batches, each update, within the bandwidth (bytes per second)
+// -- object members are sent in blocks of up to kDebuggerMemberBlockMaxRows, and no packet exceeds the socket's
+// max packet size
+const int32 kDebuggerDefaultBandwidth = 1024 * 1024;
+const int32 kDebuggerMemberBlockMaxRows = 64;
+const int32 kDebuggerPacketMaxSize = 1024;
+const int32 kDebuggerSyncTableSize = 251;
 const int32 kBreakpointTableSize = 17;
 
 const int32 kGlobalFuncTableSize = 251;
@@ -172,6 +236,7 @@ const int32 kLocalVarTableSize = 17;
 const int32 kExecStackSize = 4096;
 const int32 kExecFuncCallDepth = 2048;
 const int32 kExecFuncCallMaxLocalObjects = 32;
+const int32 kMemberCacheInitialSize = 16;
 
 const int32 kExecBranchMaxLoopCount = 1000000;
 
@@ -187,27 +252,77 @@ const int32 kExecBranchMaxLoopCount = 1000000;
 
 const int32 kExecAssertStackDepth = 5;
 
-const int32 kStringTableSize = 512 * 1024;
-const int32 kStringTableDictionarySize = 1553;
+// -- string table pools allocate slabs of (at least) this size, and unreferenced strings are removed
+// -- within this budget (microseconds) each frame
+const int32 kStringTableSlabSize = 16 * 1024;
+const int32 kStringTableRemoveBudget = 500;
+
+// -- unreferenced strings (e.g. intermediate values) are also removed at a loop's back edge, once there are this many
+const int32 kStringTableTransientReclaimCount = 256;
+
+// -- by default, the scheduler dispatches every due command each frame - given a frame budget (microseconds),
+// commands over budget are carried over to the next frame, but never deferred for more than this many frames
+const int32 kScheduleDefaultFrameBudget = 0;
+const int32 kScheduleMaxDeferralFrames = 8;
+
+// -- suspended coroutines are kept in a heap ordered by wake time, grown (doubled) from this capacity
+const int32 kCoroutineHeapInitialSize = 256;
+
+// -- coroutines suspended by an async function call are looked up by handle when completed
+const int32 kAsyncWaitTableSize = 67;
+
+// -- registered string builders start with this capacity, and double as needed
+const int32 kStringBuilderInitialSize = 64;
+
+// -- the string table index is open addressed, and must be a power of 2 - it's grown as needed
+const int32 kStringTableIndexSize = 32 * 1024;
+
+// -- the shared string table's first index level (a power of 2) - a string is added to the next level (twice the size)
+// once this many slots from its hash slot are taken, and strings are packed into chunks of (at least) this size
+const int32 kSharedStringTableIndexSize = 4 * 1024;
+const int32 kSharedStringTableMaxProbe = 16;
+const int32 kSharedStringTableChunkSize = 16 * 1024;
 
 const int32 kObjectTableSize = 10007;
 
-const int32 kMasterMembershipTableSize = 97;
-const int32 kObjectGroupTableSize = 17;
+// -- object sets are dense arrays, grown (doubled) from this initial size
+const int32 kObjectGroupTableSize = 16;
 const int32 kHashTableIteratorTableSize = 7;
 
 const int32 kMaxScratchBuffers = 32;
 
+// -- object instances and object entries are allocated from pools, a slab of this many elements at a time
+const int32 kMemoryPoolSlabCount = 64;
+
+// -- each context allocator serves TinAlloc() requests up to this size from size class pools (powers of 2)
+const int32 kMemoryPoolMinBlockSize = 32;
+const int32 kMemoryPoolMaxBlockSize = 2048;
+
 const int32 kThreadExecBufferSize = 32 * 1024;
 
-// -- we're using pools for strings of size 16, 32, 64 and 128
-// -- here we're defining the number in each pool... the total memory
-// -- for each is the count * string size (not including the count x sizeof(StringEntry))
-// -- e.g.  if we have 2048 strings of size 16, then our mem usage for
-// that pool is 32Kb + 2048 * sizeof(tStringEntry)
-// note:  ensure if we change the number of pools in the enum eStringPool,
-// we update the counts array here, to match
-const int32 kStringPoolSizesCount[4] = { 8192, 4096, 1024, 512 };
+// -- typed thread commands are posted to a lock-free ring (the size must be a power of 2),
+// and each context update executes at most kThreadCommandProcessMax of them
+const int32 kThreadCommandQueueSize = 4096;
+const int32 kThreadCommandProcessMax = 1024;
+const int32 kThreadCommandMaxParams = 8;
+const int32 kThreadCommandStringSize = 128;
+
+// -- worker pool threads, each owning a script context, update their context when idle for this long
+const int32 kWorkerPoolMaxThreads = 16;
+const int32 kWorkerPoolIdleUpdateMS = 16;
+
+// -- parallel loops (e.g. CObjectSet::ParallelForEachNative()) are split into chunks, executed by a pool of threads
+const int32 kParallelForMaxThreads = 16;
+const int32 kParallelForChunkSize = 64;
+
+// -- CObjectSet::ParallelForEach() executes each member's method on a copy within a worker context - the copy's
+// namespace hierarchy is linked up to this depth, and up to this many members added by the method are copied back
+const int32 kParallelForEachMaxNamespaces = 8;
+const int32 kParallelForEachNewMembers = 8;
+const int32 kParallelForEachChunkSize = 16;
+
+// -- used to keep data written by different threads from sharing a cache line
+const int32 kCacheLineSize = 64;
 
 // -- we need to throttle the socket send/recv packet count, or the debugger
 // will become unresponsive if flooded
@@ -236,9 +351,13 @@ const int32 kSocketPacketProcessMax = 64;
     AllocTypeEntry(ObjEntry)        \
     AllocTypeEntry(Namespace)       \
     AllocTypeEntry(SchedCmd)        \
+    AllocTypeEntry(Coroutine)       \
     AllocTypeEntry(FuncCallEntry)   \
     AllocTypeEntry(CreateObj)       \
     AllocTypeEntry(StringTable)     \
+    AllocTypeEntry(StringBuilder)   \
+    AllocTypeEntry(ThreadQueue)     \
+    AllocTypeEntry(WorkerPool)      \
     AllocTypeEntry(ObjectGroup)     \
     AllocTypeEntry(FileBuf)         \
     AllocTypeEntry(Debugger)        \
@@ -267,29 +386,28 @@ namespace TinScript
 #define TinAlloc(alloctype, T, ...) \
     new (reinterpret_cast<T*>(TinScript::CMemoryTracker::Alloc(alloctype, sizeof(T)))) T(__VA_ARGS__);
 
+// -- memory is owned by the context allocator, so we destruct in place and return it through the tracker
 #define TinFree(addr)                                           \
     {                                                           \
-        if (addr != nullptr)                                    \
-        {                                                       \
-            void* notify_addr = (void*)addr;                    \
-            TinScript::CMemoryTracker::Free(notify_addr);       \
-            delete addr;                                        \
-        }                                                       \
+        TinScript::CMemoryTracker::Destroy(addr);               \
     }
 
 #define TinAllocArray(alloctype, T, size) \
-        new (reinterpret_cast<T*>(TinScript::CMemoryTracker::Alloc(alloctype, sizeof(T) * size))) T[size];
+        new (reinterpret_cast<T*>(TinScript::CMemoryTracker::Alloc(alloctype, sizeof(T) * (size)))) T[(size)];
 
 #define TinFreeArray(addr)                                      \
     {                                                           \
-        if (addr != nullptr)                                    \
-        {                                                       \
-            void* notify_addr = (void*)addr;                    \
-            TinScript::CMemoryTracker::Free(notify_addr);       \
-            delete[] addr;                                      \
-        }                                                       \
+        TinScript::CMemoryTracker::DestroyArray(addr);          \
     }
 
+// -- shared allocations come from the heap, rather than the calling thread's context allocator,
+// so they may outlive the context that allocated them - they're freed with TinFree()/TinFreeArray()
+#define TinAllocShared(alloctype, T, ...) \
+    new (reinterpret_cast<T*>(TinScript::CMemoryTracker::AllocShared(alloctype, sizeof(T)))) T(__VA_ARGS__);
+
+#define TinAllocSharedArray(alloctype, T, size) \
+        new (reinterpret_cast<T*>(TinScript::CMemoryTracker::AllocShared(alloctype, sizeof(T) * (size)))) T[(size)];
+
 #define TinObjectCreated(object_id, funccallstack) \
     TinScript::CMemoryTracker::NotifyObjectCreated(object_id, funccallstack);
 
@@ -305,12 +423,18 @@ namespace TinScript
     delete addr;
 
 #define TinAllocArray(alloctype, T, size) \
-    new T[size];
+    new T[(size)];
 
 
 #define TinFreeArray(addr) \
     delete [] addr;
 
+#define TinAllocShared(alloctype, T, ...)                                   \
+    new (reinterpret_cast<T*>(::operator new(sizeof(T)))) T(__VA_ARGS__);
+
+#define TinAllocSharedArray(alloctype, T, size) \
+    new T[(size)];
+
 #define TinObjectCreated(object_id, codeblock_hash, line_number) ;
 #define TinObjectDestroyed(object_id);
 
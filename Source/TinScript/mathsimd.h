@@ -0,0 +1,350 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ====================================================================================================================
+// mathsimd.h
+// A thin portable wrapper over 4-wide float registers, used by the vector/quat/matrix types in mathutil.h
+// -- SSE on x86/x64, NEON on AArch64, and a scalar fallback everywhere else (or if TIN_SIMD_ENABLE is 0)
+// -- note:  script values are stored unaligned (on the exec stack, in var tables, object members...)
+// so all loads and stores are unaligned, and a 3-float load never reads past the 12x bytes of a vector3f
+// ====================================================================================================================
+
+#ifndef __MATHSIMD_H
+#define __MATHSIMD_H
+
+#include <math.h>
+
+#include "integration.h"
+
+#if TIN_SIMD_ENABLE && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+    #define TIN_SIMD_SSE 1
+    #include <xmmintrin.h>
+#elif TIN_SIMD_ENABLE && (defined(__aarch64__) || defined(_M_ARM64))
+    #define TIN_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+#if TIN_SIMD_SSE
+    typedef __m128 tSimd4f;
+#elif TIN_SIMD_NEON
+    typedef float32x4_t tSimd4f;
+#else
+    struct tSimd4f { float32 v[4]; };
+#endif
+
+// ====================================================================================================================
+// -- load/store
+// ====================================================================================================================
+inline tSimd4f Simd4fLoad(const float32* src)
+{
+#if TIN_SIMD_SSE
+    return (_mm_loadu_ps(src));
+#elif TIN_SIMD_NEON
+    return (vld1q_f32(src));
+#else
+    tSimd4f result = { { src[0], src[1], src[2], src[3] } };
+    return (result);
+#endif
+}
+
+// -- loads x, y, z, with w set to 0.0f
+inline tSimd4f Simd4fLoad3(const float32* src)
+{
+#if TIN_SIMD_SSE
+    return (_mm_setr_ps(src[0], src[1], src[2], 0.0f));
+#elif TIN_SIMD_NEON
+    return (vcombine_f32(vld1_f32(src), vset_lane_f32(src[2], vdup_n_f32(0.0f), 0)));
+#else
+    tSimd4f result = { { src[0], src[1], src[2], 0.0f } };
+    return (result);
+#endif
+}
+
+inline tSimd4f Simd4fSet(float32 x, float32 y, float32 z, float32 w)
+{
+#if TIN_SIMD_SSE
+    return (_mm_setr_ps(x, y, z, w));
+#else
+    const float32 src[4] = { x, y, z, w };
+    return (Simd4fLoad(src));
+#endif
+}
+
+inline tSimd4f Simd4fSplat(float32 s)
+{
+#if TIN_SIMD_SSE
+    return (_mm_set1_ps(s));
+#elif TIN_SIMD_NEON
+    return (vdupq_n_f32(s));
+#else
+    tSimd4f result = { { s, s, s, s } };
+    return (result);
+#endif
+}
+
+inline void Simd4fStore(float32* dst, tSimd4f v)
+{
+#if TIN_SIMD_SSE
+    _mm_storeu_ps(dst, v);
+#elif TIN_SIMD_NEON
+    vst1q_f32(dst, v);
+#else
+    dst[0] = v.v[0]; dst[1] = v.v[1]; dst[2] = v.v[2]; dst[3] = v.v[3];
+#endif
+}
+
+// -- stores x, y, z only
+inline void Simd4fStore3(float32* dst, tSimd4f v)
+{
+#if TIN_SIMD_SSE
+    _mm_storel_pi((__m64*)dst, v);
+    _mm_store_ss(dst + 2, _mm_movehl_ps(v, v));
+#elif TIN_SIMD_NEON
+    vst1_f32(dst, vget_low_f32(v));
+    vst1q_lane_f32(dst + 2, v, 2);
+#else
+    dst[0] = v.v[0]; dst[1] = v.v[1]; dst[2] = v.v[2];
+#endif
+}
+
+// ====================================================================================================================
+// -- arithmetic
+// ====================================================================================================================
+inline tSimd4f Simd4fAdd(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_add_ps(a, b));
+#elif TIN_SIMD_NEON
+    return (vaddq_f32(a, b));
+#else
+    tSimd4f result = { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } };
+    return (result);
+#endif
+}
+
+inline tSimd4f Simd4fSub(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_sub_ps(a, b));
+#elif TIN_SIMD_NEON
+    return (vsubq_f32(a, b));
+#else
+    tSimd4f result = { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } };
+    return (result);
+#endif
+}
+
+inline tSimd4f Simd4fMul(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_mul_ps(a, b));
+#elif TIN_SIMD_NEON
+    return (vmulq_f32(a, b));
+#else
+    tSimd4f result = { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } };
+    return (result);
+#endif
+}
+
+// -- note:  like the scalar version, no divide-by-zero protection
+inline tSimd4f Simd4fDiv(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_div_ps(a, b));
+#elif TIN_SIMD_NEON
+    return (vdivq_f32(a, b));
+#else
+    tSimd4f result = { { a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3] } };
+    return (result);
+#endif
+}
+
+// -- returns a + (b * c)
+inline tSimd4f Simd4fMulAdd(tSimd4f a, tSimd4f b, tSimd4f c)
+{
+#if TIN_SIMD_NEON
+    return (vmlaq_f32(a, b, c));
+#else
+    return (Simd4fAdd(a, Simd4fMul(b, c)));
+#endif
+}
+
+// -- horizontal sum of all four lanes
+inline float32 Simd4fSum(tSimd4f v)
+{
+#if TIN_SIMD_SSE
+    __m128 shuf = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 sums = _mm_add_ps(v, shuf);
+    shuf = _mm_movehl_ps(shuf, sums);
+    sums = _mm_add_ss(sums, shuf);
+    return (_mm_cvtss_f32(sums));
+#elif TIN_SIMD_NEON
+    return (vaddvq_f32(v));
+#else
+    return ((v.v[0] + v.v[1]) + (v.v[2] + v.v[3]));
+#endif
+}
+
+// -- for 3-float values loaded with Simd4fLoad3(), w is 0.0f, so the 4-lane dot is also the 3-lane dot
+inline float32 Simd4fDot(tSimd4f a, tSimd4f b)
+{
+    return (Simd4fSum(Simd4fMul(a, b)));
+}
+
+// -- the w component of the result is 0.0f
+inline tSimd4f Simd4fCross3(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+    return (_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+#else
+    float32 av[4];
+    float32 bv[4];
+    Simd4fStore(av, a);
+    Simd4fStore(bv, b);
+    return (Simd4fSet(av[1] * bv[2] - av[2] * bv[1],
+                      av[2] * bv[0] - av[0] * bv[2],
+                      av[0] * bv[1] - av[1] * bv[0], 0.0f));
+#endif
+}
+
+// -- returns true if all four lanes are equal (NaN compares unequal, same as the scalar ==)
+inline bool8 Simd4fEqual(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_movemask_ps(_mm_cmpeq_ps(a, b)) == 0xf);
+#elif TIN_SIMD_NEON
+    return (vminvq_u32(vceqq_f32(a, b)) != 0);
+#else
+    return (a.v[0] == b.v[0] && a.v[1] == b.v[1] && a.v[2] == b.v[2] && a.v[3] == b.v[3]);
+#endif
+}
+
+inline tSimd4f Simd4fSqrt(tSimd4f v)
+{
+#if TIN_SIMD_SSE
+    return (_mm_sqrt_ps(v));
+#elif TIN_SIMD_NEON
+    return (vsqrtq_f32(v));
+#else
+    tSimd4f result = { { sqrtf(v.v[0]), sqrtf(v.v[1]), sqrtf(v.v[2]), sqrtf(v.v[3]) } };
+    return (result);
+#endif
+}
+
+inline tSimd4f Simd4fMin(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_min_ps(a, b));
+#elif TIN_SIMD_NEON
+    return (vminq_f32(a, b));
+#else
+    tSimd4f result = { { a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1],
+                         a.v[2] < b.v[2] ? a.v[2] : b.v[2], a.v[3] < b.v[3] ? a.v[3] : b.v[3] } };
+    return (result);
+#endif
+}
+
+inline tSimd4f Simd4fMax(tSimd4f a, tSimd4f b)
+{
+#if TIN_SIMD_SSE
+    return (_mm_max_ps(a, b));
+#elif TIN_SIMD_NEON
+    return (vmaxq_f32(a, b));
+#else
+    tSimd4f result = { { a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1],
+                         a.v[2] > b.v[2] ? a.v[2] : b.v[2], a.v[3] > b.v[3] ? a.v[3] : b.v[3] } };
+    return (result);
+#endif
+}
+
+// ====================================================================================================================
+// -- struct-of-arrays transposes
+// -- vector3f arrays are stored interleaved (x0 y0 z0 x1 y1 z1 ...), which is what the VM needs to address
+// a single element, but batch kernels want one register per component, four elements wide
+// ====================================================================================================================
+
+// -- reads 4x packed vector3f's (12 floats), and returns the x's, y's and z's each in their own register
+inline void Simd4fLoadSoA3(const float32* src, tSimd4f& xs, tSimd4f& ys, tSimd4f& zs)
+{
+#if TIN_SIMD_SSE
+    // -- a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+    __m128 a = _mm_loadu_ps(src);
+    __m128 b = _mm_loadu_ps(src + 4);
+    __m128 c = _mm_loadu_ps(src + 8);
+    __m128 tx = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+    xs = _mm_shuffle_ps(a, tx, _MM_SHUFFLE(2, 0, 3, 0));
+    __m128 ty0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+    __m128 ty1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+    ys = _mm_shuffle_ps(ty0, ty1, _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 tz0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+    zs = _mm_shuffle_ps(tz0, c, _MM_SHUFFLE(3, 0, 2, 0));
+#elif TIN_SIMD_NEON
+    float32x4x3_t soa = vld3q_f32(src);
+    xs = soa.val[0];
+    ys = soa.val[1];
+    zs = soa.val[2];
+#else
+    tSimd4f x = { { src[0], src[3], src[6], src[9] } };
+    tSimd4f y = { { src[1], src[4], src[7], src[10] } };
+    tSimd4f z = { { src[2], src[5], src[8], src[11] } };
+    xs = x;
+    ys = y;
+    zs = z;
+#endif
+}
+
+// -- the inverse of Simd4fLoadSoA3(), writes 4x packed vector3f's (12 floats)
+inline void Simd4fStoreSoA3(float32* dst, tSimd4f xs, tSimd4f ys, tSimd4f zs)
+{
+#if TIN_SIMD_SSE
+    __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(xs, ys, _MM_SHUFFLE(0, 0, 0, 0)),
+                              _mm_shuffle_ps(zs, xs, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(ys, zs, _MM_SHUFFLE(1, 1, 1, 1)),
+                              _mm_shuffle_ps(xs, ys, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+    __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(zs, xs, _MM_SHUFFLE(3, 3, 2, 2)),
+                              _mm_shuffle_ps(ys, zs, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    _mm_storeu_ps(dst, a);
+    _mm_storeu_ps(dst + 4, b);
+    _mm_storeu_ps(dst + 8, c);
+#elif TIN_SIMD_NEON
+    float32x4x3_t soa;
+    soa.val[0] = xs;
+    soa.val[1] = ys;
+    soa.val[2] = zs;
+    vst3q_f32(dst, soa);
+#else
+    for (int32 i = 0; i < 4; ++i)
+    {
+        dst[i * 3] = xs.v[i];
+        dst[i * 3 + 1] = ys.v[i];
+        dst[i * 3 + 2] = zs.v[i];
+    }
+#endif
+}
+
+#endif // __MATHSIMD_H
+
+// ====================================================================================================================
+// EOF
+// ====================================================================================================================
@@ -39,6 +39,8 @@ DECLARE_FILE(mathutil_cpp);
 const CVector3f CVector3f::zero(0.0f, 0.0f, 0.0f);
 const CVector3f CVector3f::realmax(1e8f, 1e8f, 1e8f);
 
+static const float32 kPI = 3.1415926535f;
+
 // ====================================================================================================================
 // Set():  Sets the x,y,z values
 // ====================================================================================================================
@@ -54,7 +56,8 @@ void CVector3f::Set(float32 _x, float32 _y, float32 _z)
 // ====================================================================================================================
 float32 CVector3f::Length()
 {
-    float32 length = (float32)sqrt(float32(x*x + y*y + z*z));
+    tSimd4f v = Simd4fLoad3(&x);
+    float32 length = (float32)sqrt(Simd4fDot(v, v));
     return (length);
 }
 
@@ -63,13 +66,10 @@ float32 CVector3f::Length()
 // ====================================================================================================================
 float32 CVector3f::Normalize()
 {
-    float32 length = (float32)sqrt(x*x + y*y + z*z);
+    tSimd4f v = Simd4fLoad3(&x);
+    float32 length = (float32)sqrt(Simd4fDot(v, v));
     if (length > 0.0f)
-    {
-        x /= length;
-        y /= length;
-        z /= length;
-    }
+        Simd4fStore3(&x, Simd4fDiv(v, Simd4fSplat(length)));
 
     // -- return the length
     return (length);
@@ -80,9 +80,8 @@ float32 CVector3f::Normalize()
 // ====================================================================================================================
 CVector3f CVector3f::Cross(CVector3f v0, CVector3f v1)
 {
-    CVector3f result(v0.y * v1.z - v0.z * v1.y,
-                     v0.z * v1.x - v0.x * v1.z,
-                     v0.x * v1.y - v0.y * v1.x);
+    CVector3f result;
+    Simd4fStore3(&result.x, Simd4fCross3(Simd4fLoad3(&v0.x), Simd4fLoad3(&v1.x)));
     return (result);
 }
 
@@ -91,7 +90,7 @@ CVector3f CVector3f::Cross(CVector3f v0, CVector3f v1)
 // ====================================================================================================================
 float32 CVector3f::Dot(CVector3f v0, CVector3f v1)
 {
-    float dot = v0.x * v1.x + v0.y * v1.y + v0.z * v1.z;
+    float dot = Simd4fDot(Simd4fLoad3(&v0.x), Simd4fLoad3(&v1.x));
     return dot;
 }
 
@@ -187,6 +186,494 @@ REGISTER_FUNCTION(V3fCross, TS_V3fCrossProduct);
 REGISTER_FUNCTION(V3fDot, TS_V3fDotProduct);
 REGISTER_FUNCTION(V3fNormalized, TS_V3fNormalized);
 
+// == CVector4f =======================================================================================================
+
+const CVector4f CVector4f::zero(0.0f, 0.0f, 0.0f, 0.0f);
+
+// ====================================================================================================================
+// Set():  Sets the x,y,z,w values
+// ====================================================================================================================
+void CVector4f::Set(float32 _x, float32 _y, float32 _z, float32 _w)
+{
+    x = _x;
+    y = _y;
+    z = _z;
+    w = _w;
+}
+
+// ====================================================================================================================
+// Length():  Returns the length of the vector
+// ====================================================================================================================
+float32 CVector4f::Length() const
+{
+    tSimd4f v = Simd4fLoad(&x);
+    return ((float32)sqrt(Simd4fDot(v, v)));
+}
+
+// ====================================================================================================================
+// Normalize():  Normalizes the vector, returns the length
+// ====================================================================================================================
+float32 CVector4f::Normalize()
+{
+    tSimd4f v = Simd4fLoad(&x);
+    float32 length = (float32)sqrt(Simd4fDot(v, v));
+    if (length > 0.0f)
+        Simd4fStore(&x, Simd4fDiv(v, Simd4fSplat(length)));
+
+    // -- return the length
+    return (length);
+}
+
+// ====================================================================================================================
+// Dot():  Returns the dot product of two vectors
+// ====================================================================================================================
+float32 CVector4f::Dot(const CVector4f& v0, const CVector4f& v1)
+{
+    return (Simd4fDot(Simd4fLoad(&v0.x), Simd4fLoad(&v1.x)));
+}
+
+// ====================================================================================================================
+// Normalized():  Returns the value of the input vector normalized
+// ====================================================================================================================
+CVector4f CVector4f::Normalized(CVector4f v0)
+{
+    v0.Normalize();
+    return (v0);
+}
+
+// == CQuaternion =====================================================================================================
+
+const CQuaternion CQuaternion::identity(0.0f, 0.0f, 0.0f, 1.0f);
+
+// ====================================================================================================================
+// operator*():  The Hamilton product, computed as vector and scalar parts
+// ====================================================================================================================
+CQuaternion CQuaternion::operator*(const CQuaternion& rhs) const
+{
+    tSimd4f v0 = Simd4fLoad3(&x);
+    tSimd4f v1 = Simd4fLoad3(&rhs.x);
+
+    // -- v = w0 * v1 + w1 * v0 + (v0 x v1),  w = w0 * w1 - (v0 . v1)
+    tSimd4f v = Simd4fMulAdd(Simd4fCross3(v0, v1), Simd4fSplat(w), v1);
+    v = Simd4fMulAdd(v, Simd4fSplat(rhs.w), v0);
+
+    CQuaternion result;
+    Simd4fStore3(&result.x, v);
+    result.w = w * rhs.w - Simd4fDot(v0, v1);
+    return (result);
+}
+
+// ====================================================================================================================
+// Set():  Sets the x,y,z,w values
+// ====================================================================================================================
+void CQuaternion::Set(float32 _x, float32 _y, float32 _z, float32 _w)
+{
+    x = _x;
+    y = _y;
+    z = _z;
+    w = _w;
+}
+
+// ====================================================================================================================
+// SetAxisAngle():  Sets the quaternion to a rotation of the given degrees around the given axis
+// ====================================================================================================================
+void CQuaternion::SetAxisAngle(const CVector3f& axis, float32 degrees)
+{
+    float32 half_angle = degrees * kPI / 360.0f;
+    CVector3f unit_axis = CVector3f::Normalized(axis);
+    Simd4fStore3(&x, Simd4fMul(Simd4fLoad3(&unit_axis.x), Simd4fSplat(sinf(half_angle))));
+    w = cosf(half_angle);
+}
+
+// ====================================================================================================================
+// Length():  Returns the length (norm) of the quaternion
+// ====================================================================================================================
+float32 CQuaternion::Length() const
+{
+    tSimd4f q = Simd4fLoad(&x);
+    return ((float32)sqrt(Simd4fDot(q, q)));
+}
+
+// ====================================================================================================================
+// Normalize():  Normalizes the quaternion, returns the length
+// ====================================================================================================================
+float32 CQuaternion::Normalize()
+{
+    tSimd4f q = Simd4fLoad(&x);
+    float32 length = (float32)sqrt(Simd4fDot(q, q));
+    if (length > 0.0f)
+        Simd4fStore(&x, Simd4fDiv(q, Simd4fSplat(length)));
+
+    // -- return the length
+    return (length);
+}
+
+// ====================================================================================================================
+// Conjugate():  Returns the conjugate, which for a unit quaternion is the inverse rotation
+// ====================================================================================================================
+CQuaternion CQuaternion::Conjugate() const
+{
+    return (CQuaternion(-x, -y, -z, w));
+}
+
+// ====================================================================================================================
+// Rotate():  Returns the given vector rotated by this (unit) quaternion
+// ====================================================================================================================
+CVector3f CQuaternion::Rotate(const CVector3f& v) const
+{
+    // -- t = 2 * (q.xyz x v),  v' = v + w * t + (q.xyz x t)
+    tSimd4f qv = Simd4fLoad3(&x);
+    tSimd4f vv = Simd4fLoad3(&v.x);
+    tSimd4f t = Simd4fCross3(qv, vv);
+    t = Simd4fAdd(t, t);
+    tSimd4f result_v = Simd4fAdd(Simd4fMulAdd(vv, Simd4fSplat(w), t), Simd4fCross3(qv, t));
+
+    CVector3f result;
+    Simd4fStore3(&result.x, result_v);
+    return (result);
+}
+
+// ====================================================================================================================
+// Normalized():  Returns the value of the input quaternion normalized
+// ====================================================================================================================
+CQuaternion CQuaternion::Normalized(CQuaternion q)
+{
+    q.Normalize();
+    return (q);
+}
+
+// == CMatrix44 =======================================================================================================
+
+// ====================================================================================================================
+// operator*():  Returns (this * rhs) - each result row is a linear combination of the rhs rows
+// ====================================================================================================================
+CMatrix44 CMatrix44::operator*(const CMatrix44& rhs) const
+{
+    tSimd4f rhs_row[4];
+    for (int32 j = 0; j < 4; ++j)
+        rhs_row[j] = Simd4fLoad(&rhs.row[j].x);
+
+    CMatrix44 result;
+    for (int32 i = 0; i < 4; ++i)
+    {
+        tSimd4f r = Simd4fMul(Simd4fSplat(row[i].x), rhs_row[0]);
+        r = Simd4fMulAdd(r, Simd4fSplat(row[i].y), rhs_row[1]);
+        r = Simd4fMulAdd(r, Simd4fSplat(row[i].z), rhs_row[2]);
+        r = Simd4fMulAdd(r, Simd4fSplat(row[i].w), rhs_row[3]);
+        Simd4fStore(&result.row[i].x, r);
+    }
+
+    return (result);
+}
+
+// ====================================================================================================================
+// SetIdentity():  Resets the matrix to the identity
+// ====================================================================================================================
+void CMatrix44::SetIdentity()
+{
+    row[0].Set(1.0f, 0.0f, 0.0f, 0.0f);
+    row[1].Set(0.0f, 1.0f, 0.0f, 0.0f);
+    row[2].Set(0.0f, 0.0f, 1.0f, 0.0f);
+    row[3].Set(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+// ====================================================================================================================
+// SetRow():  Sets the row at the given index
+// ====================================================================================================================
+void CMatrix44::SetRow(int32 index, CVector4f value)
+{
+    if (index < 0 || index >= 4)
+    {
+        ScriptAssert_(::TinScript::GetContext(), false, "<internal>", -1,
+                      "Error - CMatrix44::SetRow():  index %d out of range [0, 3]\n", index);
+        return;
+    }
+
+    row[index] = value;
+}
+
+// ====================================================================================================================
+// GetRow():  Returns the row at the given index
+// ====================================================================================================================
+CVector4f CMatrix44::GetRow(int32 index)
+{
+    if (index < 0 || index >= 4)
+    {
+        ScriptAssert_(::TinScript::GetContext(), false, "<internal>", -1,
+                      "Error - CMatrix44::GetRow():  index %d out of range [0, 3]\n", index);
+        return (CVector4f::zero);
+    }
+
+    return (row[index]);
+}
+
+// ====================================================================================================================
+// SetRotation():  Sets the upper 3x3 to the rotation of the given quaternion, leaving the translation intact
+// ====================================================================================================================
+void CMatrix44::SetRotation(CQuaternion q)
+{
+    float32 xx = q.x * q.x;
+    float32 yy = q.y * q.y;
+    float32 zz = q.z * q.z;
+    float32 xy = q.x * q.y;
+    float32 xz = q.x * q.z;
+    float32 yz = q.y * q.z;
+    float32 wx = q.w * q.x;
+    float32 wy = q.w * q.y;
+    float32 wz = q.w * q.z;
+
+    row[0].Set(1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy), row[0].w);
+    row[1].Set(2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx), row[1].w);
+    row[2].Set(2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy), row[2].w);
+}
+
+// ====================================================================================================================
+// SetTranslation():  Sets the translation column
+// ====================================================================================================================
+void CMatrix44::SetTranslation(CVector3f t)
+{
+    row[0].w = t.x;
+    row[1].w = t.y;
+    row[2].w = t.z;
+}
+
+// ====================================================================================================================
+// Transpose():  Transposes the matrix in place
+// ====================================================================================================================
+void CMatrix44::Transpose()
+{
+    CMatrix44 src = *this;
+    row[0].Set(src.row[0].x, src.row[1].x, src.row[2].x, src.row[3].x);
+    row[1].Set(src.row[0].y, src.row[1].y, src.row[2].y, src.row[3].y);
+    row[2].Set(src.row[0].z, src.row[1].z, src.row[2].z, src.row[3].z);
+    row[3].Set(src.row[0].w, src.row[1].w, src.row[2].w, src.row[3].w);
+}
+
+// ====================================================================================================================
+// Transform():  Returns (this * v)
+// ====================================================================================================================
+CVector4f CMatrix44::Transform(CVector4f v)
+{
+    tSimd4f vv = Simd4fLoad(&v.x);
+    CVector4f result(Simd4fDot(Simd4fLoad(&row[0].x), vv), Simd4fDot(Simd4fLoad(&row[1].x), vv),
+                     Simd4fDot(Simd4fLoad(&row[2].x), vv), Simd4fDot(Simd4fLoad(&row[3].x), vv));
+    return (result);
+}
+
+// ====================================================================================================================
+// TransformPoint():  Returns the point (w = 1) transformed, including translation
+// ====================================================================================================================
+CVector3f CMatrix44::TransformPoint(CVector3f p)
+{
+    CVector4f result = Transform(CVector4f(p, 1.0f));
+    return (CVector3f(result.x, result.y, result.z));
+}
+
+// ====================================================================================================================
+// TransformVector():  Returns the direction (w = 0) transformed, ignoring translation
+// ====================================================================================================================
+CVector3f CMatrix44::TransformVector(CVector3f v)
+{
+    CVector4f result = Transform(CVector4f(v, 0.0f));
+    return (CVector3f(result.x, result.y, result.z));
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- registered functions
+bool8 TS_MatrixMultiply(CMatrix44* result, CMatrix44* m0, CMatrix44* m1)
+{
+    if (!result || !m0 || !m1)
+    {
+        ScriptAssert_(::TinScript::GetContext(), result && m0 && m1, "<internal>", -1,
+                      "Error - MatrixMultiply():  Unable to find the result/m0/m1 objects\n");
+        return (false);
+    }
+
+    // -- multiply the matrices, assign the result
+    *result = *m0 * *m1;
+
+    // -- success
+    return (true);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// -- registration - CMatrix44 is too large to be a POD type, so it's registered as an object
+REGISTER_SCRIPT_CLASS_BEGIN(CMatrix44, VOID)
+REGISTER_SCRIPT_CLASS_END()
+
+REGISTER_METHOD(CMatrix44, SetIdentity, SetIdentity);
+REGISTER_METHOD(CMatrix44, SetRow, SetRow);
+REGISTER_METHOD(CMatrix44, GetRow, GetRow);
+REGISTER_METHOD(CMatrix44, SetRotation, SetRotation);
+REGISTER_METHOD(CMatrix44, SetTranslation, SetTranslation);
+REGISTER_METHOD(CMatrix44, Transpose, Transpose);
+REGISTER_METHOD(CMatrix44, Transform, Transform);
+REGISTER_METHOD(CMatrix44, TransformPoint, TransformPoint);
+REGISTER_METHOD(CMatrix44, TransformVector, TransformVector);
+
+REGISTER_FUNCTION(MatrixMultiply, TS_MatrixMultiply);
+
+// == Batch vector3f kernels ==========================================================================================
+
+// -- note:  CVector3f is three packed floats, so an array of count vectors is 3 * count floats,
+// transposed four elements at a time into x/y/z registers - the remaining (count % 4) are done one at a time
+static_assert(sizeof(CVector3f) == 3 * sizeof(float32), "Error - CVector3f must be packed for the batch kernels");
+
+// ====================================================================================================================
+// V3fBatchLengths():  Fills out_lengths[i] with the length of src[i]
+// ====================================================================================================================
+void V3fBatchLengths(const CVector3f* src, int32 count, float32* out_lengths)
+{
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        tSimd4f xs, ys, zs;
+        Simd4fLoadSoA3(&src[i].x, xs, ys, zs);
+        tSimd4f len_sq = Simd4fMulAdd(Simd4fMulAdd(Simd4fMul(xs, xs), ys, ys), zs, zs);
+        Simd4fStore(&out_lengths[i], Simd4fSqrt(len_sq));
+    }
+
+    for (; i < count; ++i)
+        out_lengths[i] = sqrtf(CVector3f::Dot(src[i], src[i]));
+}
+
+// ====================================================================================================================
+// V3fBatchDot():  Fills out_dots[i] with the dot product of src[i] and v
+// ====================================================================================================================
+void V3fBatchDot(const CVector3f* src, int32 count, const CVector3f& v, float32* out_dots)
+{
+    tSimd4f vx = Simd4fSplat(v.x);
+    tSimd4f vy = Simd4fSplat(v.y);
+    tSimd4f vz = Simd4fSplat(v.z);
+
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        tSimd4f xs, ys, zs;
+        Simd4fLoadSoA3(&src[i].x, xs, ys, zs);
+        Simd4fStore(&out_dots[i], Simd4fMulAdd(Simd4fMulAdd(Simd4fMul(xs, vx), ys, vy), zs, vz));
+    }
+
+    for (; i < count; ++i)
+        out_dots[i] = CVector3f::Dot(src[i], v);
+}
+
+// ====================================================================================================================
+// V3fBatchNearest():  Returns the index of the element closest to p, or -1 if the array is empty
+// -- ties resolve to the lowest index, same as a linear search
+// ====================================================================================================================
+int32 V3fBatchNearest(const CVector3f* src, int32 count, const CVector3f& p, float32* out_dist_sq)
+{
+    if (!src || count <= 0)
+        return (-1);
+
+    tSimd4f px = Simd4fSplat(p.x);
+    tSimd4f py = Simd4fSplat(p.y);
+    tSimd4f pz = Simd4fSplat(p.z);
+
+    int32 nearest = -1;
+    float32 nearest_dist_sq = 0.0f;
+    float32 dist_sq[4];
+
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        tSimd4f xs, ys, zs;
+        Simd4fLoadSoA3(&src[i].x, xs, ys, zs);
+        xs = Simd4fSub(xs, px);
+        ys = Simd4fSub(ys, py);
+        zs = Simd4fSub(zs, pz);
+        Simd4fStore(dist_sq, Simd4fMulAdd(Simd4fMulAdd(Simd4fMul(xs, xs), ys, ys), zs, zs));
+
+        for (int32 lane = 0; lane < 4; ++lane)
+        {
+            if (nearest < 0 || dist_sq[lane] < nearest_dist_sq)
+            {
+                nearest = i + lane;
+                nearest_dist_sq = dist_sq[lane];
+            }
+        }
+    }
+
+    for (; i < count; ++i)
+    {
+        CVector3f diff = src[i] - p;
+        float32 elem_dist_sq = CVector3f::Dot(diff, diff);
+        if (nearest < 0 || elem_dist_sq < nearest_dist_sq)
+        {
+            nearest = i;
+            nearest_dist_sq = elem_dist_sq;
+        }
+    }
+
+    if (out_dist_sq)
+        *out_dist_sq = nearest_dist_sq;
+    return (nearest);
+}
+
+// ====================================================================================================================
+// V3fBatchAddScaled():  dst[i] += src[i] * s
+// -- the operation is per-component, so no transpose is needed - the arrays are treated as flat floats
+// ====================================================================================================================
+void V3fBatchAddScaled(CVector3f* dst, const CVector3f* src, int32 count, float32 s)
+{
+    float32* dst_f = &dst[0].x;
+    const float32* src_f = &src[0].x;
+    int32 float_count = count * 3;
+    tSimd4f scale = Simd4fSplat(s);
+
+    int32 i = 0;
+    for (; i + 4 <= float_count; i += 4)
+        Simd4fStore(&dst_f[i], Simd4fMulAdd(Simd4fLoad(&dst_f[i]), Simd4fLoad(&src_f[i]), scale));
+
+    for (; i < float_count; ++i)
+        dst_f[i] += src_f[i] * s;
+}
+
+// ====================================================================================================================
+// V3fBatchNormalize():  Normalizes every element in place - zero-length elements are left unchanged
+// ====================================================================================================================
+void V3fBatchNormalize(CVector3f* dst, int32 count)
+{
+    // -- dividing by max(length, tiny) leaves a zero vector as zero, without a per-lane branch
+    tSimd4f tiny = Simd4fSplat(1e-30f);
+
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        tSimd4f xs, ys, zs;
+        Simd4fLoadSoA3(&dst[i].x, xs, ys, zs);
+        tSimd4f len_sq = Simd4fMulAdd(Simd4fMulAdd(Simd4fMul(xs, xs), ys, ys), zs, zs);
+        tSimd4f length = Simd4fMax(Simd4fSqrt(len_sq), tiny);
+        Simd4fStoreSoA3(&dst[i].x, Simd4fDiv(xs, length), Simd4fDiv(ys, length), Simd4fDiv(zs, length));
+    }
+
+    for (; i < count; ++i)
+        dst[i].Normalize();
+}
+
+// ====================================================================================================================
+// V3fBatchBounds():  Computes the axis-aligned bounding box of the elements, returns false if the array is empty
+// ====================================================================================================================
+bool8 V3fBatchBounds(const CVector3f* src, int32 count, CVector3f& out_min, CVector3f& out_max)
+{
+    if (!src || count <= 0)
+        return (false);
+
+    tSimd4f min_v = Simd4fLoad3(&src[0].x);
+    tSimd4f max_v = min_v;
+    for (int32 i = 1; i < count; ++i)
+    {
+        tSimd4f v = Simd4fLoad3(&src[i].x);
+        min_v = Simd4fMin(min_v, v);
+        max_v = Simd4fMax(max_v, v);
+    }
+
+    Simd4fStore3(&out_min.x, min_v);
+    Simd4fStore3(&out_max.x, max_v);
+    return (true);
+}
+
 // ====================================================================================================================
 // Random Numbers
 // ====================================================================================================================
@@ -220,7 +707,6 @@ REGISTER_FUNCTION(RandomInt, RandomInt);
 // ====================================================================================================================
 // Trigonometry
 // ====================================================================================================================
-static const float32 kPI = 3.1415926535f;
 float32 Cos(float32 degrees)
 {
     return (cosf(degrees * kPI / 180.0f));
@@ -29,6 +29,9 @@
 #include "TinScript.h"
 #include "TinRegistration.h"
 
+// -- SSE/NEON wrapper
+#include "mathsimd.h"
+
 // ====================================================================================================================
 // class CVector3f
 // Simple implementation of a 3D float class
@@ -55,36 +58,41 @@ public:
         return *this;
     }
 
-    CVector3f& operator+(const CVector3f& rhs)
+    // -- note:  the arithmetic operators return a new value - neither operand is modified
+    CVector3f operator+(const CVector3f& rhs) const
     {
-        x += rhs.x; y += rhs.y; z += rhs.z;
-        return *this;
+        CVector3f result;
+        Simd4fStore3(&result.x, Simd4fAdd(Simd4fLoad3(&x), Simd4fLoad3(&rhs.x)));
+        return result;
     }
 
-    CVector3f& operator-(const CVector3f& rhs)
+    CVector3f operator-(const CVector3f& rhs) const
     {
-        x -= rhs.x; y -= rhs.y; z -= rhs.z;
-        return *this;
+        CVector3f result;
+        Simd4fStore3(&result.x, Simd4fSub(Simd4fLoad3(&x), Simd4fLoad3(&rhs.x)));
+        return result;
     }
 
-    CVector3f& operator*(const float32 s)
+    CVector3f operator*(const float32 s) const
     {
-        x *= s; y *= s; z *= s;
-        return *this;
+        CVector3f result;
+        Simd4fStore3(&result.x, Simd4fMul(Simd4fLoad3(&x), Simd4fSplat(s)));
+        return result;
     }
 
-    CVector3f& operator/(const float32 s)
+    CVector3f operator/(const float32 s) const
     {
-        x /= s; y /= s; z /= s;
-        return *this;
+        CVector3f result;
+        Simd4fStore3(&result.x, Simd4fDiv(Simd4fLoad3(&x), Simd4fSplat(s)));
+        return result;
     }
 
-    bool8 operator==(const CVector3f& rhs)
+    bool8 operator==(const CVector3f& rhs) const
     {
         return (x == rhs.x && y == rhs.y && z == rhs.z);
     }
 
-    bool8 operator!=(const CVector3f& rhs)
+    bool8 operator!=(const CVector3f& rhs) const
     {
         return (x != rhs.x || y != rhs.y || z != rhs.z);
     }
@@ -107,6 +115,164 @@ public:
     float32 z;
 };
 
+// ====================================================================================================================
+// class CVector4f
+// 4D float class, registered as the script POD type vector4f
+// ====================================================================================================================
+class CVector4f {
+
+public:
+
+    CVector4f(float32 _x = 0.0f, float32 _y = 0.0f, float32 _z = 0.0f, float32 _w = 0.0f)
+    {
+        x = _x; y = _y; z = _z; w = _w;
+    }
+
+    // -- a vector3f extends to a vector4f with w = 0.0f
+    explicit CVector4f(const CVector3f& v3, float32 _w = 0.0f)
+    {
+        x = v3.x; y = v3.y; z = v3.z; w = _w;
+    }
+
+    CVector4f operator+(const CVector4f& rhs) const
+    {
+        CVector4f result;
+        Simd4fStore(&result.x, Simd4fAdd(Simd4fLoad(&x), Simd4fLoad(&rhs.x)));
+        return result;
+    }
+
+    CVector4f operator-(const CVector4f& rhs) const
+    {
+        CVector4f result;
+        Simd4fStore(&result.x, Simd4fSub(Simd4fLoad(&x), Simd4fLoad(&rhs.x)));
+        return result;
+    }
+
+    CVector4f operator*(const float32 s) const
+    {
+        CVector4f result;
+        Simd4fStore(&result.x, Simd4fMul(Simd4fLoad(&x), Simd4fSplat(s)));
+        return result;
+    }
+
+    CVector4f operator/(const float32 s) const
+    {
+        CVector4f result;
+        Simd4fStore(&result.x, Simd4fDiv(Simd4fLoad(&x), Simd4fSplat(s)));
+        return result;
+    }
+
+    bool8 operator==(const CVector4f& rhs) const
+    {
+        return (Simd4fEqual(Simd4fLoad(&x), Simd4fLoad(&rhs.x)));
+    }
+
+    bool8 operator!=(const CVector4f& rhs) const
+    {
+        return (!Simd4fEqual(Simd4fLoad(&x), Simd4fLoad(&rhs.x)));
+    }
+
+    void Set(float32 _x, float32 _y, float32 _z, float32 _w);
+    float32 Length() const;
+    float32 Normalize();
+
+    static float32 Dot(const CVector4f& v0, const CVector4f& v1);
+    static CVector4f Normalized(CVector4f v0);
+
+    static const CVector4f zero;
+
+    float32 x;
+    float32 y;
+    float32 z;
+    float32 w;
+};
+
+// ====================================================================================================================
+// class CQuaternion
+// Rotation quaternion (x, y, z imaginary, w real), registered as the script POD type quat
+// ====================================================================================================================
+class CQuaternion {
+
+public:
+
+    CQuaternion(float32 _x = 0.0f, float32 _y = 0.0f, float32 _z = 0.0f, float32 _w = 1.0f)
+    {
+        x = _x; y = _y; z = _z; w = _w;
+    }
+
+    // -- the Hamilton product - applying the result rotates by rhs, then by this
+    CQuaternion operator*(const CQuaternion& rhs) const;
+
+    bool8 operator==(const CQuaternion& rhs) const
+    {
+        return (Simd4fEqual(Simd4fLoad(&x), Simd4fLoad(&rhs.x)));
+    }
+
+    bool8 operator!=(const CQuaternion& rhs) const
+    {
+        return (!Simd4fEqual(Simd4fLoad(&x), Simd4fLoad(&rhs.x)));
+    }
+
+    void Set(float32 _x, float32 _y, float32 _z, float32 _w);
+    void SetAxisAngle(const CVector3f& axis, float32 degrees);
+    float32 Length() const;
+    float32 Normalize();
+    CQuaternion Conjugate() const;
+    CVector3f Rotate(const CVector3f& v) const;
+
+    static CQuaternion Normalized(CQuaternion q);
+
+    static const CQuaternion identity;
+
+    float32 x;
+    float32 y;
+    float32 z;
+    float32 w;
+};
+
+// ====================================================================================================================
+// class CMatrix44
+// 4x4 row-major float matrix, transforming column vectors (v' = M * v)
+// -- note:  at 64x bytes, a matrix does not fit in a 16x byte exec stack entry, so unlike vector4f and quat,
+// it is not a POD type - it is registered as a script class, with rows accessed as vector4f values
+// ====================================================================================================================
+class CMatrix44 {
+
+public:
+
+    CMatrix44()
+    {
+        SetIdentity();
+    }
+
+    CMatrix44 operator*(const CMatrix44& rhs) const;
+
+    // -- registered methods
+    void SetIdentity();
+    void SetRow(int32 index, CVector4f row);
+    CVector4f GetRow(int32 index);
+    void SetRotation(CQuaternion q);
+    void SetTranslation(CVector3f t);
+    void Transpose();
+
+    CVector4f Transform(CVector4f v);
+    CVector3f TransformPoint(CVector3f p);
+    CVector3f TransformVector(CVector3f v);
+
+    CVector4f row[4];
+};
+
+// ====================================================================================================================
+// Batch vector3f kernels
+// Operate on a packed array of vector3f's (e.g. the storage of a script vector3f[] array), four elements at a time
+// ====================================================================================================================
+void V3fBatchLengths(const CVector3f* src, int32 count, float32* out_lengths);
+void V3fBatchDot(const CVector3f* src, int32 count, const CVector3f& v, float32* out_dots);
+int32 V3fBatchNearest(const CVector3f* src, int32 count, const CVector3f& p, float32* out_dist_sq = nullptr);
+void V3fBatchAddScaled(CVector3f* dst, const CVector3f* src, int32 count, float32 s);
+void V3fBatchNormalize(CVector3f* dst, int32 count);
+bool8 V3fBatchBounds(const CVector3f* src, int32 count, CVector3f& out_min, CVector3f& out_max);
+
 // ====================================================================================================================
 // Random Numbers
 // ====================================================================================================================
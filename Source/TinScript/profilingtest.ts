@@ -77,6 +77,33 @@ void vector_test(int count, vector3f pos)
     Print("Total elapsed time: ", elapsed);
 }
 
+// -- same search as vector_test(), but the vectors are stored in a vector3f array,
+// and the search is a single native call to the batch kernel, rather than an interpreted loop
+vector3f[2] vector_array;
+void vector_batch_test(int count, vector3f pos)
+{
+    int cur_time = GetSimTime();
+        vector_array:resize(count);
+        int i;
+        for (i = 0; i < count; ++i)
+        {
+                vector3f v;
+                v:x = -1000.0f + (Random() * 2000.0f);
+                v:y = -1000.0f + (Random() * 2000.0f);
+                v:z = -1000.0f + (Random() * 2000.0f);
+                vector_array[i] = v;
+        }
+        int elapsed = GetSimTime() - cur_time;
+    Print("Array elapsed time: ", elapsed);
+
+        int closest_index = vector_array:nearest_to(pos);
+        vector3f closest = vector_array[closest_index];
+
+        Print(closest:x, " ", closest:y, " ", closest:z, " len: ", V3fLength(closest));
+        elapsed = GetSimTime() - cur_time;
+    Print("Total elapsed time: ", elapsed);
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 int CallFromCode(int a, int b, string foo)
 {
@@ -68,7 +68,7 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
         return (success);
     }
 
@@ -106,7 +106,7 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
 
         return (success);
     }
@@ -150,7 +150,7 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
 
         return (success);
     }
@@ -190,7 +190,7 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
 
         return (success);
     }
@@ -239,8 +239,8 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
         return (success);
     }
 
@@ -279,8 +279,8 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
         return (success);
     }
@@ -326,8 +326,8 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
         return (success);
     }
@@ -369,8 +369,8 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
         return (success);
     }
@@ -421,9 +421,9 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
         return (success);
     }
 
@@ -464,9 +464,9 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
         return (success);
     }
@@ -514,9 +514,9 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
         return (success);
     }
@@ -560,9 +560,9 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
         return (success);
     }
@@ -615,10 +615,10 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
         return (success);
     }
 
@@ -661,10 +661,10 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
         return (success);
     }
@@ -714,10 +714,10 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
         return (success);
     }
@@ -763,10 +763,10 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
         return (success);
     }
@@ -821,11 +821,11 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
         return (success);
     }
 
@@ -870,11 +870,11 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
         return (success);
     }
@@ -926,11 +926,11 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
         return (success);
     }
@@ -978,11 +978,11 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
         return (success);
     }
@@ -1039,12 +1039,12 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
         return (success);
     }
 
@@ -1091,12 +1091,12 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
         return (success);
     }
@@ -1150,12 +1150,12 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
         return (success);
     }
@@ -1205,12 +1205,12 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
         return (success);
     }
@@ -1269,13 +1269,13 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
         return (success);
     }
 
@@ -1324,13 +1324,13 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
         return (success);
     }
@@ -1386,13 +1386,13 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
         return (success);
     }
@@ -1444,13 +1444,13 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
         return (success);
     }
@@ -1511,14 +1511,14 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
         return (success);
     }
 
@@ -1569,14 +1569,14 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
         return (success);
     }
@@ -1634,14 +1634,14 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
         return (success);
     }
@@ -1695,14 +1695,14 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
         return (success);
     }
@@ -1765,15 +1765,15 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
         return (success);
     }
 
@@ -1826,15 +1826,15 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
         return (success);
     }
@@ -1894,15 +1894,15 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
         return (success);
     }
@@ -1958,15 +1958,15 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
         return (success);
     }
@@ -2031,16 +2031,16 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
         return (success);
     }
 
@@ -2095,16 +2095,16 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
         return (success);
     }
@@ -2166,16 +2166,16 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
         return (success);
     }
@@ -2233,16 +2233,16 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
         return (success);
     }
@@ -2309,17 +2309,17 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
         return (success);
     }
 
@@ -2376,17 +2376,17 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
         return (success);
     }
@@ -2450,17 +2450,17 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
         return (success);
     }
@@ -2520,17 +2520,17 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
         return (success);
     }
@@ -2599,18 +2599,18 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
         return (success);
     }
 
@@ -2669,18 +2669,18 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
         return (success);
     }
@@ -2746,18 +2746,18 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
         return (success);
     }
@@ -2819,18 +2819,18 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
         return (success);
     }
@@ -2901,19 +2901,19 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
         return (success);
     }
 
@@ -2974,19 +2974,19 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
         return (success);
     }
@@ -3054,19 +3054,19 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
         return (success);
     }
@@ -3130,19 +3130,19 @@ public:
     virtual bool Register() {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
         return (success);
     }
@@ -130,7 +130,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name)
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name)));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name)));
 }
 
 template<typename R>
@@ -157,7 +157,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name)));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name)));
 }
 
 template<typename R>
@@ -190,7 +190,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name)));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name)));
 }
 
 
@@ -271,7 +271,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1)
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1));
 }
 
 template<typename R, typename T1>
@@ -298,7 +298,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1));
 }
 
 template<typename R, typename T1>
@@ -331,7 +331,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1));
 }
 
 
@@ -437,7 +437,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2)
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2));
 }
 
 template<typename R, typename T1, typename T2>
@@ -464,7 +464,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2));
 }
 
 template<typename R, typename T1, typename T2>
@@ -497,7 +497,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2));
 }
 
 
@@ -628,7 +628,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3));
 }
 
 template<typename R, typename T1, typename T2, typename T3>
@@ -655,7 +655,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3));
 }
 
 template<typename R, typename T1, typename T2, typename T3>
@@ -688,7 +688,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3));
 }
 
 
@@ -844,7 +844,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4>
@@ -871,7 +871,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4>
@@ -904,7 +904,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4));
 }
 
 
@@ -1085,7 +1085,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5>
@@ -1112,7 +1112,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5>
@@ -1145,7 +1145,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5));
 }
 
 
@@ -1351,7 +1351,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
@@ -1378,7 +1378,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6>
@@ -1411,7 +1411,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6));
 }
 
 
@@ -1642,7 +1642,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6, p7));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6, p7));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
@@ -1669,7 +1669,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7>
@@ -1702,7 +1702,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7));
 }
 
 
@@ -1958,7 +1958,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6, p7, p8));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6, p7, p8));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
@@ -1985,7 +1985,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8>
@@ -2018,7 +2018,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8));
 }
 
 
@@ -2299,7 +2299,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9>
@@ -2326,7 +2326,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9>
@@ -2359,7 +2359,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9));
 }
 
 
@@ -2665,7 +2665,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10>
@@ -2692,7 +2692,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10>
@@ -2725,7 +2725,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10));
 }
 
 
@@ -3056,7 +3056,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11>
@@ -3083,7 +3083,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11>
@@ -3116,7 +3116,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11));
 }
 
 
@@ -3472,7 +3472,7 @@ inline bool8 ExecFunction(R& return_value, const char* func_name, T1 p1, T2 p2,
     if (!script_context->GetGlobalNamespace() || !func_name || !func_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::Hash(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12));
+    return (ExecFunctionImpl<R>(return_value, 0, 0, TinScript::HashValue(func_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12>
@@ -3499,7 +3499,7 @@ inline bool8 ObjExecMethod(void* obj_addr, R& return_value, const char* method_n
         return false;
     }
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12));
 }
 
 template<typename R, typename T1, typename T2, typename T3, typename T4, typename T5, typename T6, typename T7, typename T8, typename T9, typename T10, typename T11, typename T12>
@@ -3532,7 +3532,7 @@ inline bool8 ObjExecMethod(uint32 object_id, R& return_value, const char* method
     if (!script_context->GetGlobalNamespace() || !method_name || !method_name[0])
         return false;
 
-    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::Hash(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12));
+    return (ExecFunctionImpl<R>(return_value, object_id, 0, TinScript::HashValue(method_name), p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12));
 }
 
 } // TinScript
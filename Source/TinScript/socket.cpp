@@ -30,11 +30,36 @@
 #endif
 
 // -- system includes
+#include <atomic>
+#include <chrono>
 #include <map>
+#include <mutex>
+#include <new>
+#include <thread>
+
+// -- sockets are implemented with winsock on Windows, and everywhere else with epoll, where the socket thread sleeps
+// until there's traffic, or an eventfd wakes it to send
+#if defined(_WIN32)
+    #define SOCKET_EPOLL 0
+#else
+    #define SOCKET_EPOLL 1
+#endif
 
-// -- sockets are only implemented in WIN32
-#include <winsock2.h>
-#include <ws2tcpip.h>
+#if !SOCKET_EPOLL
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
 
 #include <vector>
 
@@ -50,7 +75,15 @@ DECLARE_FILE(socket_cpp);
 
 // --------------------------------------------------------------------------------------------------------------------
 // -- statics
-const uint32 SCK_VERSION2 = 0x0202;
+#if !SOCKET_EPOLL
+    const uint32 SCK_VERSION2 = 0x0202;
+#else
+    typedef int SOCKET;
+    const int SOCKET_ERROR = -1;
+
+    // -- each send gathers the header and payload of up to kSocketPacketProcessMax packets
+    const int32 k_MaxSendIOVecs = kSocketPacketProcessMax * 2;
+#endif
 
 // == namespace SocketManager =========================================================================================
 
@@ -60,14 +93,113 @@ namespace SocketManager
 // --------------------------------------------------------------------------------------------------------------------
 // -- statics
 static bool mInitialized = false;
-static DWORD mThreadID = 0;
-static HANDLE mThreadHandle = NULL;
 static CSocket* mThreadSocket = NULL;
 static int mThreadSocketID = 1;
 
-// -- WSA variables
-bool mWSAInitialized = false;
-static WSADATA mWSAdata;
+#if !SOCKET_EPOLL
+    static DWORD mThreadID = 0;
+    static HANDLE mThreadHandle = NULL;
+
+    // -- WSA variables
+    bool mWSAInitialized = false;
+    static WSADATA mWSAdata;
+#else
+    static std::thread mThread;
+    static std::atomic<bool> mThreadTerminate(false);
+    static int mEpollFD = -1;
+    static int mWakeEventFD = -1;
+#endif
+
+static void FlushPacketPool();
+
+// == socket platform layer ===========================================================================================
+
+// ====================================================================================================================
+// SocketClose():  Closes a socket handle (closing a file descriptor also removes it from the epoll set)
+// ====================================================================================================================
+static void SocketClose(intptr_t socket_handle)
+{
+    if (socket_handle == k_InvalidSocket)
+        return;
+
+#if !SOCKET_EPOLL
+    closesocket((SOCKET)socket_handle);
+#else
+    close((int)socket_handle);
+#endif
+}
+
+// ====================================================================================================================
+// SocketSetNonBlocking():  Sets the socket to return immediately from send/recv/accept
+// ====================================================================================================================
+static void SocketSetNonBlocking(intptr_t socket_handle)
+{
+#if !SOCKET_EPOLL
+    u_long iMode = 1;
+    ioctlsocket((SOCKET)socket_handle, FIONBIO, &iMode);
+#else
+    int flags = fcntl((int)socket_handle, F_GETFL, 0);
+    fcntl((int)socket_handle, F_SETFL, flags | O_NONBLOCK);
+#endif
+}
+
+// ====================================================================================================================
+// SocketSetNoDelay():  Disables Nagle - our packets are small, and a SocketExec() round trip is latency bound
+// ====================================================================================================================
+static void SocketSetNoDelay(intptr_t socket_handle)
+{
+    int no_delay = 1;
+    setsockopt((SOCKET)socket_handle, IPPROTO_TCP, TCP_NODELAY, (const char*)&no_delay, sizeof(no_delay));
+}
+
+// ====================================================================================================================
+// SocketLastError():  Returns the error from the last failed socket call
+// ====================================================================================================================
+static int SocketLastError()
+{
+#if !SOCKET_EPOLL
+    return (WSAGetLastError());
+#else
+    return (errno);
+#endif
+}
+
+// ====================================================================================================================
+// SocketWouldBlock():  Returns true if the error only means a non-blocking call had nothing to do
+// ====================================================================================================================
+static bool SocketWouldBlock(int error)
+{
+#if !SOCKET_EPOLL
+    return (error == WSAEWOULDBLOCK);
+#else
+    return (error == EAGAIN || error == EWOULDBLOCK || error == EINTR);
+#endif
+}
+
+// ====================================================================================================================
+// WakeSocketThread():  Wakes the socket thread from WaitForEvents(), e.g. to send a packet just queued
+// ====================================================================================================================
+static void WakeSocketThread()
+{
+#if SOCKET_EPOLL
+    if (mWakeEventFD >= 0)
+    {
+        uint64 value = 1;
+        ssize_t result = write(mWakeEventFD, &value, sizeof(value));
+        (void)result;
+    }
+#endif
+}
+
+// ====================================================================================================================
+// GetSocketTimeMS():  The heartbeat timers are updated by the time elapsed, since the thread no longer updates at
+// a fixed rate
+// ====================================================================================================================
+static int64 GetSocketTimeMS()
+{
+    return ((int64)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
 
 // --------------------------------------------------------------------------------------------------------------------
 // class cSocketFunctionSignature
@@ -100,13 +232,18 @@ typedef std::map<uint32, cSocketFunctionSignature>::iterator tSignatureIterator;
 // -- a custom data handler
 static ProcessRecvDataCallback mRecvDataCallback = NULL;
 
-DWORD WINAPI ThreadUpdate(void* script_context);
+#if !SOCKET_EPOLL
+    DWORD WINAPI ThreadUpdate(void* script_context);
+#else
+    uint32 ThreadUpdate(void* script_context);
+#endif
 
 // ====================================================================================================================
 // Initialize():  Initialize the SocketManager
 // ====================================================================================================================
 void Initialize()
 {
+#if !SOCKET_EPOLL
     // -- create the thread
     mThreadHandle = CreateThread(NULL,                      // default security attributes
                                     0,                         // use default stack size  
@@ -114,12 +251,33 @@ void Initialize()
                                     TinScript::GetContext(),   // argument to thread function 
                                     0,                         // use default creation flags 
                                     &mThreadID);               // returns the thread identifier 
+#else
+    // -- the eventfd is how other threads wake the socket thread, it's always in the epoll set
+    mEpollFD = epoll_create1(EPOLL_CLOEXEC);
+    mWakeEventFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (mEpollFD >= 0 && mWakeEventFD >= 0)
+    {
+        epoll_event wake_event;
+        memset(&wake_event, 0, sizeof(wake_event));
+        wake_event.events = EPOLLIN;
+        wake_event.data.fd = mWakeEventFD;
+        epoll_ctl(mEpollFD, EPOLL_CTL_ADD, mWakeEventFD, &wake_event);
+    }
+
+    // -- create the thread
+    mThreadTerminate = false;
+    mThread = std::thread(ThreadUpdate, (void*)TinScript::GetContext());
+#endif
 }
 
 // ====================================================================================================================
 // ThreadUpdate():  Update loop for the SocketManager, run inside the thread
 // ====================================================================================================================
+#if !SOCKET_EPOLL
 DWORD WINAPI ThreadUpdate(void* script_context)
+#else
+uint32 ThreadUpdate(void* script_context)
+#endif
 {
     // -- see if we need to create the socket
     TinScript::CScriptContext* ts_context = (TinScript::CScriptContext*)(script_context);
@@ -127,6 +285,7 @@ DWORD WINAPI ThreadUpdate(void* script_context)
     {
         mThreadSocket = new CSocket(ts_context);
 
+#if !SOCKET_EPOLL
         // -- initialize the WSAData
         int error = WSAStartup(SCK_VERSION2, &mWSAdata);
         if (error)
@@ -144,6 +303,7 @@ DWORD WINAPI ThreadUpdate(void* script_context)
 
         // -- we were successfully able to initialize WSA
         mWSAInitialized = true;
+#endif
     }
 
     // -- update the socket until the thread is terminated
@@ -155,6 +315,11 @@ DWORD WINAPI ThreadUpdate(void* script_context)
 			break;
 		}
 
+#if SOCKET_EPOLL
+        if (mThreadTerminate)
+            break;
+#endif
+
         // -- listen for connections (internally, will actually listen, or simply ignore)
         if (!mThreadSocket->Listen())
         {
@@ -167,7 +332,8 @@ DWORD WINAPI ThreadUpdate(void* script_context)
             return (0);
         }
 
-        Sleep(k_ThreadUpdateTimeMS);
+        // -- sleep until there's traffic, something to send, or it's time to update the heartbeat
+        mThreadSocket->WaitForEvents(k_ThreadUpdateTimeMS);
     }
 
     // -- no errors
@@ -182,8 +348,16 @@ void Terminate()
     // -- first disconnect the socket
     Disconnect(true);
 
+#if !SOCKET_EPOLL
     // -- kill the thread
     TerminateThread(mThreadHandle, 0);
+#else
+    // -- wake the thread, so it sees the request, and wait for it to exit
+    mThreadTerminate = true;
+    WakeSocketThread();
+    if (mThread.joinable())
+        mThread.join();
+#endif
 
     // -- kill the socket
     if (mThreadSocket)
@@ -192,12 +366,28 @@ void Terminate()
         mThreadSocket = NULL;
     }
 
+#if !SOCKET_EPOLL
     // -- see if we need to shutdown WSA
     if (mWSAInitialized)
     {
         WSACleanup();
         mWSAInitialized = false;
     }
+#else
+    if (mWakeEventFD >= 0)
+    {
+        close(mWakeEventFD);
+        mWakeEventFD = -1;
+    }
+    if (mEpollFD >= 0)
+    {
+        close(mEpollFD);
+        mEpollFD = -1;
+    }
+#endif
+
+    // -- release the pooled blocks (packets still held elsewhere return to the pool as they're deleted)
+    FlushPacketPool();
 }
 
 // ====================================================================================================================
@@ -224,6 +414,7 @@ bool Listen()
     if (mThreadSocket && !mThreadSocket->IsConnected())
     {
         mThreadSocket->SetListen(true);
+        WakeSocketThread();
         return (true);
     }
 
@@ -253,6 +444,11 @@ bool Connect(const char* ipAddress, bool is_auto_connect)
         ipAddress = "127.0.0.1";
 
     result = mThreadSocket->Connect(ipAddress, is_auto_connect);
+
+    // -- the socket thread needs to start watching the new connection
+    if (result)
+        WakeSocketThread();
+
     if (!result)
     {
         // -- we don't want to display an error each time we attempt to auto-reconnect
@@ -329,7 +525,7 @@ bool SendCommandf(const char* fmt, ...)
     va_list args;
     va_start(args, fmt);
     char cmdBuf[2048];
-    vsprintf_s(cmdBuf, 2048, fmt, args);
+    vsnprintf(cmdBuf, sizeof(cmdBuf), fmt, args);
     va_end(args);
 
     result = mThreadSocket->SendScriptCommand(cmdBuf);
@@ -343,8 +539,19 @@ bool SendCommandf(const char* fmt, ...)
 bool SendExec(int32 func_hash, const char* arg1, const char* arg2, const char* arg3, const char* arg4,
               const char* arg5, const char* arg6, const char* arg7)
 {
-    // -- create the packet data - convert each arg to a valid type, and serialize the values
-    char packet_buffer[k_MaxPacketSize];
+    // -- create the packet at its max size, and serialize the args directly into it
+    SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::SCRIPT_FUNCTION_EXEC,
+                                        k_MaxPacketSize);
+    SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header, NULL);
+    if (!newPacket)
+    {
+        TinPrint(TinScript::GetContext(),
+                 "Error - SocketManager::SendExec(): not connected - don't forget to SocketListen()\n");
+        return (false);
+    }
+
+    // -- convert each arg to a valid type, and serialize the values
+    char* packet_buffer = newPacket->mData;
     int32 max_size = k_MaxPacketSize;
     uint32* dataptr = (uint32*)packet_buffer;
 
@@ -424,21 +631,9 @@ bool SendExec(int32 func_hash, const char* arg1, const char* arg2, const char* a
         *arg_count += 1;
     }
 
-    // -- at this point, we have the packet data ready to send
-    void* data_start = &packet_buffer[0];
-    int32 total_size = kPointerDiffUInt32(dataptr, data_start);
-
-    // -- create the packet header
-    SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::SCRIPT_FUNCTION_EXEC, total_size);
-
-    // -- now create the packet to send
-    SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header, data_start);
-    if (!newPacket)
-    {
-        TinPrint(TinScript::GetContext(),
-                 "Error - SocketManager::SendExec(): not connected - don't forget to SocketListen()\n");
-        return (false);
-    }
+    // -- at this point, we have the packet data ready to send - trim the packet to the size written
+    int32 total_size = kPointerDiffUInt32(dataptr, packet_buffer);
+    newPacket->SetSize(total_size);
 
     // -- send the packet
     SocketManager::SendDataPacket(newPacket);
@@ -460,10 +655,13 @@ void SendDebuggerBreak()
 
 // ====================================================================================================================
 // RegisterProcessRecvDataCallback():  Register a function to call, if a packt of type Socket::DATA is received
+// -- returns the previously registered callback, so a temporary handler (e.g. a unit test) can restore it
 // ====================================================================================================================
-void RegisterProcessRecvDataCallback(ProcessRecvDataCallback recvCallback)
+ProcessRecvDataCallback RegisterProcessRecvDataCallback(ProcessRecvDataCallback recvCallback)
 {
+    ProcessRecvDataCallback prev_callback = mRecvDataCallback;
     mRecvDataCallback = recvCallback;
+    return (prev_callback);
 }
 
 // ====================================================================================================================
@@ -526,13 +724,184 @@ bool SendPrintDataPacket(tDataPacket* dataPacket)
     return (result);
 }
 
+// == packet pool =====================================================================================================
+
+// -- each block is preceded by a header recording its size class - the free list is linked through the header
+struct alignas(16) tPacketPoolHeader
+{
+    int32 mSizeClass;
+    tPacketPoolHeader* mNext;
+};
+
+// -- each class has room for a small header as well, so e.g. a 1K payload and its tPacketBuffer share the 1K class
+static const int32 k_PacketPoolClassPadding = 32;
+
+struct tPacketPoolClass
+{
+    std::mutex mLock;
+    tPacketPoolHeader* mFreeList = NULL;
+    int32 mFreeCount = 0;
+};
+
+static tPacketPoolClass mPacketPool[k_PacketPoolClassCount];
+
+// ====================================================================================================================
+// PacketPoolAlloc():  Allocates a block from the smallest size class that fits, or from the heap, if none do
+// ====================================================================================================================
+void* PacketPoolAlloc(size_t size)
+{
+    int32 size_class = -1;
+    for (int32 i = 0; i < k_PacketPoolClassCount; ++i)
+    {
+        if (size <= (size_t)(k_PacketPoolSizeClasses[i] + k_PacketPoolClassPadding))
+        {
+            size_class = i;
+            break;
+        }
+    }
+
+    // -- reuse a free block, if the class has one
+    tPacketPoolHeader* block = NULL;
+    if (size_class >= 0)
+    {
+        tPacketPoolClass& pool_class = mPacketPool[size_class];
+        std::lock_guard<std::mutex> lock(pool_class.mLock);
+        if (pool_class.mFreeList != NULL)
+        {
+            block = pool_class.mFreeList;
+            pool_class.mFreeList = block->mNext;
+            --pool_class.mFreeCount;
+        }
+    }
+
+    if (block == NULL)
+    {
+        size_t block_size = size_class >= 0 ? (size_t)(k_PacketPoolSizeClasses[size_class] + k_PacketPoolClassPadding)
+                                            : size;
+        block = (tPacketPoolHeader*)::operator new(sizeof(tPacketPoolHeader) + block_size);
+    }
+
+    block->mSizeClass = size_class;
+    block->mNext = NULL;
+    return (block + 1);
+}
+
+// ====================================================================================================================
+// PacketPoolFree():  Returns a block to its size class, or to the heap, if the class has enough free blocks
+// ====================================================================================================================
+void PacketPoolFree(void* block)
+{
+    if (block == NULL)
+        return;
+
+    tPacketPoolHeader* header = (tPacketPoolHeader*)block - 1;
+    if (header->mSizeClass >= 0)
+    {
+        tPacketPoolClass& pool_class = mPacketPool[header->mSizeClass];
+        std::lock_guard<std::mutex> lock(pool_class.mLock);
+        if (pool_class.mFreeCount < k_PacketPoolMaxFree)
+        {
+            header->mNext = pool_class.mFreeList;
+            pool_class.mFreeList = header;
+            ++pool_class.mFreeCount;
+            return;
+        }
+    }
+
+    ::operator delete(header);
+}
+
+// ====================================================================================================================
+// FlushPacketPool():  Releases every free block back to the heap
+// ====================================================================================================================
+static void FlushPacketPool()
+{
+    for (int32 i = 0; i < k_PacketPoolClassCount; ++i)
+    {
+        tPacketPoolClass& pool_class = mPacketPool[i];
+        std::lock_guard<std::mutex> lock(pool_class.mLock);
+        while (pool_class.mFreeList != NULL)
+        {
+            tPacketPoolHeader* header = pool_class.mFreeList;
+            pool_class.mFreeList = header->mNext;
+            ::operator delete(header);
+        }
+        pool_class.mFreeCount = 0;
+    }
+}
+
+// ====================================================================================================================
+// AllocPacketBuffer():  Allocates a pooled buffer, with a ref count of 1
+// ====================================================================================================================
+tPacketBuffer* AllocPacketBuffer(int32 size)
+{
+    void* block = PacketPoolAlloc(sizeof(tPacketBuffer) + (size_t)size);
+    tPacketBuffer* buffer = new (block) tPacketBuffer;
+    buffer->mRefCount.store(1, std::memory_order_relaxed);
+    buffer->mCapacity = size;
+    return (buffer);
+}
+
+// ====================================================================================================================
+// AddRefPacketBuffer():  Adds a reference, e.g. for each packet whose data lies within the buffer
+// ====================================================================================================================
+void AddRefPacketBuffer(tPacketBuffer* buffer)
+{
+    if (buffer != NULL)
+        buffer->mRefCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ====================================================================================================================
+// ReleasePacketBuffer():  Releases a reference, returning the buffer to the pool once the last is released
+// ====================================================================================================================
+void ReleasePacketBuffer(tPacketBuffer* buffer)
+{
+    if (buffer != NULL && buffer->mRefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        buffer->~tPacketBuffer();
+        PacketPoolFree(buffer);
+    }
+}
+
 // == class DataQueue =================================================================================================
 
+static_assert((k_DataQueueInitialSize & (k_DataQueueInitialSize - 1)) == 0,
+              "Error - k_DataQueueInitialSize must be a power of 2");
+
 // ====================================================================================================================
 // Constructure
 // ====================================================================================================================
 DataQueue::DataQueue()
 {
+    mCapacity = k_DataQueueInitialSize;
+    mQueue = new tDataPacket*[mCapacity];
+    mHead = 0;
+    mCount = 0;
+}
+
+// ====================================================================================================================
+// Destructor
+// ====================================================================================================================
+DataQueue::~DataQueue()
+{
+    Clear();
+    delete [] mQueue;
+}
+
+// ====================================================================================================================
+// Grow():  Doubles the capacity, unwrapping the queued packets to the start of the new buffer
+// ====================================================================================================================
+void DataQueue::Grow()
+{
+    int32 new_capacity = mCapacity * 2;
+    tDataPacket** new_queue = new tDataPacket*[new_capacity];
+    for (int32 i = 0; i < mCount; ++i)
+        new_queue[i] = mQueue[(mHead + i) & (mCapacity - 1)];
+
+    delete [] mQueue;
+    mQueue = new_queue;
+    mCapacity = new_capacity;
+    mHead = 0;
 }
 
 // ====================================================================================================================
@@ -555,10 +924,19 @@ bool DataQueue::Enqueue(tDataPacket* packet, bool at_front)
     }
 
     // -- add the packet to the queue
+    if (mCount >= mCapacity)
+        Grow();
+
     if (at_front)
-        mQueue.insert(mQueue.begin(), packet);
+    {
+        mHead = (mHead - 1) & (mCapacity - 1);
+        mQueue[mHead] = packet;
+    }
     else
-        mQueue.push_back(packet);
+    {
+        mQueue[(mHead + mCount) & (mCapacity - 1)] = packet;
+    }
+    ++mCount;
 
     // -- success
     return (true);
@@ -569,31 +947,42 @@ bool DataQueue::Enqueue(tDataPacket* packet, bool at_front)
 // ====================================================================================================================
 bool DataQueue::Dequeue(tDataPacket*& packet, bool peekOnly)
 {
-    if (mQueue.size() == 0)
+    if (mCount == 0)
         return (false);
 
     // -- if we didn't request a specific packet ID, return the first element
-    packet = mQueue[0];
+    packet = mQueue[mHead];
 
     // -- if we're only peeking, then don't remove
     if (!peekOnly)
-        mQueue.erase(mQueue.begin());
+    {
+        mHead = (mHead + 1) & (mCapacity - 1);
+        --mCount;
+    }
 
     return (true);
 }
 
+// ====================================================================================================================
+// Peek():  Returns the packet at the given position from the front, or NULL
+// ====================================================================================================================
+tDataPacket* DataQueue::Peek(int32 index) const
+{
+    if (index < 0 || index >= mCount)
+        return (NULL);
+
+    return (mQueue[(mHead + index) & (mCapacity - 1)]);
+}
+
 // ====================================================================================================================
 // Clear();
 // ====================================================================================================================
 void DataQueue::Clear()
 {
     // -- delete all queued packets
-    while (mQueue.size() > 0)
-    {
-        tDataPacket* packet = mQueue[0];
-        mQueue.erase(mQueue.begin());
+    tDataPacket* packet = NULL;
+    while (Dequeue(packet))
         delete packet;
-    }
 }
 
 // == CSocket =========================================================================================================
@@ -605,14 +994,19 @@ CSocket::CSocket(TinScript::CScriptContext* script_context)
     : mListen(false)
     , mConnected(false)
     , mIsShuttingDown(false)
-    , mListenSocket(nullptr)
-    , mConnectSocket(nullptr)
+    , mListenSocket(k_InvalidSocket)
+    , mConnectSocket(k_InvalidSocket)
     , mScriptContext(script_context)
 {
     // -- initialize the incoming packet members
     mRecvHeader[0] = '\0';
     mRecvPtr = mRecvHeader;
     mRecvPacket = NULL;
+    mRecvBuffer = NULL;
+
+    mSendHeartbeatTimer = k_HeartbeatTimeMS;
+    mRecvHeartbeatTimer = k_HeartbeatTimeoutMS;
+    mHeartbeatUpdateTime = GetSocketTimeMS();
 }
 
 // ====================================================================================================================
@@ -627,14 +1021,11 @@ CSocket::~CSocket()
     {
         delete mRecvPacket;
     }
+    ReleasePacketBuffer(mRecvBuffer);
 
-    // -- close the socket if it exists
-    if (mListenSocket != nullptr)
-        closesocket((SOCKET)mConnectSocket);
-
-    // -- if we have an open connection socket, we also need to cleanup WSA
-    if (mConnectSocket != nullptr)
-        closesocket((SOCKET)mConnectSocket);
+    // -- close the sockets if they exist
+    SocketClose(mListenSocket);
+    SocketClose(mConnectSocket);
 }
 
 // ====================================================================================================================
@@ -657,13 +1048,14 @@ bool CSocket::Listen()
     }
 
     // -- if we don't have a listen socket, create one
-    if (mListenSocket == nullptr)
+    if (mListenSocket == k_InvalidSocket)
     {
         // -- this is executed within a thread - enqueue a thread command to print the message
         ScriptCommand("Print('CSocket::Listen(): listening for connection.\n');");
 
         // The address structure for a TCP socket
-        SOCKADDR_IN addr;
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
 
         // -- address family
         addr.sin_family = AF_INET;      
@@ -677,19 +1069,27 @@ bool CSocket::Listen()
         addr.sin_addr.s_addr = htonl(INADDR_ANY);
 
         // Create socket
-        mListenSocket = (uint32*)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-        if (mListenSocket == nullptr)
+        mListenSocket = (intptr_t)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (mListenSocket == k_InvalidSocket)
         {
             // -- failed to create a socket
             return (false); 
         }
 
+#if SOCKET_EPOLL
+        // -- allow the port to be reused immediately, if we relisten (e.g. after a disconnect), and never block in
+        // accept() - the listen socket is in the epoll set, so we're woken when a connection is pending
+        int reuse_addr = 1;
+        setsockopt((SOCKET)mListenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse_addr, sizeof(reuse_addr));
+        SocketSetNonBlocking(mListenSocket);
+#endif
+
         // -- bind the socket to this address
-        if (bind((SOCKET)mListenSocket, (LPSOCKADDR)&addr, sizeof(addr)) == SOCKET_ERROR)
+        if (bind((SOCKET)mListenSocket, (sockaddr*)&addr, sizeof(addr)) == SOCKET_ERROR)
         {
             // -- failed to bind
-            closesocket((SOCKET)mListenSocket);
-            mListenSocket = nullptr;
+            SocketClose(mListenSocket);
+            mListenSocket = k_InvalidSocket;
             return (false);
         }
 
@@ -697,38 +1097,44 @@ bool CSocket::Listen()
         if (listen((SOCKET)mListenSocket, 1) != 0)
         {
             // -- failed to listen
-            ScriptCommand("Print('Error - CSocket: listen() failed with error %d\n');", WSAGetLastError());
-            closesocket((SOCKET)mListenSocket);
-            mListenSocket = nullptr;
+            ScriptCommand("Print('Error - CSocket: listen() failed with error %d\n');", SocketLastError());
+            SocketClose(mListenSocket);
+            mListenSocket = k_InvalidSocket;
             return (false);
         }
+    }
 
-        // -- accept a socket request
-        mConnectSocket = (uint32*)accept((SOCKET)mListenSocket, NULL, NULL);
-        if (mConnectSocket == nullptr)
-        {
-            // -- failed to listen - note, if we chose to disconnect, this will also fail
-            // -- so we still return true, to allow the thread to continue
-            ScriptCommand("Print('Error - CSocket: accept() failed with error %d\n');", WSAGetLastError());
-            closesocket((SOCKET)mListenSocket);
-            mListenSocket = nullptr;
+    // -- accept a socket request
+    mConnectSocket = (intptr_t)accept((SOCKET)mListenSocket, NULL, NULL);
+    if (mConnectSocket == k_InvalidSocket)
+    {
+        // -- a non-blocking listen socket has no connection pending - keep listening
+        int error = SocketLastError();
+        if (SocketWouldBlock(error))
             return (true);
-        }
 
-        // -- ensure the connect socket is non-blocking
-        u_long iMode=1;
-        ioctlsocket((SOCKET)mConnectSocket, FIONBIO, &iMode);
+        // -- failed to listen - note, if we chose to disconnect, this will also fail
+        // -- so we still return true, to allow the thread to continue
+        ScriptCommand("Print('Error - CSocket: accept() failed with error %d\n');", error);
+        SocketClose(mListenSocket);
+        mListenSocket = k_InvalidSocket;
+        return (true);
+    }
 
-        // -- we're connected
-        ScriptCommand("Print('CSocket: Connected.');");
-        closesocket((SOCKET)mListenSocket);
-        mListenSocket = nullptr;
-        mConnected = true;
+    // -- ensure the connect socket is non-blocking, and sends each packet immediately
+    SocketSetNonBlocking(mConnectSocket);
+    SocketSetNoDelay(mConnectSocket);
 
-        // -- initialize the heartbeat
-        mSendHeartbeatTimer = k_HeartbeatTimeMS;
-        mRecvHeartbeatTimer = k_HeartbeatTimeoutMS;
-    }
+    // -- we're connected
+    ScriptCommand("Print('CSocket: Connected.');");
+    SocketClose(mListenSocket);
+    mListenSocket = k_InvalidSocket;
+    mConnected = true;
+
+    // -- initialize the heartbeat
+    mSendHeartbeatTimer = k_HeartbeatTimeMS;
+    mRecvHeartbeatTimer = k_HeartbeatTimeoutMS;
+    mHeartbeatUpdateTime = GetSocketTimeMS();
 
     // -- done
     return (true);
@@ -765,51 +1171,43 @@ bool CSocket::Connect(const char* ipAddress, bool is_auto_connect)
     }
 
     // -- create the connect socket
-    mConnectSocket = (uint32*)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (mConnectSocket == nullptr)
+    mConnectSocket = (intptr_t)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (mConnectSocket == k_InvalidSocket)
     {
         // -- failed to create a socket
+        freeaddrinfo(addressResult);
         return (false); 
     }
 
     // -- see if we can request a connection
     int32 connectResult = (int32)connect((SOCKET)mConnectSocket, addressResult->ai_addr, (int32)addressResult->ai_addrlen);
-    if (connectResult == SOCKET_ERROR)
-    {
-        if (!is_auto_connect)
-        {
-            ScriptCommand("Print('Error CSocket: connect() failed.\n');");
-        }
-        closesocket((SOCKET)mConnectSocket);
-        mConnectSocket = nullptr;
-        return (false);
-    }
 
     // -- cleanup the addr info
     freeaddrinfo(addressResult);
 
-    // -- see if we actually created a socket
-    if (mConnectSocket == nullptr)
+    if (connectResult == SOCKET_ERROR)
     {
         if (!is_auto_connect)
         {
             ScriptCommand("Print('Error CSocket: connect() failed.\n');");
         }
+        SocketClose(mConnectSocket);
+        mConnectSocket = k_InvalidSocket;
         return (false);
     }
 
-    // -- ensure the socket is non-blocking
-    u_long iMode=1;
-    ioctlsocket((SOCKET)mConnectSocket, FIONBIO, &iMode);
+    // -- ensure the socket is non-blocking, and sends each packet immediately
+    SocketSetNonBlocking(mConnectSocket);
+    SocketSetNoDelay(mConnectSocket);
 
     // -- success
     ScriptCommand("Print('CSocket: Connected.\n');");
 
     // -- connection was successful - close down the listening connection
-    if (mListenSocket != nullptr)
+    if (mListenSocket != k_InvalidSocket)
     {
-        closesocket((SOCKET)mListenSocket);
-        mListenSocket = nullptr;
+        SocketClose(mListenSocket);
+        mListenSocket = k_InvalidSocket;
     }
 
     // -- set the bool, return the result
@@ -819,6 +1217,7 @@ bool CSocket::Connect(const char* ipAddress, bool is_auto_connect)
     // -- initialize the heartbeat
     mSendHeartbeatTimer = k_HeartbeatTimeMS;
     mRecvHeartbeatTimer = k_HeartbeatTimeoutMS;
+    mHeartbeatUpdateTime = GetSocketTimeMS();
 
     return (true);
 }
@@ -863,17 +1262,17 @@ void CSocket::Disconnect(bool is_shutting_down)
     }
 
     // -- close the listening socket as well
-    if (mListenSocket != nullptr)
+    if (mListenSocket != k_InvalidSocket)
     {
         // -- close the socket
         shutdown((SOCKET)mListenSocket, 2);
-        closesocket((SOCKET)mListenSocket);
-        mListenSocket = nullptr;
+        SocketClose(mListenSocket);
+        mListenSocket = k_InvalidSocket;
     }
 
     // -- close the socket
-    closesocket((SOCKET)mConnectSocket);
-    mConnectSocket = nullptr;
+    SocketClose(mConnectSocket);
+    mConnectSocket = k_InvalidSocket;
     mConnected = false;
 
     // -- notify TinScript, in case this connection was from a debugger
@@ -917,9 +1316,86 @@ bool CSocket::ProcessSendPackets()
     }
 
     // -- send the messages we've queued, and check for an error
-    int packets_sent_count = kSocketPacketProcessMax;
     bool errorDisconnect = false;
     int error = 0;
+
+#if SOCKET_EPOLL
+    // -- gather the unsent header and payload of each queued packet, so they're all sent with a single sendmsg()
+    struct iovec send_iov[k_MaxSendIOVecs];
+    int32 iov_count = 0;
+    for (int32 i = 0; i < mSendQueue.Size() && iov_count + 2 <= k_MaxSendIOVecs; ++i)
+    {
+        tDataPacket* packet = mSendQueue.Peek(i);
+        if (!packet->mHeader.mHeaderSent)
+        {
+            const char* header_ptr = (const char*)&packet->mHeader;
+            const char* send_ptr = packet->mHeader.mSendPtr != NULL ? packet->mHeader.mSendPtr : header_ptr;
+            send_iov[iov_count].iov_base = (void*)send_ptr;
+            send_iov[iov_count++].iov_len = tPacketHeader::HeaderSize - (send_ptr - header_ptr);
+        }
+        if (packet->mHeader.mSize > 0)
+        {
+            const char* send_ptr = packet->mHeader.mHeaderSent ? packet->mHeader.mSendPtr : packet->mData;
+            send_iov[iov_count].iov_base = (void*)send_ptr;
+            send_iov[iov_count++].iov_len = packet->mHeader.mSize - (send_ptr - packet->mData);
+        }
+    }
+
+    if (iov_count > 0)
+    {
+        // -- as long as we're attempting to send, reset the heartbeat timer
+        mSendHeartbeatTimer = k_HeartbeatTimeMS;
+
+        // -- sendmsg() is the socket writev(), and won't raise SIGPIPE if our partner has gone
+        msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = send_iov;
+        message.msg_iovlen = iov_count;
+        ssize_t bytes_sent = sendmsg((int)mConnectSocket, &message, MSG_NOSIGNAL);
+        if (bytes_sent < 0)
+        {
+            error = SocketLastError();
+            if (!SocketWouldBlock(error))
+                errorDisconnect = true;
+        }
+
+        // -- advance through the packets by what was sent - the rest is sent once the socket is writable again
+        ssize_t bytes_remaining = bytes_sent > 0 ? bytes_sent : 0;
+        tDataPacket* send_packet = nullptr;
+        while (!errorDisconnect && mSendQueue.Dequeue(send_packet, true))
+        {
+            if (!send_packet->mHeader.mHeaderSent)
+            {
+                const char* header_ptr = (const char*)&send_packet->mHeader;
+                const char* send_ptr = send_packet->mHeader.mSendPtr != NULL ? send_packet->mHeader.mSendPtr
+                                                                             : header_ptr;
+                ssize_t header_remaining = tPacketHeader::HeaderSize - (send_ptr - header_ptr);
+                if (bytes_remaining < header_remaining)
+                {
+                    send_packet->mHeader.mSendPtr = send_ptr + bytes_remaining;
+                    break;
+                }
+
+                bytes_remaining -= header_remaining;
+                send_packet->mHeader.mHeaderSent = true;
+                send_packet->mHeader.mSendPtr = (const char*)send_packet->mData;
+            }
+
+            ssize_t data_remaining = send_packet->mHeader.mSize -
+                                     (send_packet->mHeader.mSendPtr - (const char*)send_packet->mData);
+            if (bytes_remaining < data_remaining)
+            {
+                send_packet->mHeader.mSendPtr += bytes_remaining;
+                break;
+            }
+
+            bytes_remaining -= data_remaining;
+            mSendQueue.Dequeue(send_packet);
+            delete send_packet;
+        }
+    }
+#else
+    int packets_sent_count = kSocketPacketProcessMax;
     tDataPacket* send_packet = nullptr;
     while (--packets_sent_count >= 0 && mSendQueue.Dequeue(send_packet, true))
     {
@@ -955,8 +1431,8 @@ bool CSocket::ProcessSendPackets()
         // -- if we received an error, we'll have to disconnect
         if (bytesSent == SOCKET_ERROR)
         {
-            error = WSAGetLastError();
-            if (error != WSAEWOULDBLOCK)
+            error = SocketLastError();
+            if (!SocketWouldBlock(error))
                 errorDisconnect = true;
             break;
         }
@@ -992,6 +1468,7 @@ bool CSocket::ProcessSendPackets()
                 break;
         }
     }
+#endif
 
     // -- if we encountered a socket error sending, disconnect
     if (errorDisconnect)
@@ -1024,21 +1501,30 @@ bool CSocket::ReceivePackets()
     mThreadLock.Lock();
 
     // -- decrement the heartbeat timers
-    mSendHeartbeatTimer -= k_ThreadUpdateTimeMS;
-    mRecvHeartbeatTimer -= k_ThreadUpdateTimeMS;
-
-    // -- see if we have something to recv
-    char recvbuf[k_MaxBufferSize];
-    int recvbuflen = k_MaxBufferSize;
+    int64 current_time = GetSocketTimeMS();
+    int32 elapsed_ms = (int32)(current_time - mHeartbeatUpdateTime);
+    mHeartbeatUpdateTime = current_time;
+    mSendHeartbeatTimer -= elapsed_ms;
+    mRecvHeartbeatTimer -= elapsed_ms;
 
     // -- recv data from the socket
     while (true)
     {
-        int bytesRecv = recv((SOCKET)mConnectSocket, recvbuf, recvbuflen, 0);
+        // -- we recv directly into a pooled buffer, which the packets received whole reference
+        // -- while any packet still references it, we need a new one (only this thread adds references)
+        if (mRecvBuffer != NULL && mRecvBuffer->mRefCount.load(std::memory_order_acquire) > 1)
+        {
+            ReleasePacketBuffer(mRecvBuffer);
+            mRecvBuffer = NULL;
+        }
+        if (mRecvBuffer == NULL)
+            mRecvBuffer = AllocPacketBuffer(k_MaxBufferSize);
+
+        int bytesRecv = recv((SOCKET)mConnectSocket, mRecvBuffer->GetData(), k_MaxBufferSize, 0);
 
         // -- check for a disconnect
-        int error = WSAGetLastError();
-        if (error != WSAEWOULDBLOCK && error != 0)
+        int error = bytesRecv == SOCKET_ERROR ? SocketLastError() : 0;
+        if (bytesRecv == SOCKET_ERROR && !SocketWouldBlock(error))
         {
             // -- notify the script context
             ScriptCommand("Print('CSocket: Recv error %d\n');", error);
@@ -1047,13 +1533,22 @@ bool CSocket::ReceivePackets()
             return (true);
         }
 
+        // -- a recv of 0 bytes is our partner closing the connection
+        else if (bytesRecv == 0)
+        {
+            ScriptCommand("Print('CSocket: Connection closed\n');");
+            mThreadLock.Unlock();
+            Disconnect(false);
+            return (true);
+        }
+
         else if (bytesRecv > 0)
         {
             // -- we received data - reset the heartbeat timer
             mRecvHeartbeatTimer = k_HeartbeatTimeoutMS;
 
             // -- if we fail to process the data, something very bad has happened
-            if (!ProcessRecvData(recvbuf, bytesRecv))
+            if (!ProcessRecvData(mRecvBuffer, mRecvBuffer->GetData(), bytesRecv))
             {
                 // -- notify the script context
                 ScriptCommand("Print('CSocket: Unable to ProcessRecvData()\n');");
@@ -1215,6 +1710,7 @@ bool CSocket::SendScriptCommand(const char* command)
     // -- ensure we don't exceed the max length
     if (length > k_MaxPacketSize)
     {
+        mThreadLock.Unlock();
         return (false);
     }
 
@@ -1227,6 +1723,10 @@ bool CSocket::SendScriptCommand(const char* command)
     // -- unlock the thread
     mThreadLock.Unlock();
 
+    // -- the socket thread sends immediately, rather than at its next update
+    if (result)
+        WakeSocketThread();
+
     // -- return the result
     return (result);
 }
@@ -1254,6 +1754,10 @@ bool CSocket::SendData(void* data, int dataSize)
     // -- unlock the thread
     mThreadLock.Unlock();
 
+    // -- the socket thread sends immediately, rather than at its next update
+    if (result)
+        WakeSocketThread();
+
     // -- return the result
     return (result);
 }
@@ -1278,6 +1782,10 @@ bool CSocket::SendDataPacket(tDataPacket* dataPacket)
     // -- unlock the thread
     mThreadLock.Unlock();
 
+    // -- the socket thread sends immediately, rather than at its next update
+    if (result)
+        WakeSocketThread();
+
     // -- return the result
     // -- note:  if this returns false, the packet will not have been enqueued,
     // -- so the requester must either try again, or delete the memory
@@ -1305,6 +1813,10 @@ bool CSocket::SendPrintDataPacket(tDataPacket* dataPacket)
     // -- unlock the thread
     mThreadLock.Unlock();
 
+    // -- the socket thread sends immediately, rather than at its next update
+    if (result)
+        WakeSocketThread();
+
     // -- return the result
     // -- note:  if this returns false, the packet will not have been enqueued,
     // -- so the requester must either try again, or delete the memory
@@ -1348,6 +1860,56 @@ bool CSocket::Update()
     return (true);
 }
 
+// ====================================================================================================================
+// WaitForEvents():  Blocks the socket thread until there's socket traffic, a wakeup, or the timeout elapses
+// ====================================================================================================================
+void CSocket::WaitForEvents(int32 timeout_ms)
+{
+#if !SOCKET_EPOLL
+    // -- winsock simply polls
+    Sleep(timeout_ms);
+#else
+    if (mEpollFD < 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+        return;
+    }
+
+    // -- (re)register the sockets - closing a socket removes it from the epoll set, so a new socket is added,
+    // and we only watch for writable while there's something left to send
+    mThreadLock.Lock();
+    intptr_t watch_sockets[2] = { mListenSocket, mConnected ? mConnectSocket : k_InvalidSocket };
+    uint32 watch_events[2] = { EPOLLIN, EPOLLIN | EPOLLRDHUP | (mSendQueue.Size() > 0 ? EPOLLOUT : 0) };
+    for (int32 i = 0; i < 2; ++i)
+    {
+        if (watch_sockets[i] == k_InvalidSocket)
+            continue;
+
+        epoll_event socket_event;
+        memset(&socket_event, 0, sizeof(socket_event));
+        socket_event.events = watch_events[i];
+        socket_event.data.fd = (int)watch_sockets[i];
+        if (epoll_ctl(mEpollFD, EPOLL_CTL_MOD, (int)watch_sockets[i], &socket_event) != 0 && errno == ENOENT)
+            epoll_ctl(mEpollFD, EPOLL_CTL_ADD, (int)watch_sockets[i], &socket_event);
+    }
+    mThreadLock.Unlock();
+
+    // -- wait - we don't need to know which socket is ready, the update services both
+    epoll_event ready_events[4];
+    int ready_count = epoll_wait(mEpollFD, ready_events, 4, timeout_ms);
+    for (int i = 0; i < ready_count; ++i)
+    {
+        // -- reset the wakeup
+        if (ready_events[i].data.fd == mWakeEventFD)
+        {
+            uint64 value = 0;
+            ssize_t result = read(mWakeEventFD, &value, sizeof(value));
+            (void)result;
+        }
+    }
+#endif
+}
+
 // -- Because sockets run in their own thread, they have to enqueue commands and statements through a mutex
 // ====================================================================================================================
 // ScriptCommand():  Create a text command, to be enqueued in the script context thread
@@ -1362,7 +1924,7 @@ bool8 CSocket::ScriptCommand(const char* fmt, ...)
     va_list args;
     va_start(args, fmt);
     char cmdBuf[2048];
-    vsprintf_s(cmdBuf, 2048, fmt, args);
+    vsnprintf(cmdBuf, sizeof(cmdBuf), fmt, args);
     va_end(args);
 
     // -- add the command to the thread buffer
@@ -1451,40 +2013,31 @@ bool CSocket::SendScriptSignature(uint32 func_hash, TinScript::CFunctionContext*
         return (false);
 
     // -- we pack the function hash, then the arg count, and then the type of each arg
-    uint32 packet_buffer[kMaxRegisteredParameterCount + 2];
-    uint32* data_ptr = (uint32*)packet_buffer;
-
-    // -- function hash
-    *data_ptr++ = func_hash;
-
-    // -- arg count
     int32 arg_count = func_context->GetParameterCount();
     if (arg_count > kMaxRegisteredParameterCount)
         arg_count = kMaxRegisteredParameterCount;
-    *data_ptr++ = arg_count;
 
-    // -- loop through the args, add the type of each
-    for (int i = 0; i < arg_count; ++i)
-    {
-        *data_ptr++ = (uint32)func_context->GetParameter(i)->GetType();
-    }
-
-    // -- create the header
-    // -- at this point, we have the packet data ready to send
-    void* data_start = &packet_buffer[0];
-    int32 total_size = kPointerDiffUInt32(data_ptr, data_start);
-
-    // -- create the packet header
+    // -- the size is known up front, so the packet is created first, and written in place
+    int32 total_size = (arg_count + 2) * (int32)sizeof(uint32);
     SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::SCRIPT_FUNCTION_SIGNATURE, total_size);
-
-    // -- now create the packet to send
-    SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header, data_start);
+    SocketManager::tDataPacket* newPacket = SocketManager::CreateDataPacket(&header, NULL);
     if (!newPacket)
     {
         TinPrint(mScriptContext, "Error - SendScriptSignature():  not connected - don't forget to SocketListen()\n");
         return (false);
     }
 
+    // -- function hash, then the arg count
+    uint32* data_ptr = (uint32*)newPacket->mData;
+    *data_ptr++ = func_hash;
+    *data_ptr++ = arg_count;
+
+    // -- loop through the args, add the type of each
+    for (int i = 0; i < arg_count; ++i)
+    {
+        *data_ptr++ = (uint32)func_context->GetParameter(i)->GetType();
+    }
+
     // -- send the packet
     SocketManager::SendDataPacket(newPacket);
 
@@ -1532,11 +2085,12 @@ bool CSocket::ReceiveScriptSignature(void* data)
 
 // ====================================================================================================================
 // ProcessRecvData():  Reconstitute a data stream back into packets
+// -- a packet whose data lies entirely within the given buffer references it, only split packets are copied
 // ====================================================================================================================
-bool CSocket::ProcessRecvData(void* data, int dataSize)
+bool CSocket::ProcessRecvData(tPacketBuffer* buffer, char* data, int dataSize)
 {
     // -- keep track of the data left to process
-    char* dataPtr = (char*)data;
+    char* dataPtr = data;
     int bytesToProcess = dataSize;
 
     // -- keep processing, as long as we have data
@@ -1580,13 +2134,29 @@ bool CSocket::ProcessRecvData(void* data, int dataSize)
                     return (false);
                 }
 
-                if (newPacketHeader->mSize < 0 || newPacketHeader->mSize > 1024)
+                if (newPacketHeader->mSize < 0 || newPacketHeader->mSize > k_MaxPacketSize)
                 {
                     // -- invalid size
                     return (false);
                 }
 
-                // -- create the new packet
+                // -- if we've already received all the data, the packet references it in place
+                int32 data_size = newPacketHeader->mSize;
+                if (buffer != NULL && data_size > 0 && bytesToProcess >= data_size)
+                {
+                    tDataPacket* newPacket = new tDataPacket(newPacketHeader, buffer, dataPtr);
+                    dataPtr += data_size;
+                    bytesToProcess -= data_size;
+                    mRecvPtr = mRecvHeader;
+                    if (!mRecvQueue.Enqueue(newPacket))
+                    {
+                        delete newPacket;
+                        return (false);
+                    }
+                    continue;
+                }
+
+                // -- otherwise, create the new packet, and copy the data as it arrives
                 mRecvPacket = new tDataPacket((tPacketHeader*)mRecvHeader, NULL);
 
                 // -- reset the recv pointer to the data of the new packet
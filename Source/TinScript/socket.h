@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <stdint.h>
 #include <vector>
 
 // -- includes required by any system wanting access to TinScript
@@ -36,10 +38,23 @@ const int32 k_MaxPacketSize = 1024;
 const int32 k_DefaultPort = 27069;
 const int32 k_MaxBufferSize = 8 * 1024;
 
+// -- the socket thread waits at most this long for socket traffic (or a wakeup), before updating the heartbeat
 const int32 k_ThreadUpdateTimeMS = 10;
 const int32 k_HeartbeatTimeMS = 10000;
 const int32 k_HeartbeatTimeoutMS = 300000;
 
+// -- the send and recv queues are ring buffers, grown (doubled) from this capacity, which must be a power of 2
+const int32 k_DataQueueInitialSize = 64;
+
+// -- socket handles are stored as an intptr_t on every platform (a winsock SOCKET, or a file descriptor)
+const intptr_t k_InvalidSocket = -1;
+
+// -- packets, and their payload buffers, are allocated from pooled size classes - larger allocations use the heap
+// -- each class keeps at most k_PacketPoolMaxFree blocks for reuse
+const int32 k_PacketPoolSizeClasses[] = { 64, 256, 1024, k_MaxBufferSize };
+const int32 k_PacketPoolClassCount = sizeof(k_PacketPoolSizeClasses) / sizeof(int32);
+const int32 k_PacketPoolMaxFree = 256;
+
 // ====================================================================================================================
 // namespace SocketManager: managing remote connections
 // ====================================================================================================================
@@ -50,6 +65,7 @@ namespace SocketManager
 // -- forward declarations
 struct tPacketHeader;
 struct tDataPacket;
+struct tPacketBuffer;
 
 // -- initialize the SocketManager
 void Initialize();
@@ -82,12 +98,36 @@ void SendDebuggerBreak();
 // -- finally, send the data packet.
 // -- note:  if sending the data packet fails, the client is required to resend or deallocate the memory
 
+// -- to build a packet in place, create it with the max size, write to mData, and SetSize() to the size written
+// -- a received packet usually points directly into the buffer it was received in - deleting it releases the buffer
+
 typedef void (*ProcessRecvDataCallback)(tDataPacket* packet); 
-void RegisterProcessRecvDataCallback(ProcessRecvDataCallback recvCallback);
+ProcessRecvDataCallback RegisterProcessRecvDataCallback(ProcessRecvDataCallback recvCallback);
 tDataPacket* CreateDataPacket(tPacketHeader* header, void* data); 
 bool SendDataPacket(tDataPacket* dataPacket);
 bool SendPrintDataPacket(tDataPacket* dataPacket);
 
+// ====================================================================================================================
+// -- the packet pool, thread safe - blocks are allocated and released by both the script and socket threads
+void* PacketPoolAlloc(size_t size);
+void PacketPoolFree(void* block);
+
+// -- reference counted payload buffers
+tPacketBuffer* AllocPacketBuffer(int32 size);
+void AddRefPacketBuffer(tPacketBuffer* buffer);
+void ReleasePacketBuffer(tPacketBuffer* buffer);
+
+// ====================================================================================================================
+// struct tPacketBuffer:  a pooled, reference counted buffer, the data immediately following
+// ====================================================================================================================
+struct tPacketBuffer
+{
+    std::atomic<int32> mRefCount;
+    int32 mCapacity;
+
+    char* GetData() { return ((char*)(this + 1)); }
+};
+
 // ====================================================================================================================
 // struct tPacketHeader:  struct to organize the data being queued for send/recv
 // ====================================================================================================================
@@ -150,9 +190,13 @@ struct tDataPacket
 
         // -- allocate the buffer
         mData = NULL;
+        mBuffer = NULL;
+        mCapacity = 0;
         if (mHeader.mSize > 0)
         {
-            mData = new char[mHeader.mSize];
+            mBuffer = AllocPacketBuffer(mHeader.mSize);
+            mData = mBuffer->GetData();
+            mCapacity = mHeader.mSize;
 
             // -- if we already have data, fill that in as well
             if (data != NULL)
@@ -162,16 +206,43 @@ struct tDataPacket
         }
     }
 
+    // -- constructor, referencing the data within a shared buffer (e.g. the buffer the packet was received in)
+    tDataPacket(tPacketHeader* header, tPacketBuffer* buffer, char* data)
+    {
+        memset(&mHeader, 0, sizeof(tPacketHeader));
+        memcpy(&mHeader, header, tPacketHeader::HeaderSize);
+
+        AddRefPacketBuffer(buffer);
+        mBuffer = buffer;
+        mData = data;
+        mCapacity = mHeader.mSize;
+    }
+
     // -- destructor
     ~tDataPacket()
     {
-        if (mData)
-            delete [] mData;
+        if (mBuffer)
+            ReleasePacketBuffer(mBuffer);
+    }
+
+    // -- packets are pooled
+    static void* operator new(size_t size) { return (PacketPoolAlloc(size)); }
+    static void operator delete(void* block) { PacketPoolFree(block); }
+
+    // -- a packet built in place is created at its max size, and set to the size actually written before sending
+    bool SetSize(int32 size)
+    {
+        if (size < 0 || size > mCapacity)
+            return (false);
+        mHeader.mSize = size;
+        return (true);
     }
 
     // -- members, a header and the packet data
     tPacketHeader mHeader;
     char* mData;
+    tPacketBuffer* mBuffer;
+    int32 mCapacity;
 
     private:
         // -- no empty packets
@@ -185,16 +256,25 @@ class DataQueue
 {
     public:
         DataQueue();
+        ~DataQueue();
         bool Enqueue(tDataPacket* packet, bool at_front = false);
         bool Dequeue(tDataPacket*& packet, bool peekOnly = false);
 
+        // -- returns the packet at the given position from the front, without dequeuing it
+        tDataPacket* Peek(int32 index) const;
+
         // -- clear the entire queue
         void Clear();
 
-        size_t Size() const { return mQueue.size(); }
+        int32 Size() const { return (mCount); }
 
     protected:
-        std::vector<tDataPacket*> mQueue;
+        void Grow();
+
+        tDataPacket** mQueue;
+        int32 mCapacity;
+        int32 mHead;
+        int32 mCount;
 };
 
 // ====================================================================================================================
@@ -258,6 +338,9 @@ class CSocket
         // -- update, to send/recv data
         bool Update();
 
+        // -- blocks the socket thread until there's socket traffic, a wakeup, or the timeout elapses
+        void WaitForEvents(int32 timeout_ms);
+
         // -- Because sockets run in their own thread, they have to enqueue commands and statements through a mutex
         bool ScriptCommand(const char* fmt, ...);
 
@@ -276,14 +359,16 @@ class CSocket
         bool mListen;
         bool mConnected;
         bool mIsShuttingDown = false;
-        uint32* mListenSocket;
-        uint32* mConnectSocket;
+        intptr_t mListenSocket;
+        intptr_t mConnectSocket;
 
         // -- we need access to the script context for which this socket was created
         TinScript::CScriptContext* mScriptContext;
 
-        // -- we need to reconstitute packets as they arrive
-        bool ProcessRecvData(void* data, int dataSize);
+        // -- we need to reconstitute packets as they arrive - a packet received whole within the recv buffer
+        // references it, rather than copying the data
+        bool ProcessRecvData(tPacketBuffer* buffer, char* data, int dataSize);
+        tPacketBuffer* mRecvBuffer;
         char mRecvHeader[tPacketHeader::HeaderSize];
         char* mRecvPtr;
         tDataPacket* mRecvPacket;
@@ -292,9 +377,10 @@ class CSocket
         DataQueue mSendQueue;
         DataQueue mRecvQueue;
 
-        // -- timers to track last packet sent/received
+        // -- timers to track last packet sent/received, decremented by the time elapsed between updates
         int32 mSendHeartbeatTimer;
         int32 mRecvHeartbeatTimer;
+        int64 mHeartbeatUpdateTime;
 
         // -- we need to ensure the queues are thread safe
         TinScript::CThreadMutex mThreadLock;
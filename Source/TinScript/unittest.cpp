@@ -32,13 +32,24 @@
 
 // -- lib includes
 #include "stdio.h"
+#include "string.h"
 
 // -- platform includes
+#if defined(_WIN32)
+    #include <winsock2.h>
+    typedef SOCKET tUnitTestSocketHandle;
+#else
+    #include <sys/socket.h>
+    typedef int tUnitTestSocketHandle;
+#endif
+
 #if TS_PLATFORM_WINDOWS
     #include <Windows.h>
 #endif
 
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 #include "mathutil.h"
 
@@ -46,10 +57,14 @@
 #include "TinHash.h"
 #include "TinHashtable.h"
 #include "TinScript.h"
+#include "TinObjectGroup.h"
 #include "TinRegistration.h"
+#include "TinStringTable.h"
 
 #include "TinRegBinding.h"
 
+#include "socket.h"
+
 #if PLATFORM_UE4 && TS_PLATFORM_WINDOWS
     #undef WIN32_LEAN_AND_MEAN
 #endif
@@ -61,9 +76,11 @@ DECLARE_FILE(unittest_cpp);
 #if PLATFORM_UE4
     static const char* kUnitTestScriptName = "unittest.ts";
     static const char* kProfilingTestScriptName = "profilingtest.ts";
+    static const char* kUnitTestWorkerScriptName = "unittest_worker.ts";
 #else
     static const char* kUnitTestScriptName = "../Source/TinScript/unittest.ts";
     static const char* kProfilingTestScriptName = "../Source/TinScript/profilingtest.ts";
+    static const char* kUnitTestWorkerScriptName = "unittest_worker.ts";
 #endif
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -136,6 +153,11 @@ class CBase {
             boolvalue = val;
         }
 
+        // -- object-local, and safe to dispatch from CObjectSet::ParallelForEachNative()
+        void DoubleIntValue() {
+            intvalue = 2 * intvalue;
+        }
+
         int32 TestP1(int32 a)
         {
             MTPrint("CBase P1: %d\n", a);
@@ -178,6 +200,7 @@ REGISTER_METHOD(CBase, GetBoolValue, GetBoolValue);
 REGISTER_METHOD(CBase, SetFloatValue, SetFloatValue);
 REGISTER_METHOD(CBase, SetIntValue, SetIntValue);
 REGISTER_METHOD(CBase, SetBoolValue, SetBoolValue);
+REGISTER_THREADSAFE_METHOD(CBase, DoubleIntValue, DoubleIntValue);
 
 class CChild : public CBase {
     public:
@@ -311,6 +334,857 @@ REGISTER_FUNCTION(UnitTest_IsGreaterThan, UnitTest_IsGreaterThan);
 REGISTER_FUNCTION(UnitTest_AnimalType, UnitTest_AnimalType);
 REGISTER_FUNCTION(UnitTest_V3fNormalize, UnitTest_V3fNormalize);
 
+// -- posts typed thread commands from several threads at once, then drains the queue on this thread
+// -- returns the number of commands rejected because the queue was full
+int32 UnitTest_PostThreadCommands(int32 thread_count, int32 commands_per_thread)
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+    uint32 func_hash = TinScript::Hash("UnitTest_ThreadCommandReceived");
+    uint32 rejected_count = script_context->GetThreadCommandRejectedCount();
+
+    const int32 max_thread_count = 8;
+    thread_count = thread_count < max_thread_count ? thread_count : max_thread_count;
+    std::thread threads[max_thread_count];
+    for (int32 t = 0; t < thread_count; ++t)
+    {
+        threads[t] = std::thread([script_context, func_hash, commands_per_thread]()
+        {
+            TinScript::CThreadCommand command;
+            for (int32 i = 1; i <= commands_per_thread; ++i)
+            {
+                command.Reset(func_hash);
+                command.AddParam(TinScript::TYPE_int, &i);
+                command.AddParam(TinScript::TYPE_string, "post");
+                script_context->PostThreadCommand(command);
+            }
+        });
+    }
+
+    for (int32 t = 0; t < thread_count; ++t)
+        threads[t].join();
+
+    // -- each update executes a limited number of commands
+    int32 update_count = (thread_count * commands_per_thread) / kThreadCommandProcessMax + 1;
+    for (int32 i = 0; i < update_count && script_context->GetThreadCommandCount() > 0; ++i)
+        script_context->ProcessThreadCommands();
+
+    return ((int32)(script_context->GetThreadCommandRejectedCount() - rejected_count));
+}
+
+REGISTER_FUNCTION(UnitTest_PostThreadCommands, UnitTest_PostThreadCommands);
+
+// -- blocks freed from another thread are queued to their allocator, and freed by its next allocation
+// -- once released, the allocator (and any block header still naming it) is no longer live
+void UnitTest_RemoteFree()
+{
+    const int32 block_count = 16;
+    TinScript::CScriptAllocator* allocator = new TinScript::CPoolAllocator();
+    uint32 generation = allocator->GetGeneration();
+    bool8 live = TinScript::CScriptAllocator::IsLive(allocator, generation);
+
+    void* blocks[block_count];
+    for (int32 i = 0; i < block_count; ++i)
+        blocks[i] = allocator->Alloc(ALLOC_Integration, 64);
+    int32 alloc_count = allocator->GetAllocationCount(ALLOC_Integration);
+
+    // -- the thread has no context, so its frees are remote
+    std::thread free_thread([&blocks]()
+    {
+        for (int32 i = 0; i < block_count; ++i)
+            TinScript::CMemoryTracker::Free(blocks[i]);
+    });
+    free_thread.join();
+    int32 queued_count = allocator->GetAllocationCount(ALLOC_Integration);
+
+    allocator->ProcessRemoteFrees();
+    int32 freed_count = allocator->GetAllocationCount(ALLOC_Integration);
+
+    allocator->Release();
+    bool8 released = !TinScript::CScriptAllocator::IsLive(allocator, generation);
+
+    snprintf(CUnitTest::gCodeResult, sizeof(CUnitTest::gCodeResult), "%s %d %d %d %s", live ? "true" : "false",
+             alloc_count, queued_count, freed_count, released ? "true" : "false");
+}
+
+// -- submits jobs to a worker pool executing unittest.ts - odd jobs report through a script callback,
+// and even jobs are polled as futures
+// -- returns the sum of the future results
+int32 UnitTest_RunWorkerPool(int32 worker_count, int32 job_count)
+{
+    const char* script_files[] = { kUnitTestScriptName };
+    TinScript::CScriptWorkerPool* worker_pool =
+        TinAlloc(ALLOC_WorkerPool, TinScript::CScriptWorkerPool, worker_count, script_files, 1);
+
+    uint32 func_hash = TinScript::Hash("UnitTest_WorkerJob");
+    uint32 callback_hash = TinScript::Hash("UnitTest_WorkerJobComplete");
+
+    const int32 max_job_count = 64;
+    job_count = job_count < max_job_count ? job_count : max_job_count;
+    TinScript::CScriptJob* futures[max_job_count];
+    int32 future_count = 0;
+
+    TinScript::CThreadCommand command;
+    for (int32 i = 1; i <= job_count; ++i)
+    {
+        command.Reset(func_hash);
+        command.AddParam(TinScript::TYPE_int, &i);
+        if ((i & 1) != 0)
+            worker_pool->Submit(command, callback_hash);
+        else
+            futures[future_count++] = worker_pool->Submit(command);
+    }
+
+    // -- the callbacks are normally executed during UpdateContext(), but we're mid-test, so collect them directly
+    while (worker_pool->GetActiveCount() > 0)
+    {
+        worker_pool->Update();
+        std::this_thread::yield();
+    }
+
+    int32 future_sum = 0;
+    for (int32 i = 0; i < future_count; ++i)
+    {
+        if (futures[i] != nullptr && futures[i]->Succeeded() &&
+            futures[i]->GetResultType() == TinScript::TYPE_int)
+        {
+            future_sum += *(int32*)futures[i]->GetResultAddr();
+        }
+        worker_pool->Release(futures[i]);
+    }
+
+    TinFree(worker_pool);
+    return (future_sum);
+}
+
+REGISTER_FUNCTION(UnitTest_RunWorkerPool, UnitTest_RunWorkerPool);
+
+// -- creates a worker pool executing unittest.ts, and returns the number of references the workers added
+// to the compiled image of unittest.ts, already loaded by this context
+int32 UnitTest_SharedCodeBlockImage(int32 worker_count)
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+    char full_path[kMaxNameLength * 2];
+    if (!script_context->GetFullPath(kUnitTestScriptName, full_path, sizeof(full_path)))
+        return (-1);
+
+    TinScript::CCodeBlock* codeblock = script_context->GetCodeBlockList()->FindItem(TinScript::HashValue(full_path));
+    if (codeblock == nullptr || codeblock->GetImage() == nullptr)
+        return (-1);
+
+    int32 ref_count = codeblock->GetImage()->GetRefCount();
+
+    const char* script_files[] = { kUnitTestScriptName };
+    TinScript::CScriptWorkerPool* worker_pool =
+        TinAlloc(ALLOC_WorkerPool, TinScript::CScriptWorkerPool, worker_count, script_files, 1);
+    int32 shared_count = codeblock->GetImage()->GetRefCount() - ref_count;
+    TinFree(worker_pool);
+
+    return (shared_count);
+}
+
+REGISTER_FUNCTION(UnitTest_SharedCodeBlockImage, UnitTest_SharedCodeBlockImage);
+
+// -- calls the method on every member of the group, with CObjectSet::ParallelForEach(), by a worker pool executing
+// unittest.ts - without workers, the method is called on each member in order
+// -- returns the number of members the method was called on
+int32 UnitTest_RunParallelForEach(int32 worker_count, uint32 group_id, const char* method_name)
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+    TinScript::CObjectEntry* oe = script_context->FindObjectEntry(group_id);
+    if (oe == nullptr || !oe->HasNamespace(HashLiteral_("CObjectSet")))
+        return (-1);
+
+    TinScript::CScriptWorkerPool* worker_pool = nullptr;
+    if (worker_count > 0)
+    {
+        const char* script_files[] = { kUnitTestScriptName };
+        worker_pool = TinAlloc(ALLOC_WorkerPool, TinScript::CScriptWorkerPool, worker_count, script_files, 1);
+    }
+
+    int32 call_count = static_cast<TinScript::CObjectSet*>(oe->GetAddr())->ParallelForEach(method_name);
+
+    if (worker_pool != nullptr)
+        TinFree(worker_pool);
+    return (call_count);
+}
+
+REGISTER_FUNCTION(UnitTest_RunParallelForEach, UnitTest_RunParallelForEach);
+
+// -- holds each worker job until every worker is executing one, so each job is executed by a different worker
+static std::atomic<int32> gUnitTestWorkerBarrier(0);
+void UnitTest_WorkerBarrier(int32 worker_count)
+{
+    ++gUnitTestWorkerBarrier;
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    while (gUnitTestWorkerBarrier.load() < worker_count &&
+           std::chrono::steady_clock::now() - start_time < std::chrono::seconds(2))
+    {
+        std::this_thread::yield();
+    }
+}
+
+REGISTER_FUNCTION(UnitTest_WorkerBarrier, UnitTest_WorkerBarrier);
+
+// -- writes a script this context never compiles, and executes it in a worker pool - the first worker compiles it,
+// and the rest share the compiled image, so each must find the script's string literal in its own string table
+// -- returns the number of workers that returned the literal
+int32 UnitTest_WorkerLiterals(int32 worker_count)
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+    char full_path[kMaxNameLength * 2];
+    if (!script_context->GetFullPath(kUnitTestWorkerScriptName, full_path, sizeof(full_path)))
+        return (-1);
+
+    // -- the source is rewritten each time, so it's always newer than the binary, and compiled by the first worker
+    const char* worker_script =
+        "string UnitTest_WorkerLiteral(int worker_count)\r\n"
+        "{\r\n"
+        "    UnitTest_WorkerBarrier(worker_count);\r\n"
+        "    return (\"worker literal\");\r\n"
+        "}\r\n";
+
+    FILE* filehandle = NULL;
+    if (fopen_s(&filehandle, full_path, "wb") != 0 || filehandle == NULL)
+        return (-1);
+    fwrite(worker_script, sizeof(char), strlen(worker_script), filehandle);
+    fclose(filehandle);
+
+    const char* script_files[] = { kUnitTestWorkerScriptName };
+    TinScript::CScriptWorkerPool* worker_pool =
+        TinAlloc(ALLOC_WorkerPool, TinScript::CScriptWorkerPool, worker_count, script_files, 1);
+
+    const int32 max_job_count = 8;
+    worker_count = worker_count < max_job_count ? worker_count : max_job_count;
+    TinScript::CScriptJob* futures[max_job_count];
+
+    gUnitTestWorkerBarrier = 0;
+    TinScript::CThreadCommand command;
+    for (int32 i = 0; i < worker_count; ++i)
+    {
+        command.Reset(TinScript::Hash("UnitTest_WorkerLiteral"));
+        command.AddParam(TinScript::TYPE_int, &worker_count);
+        futures[i] = worker_pool->Submit(command);
+    }
+
+    while (worker_pool->GetActiveCount() > 0)
+        std::this_thread::yield();
+
+    int32 literal_count = 0;
+    for (int32 i = 0; i < worker_count; ++i)
+    {
+        if (futures[i] != nullptr && futures[i]->Succeeded() &&
+            futures[i]->GetResultType() == TinScript::TYPE_string &&
+            strcmp((const char*)futures[i]->GetResultAddr(), "worker literal") == 0)
+        {
+            ++literal_count;
+        }
+        worker_pool->Release(futures[i]);
+    }
+
+    TinFree(worker_pool);
+    return (literal_count);
+}
+
+REGISTER_FUNCTION(UnitTest_WorkerLiterals, UnitTest_WorkerLiterals);
+
+// -- the string table index starts at kStringTableIndexSize slots, and grows as strings are added
+int32 UnitTest_StringTableIndexSize()
+{
+    return (TinScript::GetContext()->GetStringTable()->GetIndexSize());
+}
+
+REGISTER_FUNCTION(UnitTest_StringTableIndexSize, UnitTest_StringTableIndexSize);
+
+// -- the number of strings in the table, referenced or not
+int32 UnitTest_StringTableCount()
+{
+    return (TinScript::GetContext()->GetStringTable()->GetStringCount());
+}
+
+REGISTER_FUNCTION(UnitTest_StringTableCount, UnitTest_StringTableCount);
+
+// -- a registered function returning a different string for every value
+const char* UnitTest_NativeString(int32 value)
+{
+    char* buffer = TinScript::GetContext()->GetScratchBuffer();
+    snprintf(buffer, kMaxTokenLength, "ut_native_string_%d", value);
+    return (buffer);
+}
+
+REGISTER_FUNCTION(UnitTest_NativeString, UnitTest_NativeString);
+
+// -- strings returned from a registered function are released with the value - run between executions, so the
+// unreferenced strings can be removed, and the table must be the same size before and after the loop
+void UnitTest_NativeStringRelease()
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+    TinScript::CStringTable* string_table = script_context->GetStringTable();
+
+    // -- the first execution compiles the command
+    script_context->ExecCommand("UnitTest_NativeStringLoop(1000);");
+    string_table->RemoveUnreferencedStrings();
+    int32 string_count = string_table->GetStringCount();
+
+    script_context->ExecCommand("UnitTest_NativeStringLoop(1000);");
+    string_table->RemoveUnreferencedStrings();
+
+    snprintf(CUnitTest::gCodeResult, sizeof(CUnitTest::gCodeResult), "%d",
+             string_table->GetStringCount() - string_count);
+}
+
+// -- threads without a context hash the same strings at once, into the shared string table
+// -- each string must be added exactly once, every lookup (while other threads insert) must find the right string,
+// and the main thread must be able to UnHash() them, although its own string table never saw them
+void UnitTest_SharedStringTable()
+{
+    const int32 thread_count = 8;
+    const int32 string_count = 10000;
+    int32 count_before = TinScript::CSharedStringTable::GetInstance()->GetStringCount();
+
+    std::atomic<int32> mismatch_count(0);
+    std::thread threads[thread_count];
+    for (int32 t = 0; t < thread_count; ++t)
+    {
+        threads[t] = std::thread([t, &mismatch_count]()
+        {
+            // -- each thread starts at a different string, so inserts and lookups interleave
+            TinScript::CSharedStringTable* shared_table = TinScript::CSharedStringTable::GetInstance();
+            char buffer[32];
+            for (int32 i = 0; i < string_count; ++i)
+            {
+                snprintf(buffer, sizeof(buffer), "shared_string_%d", (i + t * (string_count / thread_count)) %
+                                                                     string_count);
+                uint32 hash = TinScript::Hash(buffer);
+                const char* found = shared_table->FindString(hash);
+                if (hash != TinScript::HashValue(buffer) || found == nullptr || strcmp(found, buffer) != 0)
+                    ++mismatch_count;
+            }
+        });
+    }
+
+    for (int32 t = 0; t < thread_count; ++t)
+        threads[t].join();
+
+    TinScript::CSharedStringTable* shared_table = TinScript::CSharedStringTable::GetInstance();
+    int32 added_count = shared_table->GetStringCount() - count_before;
+
+    uint32 sample_hash = TinScript::HashValue("shared_string_1234");
+    bool8 unhashed = TinScript::GetContext()->GetStringTable()->FindString(sample_hash) == nullptr &&
+                     strcmp(TinScript::UnHash(sample_hash), "shared_string_1234") == 0;
+
+    snprintf(CUnitTest::gCodeResult, sizeof(CUnitTest::gCodeResult), "%d %d %s %s", added_count,
+             mismatch_count.load(), shared_table->GetLevelCount() > 1 ? "true" : "false", unhashed ? "true" : "false");
+}
+
+// -- a private scheduler with a (deliberately too small) frame budget, a burst of low priority commands, and one
+// high priority command, all due on the same frame - returns true if the burst was dispatched within the max deferral
+bool8 UnitTest_RunScheduleBudget(int32 command_count, int32 max_deferral_frames)
+{
+    TinScript::CScheduler* scheduler =
+        TinAlloc(ALLOC_SchedCmd, TinScript::CScheduler, TinScript::GetContext());
+    scheduler->SetFrameBudget(1, max_deferral_frames);
+
+    for (int32 i = 0; i < command_count; ++i)
+        scheduler->Schedule(0, 1, false, "UnitTest_ScheduleRecord(1);", TinScript::eSchedulePriorityLow);
+    scheduler->Schedule(0, 1, false, "UnitTest_ScheduleRecord(9);", TinScript::eSchedulePriorityHigh);
+
+    uint32 sim_time = 0;
+    int32 frame_count = 0;
+    do
+    {
+        scheduler->Update(++sim_time);
+        ++frame_count;
+    } while (scheduler->GetBacklogCount() > 0 && frame_count <= max_deferral_frames + 1);
+
+    bool8 bounded = scheduler->GetBacklogCount() == 0 && frame_count <= max_deferral_frames + 1;
+    TinFree(scheduler);
+
+    return (bounded);
+}
+
+REGISTER_FUNCTION(UnitTest_RunScheduleBudget, UnitTest_RunScheduleBudget);
+
+// -- schedules the coroutine worker count times, and updates until every coroutine has completed
+// -- returns true if all were suspended at once, and all completed
+bool8 UnitTest_RunCoroutines(int32 count)
+{
+    TinScript::CScheduler* scheduler =
+        TinAlloc(ALLOC_SchedCmd, TinScript::CScheduler, TinScript::GetContext());
+
+    for (int32 i = 0; i < count; ++i)
+        scheduler->ScheduleCreate(0, 1, TinScript::Hash("UnitTest_CoroutineWorker"), false, false);
+
+    uint32 sim_time = 0;
+    int32 max_suspended = 0;
+    do
+    {
+        scheduler->Update(++sim_time);
+        if (scheduler->GetCoroutineCount() > max_suspended)
+            max_suspended = scheduler->GetCoroutineCount();
+    } while (scheduler->GetCoroutineCount() > 0 && sim_time < 100);
+
+    bool8 completed = max_suspended == count && scheduler->GetCoroutineCount() == 0;
+    TinFree(scheduler);
+
+    return (completed);
+}
+
+REGISTER_FUNCTION(UnitTest_RunCoroutines, UnitTest_RunCoroutines);
+
+// -- async functions issue their handles from the scheduler executing the scripts that call them
+static TinScript::CScheduler* gUnitTestAsyncScheduler = nullptr;
+
+// -- completed from another thread, with twice the value
+int32 UnitTest_AsyncDouble(int32 value)
+{
+    TinScript::CScheduler* scheduler = gUnitTestAsyncScheduler;
+    int32 handle = scheduler->AsyncBegin();
+    std::thread([scheduler, handle, value]()
+    {
+        int32 result = value * 2;
+        scheduler->AsyncComplete(handle, TinScript::TYPE_int, &result);
+    }).detach();
+
+    return (handle);
+}
+
+REGISTER_ASYNC_FUNCTION(UnitTest_AsyncDouble, UnitTest_AsyncDouble);
+
+// -- completed immediately, before the calling script has even been suspended, with a string
+int32 UnitTest_AsyncLabel(int32 value)
+{
+    char label[kMaxNameLength];
+    snprintf(label, sizeof(label), "async_%d", value);
+    int32 handle = gUnitTestAsyncScheduler->AsyncBegin();
+    gUnitTestAsyncScheduler->AsyncComplete(handle, TinScript::TYPE_string, label);
+
+    return (handle);
+}
+
+REGISTER_ASYNC_FUNCTION(UnitTest_AsyncLabel, UnitTest_AsyncLabel);
+
+// -- schedules the async worker count times, and updates until every async call has completed
+// -- returns true if all were waiting at once, and all completed
+bool8 UnitTest_RunAsync(int32 count)
+{
+    gUnitTestAsyncScheduler = TinAlloc(ALLOC_SchedCmd, TinScript::CScheduler, TinScript::GetContext());
+
+    for (int32 i = 0; i < count; ++i)
+        gUnitTestAsyncScheduler->ScheduleCreate(0, 1, TinScript::Hash("UnitTest_AsyncWorker"), false, false);
+
+    uint32 sim_time = 0;
+    int32 max_waiting = 0;
+    do
+    {
+        gUnitTestAsyncScheduler->Update(++sim_time);
+        if (gUnitTestAsyncScheduler->GetAsyncWaitCount() > max_waiting)
+            max_waiting = gUnitTestAsyncScheduler->GetAsyncWaitCount();
+
+        // -- give the completing threads a chance to run
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    } while (gUnitTestAsyncScheduler->GetCoroutineCount() > 0 && sim_time < 5000);
+
+    bool8 completed = max_waiting == count && gUnitTestAsyncScheduler->GetCoroutineCount() == 0;
+    TinFree(gUnitTestAsyncScheduler);
+    gUnitTestAsyncScheduler = nullptr;
+
+    return (completed);
+}
+
+REGISTER_FUNCTION(UnitTest_RunAsync, UnitTest_RunAsync);
+
+// -- a headless debugger, counting the records and rows it decodes from the packets it's sent
+class CUnitTestDebuggerClient : public TinScript::CDebuggerSyncListener
+{
+    public:
+        void Reset()
+        {
+            mCreateCount = 0;
+            mDestroyCount = 0;
+            mSetAddCount = 0;
+            mSetRemoveCount = 0;
+            mListCompleteCount = 0;
+            mMemberRowCount = 0;
+            mPacketCount = 0;
+        }
+
+        virtual void OnCreateObject(uint32 object_id, const char* object_name, const char* derivation,
+                                    int32 stack_size, uint32* file_array, int32* line_array) override
+        {
+            ++mCreateCount;
+        }
+
+        virtual void OnDestroyObject(uint32 object_id) override { ++mDestroyCount; }
+        virtual void OnSetAddObject(uint32 set_id, uint32 object_id, bool8 owned) override { ++mSetAddCount; }
+        virtual void OnSetRemoveObject(uint32 set_id, uint32 object_id) override { ++mSetRemoveCount; }
+        virtual void OnListObjectsComplete() override { ++mListCompleteCount; }
+        virtual void OnMemberEntry(TinScript::CDebuggerWatchVarEntry& watch_var_entry) override { ++mMemberRowCount; }
+
+        int32 mCreateCount = 0;
+        int32 mDestroyCount = 0;
+        int32 mSetAddCount = 0;
+        int32 mSetRemoveCount = 0;
+        int32 mListCompleteCount = 0;
+        int32 mMemberRowCount = 0;
+        int32 mPacketCount = 0;
+};
+
+static CUnitTestDebuggerClient gUnitTestDebuggerClient;
+
+// -- the loopback sink delivers each packet straight to the client, and owns the packet once sent
+static bool UnitTest_DebuggerLoopback(SocketManager::tDataPacket* packet)
+{
+    TinScript::CDebuggerSync::DecodePacket((int32*)packet->mData, packet->mHeader.mSize, &gUnitTestDebuggerClient);
+    ++gUnitTestDebuggerClient.mPacketCount;
+    delete packet;
+    return (true);
+}
+
+// -- connects (or disconnects) the headless client, resetting its counts
+void UnitTest_DebuggerSyncConnect(bool8 connect)
+{
+    gUnitTestDebuggerClient.Reset();
+    TinScript::CDebuggerSync* debugger_sync = TinScript::GetContext()->GetDebuggerSync();
+    debugger_sync->Flush();
+    debugger_sync->SetPacketSink(connect ? UnitTest_DebuggerLoopback : nullptr);
+}
+
+// -- sends everything queued, returning the number of packets the client has received since the last reset
+int32 UnitTest_DebuggerSyncFlush()
+{
+    TinScript::GetContext()->GetDebuggerSync()->Flush();
+    return (gUnitTestDebuggerClient.mPacketCount);
+}
+
+void UnitTest_DebuggerSyncReset()
+{
+    gUnitTestDebuggerClient.Reset();
+}
+
+int32 UnitTest_DebuggerSyncCount(const char* counter)
+{
+    if (!strcmp(counter, "create"))
+        return (gUnitTestDebuggerClient.mCreateCount);
+    else if (!strcmp(counter, "destroy"))
+        return (gUnitTestDebuggerClient.mDestroyCount);
+    else if (!strcmp(counter, "set_add"))
+        return (gUnitTestDebuggerClient.mSetAddCount);
+    else if (!strcmp(counter, "set_remove"))
+        return (gUnitTestDebuggerClient.mSetRemoveCount);
+    else if (!strcmp(counter, "list_complete"))
+        return (gUnitTestDebuggerClient.mListCompleteCount);
+    else if (!strcmp(counter, "member_row"))
+        return (gUnitTestDebuggerClient.mMemberRowCount);
+    return (gUnitTestDebuggerClient.mPacketCount);
+}
+
+REGISTER_FUNCTION(UnitTest_DebuggerSyncConnect, UnitTest_DebuggerSyncConnect);
+REGISTER_FUNCTION(UnitTest_DebuggerSyncFlush, UnitTest_DebuggerSyncFlush);
+REGISTER_FUNCTION(UnitTest_DebuggerSyncReset, UnitTest_DebuggerSyncReset);
+REGISTER_FUNCTION(UnitTest_DebuggerSyncCount, UnitTest_DebuggerSyncCount);
+
+// -- a socket pumped directly by the unit tests (rather than by the socket thread), with access to its internals
+class CUnitTestSocket : public SocketManager::CSocket
+{
+    public:
+        CUnitTestSocket() : SocketManager::CSocket(nullptr) { }
+
+        int32 GetSendQueueSize() const { return (mSendQueue.Size()); }
+        bool IsRecvPacketPending() const { return (mRecvPacket != NULL); }
+
+        // -- a small send buffer ensures a burst of packets can't be sent with a single call
+        // -- note:  the recv buffer is left alone - shrinking it once connected stalls the loopback on retransmits
+        void SetSendBufferSize(int32 size)
+        {
+            setsockopt((tUnitTestSocketHandle)mConnectSocket, SOL_SOCKET, SO_SNDBUF, (const char*)&size, sizeof(size));
+        }
+
+        // -- writes raw bytes, bypassing the send queue, e.g. to split a packet across two recvs
+        bool SendRaw(const void* data, int32 size)
+        {
+            return (send((tUnitTestSocketHandle)mConnectSocket, (const char*)data, size, 0) == size);
+        }
+};
+
+static const int32 k_UnitTestSocketBufferSize = 4096;
+static const int32 k_UnitTestSocketPumpMax = 2000;
+static const int32 k_UnitTestSocketMaxKept = 16;
+
+static CUnitTestSocket* gUnitTestSocketServer = nullptr;
+static CUnitTestSocket* gUnitTestSocketClient = nullptr;
+static SocketManager::ProcessRecvDataCallback gUnitTestSocketPrevCallback = nullptr;
+
+// -- each DATA packet begins with its sequence number, and the server counts those received in order, and intact
+static int32 gUnitTestSocketSendCount = 0;
+static int32 gUnitTestSocketRecvCount = 0;
+static int32 gUnitTestSocketIntactCount = 0;
+
+// -- the recv callback owns each packet - it may keep them, rather than delete them
+static bool gUnitTestSocketKeepPackets = false;
+static SocketManager::tDataPacket* gUnitTestSocketKept[k_UnitTestSocketMaxKept];
+static int32 gUnitTestSocketKeptCount = 0;
+
+static void UnitTest_SocketFillPayload(char* data, int32 sequence, int32 size)
+{
+    memcpy(data, &sequence, sizeof(int32));
+    for (int32 i = sizeof(int32); i < size; ++i)
+        data[i] = (char)(sequence + i);
+}
+
+static bool UnitTest_SocketIsIntact(SocketManager::tDataPacket* packet, int32 sequence)
+{
+    if (packet->mHeader.mType != SocketManager::tPacketHeader::DATA || packet->mHeader.mSize < (int32)sizeof(int32))
+        return (false);
+
+    int32 packet_sequence = -1;
+    memcpy(&packet_sequence, packet->mData, sizeof(int32));
+    if (packet_sequence != sequence)
+        return (false);
+
+    for (int32 i = sizeof(int32); i < packet->mHeader.mSize; ++i)
+    {
+        if (packet->mData[i] != (char)(sequence + i))
+            return (false);
+    }
+
+    return (true);
+}
+
+static void UnitTest_SocketRecvData(SocketManager::tDataPacket* packet)
+{
+    if (UnitTest_SocketIsIntact(packet, gUnitTestSocketRecvCount))
+        ++gUnitTestSocketIntactCount;
+    ++gUnitTestSocketRecvCount;
+
+    if (gUnitTestSocketKeepPackets && gUnitTestSocketKeptCount < k_UnitTestSocketMaxKept)
+        gUnitTestSocketKept[gUnitTestSocketKeptCount++] = packet;
+    else
+        delete packet;
+}
+
+// -- connects a client to a listening server, over the loopback, on the default port
+static bool8 UnitTest_SocketOpen()
+{
+    // -- the default port can't be shared with the socket manager
+    if (SocketManager::IsListening() || SocketManager::IsConnected())
+        return (false);
+
+    gUnitTestSocketSendCount = 0;
+    gUnitTestSocketRecvCount = 0;
+    gUnitTestSocketIntactCount = 0;
+    gUnitTestSocketKeepPackets = false;
+    gUnitTestSocketKeptCount = 0;
+
+    gUnitTestSocketServer = new CUnitTestSocket();
+    gUnitTestSocketClient = new CUnitTestSocket();
+    gUnitTestSocketServer->SetListen(true);
+
+    // -- the client connects from another thread, since (on winsock) the server blocks in accept()
+    std::thread connect_thread([]()
+    {
+        for (int32 i = 0; i < k_UnitTestSocketPumpMax && !gUnitTestSocketClient->Connect("127.0.0.1", true); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+
+    for (int32 i = 0; i < k_UnitTestSocketPumpMax && !gUnitTestSocketServer->IsConnected(); ++i)
+    {
+        if (!gUnitTestSocketServer->Listen())
+            break;
+        if (!gUnitTestSocketServer->IsConnected())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    connect_thread.join();
+
+    if (!gUnitTestSocketServer->IsConnected() || !gUnitTestSocketClient->IsConnected())
+        return (false);
+
+    gUnitTestSocketClient->SetSendBufferSize(k_UnitTestSocketBufferSize);
+    gUnitTestSocketPrevCallback = SocketManager::RegisterProcessRecvDataCallback(UnitTest_SocketRecvData);
+    return (true);
+}
+
+static void UnitTest_SocketClose()
+{
+    if (gUnitTestSocketServer == nullptr)
+        return;
+
+    SocketManager::RegisterProcessRecvDataCallback(gUnitTestSocketPrevCallback);
+    gUnitTestSocketPrevCallback = nullptr;
+
+    for (int32 i = 0; i < gUnitTestSocketKeptCount; ++i)
+    {
+        if (gUnitTestSocketKept[i] != nullptr)
+            delete gUnitTestSocketKept[i];
+    }
+    gUnitTestSocketKeptCount = 0;
+
+    delete gUnitTestSocketClient;
+    delete gUnitTestSocketServer;
+    gUnitTestSocketClient = nullptr;
+    gUnitTestSocketServer = nullptr;
+}
+
+// -- does the work of both socket threads, until the server has received the expected number of packets
+static bool8 UnitTest_SocketPump(int32 expected_count)
+{
+    for (int32 i = 0; i < k_UnitTestSocketPumpMax; ++i)
+    {
+        gUnitTestSocketClient->ProcessSendPackets();
+        gUnitTestSocketServer->ReceivePackets();
+        gUnitTestSocketServer->ProcessRecvPackets();
+        if (gUnitTestSocketRecvCount >= expected_count)
+            return (true);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return (false);
+}
+
+static void UnitTest_SocketQueuePackets(int32 count, int32 size)
+{
+    for (int32 i = 0; i < count; ++i)
+    {
+        SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::DATA, size);
+        SocketManager::tDataPacket* packet = new SocketManager::tDataPacket(&header, NULL);
+        UnitTest_SocketFillPayload(packet->mData, gUnitTestSocketSendCount++, size);
+        gUnitTestSocketClient->SendDataPacket(packet);
+    }
+}
+
+// -- returns the number of packets received in order, and intact
+static int32 UnitTest_SocketSendRecv(int32 count, int32 size)
+{
+    int32 intact_count = gUnitTestSocketIntactCount;
+    UnitTest_SocketQueuePackets(count, size);
+    UnitTest_SocketPump(gUnitTestSocketSendCount);
+    return (gUnitTestSocketIntactCount - intact_count);
+}
+
+// -- the burst is larger than the kernel buffers, so the first sendmsg() only sends part of it, possibly ending
+// mid packet - returns the number received in order, and intact, or -1 if the first send wasn't partial
+static int32 UnitTest_SocketSendPartial(int32 count)
+{
+    int32 intact_count = gUnitTestSocketIntactCount;
+    UnitTest_SocketQueuePackets(count, k_MaxPacketSize);
+
+    gUnitTestSocketClient->ProcessSendPackets();
+    bool8 partial = gUnitTestSocketClient->GetSendQueueSize() > count - kSocketPacketProcessMax;
+
+    UnitTest_SocketPump(gUnitTestSocketSendCount);
+    return (partial ? gUnitTestSocketIntactCount - intact_count : -1);
+}
+
+// -- the client closes its end, and the server disconnects, once it receives 0 bytes
+static bool8 UnitTest_SocketPeerDisconnect()
+{
+    gUnitTestSocketClient->Disconnect(false);
+    for (int32 i = 0; i < k_UnitTestSocketPumpMax && gUnitTestSocketServer->IsConnected(); ++i)
+    {
+        gUnitTestSocketServer->ReceivePackets();
+        if (gUnitTestSocketServer->IsConnected())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return (!gUnitTestSocketServer->IsConnected());
+}
+
+void UnitTest_SocketLoopback()
+{
+    bool8 connected = UnitTest_SocketOpen();
+    int32 recv_count = connected ? UnitTest_SocketSendRecv(16, 64) : 0;
+    int32 partial_count = connected ? UnitTest_SocketSendPartial(200) : 0;
+    bool8 disconnected = connected && UnitTest_SocketPeerDisconnect();
+    UnitTest_SocketClose();
+
+    snprintf(CUnitTest::gCodeResult, sizeof(CUnitTest::gCodeResult), "%s %d %d %s", connected ? "true" : "false",
+             recv_count, partial_count, disconnected ? "true" : "false");
+}
+
+// -- sends a packet as raw bytes, split after split_size bytes (including the header) - returns true if the server
+// received nothing until the rest was sent
+static bool8 UnitTest_SocketSendSplit(int32 size, int32 split_size)
+{
+    char packet_bytes[SocketManager::tPacketHeader::HeaderSize + k_MaxPacketSize];
+    SocketManager::tPacketHeader header(k_PacketVersion, SocketManager::tPacketHeader::DATA, size);
+    memcpy(packet_bytes, &header, SocketManager::tPacketHeader::HeaderSize);
+    UnitTest_SocketFillPayload(&packet_bytes[SocketManager::tPacketHeader::HeaderSize], gUnitTestSocketSendCount++,
+                               size);
+
+    // -- a loopback send has already arrived, by the time it returns
+    int32 recv_count = gUnitTestSocketRecvCount;
+    gUnitTestSocketClient->SendRaw(packet_bytes, split_size);
+    gUnitTestSocketServer->ReceivePackets();
+    gUnitTestSocketServer->ProcessRecvPackets();
+    bool8 header_split = split_size < SocketManager::tPacketHeader::HeaderSize;
+    bool8 pending = gUnitTestSocketRecvCount == recv_count &&
+                    gUnitTestSocketServer->IsRecvPacketPending() != header_split;
+
+    int32 remaining_size = SocketManager::tPacketHeader::HeaderSize + size - split_size;
+    gUnitTestSocketClient->SendRaw(&packet_bytes[split_size], remaining_size);
+    UnitTest_SocketPump(recv_count + 1);
+    return (pending);
+}
+
+void UnitTest_SocketPacketBuffer()
+{
+    bool8 connected = UnitTest_SocketOpen();
+    int32 shared_count = 0;
+    int32 ref_count = 0;
+    bool8 kept_intact = false;
+    int32 release_count = 0;
+    bool8 split_pending = false;
+    bool8 split_copied = false;
+    int32 split_intact = 0;
+    if (connected)
+    {
+        // -- packets received whole, in a single recv, all reference the recv buffer, and keeping them releases it
+        // from the socket, so the next recv can't overwrite their data
+        gUnitTestSocketKeepPackets = true;
+        UnitTest_SocketSendRecv(3, 64);
+        gUnitTestSocketKeepPackets = false;
+
+        if (gUnitTestSocketKeptCount == 3)
+        {
+            SocketManager::tPacketBuffer* buffer = gUnitTestSocketKept[0]->mBuffer;
+            for (int32 i = 0; i < gUnitTestSocketKeptCount; ++i)
+                shared_count += gUnitTestSocketKept[i]->mBuffer == buffer ? 1 : 0;
+            ref_count = buffer->mRefCount.load();
+
+            UnitTest_SocketSendRecv(16, 64);
+            kept_intact = true;
+            for (int32 i = 0; i < gUnitTestSocketKeptCount; ++i)
+                kept_intact = kept_intact && UnitTest_SocketIsIntact(gUnitTestSocketKept[i], i);
+
+            // -- deleting a packet releases its reference
+            delete gUnitTestSocketKept[0];
+            gUnitTestSocketKept[0] = nullptr;
+            release_count = buffer->mRefCount.load();
+        }
+
+        // -- a packet split across two recvs is copied into a buffer of its own, as it arrives
+        int32 intact_count = gUnitTestSocketIntactCount;
+        int32 kept_count = gUnitTestSocketKeptCount;
+        gUnitTestSocketKeepPackets = true;
+        split_pending = UnitTest_SocketSendSplit(600, SocketManager::tPacketHeader::HeaderSize + 100);
+        gUnitTestSocketKeepPackets = false;
+        if (gUnitTestSocketKeptCount == kept_count + 1)
+        {
+            SocketManager::tDataPacket* packet = gUnitTestSocketKept[kept_count];
+            split_copied = packet->mBuffer->mCapacity == 600 && packet->mBuffer->mRefCount.load() == 1;
+        }
+
+        // -- as is a packet whose header is split
+        split_pending = UnitTest_SocketSendSplit(600, 6) && split_pending;
+        split_intact = gUnitTestSocketIntactCount - intact_count;
+    }
+    UnitTest_SocketClose();
+
+    snprintf(CUnitTest::gCodeResult, sizeof(CUnitTest::gCodeResult), "%d %d %s %d %s %s %d", shared_count, ref_count,
+             kept_intact ? "true" : "false", release_count, split_pending ? "true" : "false",
+             split_copied ? "true" : "false", split_intact);
+}
+
 // -- these functions contain calls to scripted functions to test reliably receiving return values
 void UnitTest_GetScriptReturnInt()
 {
@@ -847,6 +1721,34 @@ bool8 CreateUnitTests()
         success = success && AddUnitTest("vector3f_pod_normd", "(1, 2, 3) normalized", "vector3f v0 = '1, 2, 3'; gUnitTestScriptResult = v0:normalized();", "0.2673 0.5345 0.8018");
         success = success && AddUnitTest("vector3f_pod_norm", "(1, 2, 3) normalize", "vector3f v0 = '1, 2, 3'; gUnitTestScriptResult = StringCat(v0:normalize(), ' ', v0);", "3.7417 0.2673 0.5345 0.8018");
         success = success && AddUnitTest("vector3f_pod_set", "(1, 2, 3) set", "vector3f v0 = '3, 2, 1'; gUnitTestScriptResult = v0;", "3.0000 2.0000 1.0000");
+        success = success && AddUnitTest("vector3f_add_const", "v0 + v1 leaves v0 unmodified", "vector3f v0 = '1 2 3'; vector3f v1 = '4 5 6'; vector3f v2 = v0 + v1; gUnitTestScriptResult = StringCat(v0, ' ', v2);", "1.0000 2.0000 3.0000 5.0000 7.0000 9.0000");
+
+        // -- vector4f and quat unit tests -----------------------------------------------------------------------------
+        success = success && AddUnitTest("vector4f_add", "(1, 2, 3, 4) + (4, 3, 2, 1)", "vector4f v4_0 = '1 2 3 4'; vector4f v4_1 = '4 3 2 1'; gUnitTestScriptResult = StringCat(v4_0 + v4_1);", "5.0000 5.0000 5.0000 5.0000");
+        success = success && AddUnitTest("vector4f_scale", "(1, 2, 3, 4) * 2, 0.5f * (1, 2, 3, 4)", "vector4f v4_0 = '1 2 3 4'; gUnitTestScriptResult = StringCat(v4_0 * 2, ' ', 0.5f * v4_0);", "2.0000 4.0000 6.0000 8.0000 0.5000 1.0000 1.5000 2.0000");
+        success = success && AddUnitTest("vector4f_div", "(1, 2, 3, 4) / 2.0f", "vector4f v4_0 = '1 2 3 4'; gUnitTestScriptResult = StringCat(v4_0 / 2.0f);", "0.5000 1.0000 1.5000 2.0000");
+        success = success && AddUnitTest("vector4f_podw", "Set the 'w' of (1, 2, 3, 4)", "vector4f v4_0 = '1 2 3 4'; v4_0:w = 7.0f; gUnitTestScriptResult = StringCat(v4_0);", "1.0000 2.0000 3.0000 7.0000");
+        success = success && AddUnitTest("vector4f_pod_dot", "(1, 2, 3, 4) dot (4, 3, 2, 1)", "vector4f v4_0 = '1 2 3 4'; vector4f v4_1 = '4 3 2 1'; gUnitTestScriptResult = v4_0:dot(v4_1);", "20.0000");
+        success = success && AddUnitTest("vector4f_from_v3f", "(1, 2, 3) + (1, 1, 1, 1)", "vector3f v0 = '1 2 3'; vector4f v4_1 = '1 1 1 1'; gUnitTestScriptResult = StringCat(v0 + v4_1);", "2.0000 3.0000 4.0000 1.0000");
+        success = success && AddUnitTest("quat_rotate", "Rotate (1, 0, 0) by quat", "quat q; q:set(0, 0, 0.6f, 0.8f); vector3f v = '1 0 0'; gUnitTestScriptResult = StringCat(q * v, ' ', q:rotate(v));", "0.2800 0.9600 0.0000 0.2800 0.9600 0.0000");
+        success = success && AddUnitTest("quat_mult", "quat * quat", "quat q; q:set(0, 0, 0.6f, 0.8f); gUnitTestScriptResult = StringCat(q * q);", "0.0000 0.0000 0.9600 0.2800");
+        success = success && AddUnitTest("matrix44", "CMatrix44 rotation and translation", "UnitTest_Matrix44();", "10.2800 0.9600 0.0000 0.2800 0.9600 0.0000");
+        success = success && AddUnitTest("vector3f_array_batch", "vector3f[] lengths, nearest_to, bounds, normalize_all", "UnitTest_Vector3fArrayBatch();", "5 5.0000 1.7321 1 -1.0000 -2.0000 0.0000 6.0000 5.0000 2.0000 0.0000 0.0000 1.0000");
+        success = success && AddUnitTest("int_array_ops", "int[] sum, minimum, maximum, argmin, argmax, sort, binary_search, dot", "UnitTest_IntArrayOps();", "23 -2 9 3 0 -2 4 -1 169");
+        success = success && AddUnitTest("float_array_ops", "float[] sum, maximum, argmax, scale, dot, fill", "UnitTest_FloatArrayOps();", "7.0000 4.0000 2 14.0000 126.0000 10.0000");
+        success = success && AddUnitTest("remote_free", "16x blocks freed from another thread, the allocator released", "", "", UnitTest_RemoteFree, "true 16 16 0 true");
+        success = success && AddUnitTest("thread_commands", "typed thread commands posted from 4x threads", "UnitTest_ThreadCommands();", "20200 0");
+        success = success && AddUnitTest("worker_pool", "jobs executed by 2x worker contexts, callbacks and futures", "UnitTest_WorkerPool();", "1330 1540");
+        success = success && AddUnitTest("shared_codeblock", "3x worker contexts share the compiled unittest.ts", "gUnitTestScriptResult = UnitTest_SharedCodeBlockImage(3);", "3");
+        success = success && AddUnitTest("worker_literals", "3x worker contexts find the literals of a script compiled by the first", "gUnitTestScriptResult = UnitTest_WorkerLiterals(3);", "3");
+        success = success && AddUnitTest("parallel_foreach_native", "CObjectGroup.ParallelForEachNative() over 200x thread safe registered methods", "UnitTest_ParallelForEachNative();", "200 40200");
+        success = success && AddUnitTest("parallel_foreach", "CObjectGroup.ParallelForEach() of a script method over 100x objects, by 3x worker contexts, matches the serial result", "UnitTest_ParallelForEach();", "100 15250 298 100 true");
+        success = success && AddUnitTest("schedule_budget", "budgeted scheduler, high priority first, burst dispatched within the max deferral", "UnitTest_ScheduleBudget();", "9 6 true");
+        success = success && AddUnitTest("coroutine", "500x scheduled functions suspended by wait() and yield, resumed in place", "UnitTest_Coroutine();", "1500 500 true");
+        success = success && AddUnitTest("async", "100x scheduled functions suspended by async calls, completed from other threads", "UnitTest_Async();", "3000 100 true");
+        success = success && AddUnitTest("socket_loopback", "loopback send/recv 16x packets, 200x 1K packets sent partially, peer disconnect", "", "", UnitTest_SocketLoopback, "true 16 200 true");
+        success = success && AddUnitTest("socket_packet_buffer", "packets kept by the recv callback hold their recv buffer, packets split across recvs", "", "", UnitTest_SocketPacketBuffer, "3 3 true 2 true true 2");
+        success = success && AddUnitTest("debugger_sync", "headless debugger, 20x objects batched, created/destroyed coalesced, member refresh delta", "UnitTest_DebuggerSync();", "21 0 20 true 21 20 true 1 21");
 
         // -- script access to registered variables -------------------------------------------------------------------
         success = success && AddUnitTest("scriptaccess_regint", "gUnitTestRegisteredInt, value 17 read from script", "UnitTest_RegisteredIntAccess();", "17", UnitTest_RegisteredIntAccess);
@@ -888,7 +1790,7 @@ bool8 CreateUnitTests()
 
         // -- recursive scripted function -----------------------------------------------------------------------------
         success = success && AddUnitTest("script_fib_recur", "Calc the 10th fibonnaci", "UnitTest_ScriptRecursiveFibonacci(10);", "55");
-        success = success && AddUnitTest("script_string_recur", "Print the first 9 letters", "UnitTest_ScriptRecursiveString(9);", "abcdefghi");
+        success = success && AddUnitTest("script_string_recur", "Print the first 9 letters", "UnitTest_ScriptRecursiveString(9);", "ihighifghiefghidefghicdefghibcdefghiabcdefghi");
 
         // -- object functions  ---------------------------------------------------------------------------------------
         success = success && AddUnitTest("object_base", "Create a CBase object", "UnitTest_CreateBaseObject();", "BaseObject 27.0000");
@@ -957,6 +1859,8 @@ bool8 CreateUnitTests()
         success = success && AddUnitTest("foreach_array", "Foreach Array", "UnitTest_Foreach_Array();", "3 cat mouse dog");
         success = success && AddUnitTest("foreach_ht", "Foreach Hashtable", "UnitTest_Foreach_HT();", "3 cat mouse dog");
         success = success && AddUnitTest("foreach_objectset", "Foreach ObjectSet", "UnitTest_Foreach_ObjectSet();", "3 cat mouse dog");
+        success = success && AddUnitTest("objectset_holes", "ObjectSet index lookups over removed objects", "UnitTest_ObjectSet_Holes();", "16 91 67");
+        success = success && AddUnitTest("objectset_index_iterate", "ObjectSet iterated by index, over removed objects", "UnitTest_ObjectSet_IndexIterate();", "150 15100 50 200");
 
         // -- contains
         success = success && AddUnitTest("contains_intarray_global", "Global IntArray Contains", "UnitTest_IntArray_Contains_Global();", "19 true 20 false");
@@ -982,6 +1886,22 @@ bool8 CreateUnitTests()
         success = success && AddUnitTest("ht_cpp_ht_wrap_global", "HT wrap a global ht with a Cpp", "UnitTest_CppHTWrapGlobal();", "6.7800 dogmaticallaciousness");
         success = success && AddUnitTest("ht_cpp_ht_wrap_local", "HT wrap a local ht with a Cpp", "UnitTest_CppHTWrapLocal();", "6.7800 dogmaticallaciousness");
         success = success && AddUnitTest("ht_cpp_ht_wrap_obj_ht", "HT wrap a an object member ht with a Cpp", "UnitTest_CppHTWrapObject();", "6.7800 dogmaticallaciousness");
+
+        // -- string builder
+        success = success && AddUnitTest("string_builder", "String builder append and format", "UnitTest_StringBuilder();", "key_0_1 fox% 12 0");
+        success = success && AddUnitTest("native_string_release", "1000x strings returned from a registered function are released", "", "", UnitTest_NativeStringRelease, "0");
+        success = success && AddUnitTest("string_table_growth", "40000x distinct strings added in one execution, the index grows", "UnitTest_StringTableGrowth();", "40000 true");
+        success = success && AddUnitTest("transient_strings", "10000x concatenated strings, reclaimed at the loop's back edge", "UnitTest_TransientStrings();", "transient_9999_19998 true");
+        success = success && AddUnitTest("shared_string_table", "8x threads without a context add 10000x strings to the shared table", "", "", UnitTest_SharedStringTable, "10000 0 true true");
+
+        // -- compile time hashing
+        success = success && AddUnitTest("hash_literal", "Compile time hash literals", "UnitTest_HashLiteral();", "true true OnCreate");
+
+        // -- cached lifecycle chains
+        success = success && AddUnitTest("lifecycle_chain", "OnCreate/OnDestroy hierarchy order", "UnitTest_LifecycleChain();", "base child ~child ~base");
+
+        // -- member access caches
+        success = success && AddUnitTest("member_cache", "Registered and dynamic members at one site", "UnitTest_MemberCache();", "11 21 41 12 1.0000 5.0000 3.0000");
     }
 
     // -- return success
@@ -1015,6 +1935,7 @@ void BeginUnitTests(const char* specific_test = "", bool8 results_only = false)
 {
     // -- required to ensure registered functions from memory.cpp are linked, even if the memory tracker is not enabled
     REGISTER_FILE(tinmemory_cpp);
+    REGISTER_FILE(tinstringbuilder_cpp);
 
     // -- first create the unit tests
     if (!CreateUnitTests())
@@ -1228,6 +2149,86 @@ void BeginProfilingTests(int loop_count)
 
 REGISTER_FUNCTION(BeginProfilingTests, BeginProfilingTests);
 
+// -- profile the object lifecycle (create/destroy), which is dominated by allocation
+void BeginObjectLifecycleProfile(int loop_count)
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+    uint32 class_hash = TinScript::Hash("CScriptObject");
+
+    TinPrint(script_context, "TinScript Start ObjectLifecycle()\n");
+
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loop_count; ++i)
+    {
+        uint32 object_id = script_context->CreateObject(class_hash, 0, nullptr);
+        script_context->DestroyObject(object_id);
+    }
+    auto time_stop = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::micro> elapsed_mirco = time_stop - time_start;
+
+    TinPrint(script_context, "ObjectLifecycle time: %lf\n", elapsed_mirco.count());
+}
+
+REGISTER_FUNCTION(BeginObjectLifecycleProfile, BeginObjectLifecycleProfile);
+
+// -- profile the type conversions used by the numeric operators, and parsing from a string
+void BeginTypeConvertProfile(int loop_count)
+{
+    TinScript::CScriptContext* script_context = TinScript::GetContext();
+
+    TinPrint(script_context, "TinScript Start TypeConvert()\n");
+
+    // -- mixed numeric conversions
+    float32 float_total = 0.0f;
+    auto time_start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loop_count; ++i)
+    {
+        int32 int_value = i;
+        bool8 bool_value = (i & 0x01) != 0;
+        float32 float_value = 0.0f;
+        TinScript::TypeConvertValue<TinScript::TYPE_float>(script_context, TinScript::TYPE_int, &int_value,
+                                                           float_value);
+        float_total += float_value;
+        TinScript::TypeConvertValue<TinScript::TYPE_float>(script_context, TinScript::TYPE_bool, &bool_value,
+                                                           float_value);
+        float_total += float_value;
+    }
+    auto time_stop = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::micro> elapsed_mirco = time_stop - time_start;
+
+    TinPrint(script_context, "Numeric TypeConvert time: %lf [total: %.1f]\n", elapsed_mirco.count(), float_total);
+
+    // -- string parsing
+    uint32 string_value = TinScript::Hash("1234");
+    int32 int_total = 0;
+    time_start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < loop_count; ++i)
+    {
+        int32 int_value = 0;
+        TinScript::TypeConvertValue<TinScript::TYPE_int>(script_context, TinScript::TYPE_string, &string_value,
+                                                         int_value);
+        int_total += int_value;
+    }
+    time_stop = std::chrono::high_resolution_clock::now();
+    elapsed_mirco = time_stop - time_start;
+
+    TinPrint(script_context, "String TypeConvert time: %lf [total: %d]\n", elapsed_mirco.count(), int_total);
+}
+
+REGISTER_FUNCTION(BeginTypeConvertProfile, BeginTypeConvertProfile);
+
+// -- ensure the compile time hash of each engine literal matches the runtime hash
+bool8 HashLiteralMatches(const char* literal)
+{
+    #define HashLiteralEntry(s) if (!strcmp(literal, s)) return (HashLiteral_(s) == TinScript::Hash(literal));
+    HashLiteralTuple
+    #undef HashLiteralEntry
+
+    return (false);
+}
+
+REGISTER_FUNCTION(HashLiteralMatches, HashLiteralMatches);
+
 // --------------------------------------------
 
 #define VA_LENGTH_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, N, ...) N
@@ -865,6 +865,90 @@ void UnitTest_Foreach_ObjectSet()
     }
 }
 
+// -- removed objects leave holes, which indexed lookups must step over, without compacting on every read
+void UnitTest_ObjectSet_Holes()
+{
+    object obj_set = create_local CObjectGroup("unit_test_holes");
+    int i;
+    for (i = 1; i <= 100; ++i)
+    {
+        object base_obj = create CBase();
+        base_obj.intvalue = i;
+        obj_set.AddObject(base_obj);
+    }
+
+    // -- remove every third object, leaving holes between the remaining 67
+    for (i = 32; i >= 0; --i)
+    {
+        object removed = obj_set.GetObjectByIndex(i * 3 + 2);
+        obj_set.RemoveObject(removed);
+        destroy removed;
+    }
+
+    object tenth = obj_set.GetObjectByIndex(10);
+    object sixtieth = obj_set.GetObjectByIndex(60);
+    gUnitTestScriptResult = StringCat(tenth.intvalue, " ", sixtieth.intvalue);
+
+    // -- removing from the front leaves leading holes
+    int first_count = 0;
+    while (obj_set.Used() > 0)
+    {
+        object first = obj_set.GetObjectByIndex(0);
+        if (obj_set.IsFirst(first))
+            first_count += 1;
+        obj_set.RemoveObject(first);
+        destroy first;
+    }
+
+    gUnitTestScriptResult = StringCat(gUnitTestScriptResult, " ", first_count);
+}
+
+// -- iterating by index, while the set has holes, and while removing from it
+void UnitTest_ObjectSet_IndexIterate()
+{
+    object obj_set = create_local CObjectGroup("unit_test_index_iterate");
+    int i;
+    for (i = 1; i <= 200; ++i)
+    {
+        object base_obj = create CBase();
+        base_obj.intvalue = i;
+        obj_set.AddObject(base_obj);
+    }
+
+    // -- remove every fourth object, leaving 150 objects with holes between them
+    for (i = 49; i >= 0; --i)
+    {
+        object removed = obj_set.GetObjectByIndex(i * 4 + 1);
+        obj_set.RemoveObject(removed);
+        destroy removed;
+    }
+
+    int sum = 0;
+    int count = obj_set.Used();
+    for (i = 0; i < count; ++i)
+    {
+        object member = obj_set.GetObjectByIndex(i);
+        sum += member.intvalue;
+    }
+
+    // -- remove the odd values while iterating, only advancing past the objects kept
+    i = 0;
+    while (i < obj_set.Used())
+    {
+        object candidate = obj_set.GetObjectByIndex(i);
+        if (candidate.intvalue % 2 == 1)
+        {
+            obj_set.RemoveObject(candidate);
+            destroy candidate;
+        }
+        else
+            ++i;
+    }
+
+    object last = obj_set.GetObjectByIndex(obj_set.Used() - 1);
+    gUnitTestScriptResult = StringCat(count, " ", sum, " ", obj_set.Used(), " ", last.intvalue);
+}
+
 // -- array contains tests
 
 vector3f[5] UT_ArrayContains_vector3f;
@@ -1164,6 +1248,460 @@ void TestManualCppHTAll()
     UnitTest_CppHTWrapGlobal(true);
 }
 
+void UnitTest_StringBuilder()
+{
+    // -- build a string from mixed values - only the ToString() result is added to the string table
+    object sb = create CStringBuilder();
+    sb.Append("key_", 0);
+    sb.Format("_%s %s%%", 1, "fox");
+
+    string result = sb.ToString();
+    int length = sb.Length();
+    sb.Clear();
+
+    gUnitTestScriptResult = StringCat(result, " ", length, " ", sb.Length());
+    destroy sb;
+}
+
+string[40000] gUT_GrowthValues;
+void UnitTest_StringTableGrowth()
+{
+    // -- every string is referenced by the array, so none are reclaimed at the loop's back edge - more than the
+    // initial index (kStringTableIndexSize, 32K slots) can hold
+    int found = 0;
+    int i;
+    for (i = 0; i < 40000; ++i)
+    {
+        gUT_GrowthValues[i] = StringCat("ut_growth_", i);
+        if (Unhash(Hash(gUT_GrowthValues[i])) == gUT_GrowthValues[i])
+            found += 1;
+    }
+
+    gUnitTestScriptResult = StringCat(found, " ", UnitTest_StringTableIndexSize() > 32768);
+}
+
+void UnitTest_TransientStrings()
+{
+    // -- each iteration's intermediate strings are unreferenced once the local is reassigned, and reclaimed at the
+    // loop's back edge (once kStringTableTransientReclaimCount, 256, are waiting), rather than when execution completes
+    int start_count = UnitTest_StringTableCount();
+    string result;
+    int i;
+    for (i = 0; i < 10000; ++i)
+    {
+        result = StringCat("transient_", i, "_", i * 2);
+    }
+
+    gUnitTestScriptResult = StringCat(result, " ", UnitTest_StringTableCount() - start_count < 1024);
+}
+
+void UnitTest_NativeStringLoop(int count)
+{
+    // -- every returned string is unreferenced once the local is reassigned
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        string value = UnitTest_NativeString(i);
+    }
+}
+
+void UnitTest_HashLiteral()
+{
+    // -- engine literals are hashed at compile time, and must match the runtime hash
+    gUnitTestScriptResult = StringCat(HashLiteralMatches("OnCreate"), " ", HashLiteralMatches("_p12"), " ",
+                                      Unhash(Hash("OnCreate")));
+}
+
+// -- OnCreate() is called from the root of the hierarchy down, OnDestroy() from the child up
+string gLifecycleOrder = "";
+void LifecycleBase::OnCreate()
+{
+    gLifecycleOrder = StringCat(gLifecycleOrder, "base ");
+}
+
+void LifecycleBase::OnDestroy()
+{
+    gLifecycleOrder = StringCat(gLifecycleOrder, "~base");
+}
+
+void LifecycleChild::OnCreate() : LifecycleBase
+{
+    gLifecycleOrder = StringCat(gLifecycleOrder, "child ");
+}
+
+void LifecycleChild::OnDestroy()
+{
+    gLifecycleOrder = StringCat(gLifecycleOrder, "~child ");
+}
+
+void UnitTest_LifecycleChain()
+{
+    gLifecycleOrder = "";
+    object test_obj = create CScriptObject("LifecycleChild");
+    destroy test_obj;
+    gUnitTestScriptResult = gLifecycleOrder;
+}
+
+// -- the same member access site is used for registered members of different classes, and a dynamic member
+int UnitTest_MemberCacheIncrement(object obj)
+{
+    obj.intvalue += 1;
+    return (obj.intvalue);
+}
+
+void UnitTest_MemberCache()
+{
+    object base_obj = create CBase();
+    object child_obj = create CChild();
+    object script_obj = create CScriptObject();
+    int script_obj.intvalue = 40;
+
+    base_obj.intvalue = 10;
+    child_obj.intvalue = 20;
+    base_obj.v3member = "1 2 3";
+    base_obj.v3member:y = 5;
+
+    int result_0 = UnitTest_MemberCacheIncrement(base_obj);
+    int result_1 = UnitTest_MemberCacheIncrement(child_obj);
+    int result_2 = UnitTest_MemberCacheIncrement(script_obj);
+    int result_3 = UnitTest_MemberCacheIncrement(base_obj);
+    string result = StringCat(result_0, " ", result_1, " ", result_2, " ", result_3);
+    gUnitTestScriptResult = StringCat(result, " ", base_obj.v3member);
+
+    destroy base_obj;
+    destroy child_obj;
+    destroy script_obj;
+}
+
+void UnitTest_Matrix44()
+{
+    object m = create CMatrix44("UnitTestMatrix");
+    quat q;
+    q:set(0, 0, 0.6f, 0.8f);
+    m.SetRotation(q);
+    m.SetTranslation("10 0 0");
+
+    vector3f p = m.TransformPoint("1 0 0");
+    vector3f d = m.TransformVector("1 0 0");
+    gUnitTestScriptResult = StringCat(p, " ", d);
+
+    destroy m;
+}
+
+int[6] g_UT_IntArrayOps;
+void UnitTest_IntArrayOps()
+{
+    g_UT_IntArrayOps[0] = 9;
+    g_UT_IntArrayOps[1] = 3;
+    g_UT_IntArrayOps[2] = 7;
+    g_UT_IntArrayOps[3] = -2;
+    g_UT_IntArrayOps[4] = 5;
+    g_UT_IntArrayOps[5] = 1;
+
+    string result = StringCat(g_UT_IntArrayOps:sum(), " ", g_UT_IntArrayOps:minimum(), " ", g_UT_IntArrayOps:maximum());
+    result = StringCat(result, " ", g_UT_IntArrayOps:argmin(), " ", g_UT_IntArrayOps:argmax());
+    g_UT_IntArrayOps:sort();
+    result = StringCat(result, " ", g_UT_IntArrayOps[0], " ", g_UT_IntArrayOps:binary_search(7));
+    gUnitTestScriptResult = StringCat(result, " ", g_UT_IntArrayOps:binary_search(4), " ",
+                                      g_UT_IntArrayOps:dot(g_UT_IntArrayOps));
+}
+
+float[5] g_UT_FloatArrayOps;
+void UnitTest_FloatArrayOps()
+{
+    g_UT_FloatArrayOps[0] = 1.5f;
+    g_UT_FloatArrayOps[1] = -2.0f;
+    g_UT_FloatArrayOps[2] = 4.0f;
+    g_UT_FloatArrayOps[3] = 0.5f;
+    g_UT_FloatArrayOps[4] = 3.0f;
+
+    string result = StringCat(g_UT_FloatArrayOps:sum(), " ", g_UT_FloatArrayOps:maximum(), " ", g_UT_FloatArrayOps:argmax());
+    g_UT_FloatArrayOps:scale(2.0f);
+    result = StringCat(result, " ", g_UT_FloatArrayOps:sum(), " ", g_UT_FloatArrayOps:dot(g_UT_FloatArrayOps));
+    g_UT_FloatArrayOps:fill(2.0f);
+    gUnitTestScriptResult = StringCat(result, " ", g_UT_FloatArrayOps:sum());
+}
+
+int gUnitTestThreadCommandSum = 0;
+void UnitTest_ThreadCommandReceived(int value, string tag)
+{
+    if (tag == "post")
+        gUnitTestThreadCommandSum += value;
+}
+
+void UnitTest_ThreadCommands()
+{
+    gUnitTestThreadCommandSum = 0;
+    int rejected = UnitTest_PostThreadCommands(4, 100);
+    gUnitTestScriptResult = StringCat(gUnitTestThreadCommandSum, " ", rejected);
+}
+
+int gUnitTestWorkerJobSum = 0;
+int UnitTest_WorkerJob(int value)
+{
+    return (value * value);
+}
+
+void UnitTest_WorkerJobComplete(int job_id, bool success, int result)
+{
+    if (success)
+        gUnitTestWorkerJobSum += result;
+}
+
+void UnitTest_WorkerPool()
+{
+    gUnitTestWorkerJobSum = 0;
+    int future_sum = UnitTest_RunWorkerPool(2, 20);
+    gUnitTestScriptResult = StringCat(gUnitTestWorkerJobSum, " ", future_sum);
+}
+
+void UnitTest_ParallelForEachNative()
+{
+    object group = create CObjectGroup("UTParallelGroup");
+    int i;
+    for (i = 1; i <= 200; ++i)
+    {
+        object base_obj = create CBase();
+        base_obj.intvalue = i;
+        group.AddObject(base_obj);
+    }
+
+    // -- CBase::DoubleIntValue() is registered as thread safe
+    int call_count = group.ParallelForEachNative("DoubleIntValue");
+
+    int sum = 0;
+    object member = group.First();
+    while (IsObject(member))
+    {
+        sum += member.intvalue;
+        member = group.Next();
+    }
+
+    destroy group;
+    gUnitTestScriptResult = StringCat(call_count, " ", sum);
+}
+
+// -- ParallelUnit::Think() is called by CObjectSet::ParallelForEach(), on a copy of the object within a worker context
+// -- it modifies only its own members:  a registered member, a script member, and a member it adds
+void ParallelUnit::OnCreate()
+{
+    string self.label = "";
+}
+
+void ParallelUnit::Think()
+{
+    self.intvalue = self.intvalue * 3 + 1;
+    self.label = StringCat("unit_", self.intvalue);
+    int self.remainder = self.intvalue % 7;
+}
+
+string UnitTest_ParallelForEachResult(int worker_count)
+{
+    object group = create CObjectGroup("UTParallelUnits");
+    int i;
+    for (i = 1; i <= 100; ++i)
+    {
+        object unit = create CBase("ParallelUnit");
+        unit.intvalue = i;
+        group.AddObject(unit);
+    }
+
+    int call_count = UnitTest_RunParallelForEach(worker_count, group, "Think");
+
+    int sum = 0;
+    int remainder_sum = 0;
+    int label_count = 0;
+    object member = group.First();
+    while (IsObject(member))
+    {
+        sum += member.intvalue;
+        remainder_sum += member.remainder;
+        if (member.label == StringCat("unit_", member.intvalue))
+            ++label_count;
+        member = group.Next();
+    }
+
+    destroy group;
+    return (StringCat(call_count, " ", sum, " ", remainder_sum, " ", label_count));
+}
+
+// -- the parallel result must match calling the method on each member in order
+void UnitTest_ParallelForEach()
+{
+    string parallel_result = UnitTest_ParallelForEachResult(3);
+    string serial_result = UnitTest_ParallelForEachResult(0);
+    gUnitTestScriptResult = StringCat(parallel_result, " ", parallel_result == serial_result);
+}
+
+int gUnitTestScheduleFirst = 0;
+int gUnitTestScheduleCount = 0;
+void UnitTest_ScheduleRecord(int id)
+{
+    if (gUnitTestScheduleCount == 0)
+        gUnitTestScheduleFirst = id;
+    gUnitTestScheduleCount += 1;
+}
+
+void UnitTest_ScheduleBudget()
+{
+    gUnitTestScheduleFirst = 0;
+    gUnitTestScheduleCount = 0;
+
+    // -- the priority class is part of the schedule syntax (cancelled, as it's not due until long after the test)
+    int reqid = schedule:high(0, 100000, hash("UnitTest_ScheduleRecord"), 0);
+    ScheduleCancel(reqid);
+
+    bool bounded = UnitTest_RunScheduleBudget(5, 3);
+    gUnitTestScriptResult = StringCat(gUnitTestScheduleFirst, " ", gUnitTestScheduleCount, " ", bounded);
+}
+
+int gUnitTestCoroutineSteps = 0;
+int gUnitTestCoroutineDone = 0;
+void UnitTest_CoroutineStep(string label)
+{
+    // -- the string local must survive the suspension
+    yield;
+    if (label == "step")
+        gUnitTestCoroutineSteps += 1;
+}
+
+int UnitTest_CoroutineWaitValue(int value)
+{
+    wait(2);
+    return (value);
+}
+
+bool UnitTest_CoroutineJoin(string label, int value)
+{
+    return (label == "step" && value == 3);
+}
+
+void UnitTest_CoroutineWorker()
+{
+    string label = "step";
+    vector3f position = "0 0 0";
+    int i;
+    for (i = 0; i < 3; ++i)
+    {
+        UnitTest_CoroutineStep(label);
+
+        // -- the address of the local's POD member is pending on the stack, while suspended
+        position:y = UnitTest_CoroutineWaitValue(i + 1);
+    }
+
+    // -- the first arg is a string temporary, only referenced by the suspended stack
+    if (position:y == 3.0f && UnitTest_CoroutineJoin(StringCat("st", "ep"), UnitTest_CoroutineWaitValue(3)))
+        gUnitTestCoroutineDone += 1;
+}
+
+void UnitTest_Coroutine()
+{
+    gUnitTestCoroutineSteps = 0;
+    gUnitTestCoroutineDone = 0;
+    bool completed = UnitTest_RunCoroutines(500);
+    gUnitTestScriptResult = StringCat(gUnitTestCoroutineSteps, " ", gUnitTestCoroutineDone, " ", completed);
+}
+
+int gUnitTestAsyncSum = 0;
+int gUnitTestAsyncLabels = 0;
+int UnitTest_AsyncQuadruple(int value)
+{
+    // -- each async call suspends both this function, and the worker that called it
+    int doubled = UnitTest_AsyncDouble(value);
+    return (UnitTest_AsyncDouble(doubled));
+}
+
+void UnitTest_AsyncWorker()
+{
+    string label = UnitTest_AsyncLabel(7);
+    if (label == "async_7")
+        gUnitTestAsyncLabels += 1;
+    gUnitTestAsyncSum += UnitTest_AsyncQuadruple(5);
+
+    // -- the registered member is assigned by the object's ID, once the call is completed
+    object target = create CBase();
+    target.intvalue = UnitTest_AsyncDouble(5);
+    gUnitTestAsyncSum += target.intvalue;
+    destroy target;
+}
+
+void UnitTest_Async()
+{
+    gUnitTestAsyncSum = 0;
+    gUnitTestAsyncLabels = 0;
+    bool completed = UnitTest_RunAsync(100);
+    gUnitTestScriptResult = StringCat(gUnitTestAsyncSum, " ", gUnitTestAsyncLabels, " ", completed);
+}
+
+void UnitTest_DebuggerSync()
+{
+    UnitTest_DebuggerSyncConnect(true);
+
+    // -- the creations and memberships are queued, and an object destroyed before the flush is never sent
+    object group = create CObjectGroup("UTSyncGroup");
+    int i;
+    for (i = 0; i < 20; ++i)
+    {
+        object base_obj = create CBase();
+        group.AddObject(base_obj);
+    }
+    object temp_obj = create CBase();
+    destroy temp_obj;
+
+    // -- 41 records, batched into far fewer packets
+    int packet_count = UnitTest_DebuggerSyncFlush();
+    bool batched = packet_count < 41;
+    string result = StringCat(UnitTest_DebuggerSyncCount("create"), " ", UnitTest_DebuggerSyncCount("destroy"), " ",
+                              UnitTest_DebuggerSyncCount("set_add"), " ", batched);
+
+    // -- listing the group re-sends the group and each member
+    UnitTest_DebuggerSyncReset();
+    DebuggerListObjects(group);
+    UnitTest_DebuggerSyncFlush();
+    result = StringCat(result, " ", UnitTest_DebuggerSyncCount("create"), " ", UnitTest_DebuggerSyncCount("set_add"));
+
+    // -- an inspect sends every member, a refresh only those changed
+    object child = group.First();
+    UnitTest_DebuggerSyncReset();
+    DebuggerInspectObject(child);
+    bool inspected = UnitTest_DebuggerSyncCount("member_row") > 1;
+    result = StringCat(result, " ", inspected);
+
+    child.intvalue = 17;
+    UnitTest_DebuggerSyncReset();
+    DebuggerRefreshObject(child);
+    result = StringCat(result, " ", UnitTest_DebuggerSyncCount("member_row"));
+
+    // -- the group destroys its members
+    UnitTest_DebuggerSyncReset();
+    destroy group;
+    UnitTest_DebuggerSyncFlush();
+    result = StringCat(result, " ", UnitTest_DebuggerSyncCount("destroy"));
+
+    UnitTest_DebuggerSyncConnect(false);
+    gUnitTestScriptResult = result;
+}
+
+vector3f[5] g_UT_V3fArray;
+float[5] g_UT_V3fLengths;
+void UnitTest_Vector3fArrayBatch()
+{
+    g_UT_V3fArray[0] = "3 4 0";
+    g_UT_V3fArray[1] = "0 0 2";
+    g_UT_V3fArray[2] = "-1 5 2";
+    g_UT_V3fArray[3] = "6 -2 1";
+    g_UT_V3fArray[4] = "1 1 1";
+
+    int count = g_UT_V3fArray:lengths(g_UT_V3fLengths);
+    int nearest = g_UT_V3fArray:nearest_to("0 0 1");
+    vector3f bounds_min = g_UT_V3fArray:bounds_min();
+    vector3f bounds_max = g_UT_V3fArray:bounds_max();
+    g_UT_V3fArray:normalize_all();
+
+    string result = StringCat(count, " ", g_UT_V3fLengths[0], " ", g_UT_V3fLengths[4], " ", nearest);
+    gUnitTestScriptResult = StringCat(result, " ", bounds_min, " ", bounds_max, " ", g_UT_V3fArray[1]);
+}
+
 // -------------------------------------------------------------------------------------------------
 // -- most implementations beyond this point are executed manually ---------------------------------
 // -------------------------------------------------------------------------------------------------
@@ -26,10 +26,20 @@
 
 #pragma once
 
+#include <type_traits>
+
 #define REGISTER_FUNCTION(name, funcptr) \
     static const int gArgCount_##name = SignatureArgCount<decltype(funcptr)>::arg_count; \
     static CRegisterFunction<gArgCount_##name, decltype(funcptr)> _reg_##name(#name, funcptr);
 
+// -- an async function returns the pending handle from CScriptContext::AsyncBegin() - the calling script is suspended
+// until the handle is completed (from any thread), and receives the completion value as the function's result
+#define REGISTER_ASYNC_FUNCTION(name, funcptr) \
+    static_assert(std::is_same<SignatureArgCount<decltype(funcptr)>::return_type, int32>::value, \
+                  "Error - an async function must return its int32 handle"); \
+    REGISTER_FUNCTION(name, funcptr) \
+    static const bool gIsAsync_##name = _reg_##name.SetAsync();
+
 #if !PLATFORM_VS_2019
     #define REGISTER_METHOD(classname, name, methodptr) \
         static const int gArgCount_##classname##_##name = SignatureArgCount<decltype(std::declval<classname>().methodptr)>::arg_count; \
@@ -39,6 +49,12 @@
         static const int gArgCount_##classname##_##name = MethodArgCount<decltype(&classname::methodptr)>::arg_count; \
         static CRegisterMethod<gArgCount_##classname##_##name, classname, decltype(&classname::methodptr)> _reg_##classname##_##name(#name, &classname::methodptr);
 #endif
+// -- a thread safe method may be dispatched from any thread (e.g. by CObjectSet::ParallelForEachNative()), without a
+// script context - it must only read shared state, or modify its own object, and must not call into script
+#define REGISTER_THREADSAFE_METHOD(classname, name, methodptr) \
+    REGISTER_METHOD(classname, name, methodptr) \
+    static const bool gIsThreadSafe_##classname##_##name = _reg_##classname##_##name.SetThreadSafe();
+
 #define REGISTER_CLASS_FUNCTION(classname, name, methodptr) \
     static const int gArgCount_##classname##_##name = SignatureArgCount<decltype(std::declval<classname>().methodptr)>::arg_count; \
     static CRegisterFunction<gArgCount_##classname##_##name, decltype(std::declval<classname>().methodptr)> _reg_##classname##_##name(#name, &classname::methodptr); \
@@ -51,6 +67,7 @@ class SignatureArgCount<R(Args...)>
 {
     public:
         static const int arg_count = sizeof...(Args);
+        typedef R return_type;
 };
 
 template<typename S>
@@ -96,6 +113,15 @@ public:
         Dispatch();
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        R r = funcptr();
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch()
     {
@@ -112,7 +138,7 @@ public:
     {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
 
         return (success);
     }
@@ -143,6 +169,15 @@ public:
         Dispatch();
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        funcptr();
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch()
     {
@@ -155,7 +190,7 @@ public:
     {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
         return (success);
     }
 
@@ -192,6 +227,16 @@ public:
         Dispatch(objaddr);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)();
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr)
     {
@@ -209,7 +254,7 @@ public:
     {
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
         return (success);
     }
 
@@ -245,6 +290,16 @@ public:
         Dispatch(objaddr);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        C* object = (C*)(objaddr);
+        (object->*methodptr)();
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr)
     {
@@ -260,7 +315,7 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
 
         return (success);
     }
@@ -301,6 +356,19 @@ public:
         Dispatch(&p1);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+
+        R r = funcptr(p1);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1)
     {
@@ -323,8 +391,8 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
         return (success);
     }
@@ -361,6 +429,19 @@ public:
         Dispatch(&p1);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+
+        funcptr(p1);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1)
     {
@@ -379,8 +460,8 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
         return (success);
     }
@@ -423,6 +504,20 @@ public:
         Dispatch(objaddr, &p1);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1)
     {
@@ -446,8 +541,8 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
         return (success);
     }
@@ -490,6 +585,20 @@ public:
         Dispatch(objaddr, &p1);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1)
     {
@@ -510,8 +619,8 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
 
 
         return (success);
@@ -556,6 +665,21 @@ public:
         Dispatch(&p1, &p2);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+
+        R r = funcptr(p1, p2);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2)
     {
@@ -581,9 +705,9 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
         return (success);
     }
@@ -623,6 +747,21 @@ public:
         Dispatch(&p1, &p2);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+
+        funcptr(p1, p2);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2)
     {
@@ -644,9 +783,9 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
         return (success);
     }
@@ -692,6 +831,22 @@ public:
         Dispatch(objaddr, &p1, &p2);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2)
     {
@@ -718,9 +873,9 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
         return (success);
     }
@@ -766,6 +921,22 @@ public:
         Dispatch(objaddr, &p1, &p2);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2)
     {
@@ -789,9 +960,9 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
 
 
         return (success);
@@ -839,6 +1010,23 @@ public:
         Dispatch(&p1, &p2, &p3);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+
+        R r = funcptr(p1, p2, p3);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3)
     {
@@ -867,10 +1055,10 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
         return (success);
     }
@@ -913,6 +1101,23 @@ public:
         Dispatch(&p1, &p2, &p3);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+
+        funcptr(p1, p2, p3);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3)
     {
@@ -937,10 +1142,10 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
         return (success);
     }
@@ -989,6 +1194,24 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3)
     {
@@ -1018,10 +1241,10 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
         return (success);
     }
@@ -1070,6 +1293,24 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3)
     {
@@ -1096,10 +1337,10 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
 
 
         return (success);
@@ -1150,6 +1391,25 @@ public:
         Dispatch(&p1, &p2, &p3, &p4);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+
+        R r = funcptr(p1, p2, p3, p4);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4)
     {
@@ -1181,11 +1441,11 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
         return (success);
     }
@@ -1231,6 +1491,25 @@ public:
         Dispatch(&p1, &p2, &p3, &p4);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+
+        funcptr(p1, p2, p3, p4);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4)
     {
@@ -1258,11 +1537,11 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
         return (success);
     }
@@ -1314,6 +1593,26 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4)
     {
@@ -1346,11 +1645,11 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
         return (success);
     }
@@ -1402,6 +1701,26 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4)
     {
@@ -1431,11 +1750,11 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
 
 
         return (success);
@@ -1489,6 +1808,27 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+
+        R r = funcptr(p1, p2, p3, p4, p5);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5)
     {
@@ -1523,12 +1863,12 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
         return (success);
     }
@@ -1577,6 +1917,27 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+
+        funcptr(p1, p2, p3, p4, p5);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5)
     {
@@ -1607,12 +1968,12 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
         return (success);
     }
@@ -1667,6 +2028,28 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5)
     {
@@ -1702,12 +2085,12 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
         return (success);
     }
@@ -1762,6 +2145,28 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5)
     {
@@ -1794,12 +2199,12 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
 
 
         return (success);
@@ -1856,6 +2261,29 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6)
     {
@@ -1893,13 +2321,13 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
         return (success);
     }
@@ -1951,6 +2379,29 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+
+        funcptr(p1, p2, p3, p4, p5, p6);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6)
     {
@@ -1984,13 +2435,13 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
         return (success);
     }
@@ -2048,6 +2499,30 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6)
     {
@@ -2086,13 +2561,13 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
         return (success);
     }
@@ -2150,6 +2625,30 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6)
     {
@@ -2185,13 +2684,13 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
 
 
         return (success);
@@ -2251,6 +2750,31 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6, p7);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7)
     {
@@ -2291,14 +2815,14 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
         return (success);
     }
@@ -2353,8 +2877,9 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7);
     }
 
-    // -- dispatch method
-    void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7)
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
     {
         using T1 = typename std::tuple_element<0, argument_types>::type;
         using T2 = typename std::tuple_element<1, argument_types>::type;
@@ -2364,11 +2889,35 @@ public:
         using T6 = typename std::tuple_element<5, argument_types>::type;
         using T7 = typename std::tuple_element<6, argument_types>::type;
 
-        T1* p1 = (T1*)_p1;
-        T2* p2 = (T2*)_p2;
-        T3* p3 = (T3*)_p3;
-        T4* p4 = (T4*)_p4;
-        T5* p5 = (T5*)_p5;
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+
+        funcptr(p1, p2, p3, p4, p5, p6, p7);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
+    // -- dispatch method
+    void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+
+        T1* p1 = (T1*)_p1;
+        T2* p2 = (T2*)_p2;
+        T3* p3 = (T3*)_p3;
+        T4* p4 = (T4*)_p4;
+        T5* p5 = (T5*)_p5;
         T6* p6 = (T6*)_p6;
         T7* p7 = (T7*)_p7;
 
@@ -2389,14 +2938,14 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
         return (success);
     }
@@ -2457,6 +3006,32 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7)
     {
@@ -2498,14 +3073,14 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
         return (success);
     }
@@ -2566,6 +3141,32 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7)
     {
@@ -2604,14 +3205,14 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
 
 
         return (success);
@@ -2674,6 +3275,33 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6, p7, p8);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8)
     {
@@ -2717,15 +3345,15 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
         return (success);
     }
@@ -2783,6 +3411,33 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+
+        funcptr(p1, p2, p3, p4, p5, p6, p7, p8);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8)
     {
@@ -2822,15 +3477,15 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
         return (success);
     }
@@ -2894,6 +3549,34 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8)
     {
@@ -2938,15 +3621,15 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
         return (success);
     }
@@ -3010,6 +3693,34 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8)
     {
@@ -3051,15 +3762,15 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
 
 
         return (success);
@@ -3125,6 +3836,35 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9)
     {
@@ -3171,16 +3911,16 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
         return (success);
     }
@@ -3241,6 +3981,35 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+
+        funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9)
     {
@@ -3283,16 +4052,16 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
         return (success);
     }
@@ -3359,6 +4128,36 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9)
     {
@@ -3406,16 +4205,16 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
         return (success);
     }
@@ -3482,6 +4281,36 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9)
     {
@@ -3526,16 +4355,16 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
 
 
         return (success);
@@ -3604,6 +4433,37 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10)
     {
@@ -3653,17 +4513,17 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
         return (success);
     }
@@ -3727,6 +4587,37 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+
+        funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10)
     {
@@ -3772,17 +4663,17 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
         return (success);
     }
@@ -3852,6 +4743,38 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10)
     {
@@ -3902,17 +4825,17 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
         return (success);
     }
@@ -3982,6 +4905,38 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10)
     {
@@ -4029,17 +4984,17 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
 
 
         return (success);
@@ -4111,6 +5066,39 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11)
     {
@@ -4163,18 +5151,18 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
         return (success);
     }
@@ -4241,6 +5229,39 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+
+        funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11)
     {
@@ -4289,18 +5310,18 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
         return (success);
     }
@@ -4373,6 +5394,40 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11)
     {
@@ -4426,18 +5481,18 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
         return (success);
     }
@@ -4510,6 +5565,40 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11)
     {
@@ -4560,18 +5649,18 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
 
 
         return (success);
@@ -4646,6 +5735,41 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+        using T12 = typename std::tuple_element<11, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+        T12 p12 = TinScript::ConvertStackArgForDispatch<T12>(args[11]);
+
+        R r = funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11, void* _p12)
     {
@@ -4701,19 +5825,19 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
         return (success);
     }
@@ -4783,6 +5907,41 @@ public:
         Dispatch(&p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void*, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+        using T12 = typename std::tuple_element<11, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+        T12 p12 = TinScript::ConvertStackArgForDispatch<T12>(args[11]);
+
+        funcptr(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11, void* _p12)
     {
@@ -4834,19 +5993,19 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
         return (success);
     }
@@ -4922,6 +6081,42 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+        using T12 = typename std::tuple_element<11, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+        T12 p12 = TinScript::ConvertStackArgForDispatch<T12>(args[11]);
+
+        C* object = (C*)(objaddr);
+        R r = (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), TinScript::convert_to_void_ptr<R>::Convert(r));
+        return (true);
+    }
+
     // -- dispatch method
     R Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11, void* _p12)
     {
@@ -4978,19 +6173,19 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::GetRegisteredType(TinScript::GetTypeID<R>()), 1, TinScript::GetTypeID<R>()) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
         return (success);
     }
@@ -5066,6 +6261,42 @@ public:
         Dispatch(objaddr, &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12);
     }
 
+    // -- virtual DispatchFromStack wrapper
+    virtual bool HasStackDispatch() const { return (true); }
+    virtual bool DispatchFromStack(void* objaddr, TinScript::tDispatchArg* args, TinScript::CExecStack& execstack)
+    {
+        using T1 = typename std::tuple_element<0, argument_types>::type;
+        using T2 = typename std::tuple_element<1, argument_types>::type;
+        using T3 = typename std::tuple_element<2, argument_types>::type;
+        using T4 = typename std::tuple_element<3, argument_types>::type;
+        using T5 = typename std::tuple_element<4, argument_types>::type;
+        using T6 = typename std::tuple_element<5, argument_types>::type;
+        using T7 = typename std::tuple_element<6, argument_types>::type;
+        using T8 = typename std::tuple_element<7, argument_types>::type;
+        using T9 = typename std::tuple_element<8, argument_types>::type;
+        using T10 = typename std::tuple_element<9, argument_types>::type;
+        using T11 = typename std::tuple_element<10, argument_types>::type;
+        using T12 = typename std::tuple_element<11, argument_types>::type;
+
+        T1 p1 = TinScript::ConvertStackArgForDispatch<T1>(args[0]);
+        T2 p2 = TinScript::ConvertStackArgForDispatch<T2>(args[1]);
+        T3 p3 = TinScript::ConvertStackArgForDispatch<T3>(args[2]);
+        T4 p4 = TinScript::ConvertStackArgForDispatch<T4>(args[3]);
+        T5 p5 = TinScript::ConvertStackArgForDispatch<T5>(args[4]);
+        T6 p6 = TinScript::ConvertStackArgForDispatch<T6>(args[5]);
+        T7 p7 = TinScript::ConvertStackArgForDispatch<T7>(args[6]);
+        T8 p8 = TinScript::ConvertStackArgForDispatch<T8>(args[7]);
+        T9 p9 = TinScript::ConvertStackArgForDispatch<T9>(args[8]);
+        T10 p10 = TinScript::ConvertStackArgForDispatch<T10>(args[9]);
+        T11 p11 = TinScript::ConvertStackArgForDispatch<T11>(args[10]);
+        T12 p12 = TinScript::ConvertStackArgForDispatch<T12>(args[11]);
+
+        C* object = (C*)(objaddr);
+        (object->*methodptr)(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
+        TinScript::PushDispatchReturnValue(execstack, TinScript::TYPE_void, NULL);
+        return (true);
+    }
+
     // -- dispatch method
     void Dispatch(void* objaddr, void* _p1, void* _p2, void* _p3, void* _p4, void* _p5, void* _p6, void* _p7, void* _p8, void* _p9, void* _p10, void* _p11, void* _p12)
     {
@@ -5119,19 +6350,19 @@ public:
 
         TinScript::CFunctionContext* fc = CreateContext();
         bool success = true;
-        success = fc->AddParameter("__return", TinScript::Hash("__return"), TinScript::TYPE_void, 1, 0) && success;
-        success = fc->AddParameter("_p1", TinScript::Hash("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
-        success = fc->AddParameter("_p2", TinScript::Hash("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
-        success = fc->AddParameter("_p3", TinScript::Hash("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
-        success = fc->AddParameter("_p4", TinScript::Hash("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
-        success = fc->AddParameter("_p5", TinScript::Hash("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
-        success = fc->AddParameter("_p6", TinScript::Hash("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
-        success = fc->AddParameter("_p7", TinScript::Hash("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
-        success = fc->AddParameter("_p8", TinScript::Hash("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
-        success = fc->AddParameter("_p9", TinScript::Hash("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
-        success = fc->AddParameter("_p10", TinScript::Hash("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
-        success = fc->AddParameter("_p11", TinScript::Hash("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
-        success = fc->AddParameter("_p12", TinScript::Hash("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
+        success = fc->AddParameter("__return", HashLiteral_("__return"), TinScript::TYPE_void, 1, 0) && success;
+        success = fc->AddParameter("_p1", HashLiteral_("_p1"), TinScript::GetRegisteredType(TinScript::GetTypeID<T1>()), 1, TinScript::GetTypeID<T1>()) && success;
+        success = fc->AddParameter("_p2", HashLiteral_("_p2"), TinScript::GetRegisteredType(TinScript::GetTypeID<T2>()), 1, TinScript::GetTypeID<T2>()) && success;
+        success = fc->AddParameter("_p3", HashLiteral_("_p3"), TinScript::GetRegisteredType(TinScript::GetTypeID<T3>()), 1, TinScript::GetTypeID<T3>()) && success;
+        success = fc->AddParameter("_p4", HashLiteral_("_p4"), TinScript::GetRegisteredType(TinScript::GetTypeID<T4>()), 1, TinScript::GetTypeID<T4>()) && success;
+        success = fc->AddParameter("_p5", HashLiteral_("_p5"), TinScript::GetRegisteredType(TinScript::GetTypeID<T5>()), 1, TinScript::GetTypeID<T5>()) && success;
+        success = fc->AddParameter("_p6", HashLiteral_("_p6"), TinScript::GetRegisteredType(TinScript::GetTypeID<T6>()), 1, TinScript::GetTypeID<T6>()) && success;
+        success = fc->AddParameter("_p7", HashLiteral_("_p7"), TinScript::GetRegisteredType(TinScript::GetTypeID<T7>()), 1, TinScript::GetTypeID<T7>()) && success;
+        success = fc->AddParameter("_p8", HashLiteral_("_p8"), TinScript::GetRegisteredType(TinScript::GetTypeID<T8>()), 1, TinScript::GetTypeID<T8>()) && success;
+        success = fc->AddParameter("_p9", HashLiteral_("_p9"), TinScript::GetRegisteredType(TinScript::GetTypeID<T9>()), 1, TinScript::GetTypeID<T9>()) && success;
+        success = fc->AddParameter("_p10", HashLiteral_("_p10"), TinScript::GetRegisteredType(TinScript::GetTypeID<T10>()), 1, TinScript::GetTypeID<T10>()) && success;
+        success = fc->AddParameter("_p11", HashLiteral_("_p11"), TinScript::GetRegisteredType(TinScript::GetTypeID<T11>()), 1, TinScript::GetTypeID<T11>()) && success;
+        success = fc->AddParameter("_p12", HashLiteral_("_p12"), TinScript::GetRegisteredType(TinScript::GetTypeID<T12>()), 1, TinScript::GetTypeID<T12>()) && success;
 
 
         return (success);
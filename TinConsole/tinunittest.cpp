@@ -0,0 +1,108 @@
+// ------------------------------------------------------------------------------------------------
+//  The MIT License
+//
+//  Copyright (c) 2013 Tim Andersen
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+//  and associated documentation files (the "Software"), to deal in the Software without
+//  restriction, including without limitation the rights to use, copy, modify, merge, publish,
+//  distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all copies or
+//  substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//  BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//  DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ------------------------------------------------------------------------------------------------
+
+// ------------------------------------------------------------------------------------------------
+// tinunittest.cpp - runs the unit tests headless (no command shell, or debugger), and returns
+// non-zero if any test fails - used by the CMake build, on platforms without the console shell
+// ------------------------------------------------------------------------------------------------
+
+#include "stdlib.h"
+#include "stdio.h"
+#include "stdarg.h"
+
+#include "TinScript.h"
+#include "TinRegBinding.h"
+
+// -- implemented in unittest.cpp
+void BeginUnitTests(const char* specific_test, bool8 results_only);
+
+// ------------------------------------------------------------------------------------------------
+// every failed unit test raises an assert - the count is the result
+static int32 gAssertCount = 0;
+
+// ------------------------------------------------------------------------------------------------
+// UnitTestPrintf():  print handler - everything goes to stdout
+// ------------------------------------------------------------------------------------------------
+int32 UnitTestPrintf(int32 severity, const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int32 result = vprintf(fmt, args);
+    va_end(args);
+    fflush(stdout);
+
+    return (result);
+}
+
+// ------------------------------------------------------------------------------------------------
+// UnitTestAssertHandler():  assert handler - prints the assert and callstack, and continues
+// ------------------------------------------------------------------------------------------------
+bool8 UnitTestAssertHandler(TinScript::CScriptContext* script_context, const char* condition,
+                            const char* file, int32 linenumber, const char* fmt, ...)
+{
+    ++gAssertCount;
+
+    printf("*************************************************************\n");
+    if (linenumber >= 0)
+        printf("Assert(%s)\nfile: %s, line %d:\n", condition, file, linenumber + 1);
+    else
+        printf("Exec Assert(%s):\n", condition);
+
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+
+    script_context->DumpExecutionCallStack(script_context->GetAssertStackDepth());
+    printf("*************************************************************\n");
+    fflush(stdout);
+
+    // -- never break
+    return (true);
+}
+
+// ------------------------------------------------------------------------------------------------
+// main():  usage:  tinunittest [partial test name]
+// ------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    // -- required to ensure registered functions from unittest.cpp are linked.
+    REGISTER_FILE(unittest_cpp);
+    REGISTER_FILE(mathutil_cpp);
+    REGISTER_FILE(socket_cpp);
+    REGISTER_FILE(tinhashtable_cpp);
+
+    TinScript::CreateContext(UnitTestPrintf, UnitTestAssertHandler, true);
+
+    // -- unittest.ts is found relative to the working directory, as it is for the console
+    BeginUnitTests(argc > 1 ? argv[1] : "", false);
+
+    TinScript::DestroyContext();
+
+    if (gAssertCount > 0)
+        printf("\n%d assert(s) raised - unit tests failed\n", gAssertCount);
+
+    return (gAssertCount > 0 ? 1 : 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+// eof
+// ------------------------------------------------------------------------------------------------
@@ -432,6 +432,7 @@ class CConsoleOutput : public QListWidget
         void HandlePacketPrintMsg(int32* dataPtr);
         void HandlePacketFunctionAssist(int32* dataPtr);
         void HandlePacketObjectCreated(int32* dataPtr);
+        void HandlePacketDebuggerSync(int32* dataPtr, int32 data_size);
 
         // -- helper function to see if a PrintMsg packet has a severity > 0 (warning, error...)
         // -- this method must be updated if the format for a PrintMsg packet changes
@@ -229,10 +229,10 @@ void CDebugObjectInspectWin::SetEntryValue(const TinScript::CDebuggerWatchVarEnt
 // ====================================================================================================================
 void CDebugObjectInspectWin::OnButtonRefreshPressed()
 {
-    // -- send the request to re-populate the inspector for the window's object
+    // -- request the members changed since the window was populated (or last refreshed)
     if (SocketManager::IsConnected())
     {
-        SocketManager::SendCommandf("DebuggerInspectObject(%d);", mObjectID);
+        SocketManager::SendCommandf("DebuggerRefreshObject(%d);", mObjectID);
     }
 }
 
@@ -71,7 +71,7 @@ char* ReadFileAllocBuf(const char* filename) {
     // $$$TZA for some reason, my text file is taking more space on disk than what is actually read...
 	//if (bytesread != filesize) {
 	if (bytesread <= 0) {
-		delete[] filebuf;
+		TinFreeArray(filebuf);
 		fclose(filehandle);
 		return NULL;
 	}
@@ -321,7 +321,7 @@ bool CDebugSourceWin::OpenFullPathFile(const char* full_path, bool reload)
         }
 
         // -- delete the buffer
-        delete [] filebuf;
+        TinFreeArray(filebuf);
     }
 
     // -- unable to open file
@@ -2270,6 +2270,11 @@ void CConsoleOutput::ProcessDataPackets()
                 HandlePacketObjectCreated(dataPtr);
                 break;
 
+            case k_DebuggerObjectBatchPacketID:
+            case k_DebuggerMemberBlockPacketID:
+                HandlePacketDebuggerSync(dataPtr, packet->mHeader.mSize);
+                break;
+
             default:
                 break;
         }
@@ -2433,6 +2438,33 @@ void CConsoleOutput::HandlePacketCallstack(int32* dataPtr)
     }
 }
 
+// ====================================================================================================================
+// DispatchWatchVarEntry():  Updates the watch, autos, and object inspector windows with a received watch var entry.
+// ====================================================================================================================
+static void DispatchWatchVarEntry(TinScript::CDebuggerWatchVarEntry& watch_var_entry)
+{
+    // -- this packet is received both for updating autos and watch entries...
+    // -- if there's a watch requestID, then it's a response to a user entered watch expression
+    bool is_response = watch_var_entry.mWatchRequestID > 0;
+
+    if (!is_response)
+    {
+        // -- if it's not a response, we can "update only" in the watch window, but we add to the autos window
+        CConsoleWindow::GetInstance()->GetDebugWatchesWin()->NotifyWatchVarEntry(&watch_var_entry, true);
+        CConsoleWindow::GetInstance()->GetDebugAutosWin()->NotifyWatchVarEntry(&watch_var_entry, false);
+    }
+    else
+    {
+        // -- otherwise, as a response, we update only in the autos, but we want to ensure the
+        // entry exists in the watches window
+        CConsoleWindow::GetInstance()->GetDebugWatchesWin()->NotifyVarWatchResponse(&watch_var_entry);
+        CConsoleWindow::GetInstance()->GetDebugAutosWin()->NotifyWatchVarEntry(&watch_var_entry, true);
+    }
+
+    // -- also, this entry may update the value in an object inspector window
+    CConsoleWindow::GetInstance()->NotifyWatchVarEntry(&watch_var_entry);
+}
+
 // ====================================================================================================================
 // HandlePacketWatchVarEntry():  A handler for packet type "watch var entry"
 // ====================================================================================================================
@@ -2495,26 +2527,8 @@ void CConsoleOutput::HandlePacketWatchVarEntry(int32* dataPtr)
     // stack var, "which" (stack level) var this is
     watch_var_entry.mSourceVarID = *dataPtr++;
 
-    // -- this packet is received both for updating autos and watch entries...
-    // -- if there's a watch requestID, then it's a response to a user entered watch expression
-    bool is_response = watch_var_entry.mWatchRequestID > 0;
-
-    if (!is_response)
-    {
-        // -- if it's not a response, we can "update only" in the watch window, but we add to the autos window
-        CConsoleWindow::GetInstance()->GetDebugWatchesWin()->NotifyWatchVarEntry(&watch_var_entry, true);
-        CConsoleWindow::GetInstance()->GetDebugAutosWin()->NotifyWatchVarEntry(&watch_var_entry, false);
-    }
-    else
-    {
-        // -- otherwise, as a response, we update only in the autos, but we want to ensure the
-        // entry exists in the watches window
-        CConsoleWindow::GetInstance()->GetDebugWatchesWin()->NotifyVarWatchResponse(&watch_var_entry);
-        CConsoleWindow::GetInstance()->GetDebugAutosWin()->NotifyWatchVarEntry(&watch_var_entry, true);
-    }
-
-    // -- also, this entry may update the value in an object inspector window
-    CConsoleWindow::GetInstance()->NotifyWatchVarEntry(&watch_var_entry);
+    // -- update the windows
+    DispatchWatchVarEntry(watch_var_entry);
 }
 
 // ====================================================================================================================
@@ -2765,6 +2779,59 @@ void CConsoleOutput::HandlePacketObjectCreated(int32* dataPtr)
     );
 }
 
+// ====================================================================================================================
+// class CConsoleSyncListener:  Forwards each record of a batch, or row of a member block, to the debugger windows.
+// ====================================================================================================================
+class CConsoleSyncListener : public TinScript::CDebuggerSyncListener
+{
+    public:
+        virtual void OnCreateObject(uint32 object_id, const char* object_name, const char* derivation,
+                                    int32 stack_size, uint32* file_array, int32* line_array) override
+        {
+            CConsoleWindow::GetInstance()->GetDebugObjectBrowserWin()->NotifyCreateObject(
+                object_id, object_name, derivation, stack_size, file_array, line_array
+            );
+        }
+
+        virtual void OnDestroyObject(uint32 object_id) override
+        {
+            CConsoleWindow::GetInstance()->GetDebugObjectBrowserWin()->NotifyDestroyObject(object_id);
+            CConsoleWindow::GetInstance()->NotifyDestroyObject(object_id);
+        }
+
+        virtual void OnSetAddObject(uint32 set_id, uint32 object_id, bool8 owned) override
+        {
+            CConsoleWindow::GetInstance()->GetDebugObjectBrowserWin()->NotifySetAddObject(set_id, object_id, owned);
+        }
+
+        virtual void OnSetRemoveObject(uint32 set_id, uint32 object_id) override
+        {
+            CConsoleWindow::GetInstance()->GetDebugObjectBrowserWin()->NotifySetRemoveObject(set_id, object_id);
+        }
+
+        virtual void OnListObjectsComplete() override
+        {
+            CConsoleWindow::GetInstance()->GetDebugFunctionAssistWin()->NotifyListObjectsComplete();
+        }
+
+        virtual void OnMemberEntry(TinScript::CDebuggerWatchVarEntry& watch_var_entry) override
+        {
+            DispatchWatchVarEntry(watch_var_entry);
+        }
+};
+
+// ====================================================================================================================
+// HandlePacketDebuggerSync():  A handler for the packet types "object batch" and "member block"
+// ====================================================================================================================
+void CConsoleOutput::HandlePacketDebuggerSync(int32* dataPtr, int32 data_size)
+{
+    CConsoleSyncListener listener;
+    if (!TinScript::CDebuggerSync::DecodePacket(dataPtr, data_size, &listener))
+    {
+        ConsolePrint(1, "Error - malformed debugger sync packet: %d\n", *dataPtr);
+    }
+}
+
 // ====================================================================================================================
 // PushAssertDialog():  Handler for a ScriptAssert_(), returns ignore/trace/break input
 // ====================================================================================================================